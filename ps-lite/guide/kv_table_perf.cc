@@ -0,0 +1,152 @@
+/**
+ * @file   kv_table_perf.cc
+ * @brief  Compares the push/pull throughput and the memory usage of the hash
+ * tables a server can store its KV pairs in.
+ *
+ * It runs the same loop as KVStoreSparseST on a single machine without
+ * starting the system. Run it once per table, so the reported RSS is not
+ * polluted by the other one:
+ *
+ *   ./kv_table_perf -table hash
+ *   ./kv_table_perf -table flat
+ *
+ * Requests are sorted and deduplicated key lists drawn uniformly or, with
+ * `-zipf s`, from a Zipf distribution with exponent s. Each request is
+ * processed both without and with prefetching the slots ahead (see \ref
+ * KVBatch), and the gain is reported.
+ */
+#include <random>
+#include <unordered_map>
+#include "base/common.h"
+#include "kv/kv_batch.h"
+
+DEFINE_string(table, "flat", "hash (std::unordered_map) or flat (ps::FlatHashMap)");
+DEFINE_int32(num_keys, 10000000, "number of unique keys");
+DEFINE_int32(batch, 100000, "number of keys drawn for a push or pull request");
+DEFINE_int32(repeat, 100, "number of push and pull requests after the keys are inserted");
+DEFINE_double(zipf, 0, "the exponent of the zipf distribution of the keys, 0 for uniform");
+DEFINE_int32(prefetch, 16, "number of keys prefetched ahead");
+
+using namespace ps;
+
+/// the same layout as FTRLEntry in the linear app
+struct Entry {
+  float w = 0;
+  float sqc_grad = 0;
+  float z = 0;
+  inline void Load(dmlc::Stream* fi) { CHECK_EQ(fi->Read(this, sizeof(*this)), sizeof(*this)); }
+  inline void Save(dmlc::Stream* fo) const { fo->Write(this, sizeof(*this)); }
+  inline bool Empty() const { return w == 0; }
+};
+
+struct Handle {
+  inline void Push(Key key, Blob<const float> g, Entry& e) {
+    float cg = e.sqc_grad;
+    e.sqc_grad = sqrt(cg * cg + g.data[0] * g.data[0]);
+    e.z -= g.data[0] - (e.sqc_grad - cg) / .1 * e.w;
+    e.w = e.z > 1 || e.z < -1 ? e.z / (1 + e.sqc_grad) : 0;
+  }
+  inline void Pull(Key key, const Entry& e, Blob<float>& v) { v.data[0] = e.w; }
+};
+
+/// draws the ranks of keys
+class KeyGen {
+ public:
+  KeyGen(size_t n, double s) : gen_(0), uni_(0, 1), dis_(0, n - 1) {
+    if (s <= 0) return;
+    cdf_.resize(n);
+    double sum = 0;
+    for (size_t i = 0; i < n; ++i) cdf_[i] = sum += pow(i + 1, -s);
+    for (auto& c : cdf_) c /= sum;
+  }
+  size_t operator()() {
+    if (cdf_.empty()) return dis_(gen_);
+    size_t r = std::lower_bound(cdf_.begin(), cdf_.end(), uni_(gen_)) - cdf_.begin();
+    return std::min(r, cdf_.size() - 1);
+  }
+ private:
+  std::mt19937_64 gen_;
+  std::uniform_real_distribution<double> uni_;
+  std::uniform_int_distribution<size_t> dis_;
+  std::vector<double> cdf_;
+};
+
+template <typename Map>
+void Run() {
+  std::mt19937_64 gen(0);
+  std::vector<Key> uniq(FLAGS_num_keys);
+  for (auto& k : uniq) k = gen();
+  std::vector<Key> key(FLAGS_batch);
+  std::vector<float> val(FLAGS_batch, .1);
+  KeyGen rank(uniq.size(), FLAGS_zipf);
+
+  double rss = ResUsage::myPhyMem();
+  Map data;
+  Handle handle;
+  KVBatch<Key, Entry, float, Handle, Map> batch;
+  for (size_t j = 0; j < key.size(); ++j) {
+    batch.push.push_back(Blob<const float>(&val[j], 1));
+    batch.pull.push_back(Blob<float>(&val[j], 1));
+  }
+
+  // insert all keys with push requests
+  auto tv = hwtic();
+  for (size_t i = 0; i < uniq.size(); i += key.size()) {
+    size_t n = std::min(key.size(), uniq.size() - i);
+    std::sort(uniq.begin() + i, uniq.begin() + i + n);
+    batch.Push(handle, data, n, &uniq[i], batch.push.data());
+  }
+  double t = hwtoc(tv);
+  LOG(INFO) << FLAGS_table << ": inserted " << data.size() << " keys, "
+            << data.size() / t / 1e6 << " M keys/sec, "
+            << ResUsage::myPhyMem() - rss << " MB";
+
+  // push and pull requests on the existing keys, [0] without prefetching and
+  // [1] with prefetching. each uses its own keys, otherwise the second one
+  // would find them in cache
+  double push_t[2] = {0}, pull_t[2] = {0}, sum = 0, nk = 0;
+  for (int r = 0; r < FLAGS_repeat; ++r) {
+    for (int p = 0; p < 2; ++p) {
+      key.resize(FLAGS_batch);
+      for (auto& k : key) k = uniq[rank()];
+      std::sort(key.begin(), key.end());
+      key.erase(std::unique(key.begin(), key.end()), key.end());
+      size_t n = key.size();
+      nk += n / 2.0;
+      batch.prefetch = p ? FLAGS_prefetch : 0;
+
+      tv = hwtic();
+      batch.Push(handle, data, n, key.data(), batch.push.data());
+      push_t[p] += hwtoc(tv) / n;
+
+      tv = hwtic();
+      batch.Pull(handle, data, n, key.data(), batch.pull.data());
+      pull_t[p] += hwtoc(tv) / n;
+      for (size_t j = 0; j < n; ++j) sum += val[j];
+      for (auto& v : val) v = .1;
+    }
+  }
+  for (int p = 0; p < 2; ++p) {
+    LOG(INFO) << FLAGS_table << (p ? " with" : " without") << " prefetching: "
+              << "push " << FLAGS_repeat / push_t[p] / 1e6 << " M keys/sec, "
+              << "pull " << FLAGS_repeat / pull_t[p] / 1e6 << " M keys/sec";
+  }
+  LOG(INFO) << FLAGS_table << ": prefetching gain, push "
+            << push_t[0] / push_t[1] << "x, pull " << pull_t[0] / pull_t[1]
+            << "x, " << nk / FLAGS_repeat << " unique keys per request, "
+            << "RSS " << ResUsage::myPhyMem() << " MB (checksum " << sum << ")";
+}
+
+int main(int argc, char *argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+  FLAGS_logtostderr = 1;
+  if (FLAGS_table == "hash") {
+    Run<std::unordered_map<Key, Entry>>();
+  } else if (FLAGS_table == "flat") {
+    Run<FlatHashMap<Key, Entry>>();
+  } else {
+    LOG(FATAL) << "unknown table " << FLAGS_table;
+  }
+  return 0;
+}
@@ -10,3 +10,7 @@ endif
 
 guide/%: guide/%.cc $(PS_LIB) $(PS_MAIN)
 	$(CXX) $(CFLAGS) -fopenmp $^ $(LDFLAGS) -o $@
+
+# a standalone benchmark, which does not start the system
+guide/kv_table_perf: guide/kv_table_perf.cc
+	$(CXX) $(CFLAGS) $^ $(addprefix $(DEPS_PATH)/lib/, libglog.a libgflags.a) -lpthread -o $@
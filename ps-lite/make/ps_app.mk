@@ -36,4 +36,30 @@ build/%.o: %.cc | build
 %.pb.cc %.pb.h : %.proto
 	${DEPS_PATH}/bin/protoc --cpp_out=. --proto_path=. $<
 
--include build/*.d
+# unit tests in test/, which do not start the system. run by `make test`
+
+ifndef GTEST_PATH
+GTEST_PATH = $(DEPS_PATH)
+endif
+
+UNITTEST = build/unittest
+UNITTEST_OBJ = $(patsubst test/%.cc, build/test/%.o, $(wildcard test/*.cc)) \
+	build/test/unittest_main.o
+
+build/test/%.o: test/%.cc
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) -I$(GTEST_PATH)/include -MM -MT $@ $< >build/test/$*.d
+	$(CXX) $(CFLAGS) -I$(GTEST_PATH)/include -c $< -o $@
+
+build/test/unittest_main.o: $(PS_PATH)/test/unittest/unittest_main.cc
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) -I$(GTEST_PATH)/include -c $< -o $@
+
+$(UNITTEST): $(UNITTEST_OBJ) $(DMLC_SLIB)
+	$(CXX) $(CFLAGS) $(filter %.o %.a, $^) -L$(GTEST_PATH)/lib -lgtest $(LDFLAGS) -o $@
+
+.PHONY: test
+test: $(UNITTEST)
+	./$(UNITTEST)
+
+-include build/*.d $(wildcard build/test/*.d)
@@ -1,7 +1,7 @@
 #pragma once
 #include "base/sketch.h"
 #include <math.h>
-#include "base/shared_array_inl.h"
+#include "ps/shared_array.h"
 namespace ps {
 
 template <typename K, typename V>
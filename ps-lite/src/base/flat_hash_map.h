@@ -0,0 +1,245 @@
+/**
+ * @file   flat_hash_map.h
+ * @brief  An open-addressing hash map storing keys and values inline
+ */
+#pragma once
+#include <vector>
+#include <limits>
+#include <utility>
+#include "ps/base.h"
+#include "base/numa.h"
+namespace ps {
+
+/**
+ * \brief A hash map using open addressing with linear probing
+ *
+ * Keys and values are stored side by side in one slot array, so a lookup
+ * touches one or two adjacent cache lines instead of chasing a node pointer as
+ * std::unordered_map does. It implements the subset of the std::unordered_map
+ * interface used by the KV stores, so it can be used as a drop-in replacement
+ * there.
+ *
+ * The value type must be default constructible and movable. An empty slot
+ * holds a default constructed value. Pointers and iterators are invalidated by
+ * \ref erase and by any insertion which triggers a rehash, which never happens
+ * within `n` insertions after \ref reserve `(size() + n)`.
+ *
+ * The slot array is allocated by \ref NumaAllocator, on the NUMA node of the
+ * thread which grows it.
+ *
+ * @tparam K an unsigned integer key type
+ * @tparam V the value type
+ */
+template <typename K, typename V>
+class FlatHashMap {
+ public:
+  /// \brief a key-value pair, named as std::pair for compatibility
+  struct Slot {
+    K first;
+    V second;
+  };
+
+  template <typename M, typename S>
+  class Iter {
+   public:
+    Iter(M* map, size_t pos) : map_(map), pos_(pos) { Skip(); }
+    S& operator*() const { return map_->slot(pos_); }
+    S* operator->() const { return &map_->slot(pos_); }
+    Iter& operator++() { ++ pos_; Skip(); return *this; }
+    bool operator==(const Iter& rhs) const { return pos_ == rhs.pos_; }
+    bool operator!=(const Iter& rhs) const { return pos_ != rhs.pos_; }
+    /// \brief the slot index, `Iter(map, pos())` points to the same element
+    size_t pos() const { return pos_; }
+   private:
+    friend class FlatHashMap;
+    void Skip() { while (pos_ < map_->end_pos() && !map_->occupied(pos_)) ++ pos_; }
+    M* map_;
+    size_t pos_;
+  };
+  typedef Iter<FlatHashMap, Slot> iterator;
+  typedef Iter<const FlatHashMap, const Slot> const_iterator;
+
+  FlatHashMap() { }
+  /// \brief takes the elements of \a m, which is left empty as by \ref clear
+  FlatHashMap(FlatHashMap&& m) { *this = std::move(m); }
+  FlatHashMap& operator=(FlatHashMap&& m) {
+    if (this == &m) return *this;
+    slots_ = std::move(m.slots_);
+    max_slot_ = std::move(m.max_slot_);
+    has_max_ = m.has_max_;
+    size_ = m.size_; mask_ = m.mask_; shift_ = m.shift_;
+    max_load_ = m.max_load_;
+    m.clear();
+    return *this;
+  }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, end_pos()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, end_pos()); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /// \brief the number of slots
+  size_t capacity() const { return slots_.size(); }
+
+  /// \brief the memory in bytes used by the slot array
+  size_t bytes() const { return (slots_.size() + 1) * sizeof(Slot); }
+
+  /// \brief the maximal ratio between size() and capacity(), 0.7 in default
+  void max_load_factor(float f) {
+    CHECK_GT(f, 0); CHECK_LT(f, 1); max_load_ = f;
+  }
+
+  /// \brief guarantees \a n elements can be stored without rehashing
+  void reserve(size_t n) {
+    size_t cap = std::max(slots_.size(), (size_t)16);
+    while (n > cap * max_load_) cap *= 2;
+    if (cap != slots_.size()) Rehash(cap);
+  }
+
+  /// \brief reduces the capacity to the smallest one which fits size()
+  void shrink_to_fit() {
+    size_t cap = 16;
+    while (size_ > cap * max_load_) cap *= 2;
+    if (cap < slots_.size()) Rehash(cap);
+  }
+
+  void clear() {
+    Slots().swap(slots_);
+    max_slot_ = Slot();
+    has_max_ = false;
+    size_ = 0; mask_ = 0; shift_ = 64;
+  }
+
+  /// \brief returns the value of key \a k, inserting a default one if not exist
+  V& operator[](K k) {
+    if (k == kEmpty) {
+      if (!has_max_) { has_max_ = true; max_slot_.first = k; ++ size_; }
+      return max_slot_.second;
+    }
+    if ((size_ + 1) > slots_.size() * max_load_) {
+      Rehash(std::max(slots_.size() * 2, (size_t)16));
+    }
+    size_t i = Home(k);
+    while (true) {
+      Slot& s = slots_[i];
+      if (s.first == k) return s.second;
+      if (s.first == kEmpty) { s.first = k; ++ size_; return s.second; }
+      i = (i + 1) & mask_;
+    }
+  }
+
+  iterator find(K k) { return iterator(this, Find(k)); }
+  const_iterator find(K k) const { return const_iterator(this, Find(k)); }
+  size_t count(K k) const { return Find(k) != end_pos(); }
+
+  /// \brief removes key \a k, returns the number of elements removed
+  size_t erase(K k) {
+    size_t pos = Find(k);
+    if (pos == end_pos()) return 0;
+    Erase(pos);
+    return 1;
+  }
+
+  /**
+   * \brief removes the element at \a it, returns the iterator to the next one
+   *
+   * The element shifted into the erased slot, if any, is visited next, so
+   * `for (it = begin(); it != end(); ) it = pred(*it) ? erase(it) : ++it;`
+   * visits every element at least once.
+   */
+  iterator erase(iterator it) {
+    Erase(it.pos_);
+    return iterator(this, it.pos_);
+  }
+
+  /// \brief issues a prefetch for the slot where key \a k is probed first
+  PS_ALWAYS_INLINE void prefetch(K k) const {
+    if (slots_.size()) __builtin_prefetch(&slots_[Home(k)]);
+  }
+
+ private:
+  static const K kEmpty = std::numeric_limits<K>::max();
+
+  size_t end_pos() const { return slots_.size() + 1; }
+  bool occupied(size_t pos) const {
+    return pos == slots_.size() ? has_max_ : slots_[pos].first != kEmpty;
+  }
+  Slot& slot(size_t pos) { return pos == slots_.size() ? max_slot_ : slots_[pos]; }
+  const Slot& slot(size_t pos) const {
+    return pos == slots_.size() ? max_slot_ : slots_[pos];
+  }
+
+  /// fibonacci hashing, the high bits of the product are well mixed
+  size_t Home(K k) const {
+    return (size_t)(((uint64)k * 0x9E3779B97F4A7C15ULL) >> shift_) & mask_;
+  }
+
+  size_t Find(K k) const {
+    if (k == kEmpty) return has_max_ ? slots_.size() : end_pos();
+    if (slots_.empty()) return end_pos();
+    size_t i = Home(k);
+    while (true) {
+      const Slot& s = slots_[i];
+      if (s.first == k) return i;
+      if (s.first == kEmpty) return end_pos();
+      i = (i + 1) & mask_;
+    }
+  }
+
+  /// backward shift deletion, so no tombstones are needed
+  void Erase(size_t pos) {
+    -- size_;
+    if (pos == slots_.size()) {
+      has_max_ = false; max_slot_ = Slot();
+      return;
+    }
+    size_t i = pos, j = pos;
+    while (true) {
+      j = (j + 1) & mask_;
+      if (slots_[j].first == kEmpty) break;
+      size_t h = Home(slots_[j].first);
+      // skip if h lies cyclically in (i, j]
+      if (i <= j ? (i < h && h <= j) : (i < h || h <= j)) continue;
+      slots_[i].first = slots_[j].first;
+      slots_[i].second = std::move(slots_[j].second);
+      i = j;
+    }
+    slots_[i].first = kEmpty;
+    slots_[i].second = V();
+  }
+
+  void Rehash(size_t cap) {
+    CHECK_EQ(cap & (cap - 1), (size_t)0) << "capacity must be a power of 2";
+    Slots old(cap);
+    old.swap(slots_);
+    for (auto& s : slots_) s.first = kEmpty;
+    mask_ = cap - 1;
+    shift_ = 64;
+    while (cap > 1) { cap >>= 1; -- shift_; }
+    for (auto& s : old) {
+      if (s.first == kEmpty) continue;
+      size_t i = Home(s.first);
+      while (slots_[i].first != kEmpty) i = (i + 1) & mask_;
+      slots_[i].first = s.first;
+      slots_[i].second = std::move(s.second);
+    }
+  }
+
+  typedef std::vector<Slot, NumaAllocator<Slot>> Slots;
+  Slots slots_;
+  /// the key kEmpty is stored separately
+  Slot max_slot_{};
+  bool has_max_ = false;
+  size_t size_ = 0;
+  size_t mask_ = 0;
+  int shift_ = 64;
+  float max_load_ = .7;
+};
+
+template <typename K, typename V>
+const K FlatHashMap<K, V>::kEmpty;
+
+}  // namespace ps
@@ -0,0 +1,267 @@
+/**
+ * @file   half.h
+ * @brief  Converts floats from and into 16-bit formats with stochastic rounding
+ */
+#pragma once
+#include <string.h>
+#include <algorithm>
+#include <thread>
+#include <functional>
+#include "ps/base.h"
+#if defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#endif
+namespace ps {
+
+/**
+ * \brief The formats a float can be stored in
+ */
+enum FloatFormat {
+  /// IEEE single precision
+  kFloat32 = 0,
+  /// IEEE half precision: 5-bit exponent, 10-bit mantissa. precise, but values
+  /// larger than 65504 are saturated
+  kFloat16 = 1,
+  /// bfloat16: the higher 16 bits of a float. the same range as a float, but
+  /// only a 7-bit mantissa
+  kBFloat16 = 2
+};
+
+/// \brief the bytes of a float stored in \a fmt
+inline int FloatBytes(FloatFormat fmt) { return fmt == kFloat32 ? 4 : 2; }
+
+/// \brief converts a half into a float
+inline float HalfToFloat(uint16 h) {
+  uint32 sign = (uint32)(h & 0x8000) << 16;
+  uint32 a = h & 0x7FFF;
+  uint32 x;
+  if (a >= 0x7C00) {
+    // inf and nan, which is quieted as F16C does
+    x = 0x7F800000 | ((a & 0x3FF) << 13) | (a > 0x7C00 ? 0x400000 : 0);
+  } else if (a >= 0x400) {
+    // normal, rebias the exponent from 15 to 127
+    x = (a << 13) + 0x38000000;
+  } else {
+    // subnormal, a * 2^-24
+    float f = a * (1.0f / 16777216);
+    return sign ? -f : f;
+  }
+  x |= sign;
+  float f; memcpy(&f, &x, sizeof(f));
+  return f;
+}
+
+/// \brief converts the bits of a float into a half, rounding toward zero and
+/// saturating at 65504
+inline uint16 FloatToHalfTrunc(uint32 x) {
+  uint32 sign = (x >> 16) & 0x8000;
+  uint32 a = x & 0x7FFFFFFF;
+  if (a >= 0x7F800000) return sign | 0x7C00 | (a > 0x7F800000 ? 0x200 : 0);
+  if (a >= 0x47800000) return sign | 0x7BFF;
+  if (a >= 0x38800000) return sign | ((a - 0x38000000) >> 13);
+  if (a < 0x33800000) return sign;
+  // a half subnormal
+  uint32 e = a >> 23, m = (a & 0x7FFFFF) | 0x800000;
+  return sign | (m >> (126 - e));
+}
+
+/// \brief converts a bfloat16 into a float
+inline float BFloat16ToFloat(uint16 h) {
+  uint32 x = (uint32)h << 16;
+  float f; memcpy(&f, &x, sizeof(f));
+  return f;
+}
+
+/**
+ * \brief the random bits of stochastic rounding, a xorshift generator per lane
+ *
+ * It is cheap rather than good, the rounding only needs bits which are
+ * independent of the rounded values.
+ */
+class RoundingNoise {
+ public:
+  static const int kLanes = 8;
+
+  RoundingNoise() {
+    uint32 seed = (uint32)std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (int i = 0; i < kLanes; ++i) {
+      s_[i] = (seed + 1) * 2654435761U + i * 40503U;
+      if (s_[i] == 0) s_[i] = 1;
+    }
+  }
+
+  /// \brief the noise of one thread
+  static RoundingNoise& Get() {
+    static thread_local RoundingNoise noise;
+    return noise;
+  }
+
+  /// \brief returns the next bits of \a lane
+  uint32 Next(int lane) {
+    uint32 s = s_[lane];
+    s ^= s << 13; s ^= s >> 17; s ^= s << 5;
+    return s_[lane] = s;
+  }
+
+#ifdef __AVX2__
+  /// \brief returns the next bits of all lanes
+  __m256i Next() {
+    __m256i s = _mm256_loadu_si256((const __m256i*)s_);
+    s = _mm256_xor_si256(s, _mm256_slli_epi32(s, 13));
+    s = _mm256_xor_si256(s, _mm256_srli_epi32(s, 17));
+    s = _mm256_xor_si256(s, _mm256_slli_epi32(s, 5));
+    _mm256_storeu_si256((__m256i*)s_, s);
+    return s;
+  }
+#endif
+
+ private:
+  uint32 s_[kLanes];
+};
+
+/**
+ * \brief converts \a n values stored in \a fmt into floats
+ */
+inline void DecodeFloats(FloatFormat fmt, const void* in, int n, float* out) {
+  if (fmt == kFloat32) {
+    memcpy(out, in, n * sizeof(float));
+    return;
+  }
+  const uint16* h = (const uint16*)in;
+  int i = 0;
+  if (fmt == kFloat16) {
+#ifdef __F16C__
+    for (; i + 8 <= n; i += 8) {
+      __m128i x = _mm_loadu_si128((const __m128i*)(h+i));
+      _mm256_storeu_ps(out+i, _mm256_cvtph_ps(x));
+    }
+#endif
+    for (; i < n; ++i) out[i] = HalfToFloat(h[i]);
+  } else {
+#ifdef __AVX2__
+    for (; i + 8 <= n; i += 8) {
+      __m256i x = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(h+i)));
+      _mm256_storeu_si256((__m256i*)(out+i), _mm256_slli_epi32(x, 16));
+    }
+#endif
+    for (; i < n; ++i) out[i] = BFloat16ToFloat(h[i]);
+  }
+}
+
+/**
+ * \brief converts the bits of a float in the subnormal range of halfs into a
+ * half, rounded up with the probability given by the random bits \a r
+ *
+ * A half subnormal is a multiple of 2^-24, more bits than the 13 of a normal
+ * one are dropped, so the rounding is done on the integer mantissa.
+ */
+inline uint16 FloatToHalfSubnormal(uint32 x, uint32 r) {
+  uint32 sign = (x >> 16) & 0x8000;
+  uint32 a = x & 0x7FFFFFFF;
+  // the value is m * 2^-s in units of 2^-24. the ones below 2^-32 are rounded
+  // to zero
+  int s = 126 - (int)(a >> 23);
+  if (s > 31) return sign;
+  uint32 m = (a & 0x7FFFFF) | 0x800000;
+  return sign | (uint16)((m + (r & ((1U << s) - 1))) >> s);
+}
+
+/**
+ * \brief converts \a n floats into \a fmt with stochastic rounding
+ *
+ * A value is rounded up with the probability of its distance to the lower
+ * value in \a fmt, relative to the gap, so the rounding is unbiased and small
+ * updates are not lost, as they are with rounding to the nearest. It is done by
+ * adding random bits below the last kept bit and then truncating. Only values
+ * below 2^-32 are rounded to zero for halfs. Finite values beyond the range of
+ * \a fmt are saturated at the largest finite one, inf and nan are kept. A
+ * value which is already representable in \a fmt is kept as it is, so a
+ * decode followed by an encode is lossless.
+ */
+inline void EncodeFloats(FloatFormat fmt, const float* in, int n, void* out) {
+  if (fmt == kFloat32) {
+    memcpy(out, in, n * sizeof(float));
+    return;
+  }
+  auto& noise = RoundingNoise::Get();
+  uint16* h = (uint16*)out;
+  int i = 0;
+  // the number of discarded mantissa bits
+  const int drop = fmt == kFloat16 ? 13 : 16;
+  // the largest float below inf, and the smallest normal half
+  static const uint32 kMaxFinite = 0x7F7FFFFF, kMinHalf = 0x38800000;
+#ifdef __AVX2__
+  const __m256i mask = _mm256_set1_epi32((1 << drop) - 1);
+  const __m256i abs = _mm256_set1_epi32(0x7FFFFFFF);
+  const __m256i inf = _mm256_set1_epi32(0x7F800000);
+  const __m256i max_finite = _mm256_set1_epi32(kMaxFinite);
+  const __m256i quiet = _mm256_set1_epi32(0x400000);
+  for (; i + 8 <= n; i += 8) {
+    __m256i x = _mm256_loadu_si256((const __m256i*)(in+i));
+    __m256i a = _mm256_and_si256(x, abs);
+    __m256i sign = _mm256_andnot_si256(abs, x);
+    __m256i bits = noise.Next();
+    // no noise for inf and nan, and keep the others finite
+    __m256i finite = _mm256_cmpgt_epi32(inf, a);
+    __m256i r = _mm256_and_si256(_mm256_and_si256(bits, mask), finite);
+    __m256i lim = _mm256_or_si256(_mm256_and_si256(finite, max_finite),
+                                  _mm256_andnot_si256(finite, abs));
+    __m256i y = _mm256_min_epu32(_mm256_add_epi32(a, r), lim);
+    // quiet a nan, so its payload is not truncated into inf
+    y = _mm256_or_si256(y, _mm256_and_si256(_mm256_cmpgt_epi32(a, inf), quiet));
+    y = _mm256_or_si256(sign, y);
+    if (fmt == kFloat16) {
+#ifdef __F16C__
+      __m128i z = _mm256_cvtps_ph(_mm256_castsi256_ps(y), _MM_FROUND_TO_ZERO);
+      __m256i sub = _mm256_andnot_si256(
+          _mm256_cmpeq_epi32(a, _mm256_setzero_si256()),
+          _mm256_cmpgt_epi32(_mm256_set1_epi32(kMinHalf), a));
+      if (_mm256_movemask_epi8(sub)) {
+        // the half subnormals, see FloatToHalfSubnormal. the shifts by 32 or
+        // more give 0
+        const __m256i one = _mm256_set1_epi32(1);
+        __m256i s = _mm256_sub_epi32(_mm256_set1_epi32(126),
+                                     _mm256_srli_epi32(a, 23));
+        __m256i m = _mm256_or_si256(_mm256_and_si256(a, _mm256_set1_epi32(0x7FFFFF)),
+                                    _mm256_set1_epi32(0x800000));
+        __m256i rs = _mm256_and_si256(
+            bits, _mm256_sub_epi32(_mm256_sllv_epi32(one, s), one));
+        __m256i w = _mm256_srlv_epi32(_mm256_add_epi32(m, rs), s);
+        w = _mm256_or_si256(w, _mm256_srli_epi32(sign, 16));
+        w = _mm256_permute4x64_epi64(_mm256_packus_epi32(w, w), 0xD8);
+        sub = _mm256_permute4x64_epi64(_mm256_packs_epi32(sub, sub), 0xD8);
+        z = _mm_blendv_epi8(z, _mm256_castsi256_si128(w),
+                            _mm256_castsi256_si128(sub));
+      }
+      _mm_storeu_si128((__m128i*)(h+i), z);
+      continue;
+#else
+      break;
+#endif
+    }
+    // pack the higher halves of the 32-bit lanes, the pack works within the
+    // 128-bit lanes, so the 64-bit lanes 0 and 2 are gathered afterwards
+    y = _mm256_srli_epi32(y, 16);
+    y = _mm256_permute4x64_epi64(_mm256_packus_epi32(y, y), 0xD8);
+    _mm_storeu_si128((__m128i*)(h+i), _mm256_castsi256_si128(y));
+  }
+#endif
+  for (; i < n; ++i) {
+    int lane = i % RoundingNoise::kLanes;
+    uint32 x; memcpy(&x, in+i, sizeof(x));
+    uint32 a = x & 0x7FFFFFFF;
+    if (a >= 0x7F800000) {
+      // quiet a nan, so its payload is not truncated into inf
+      if (a > 0x7F800000) x |= 0x400000;
+    } else if (fmt == kFloat16 && a < kMinHalf) {
+      h[i] = FloatToHalfSubnormal(x, noise.Next(lane));
+      continue;
+    } else {
+      a = std::min(a + (noise.Next(lane) & ((1U << drop) - 1)), kMaxFinite);
+      x = (x & 0x80000000) | a;
+    }
+    h[i] = fmt == kFloat16 ? FloatToHalfTrunc(x) : (uint16)(x >> 16);
+  }
+}
+
+}  // namespace ps
@@ -0,0 +1,325 @@
+/**
+ * @file   numa.h
+ * @brief  Places threads and memory on NUMA nodes, and backs large buffers by
+ * huge pages
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "ps/base.h"
+namespace ps {
+
+/**
+ * \brief The NUMA nodes of the machine with cpus, read from
+ * /sys/devices/system/node. Without it, there is one node with all cpus
+ */
+class NumaTopology {
+ public:
+  static const NumaTopology& Get() {
+    static NumaTopology t;
+    return t;
+  }
+
+  int num_nodes() const { return id_.size(); }
+
+  /// \brief the system id of the i-th node
+  int id(int i) const { return id_[i]; }
+
+  /// \brief the cpus of the i-th node
+  const std::vector<int>& cpus(int i) const { return cpus_[i]; }
+
+  std::string Print() const {
+    std::stringstream ss;
+    ss << "numa topology: " << num_nodes() << " nodes";
+    for (int i = 0; i < num_nodes(); ++i) {
+      ss << ", node " << id_[i] << " with " << cpus_[i].size() << " cpus";
+    }
+    return ss.str();
+  }
+
+ private:
+  NumaTopology() {
+    // node ids may have holes, and a node may have no cpu
+    for (int n = 0; n < kMaxNodes; ++n) {
+      std::ifstream in("/sys/devices/system/node/node" + std::to_string(n) +
+                       "/cpulist");
+      if (!in) continue;
+      std::string list;
+      std::getline(in, list);
+      auto cpus = ParseList(list);
+      if (cpus.empty()) continue;
+      id_.push_back(n);
+      cpus_.push_back(cpus);
+    }
+    if (id_.empty()) {
+      int n = std::max(1, (int)std::thread::hardware_concurrency());
+      id_.push_back(-1);
+      cpus_.emplace_back();
+      for (int i = 0; i < n; ++i) cpus_[0].push_back(i);
+    }
+  }
+
+  /// parses a list such as "0-11,24-35"
+  static std::vector<int> ParseList(const std::string& list) {
+    std::vector<int> ret;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+      if (range.empty()) continue;
+      auto dash = range.find('-');
+      int a = std::atoi(range.c_str());
+      int b = dash == std::string::npos ? a : std::atoi(range.c_str() + dash + 1);
+      for (int i = a; i <= b; ++i) ret.push_back(i);
+    }
+    return ret;
+  }
+
+  static const int kMaxNodes = 256;
+  std::vector<int> id_;
+  std::vector<std::vector<int>> cpus_;
+};
+
+/**
+ * \brief Allocates buffers on the NUMA node of the calling thread, with huge
+ * pages
+ *
+ * A thread sets the node its allocations go to by \ref SetNode, which is -1,
+ * the default policy of the system, if not set. A buffer of at least \ref
+ * kHugePage bytes is mapped separately, aligned to huge pages, and bound to
+ * the node before it is touched, so it is placed on the node no matter which
+ * thread touches it first. With \ref kTransparent, it is advised to be backed
+ * by transparent huge pages. With \ref kExplicit, it is mapped from the huge
+ * page pool, see /proc/sys/vm/nr_hugepages, and falls back to the transparent
+ * ones if the pool is exhausted. The smaller buffers use malloc.
+ */
+class NumaMemory {
+ public:
+  enum HugePages {
+    /// the base pages
+    kNone,
+    /// transparent huge pages, madvise(MADV_HUGEPAGE)
+    kTransparent,
+    /// explicit huge pages, mmap(MAP_HUGETLB)
+    kExplicit
+  };
+
+  /// \brief the size of a huge page
+  static const size_t kHugePage = 2 << 20;
+
+  /// \brief sets the huge pages of the buffers allocated hereafter
+  static void SetHugePages(HugePages h) { huge() = h; }
+
+  /// \brief sets the node of the buffers the calling thread allocates, -1
+  /// means the default policy
+  static void SetNode(int node) { thread_node() = node; }
+
+  static int GetNode() { return thread_node(); }
+
+  static void* Alloc(size_t bytes) {
+    if (bytes < kHugePage) return CHECK_NOTNULL(std::malloc(std::max<size_t>(bytes, 1)));
+    size_t len = RoundUp(bytes);
+    void* p = nullptr;
+#ifdef __linux__
+    if (huge() == kExplicit) {
+      p = mmap(nullptr, len, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (p == MAP_FAILED) {
+        p = nullptr;
+        ++ stats().fallback;
+      } else {
+        stats().huge += len;
+      }
+    }
+    if (!p) {
+      p = MapAligned(len);
+      if (huge() != kNone && madvise(p, len, MADV_HUGEPAGE) == 0) {
+        stats().huge += len;
+      }
+    }
+    int node = thread_node();
+    if (node >= 0 && Bind(p, len, node)) stats().bound += len;
+#else
+    p = CHECK_NOTNULL(std::malloc(bytes));
+#endif
+    stats().mapped += len;
+    return p;
+  }
+
+  static void Free(void* p, size_t bytes) {
+    if (!p) return;
+    if (bytes < kHugePage) {
+      std::free(p);
+      return;
+    }
+#ifdef __linux__
+    munmap(p, RoundUp(bytes));
+#else
+    std::free(p);
+#endif
+    stats().freed += RoundUp(bytes);
+  }
+
+  /// \brief pins the calling thread to \a cpu, returns false if failed
+  static bool PinThread(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+  }
+
+  /// \brief returns a log line of the buffers mapped
+  static std::string Print() {
+    auto& s = stats();
+    std::stringstream ss;
+    ss << "numa memory: " << (s.mapped - s.freed) / 1e6 << " MB in use, "
+       << s.mapped / 1e6 << " MB mapped in total, " << s.huge / 1e6 << " MB advised or mapped "
+       << "as huge pages, " << s.bound / 1e6 << " MB bound to nodes, "
+       << s.fallback << " fallbacks from explicit huge pages";
+    return ss.str();
+  }
+
+ private:
+  struct Stats {
+    std::atomic<size_t> mapped{0}, freed{0}, huge{0}, bound{0}, fallback{0};
+  };
+  static Stats& stats() { static Stats s; return s; }
+  static HugePages& huge() { static HugePages h = kNone; return h; }
+  static int& thread_node() { static thread_local int n = -1; return n; }
+
+  static size_t RoundUp(size_t bytes) {
+    return (bytes + kHugePage - 1) / kHugePage * kHugePage;
+  }
+
+#ifdef __linux__
+  /// maps len bytes aligned to huge pages, len is a multiple of kHugePage
+  static void* MapAligned(size_t len) {
+    size_t map = len + kHugePage;
+    char* p = (char*)mmap(nullptr, map, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    CHECK(p != MAP_FAILED) << "failed to map " << len << " bytes";
+    size_t head = (kHugePage - (uintptr_t)p % kHugePage) % kHugePage;
+    if (head) munmap(p, head);
+    munmap(p + head + len, kHugePage - head);
+    return p + head;
+  }
+
+  /// prefers the pages of [p, p+len) on node, by mbind(MPOL_PREFERRED)
+  static bool Bind(void* p, size_t len, int node) {
+#ifdef SYS_mbind
+    const int kPreferred = 1;
+    unsigned long mask[4] = {0};
+    if (node >= (int)sizeof(mask) * 8) return false;
+    mask[node / 64] |= 1UL << (node % 64);
+    return syscall(SYS_mbind, p, len, kPreferred, mask,
+                   sizeof(mask) * 8 + 1, 0) == 0;
+#else
+    return false;
+#endif
+  }
+#endif
+};
+
+/**
+ * \brief An allocator of std containers by \ref NumaMemory
+ */
+template <typename T>
+struct NumaAllocator {
+  typedef T value_type;
+  NumaAllocator() { }
+  template <typename U> NumaAllocator(const NumaAllocator<U>&) { }
+
+  T* allocate(size_t n) { return (T*)NumaMemory::Alloc(n * sizeof(T)); }
+  void deallocate(T* p, size_t n) { NumaMemory::Free(p, n * sizeof(T)); }
+
+  template <typename U> bool operator==(const NumaAllocator<U>&) const { return true; }
+  template <typename U> bool operator!=(const NumaAllocator<U>&) const { return false; }
+};
+
+/**
+ * \brief The configuration of placing the buckets of a store on NUMA nodes,
+ * see \ref KVStore::SetNuma
+ */
+struct NumaConf {
+  /// pin the bucket threads to cpus, and allocate the memory of a bucket on
+  /// the node of its cpu
+  bool pin = false;
+  /// the system ids of the nodes used, empty means all
+  std::vector<int> nodes;
+  /// the huge pages of the large buffers, such as hash tables and arenas
+  NumaMemory::HugePages huge_pages = NumaMemory::kNone;
+};
+
+/**
+ * \brief Places the buckets of a store on NUMA nodes
+ *
+ * The buckets are divided into consecutive blocks, one per node, and the
+ * buckets of a node are pinned to its cpus one by one, in the order of the
+ * cpu list, which usually lists the physical cores before their hyperthreads.
+ */
+class NumaPlacement {
+ public:
+  void Init(const NumaConf& conf, int num_buckets) {
+    const auto& t = NumaTopology::Get();
+    std::vector<int> nodes;
+    for (int i = 0; i < t.num_nodes(); ++i) {
+      if (conf.nodes.empty() || std::find(conf.nodes.begin(), conf.nodes.end(),
+                                          t.id(i)) != conf.nodes.end()) {
+        nodes.push_back(i);
+      }
+    }
+    CHECK(!nodes.empty()) << "none of the numa nodes is found. " << t.Print();
+    int nn = nodes.size();
+    node_.resize(num_buckets);
+    cpu_.resize(num_buckets);
+    for (int b = 0; b < num_buckets; ++b) {
+      int n = nodes[(int64)b * nn / num_buckets];
+      // the index of this bucket among the buckets of node n
+      int j = b - (int)(((int64)b * nn / num_buckets * num_buckets + nn - 1) / nn);
+      const auto& cpus = t.cpus(n);
+      node_[b] = t.id(n);
+      cpu_[b] = cpus[j % cpus.size()];
+    }
+  }
+
+  bool empty() const { return node_.empty(); }
+
+  /// \brief the system id of the node of bucket b, -1 if unknown
+  int node(int b) const { return node_[b]; }
+
+  /// \brief the cpu bucket b is pinned to
+  int cpu(int b) const { return cpu_[b]; }
+
+  const std::vector<int>& nodes() const { return node_; }
+
+  std::string Print() const {
+    std::stringstream ss;
+    ss << "numa placement of " << node_.size() << " buckets:";
+    for (size_t b = 0; b < node_.size(); ++b) {
+      ss << " " << b << "->node " << node_[b] << " cpu " << cpu_[b];
+      if (b + 1 < node_.size()) ss << ",";
+    }
+    return ss.str();
+  }
+
+ private:
+  std::vector<int> node_, cpu_;
+};
+
+}  // namespace ps
@@ -1,6 +1,7 @@
 #pragma once
 #include "ps/shared_array.h"
 #include "base/assign_op.h"
+#include "base/task_scheduler.h"
 namespace ps {
 
 // the implementation, see comments bellow
@@ -33,16 +34,20 @@ void ParallelOrderedMatch(
       }
     }
   } else {
-    std::thread thr(
-        ParallelOrderedMatch<K,V>, src_key, src_key_end, src_val,
-        dst_key, dst_key + dst_len / 2, dst_val,
-        k, op, grainsize, n);
+    // match the second half by the task scheduler
     size_t m = 0;
+    TaskGroup g;
+    g.Run([=, &m]() {
+        ParallelOrderedMatch<K,V>(
+            src_key, src_key_end, src_val,
+            dst_key + dst_len / 2, dst_key_end, dst_val + ( dst_len / 2 ) * k,
+            k, op, grainsize, &m);
+      });
     ParallelOrderedMatch<K,V>(
         src_key, src_key_end, src_val,
-        dst_key + dst_len / 2, dst_key_end, dst_val + ( dst_len / 2 ) * k,
-        k, op, grainsize, &m);
-    thr.join();
+        dst_key, dst_key + dst_len / 2, dst_val,
+        k, op, grainsize, n);
+    g.Wait();
     *n += m;
   }
 }
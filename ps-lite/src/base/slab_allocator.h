@@ -0,0 +1,104 @@
+/**
+ * @file   slab_allocator.h
+ * @brief  A fixed-size slot allocator backed by large contiguous arenas
+ */
+#pragma once
+#include <vector>
+#include <memory>
+#include <type_traits>
+#include "ps/base.h"
+#include "base/numa.h"
+namespace ps {
+
+/**
+ * \brief Allocates fixed-size slots of \a T from large contiguous arenas
+ *
+ * Compared to one `new T[n]` per object, it has no per-allocation header,
+ * does not fragment the heap, and places objects allocated together next to
+ * each other. A slot is identified by a 32-bit index rather than a pointer, and
+ * freed slots are recycled by later \ref Alloc calls. Arenas are never moved,
+ * so a pointer returned by \ref Get stays valid until the slot is freed.
+ * Arenas are allocated by \ref NumaMemory, so they are placed on the NUMA node
+ * of the allocating thread and may be backed by huge pages.
+ *
+ * It is not thread-safe, use one allocator per thread or per bucket.
+ */
+template <typename T>
+class SlabAllocator {
+ public:
+  /**
+   * @param slot_size the number of T in a slot
+   * @param log2_slots_per_slab an arena has 2^log2_slots_per_slab slots
+   */
+  explicit SlabAllocator(int slot_size = 1, int log2_slots_per_slab = 16)
+      : slot_size_(slot_size), shift_(log2_slots_per_slab),
+        mask_((1U << log2_slots_per_slab) - 1) {
+    CHECK_GT(slot_size_, 0);
+    CHECK_LT(shift_, 32);
+  }
+
+  SlabAllocator(SlabAllocator&& a) = default;
+  SlabAllocator& operator=(SlabAllocator&& a) = default;
+  SlabAllocator(const SlabAllocator&) = delete;
+  SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+  /// \brief allocates a slot, its content is not initialized
+  uint32 Alloc() {
+    ++ live_;
+    if (free_.size()) {
+      uint32 i = free_.back(); free_.pop_back();
+      return i;
+    }
+    if ((next_ >> shift_) == slabs_.size()) {
+      size_t n = (size_t)slot_size_ << shift_;
+      slabs_.emplace_back((T*)NumaMemory::Alloc(n * sizeof(T)), SlabDeleter{n});
+    }
+    CHECK_LT(next_, kMaxSlots);
+    return next_ ++;
+  }
+
+  /// \brief returns the slot \a i to the allocator
+  void Free(uint32 i) {
+    -- live_;
+    free_.push_back(i);
+  }
+
+  /// \brief returns the address of slot \a i
+  T* Get(uint32 i) const {
+    return slabs_[i >> shift_].get() + (size_t)(i & mask_) * slot_size_;
+  }
+
+  /// \brief the number of allocated slots
+  size_t size() const { return live_; }
+
+  /// \brief the memory in bytes held by this allocator
+  size_t bytes() const {
+    return (slabs_.size() * slot_size_ * sizeof(T) << shift_) +
+        free_.capacity() * sizeof(uint32);
+  }
+
+  int slot_size() const { return slot_size_; }
+
+  /// \brief the maximal number of slots
+  static const uint32 kMaxSlots = 0xFFFFFFFF;
+
+ private:
+  int slot_size_;
+  int shift_;
+  uint32 mask_;
+  uint32 next_ = 0;
+  size_t live_ = 0;
+  static_assert(std::is_trivially_destructible<T>::value,
+                "slots are not constructed or destroyed");
+  struct SlabDeleter {
+    size_t n;
+    void operator()(T* p) const { NumaMemory::Free(p, n * sizeof(T)); }
+  };
+  std::vector<std::unique_ptr<T[], SlabDeleter>> slabs_;
+  std::vector<uint32> free_;
+};
+
+template <typename T>
+const uint32 SlabAllocator<T>::kMaxSlots;
+
+}  // namespace ps
@@ -0,0 +1,329 @@
+/**
+ * @file   task_scheduler.h
+ * @brief  A process-wide work-stealing task scheduler, and the parallel for,
+ * sort and merge built on it
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ps/base.h"
+namespace ps {
+
+/**
+ * \brief A process-wide pool of threads running tasks by work stealing
+ *
+ * Each thread has a deque of tasks. A task spawned by a pool thread is pushed
+ * to the back of its deque, and the thread runs its own tasks from the back,
+ * so the most recently split, cache-warm work runs first. An idle thread
+ * steals from the front of the others, which holds the largest pieces of
+ * work. Tasks spawned by the other threads are spread over the deques.
+ *
+ * A thread waiting for its tasks, see \ref TaskGroup::Wait, runs the pending
+ * ones meanwhile, so nested parallel calls neither block a thread nor create
+ * any. All the parallel kernels share the pool, so several minibatches being
+ * processed at the same time do not oversubscribe the cores.
+ */
+class TaskScheduler {
+ public:
+  typedef std::function<void()> Task;
+
+  /// \brief returns the scheduler, created at the first call
+  static TaskScheduler& Get() {
+    static TaskScheduler s(num_threads() > 0 ? num_threads() :
+                           std::max(1, (int)std::thread::hardware_concurrency()));
+    return s;
+  }
+
+  /// \brief sets the number of threads, which must be called before the first
+  /// \ref Get. 0, the default, means the number of cores
+  static void SetNumThreads(int n) { num_threads() = n; }
+
+  ~TaskScheduler() {
+    {
+      std::lock_guard<std::mutex> lk(sleep_mu_);
+      stop_ = true;
+    }
+    sleep_cond_.notify_all();
+    for (auto& t : threads_) t.join();
+  }
+
+  /// \brief the number of threads
+  int size() const { return (int)queues_.size(); }
+
+  /// \brief runs \a task by some thread later
+  void Spawn(Task&& task) {
+    int me = worker_id();
+    int q = me >= 0 && worker_of() == this ? me : next_++ % size();
+    {
+      std::lock_guard<std::mutex> lk(queues_[q]->mu);
+      queues_[q]->tasks.push_back(std::move(task));
+    }
+    ++ pending_;
+    if (sleeping_.load()) {
+      std::lock_guard<std::mutex> lk(sleep_mu_);
+      sleep_cond_.notify_one();
+    }
+  }
+
+  /**
+   * \brief runs one pending task, from the back of the caller's own deque if
+   * it is a pool thread, otherwise from the front of another one. returns
+   * false if there is no pending task
+   */
+  bool RunOne() {
+    if (pending_.load() == 0) return false;
+    int me = worker_of() == this ? worker_id() : -1;
+    Task task;
+    if (me >= 0 && Pop(me, true, &task)) {
+      Run(&task);
+      return true;
+    }
+    int n = size();
+    int start = me >= 0 ? me + 1 : (int)(next_.load() % n);
+    for (int j = 0; j < n; ++j) {
+      int q = (start + j) % n;
+      if (q != me && Pop(q, false, &task)) {
+        Run(&task);
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  explicit TaskScheduler(int n) {
+    CHECK_GT(n, 0);
+    for (int i = 0; i < n; ++i) queues_.emplace_back(new Queue());
+    for (int i = 0; i < n; ++i) {
+      threads_.emplace_back([this, i]() {
+          worker_id() = i;
+          worker_of() = this;
+          Loop();
+        });
+    }
+  }
+  DISALLOW_COPY_AND_ASSIGN(TaskScheduler);
+
+  struct Queue {
+    std::mutex mu;
+    std::deque<Task> tasks;
+  };
+
+  bool Pop(int q, bool back, Task* task) {
+    auto& queue = *queues_[q];
+    std::lock_guard<std::mutex> lk(queue.mu);
+    if (queue.tasks.empty()) return false;
+    if (back) {
+      *task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      *task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    -- pending_;
+    return true;
+  }
+
+  void Run(Task* task) {
+    (*task)();
+  }
+
+  void Loop() {
+    while (true) {
+      if (RunOne()) continue;
+      std::unique_lock<std::mutex> lk(sleep_mu_);
+      ++ sleeping_;
+      sleep_cond_.wait(lk, [this]() { return stop_ || pending_.load() > 0; });
+      -- sleeping_;
+      if (stop_) return;
+    }
+  }
+
+  static int& num_threads() { static int n = 0; return n; }
+  static int& worker_id() { static thread_local int i = -1; return i; }
+  static TaskScheduler*& worker_of() {
+    static thread_local TaskScheduler* s = nullptr; return s;
+  }
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<int> pending_{0}, sleeping_{0};
+  std::atomic<unsigned> next_{0};
+  std::mutex sleep_mu_;
+  std::condition_variable sleep_cond_;
+  bool stop_ = false;
+};
+
+/**
+ * \brief A group of tasks run by the \ref TaskScheduler, which can be waited
+ * for together
+ */
+class TaskGroup {
+ public:
+  explicit TaskGroup(TaskScheduler* sched = &TaskScheduler::Get())
+      : sched_(sched) { }
+  ~TaskGroup() { Wait(); }
+
+  /// \brief runs \a f by some thread of the scheduler
+  template <typename F>
+  void Run(const F& f) {
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      ++ left_;
+    }
+    sched_->Spawn([this, f]() {
+        f();
+        std::lock_guard<std::mutex> lk(mu_);
+        if (-- left_ == 0) cond_.notify_all();
+      });
+  }
+
+  /// \brief waits until all tasks finish, running the pending tasks of the
+  /// scheduler meanwhile
+  void Wait() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lk(mu_);
+        if (left_ == 0) return;
+      }
+      if (sched_->RunOne()) continue;
+      // the tasks left are running, they may spawn more to help with
+      std::unique_lock<std::mutex> lk(mu_);
+      cond_.wait_for(lk, std::chrono::microseconds(100),
+                     [this]() { return left_ == 0; });
+    }
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(TaskGroup);
+  TaskScheduler* sched_;
+  std::mutex mu_;
+  std::condition_variable cond_;
+  int left_ = 0;
+};
+
+/**
+ * \brief runs f(i) for i = 0, ..., n-1 at the same time, f(0) by the caller
+ */
+template <typename F>
+void ParallelRun(int n, const F& f) {
+  if (n <= 1) {
+    if (n == 1) f(0);
+    return;
+  }
+  TaskGroup g;
+  for (int i = 1; i < n; ++i) g.Run([&f, i]() { f(i); });
+  f(0);
+  g.Wait();
+}
+
+/**
+ * \brief runs f(lo, hi) on \a nparts even segments of [begin, end) in
+ * parallel, the i-th one is [begin + n*i/nparts, begin + n*(i+1)/nparts)
+ */
+template <typename F>
+void ParallelFor(size_t begin, size_t end, int nparts, const F& f) {
+  size_t n = end > begin ? end - begin : 0;
+  if (n == 0) return;
+  nparts = (int)std::min((size_t)std::max(nparts, 1), n);
+  ParallelRun(nparts, [begin, n, nparts, &f](int i) {
+      f(begin + n * i / nparts, begin + n * (i+1) / nparts);
+    });
+}
+
+/**
+ * \brief returns the sum of f(lo, hi) over \a nparts even segments of [begin,
+ * end), computed in parallel
+ */
+template <typename T, typename F>
+T ParallelSum(size_t begin, size_t end, int nparts, const F& f) {
+  nparts = std::max(nparts, 1);
+  std::vector<T> sum(nparts, T());
+  size_t n = end > begin ? end - begin : 0;
+  ParallelRun(nparts, [begin, n, nparts, &f, &sum](int i) {
+      size_t lo = begin + n * i / nparts, hi = begin + n * (i+1) / nparts;
+      if (lo < hi) sum[i] = f(lo, hi);
+    });
+  T ret = T();
+  for (const auto& s : sum) ret += s;
+  return ret;
+}
+
+/**
+ * \brief merges the sorted [a, a+na) and [b, b+nb) into out stably in
+ * parallel, the pieces with at most \a grainsize items are merged serially
+ */
+template <typename T, typename Fn>
+void ParallelMerge(const T* a, size_t na, const T* b, size_t nb, T* out,
+                   size_t grainsize, const Fn& cmp) {
+  if (na + nb <= grainsize || na == 0 || nb == 0) {
+    std::merge(a, a + na, b, b + nb, out, cmp);
+    return;
+  }
+  // split the longer one in the middle, the items of a go before the equal
+  // ones of b
+  size_t ma, mb;
+  if (na >= nb) {
+    ma = na / 2;
+    mb = std::lower_bound(b, b + nb, a[ma], cmp) - b;
+  } else {
+    mb = nb / 2;
+    ma = std::upper_bound(a, a + na, b[mb], cmp) - a;
+  }
+  TaskGroup g;
+  g.Run([=, &cmp]() {
+      ParallelMerge(a + ma, na - ma, b + mb, nb - mb, out + ma + mb,
+                    grainsize, cmp); });
+  ParallelMerge(a, ma, b, mb, out, grainsize, cmp);
+  g.Wait();
+}
+
+namespace {
+/// sorts data by merging the two sorted halves through buf
+template <typename T, typename Fn>
+void ParallelSort_(T* data, T* buf, size_t len, size_t grainsize,
+                   const Fn& cmp) {
+  if (len <= grainsize) {
+    std::sort(data, data + len, cmp);
+    return;
+  }
+  size_t half = len / 2;
+  {
+    TaskGroup g;
+    g.Run([=, &cmp]() {
+        ParallelSort_(data + half, buf + half, len - half, grainsize, cmp); });
+    ParallelSort_(data, buf, half, grainsize, cmp);
+    g.Wait();
+  }
+  ParallelMerge(data, half, data + half, len - half, buf, grainsize, cmp);
+  ParallelFor(0, len, (int)((len - 1) / grainsize + 1),
+              [data, buf](size_t lo, size_t hi) {
+                std::move(buf + lo, buf + hi, data + lo); });
+}
+}  // namespace
+
+/**
+ * \brief sorts [data, data+len) by cmp in parallel, in up to about \a nparts
+ * pieces at a time
+ */
+template <typename T, typename Fn>
+void ParallelSort(T* data, size_t len, int nparts, const Fn& cmp) {
+  CHECK_GT(nparts, 0);
+  size_t grainsize = std::max(len / nparts + 5, (size_t)1024*16);
+  if (len <= grainsize) {
+    std::sort(data, data + len, cmp);
+    return;
+  }
+  std::unique_ptr<T[]> buf(new T[len]);
+  ParallelSort_(data, buf.get(), len, grainsize, cmp);
+}
+
+}  // namespace ps
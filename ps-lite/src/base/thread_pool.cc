@@ -23,14 +23,31 @@ void ThreadPool::Add(const Task& task) {
   if (started_) worker_cond_.notify_one();
 }
 
+void ThreadPool::Add(const Task& task, int worker) {
+  CHECK_LT((unsigned)worker, (unsigned)num_workers_);
+  std::lock_guard<std::mutex> l(mu_);
+  worker_tasks_[worker].push_back(task);
+  ++ num_worker_tasks_;
+  // wake up all, since notify_one may pick another worker
+  if (started_) worker_cond_.notify_all();
+}
+
 void ThreadPool::Wait() {
   std::unique_lock<std::mutex> l(mu_);
   fin_cond_.wait(l, [this]{ return Done(); });
 }
 
-typename ThreadPool::Task ThreadPool::GetNextTask() {
+typename ThreadPool::Task ThreadPool::GetNextTask(int worker) {
   std::unique_lock<std::mutex> l(mu_);
   for (;;) {
+    auto& own = worker_tasks_[worker];
+    if (!own.empty()) {
+      auto task = std::move(own.front());
+      own.pop_front();
+      -- num_worker_tasks_;
+      ++ num_running_tasks_;
+      return task;
+    }
     if (!tasks_.empty()) {
       auto task = std::move(tasks_.front());
       tasks_.pop_front();
@@ -53,19 +70,19 @@ void ThreadPool::FinishTask() {
   if (Done()) fin_cond_.notify_all();
 }
 
-void ThreadPool::RunWorker() {
-  auto task = GetNextTask();
+void ThreadPool::RunWorker(int worker) {
+  auto task = GetNextTask(worker);
   while (task) {
     task();
     FinishTask();
-    task = GetNextTask();
+    task = GetNextTask(worker);
   }
 }
 
 void ThreadPool::StartWorkers() {
   started_ = true;
   for (int i = 0; i < num_workers_; ++i) {
-    all_workers_.push_back(std::move(std::thread(&ThreadPool::RunWorker, this)));
+    all_workers_.push_back(std::move(std::thread(&ThreadPool::RunWorker, this, i)));
   }
 }
 
@@ -16,7 +16,7 @@ namespace ps {
 class ThreadPool {
  public:
   explicit ThreadPool(int num_workers)
-      : num_workers_(num_workers) {}
+      : num_workers_(num_workers), worker_tasks_(num_workers) {}
 
   /// \brief Guarantee all tasks have been finished if \ref StartWorkers has
   /// been called
@@ -36,6 +36,13 @@ class ThreadPool {
    */
   void Add(const Task& task);
 
+  /**
+   * \brief Add a task which is only run by the \a worker-th worker thread, such
+   * as the task of a bucket which should stay on the same core, see \ref
+   * NumaPlacement
+   */
+  void Add(const Task& task, int worker);
+
 
   /**
    * \brief Block the caller until all tasked added before have been
@@ -47,17 +54,22 @@ class ThreadPool {
   DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
   /// \brief Get next task, for internal use
-  Task GetNextTask();
+  Task GetNextTask(int worker);
 
   /// \brief Finished one task, for internal use
   void FinishTask();
 
-  void RunWorker();
+  void RunWorker(int worker);
 
-  bool Done() { return tasks_.empty() && num_running_tasks_ == 0; }
+  bool Done() {
+    return tasks_.empty() && num_worker_tasks_ == 0 && num_running_tasks_ == 0;
+  }
 
   const int num_workers_;
   std::list<Task> tasks_;
+  // the tasks of each worker, see Add(task, worker)
+  std::vector<std::list<Task>> worker_tasks_;
+  int num_worker_tasks_ = 0;
   std::mutex mu_;
   std::condition_variable worker_cond_, fin_cond_;
 
@@ -1,6 +1,6 @@
 #pragma once
 #include "base/countmin.h"
-#include "base/shared_array_inl.h"
+#include "ps/shared_array.h"
 namespace ps {
 
 /**
@@ -0,0 +1,78 @@
+/**
+ * @file   kv_admission.h
+ * @brief  Admits new keys into a KV store by their frequency
+ */
+#pragma once
+#include "base/countmin.h"
+namespace ps {
+
+/**
+ * \brief The statistics of \ref KVAdmission
+ */
+struct KVAdmissionStats {
+  /// the number of pushes on new keys which created an entry
+  size_t admitted = 0;
+  /// the number of pushes on new keys which were dropped
+  size_t rejected = 0;
+  /// the memory of the sketches in bytes
+  size_t bytes = 0;
+
+  KVAdmissionStats& operator+=(const KVAdmissionStats& s) {
+    admitted += s.admitted; rejected += s.rejected; bytes += s.bytes;
+    return *this;
+  }
+};
+
+/**
+ * \brief Creates an entry for a key only after it has been pushed \a threshold
+ * times
+ *
+ * The pushes of keys without an entry are counted by a count-min sketch with a
+ * fixed number of 8-bit counters, so the memory does not grow with the number
+ * of keys, and a count is never underestimated. Until a key is admitted its
+ * pushes are dropped, and its pulls get the default entry since pulls do not
+ * insert.
+ *
+ * It is not thread-safe, use one per bucket.
+ */
+template <typename K>
+class KVAdmission {
+ public:
+  /**
+   * @param threshold the number of pushes to admit a key. 0 or 1 admits all
+   * keys, which disables the sketch
+   * @param sketch_size the number of counters
+   * @param num_hashes the number of counters a key is hashed into
+   */
+  void Init(int threshold, int sketch_size, int num_hashes) {
+    CHECK_LT(threshold, (int)kMaxCount) << "the counters are 8-bit";
+    threshold_ = threshold;
+    if (!enabled()) return;
+    sketch_.resize(sketch_size, num_hashes, kMaxCount);
+    stats_.bytes = std::max(sketch_size, 64);
+  }
+
+  bool enabled() const { return threshold_ > 1; }
+
+  /// \brief counts a push on key \a k which has no entry, returns true if it
+  /// can create the entry now
+  bool Admit(K k) {
+    sketch_.insert(k, 1);
+    if ((int)sketch_.query(k) >= threshold_) {
+      ++ stats_.admitted;
+      return true;
+    }
+    ++ stats_.rejected;
+    return false;
+  }
+
+  const KVAdmissionStats& stats() const { return stats_; }
+
+ private:
+  static const uint8 kMaxCount = 255;
+  CountMin<K, uint8> sketch_;
+  int threshold_ = 0;
+  KVAdmissionStats stats_;
+};
+
+}  // namespace ps
@@ -0,0 +1,116 @@
+/**
+ * @file   kv_aggregator.h
+ * @brief  Sums the pushes of a bucket before applying them
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "ps/blob.h"
+#include "base/flat_hash_map.h"
+namespace ps {
+
+/**
+ * \brief Sums the values pushed into the same key, so that a key pushed by
+ * many requests within a window is applied by one push
+ *
+ * A key gets a slot in a flat hash map at its first push, and its values are
+ * appended into a buffer, into which the later pushes are added. The pushes of
+ * different commands, such as feature counts and gradients, are summed
+ * separately. Values of a key with different lengths are summed element-wise,
+ * as if the shorter ones were padded with zeros. It is not thread-safe, use
+ * one per bucket.
+ */
+template <typename K, typename V>
+class KVAggregator {
+ public:
+  /// \brief adds the push of val[i] into key[i] for i in [0, n) with \a cmd
+  void Add(int cmd, size_t n, const K* key, const Blob<const V>* val) {
+    auto& t = GetTable(cmd);
+    t.slot.reserve(t.slot.size() + n);
+    for (size_t i = 0; i < n; ++i) {
+      const auto& v = val[i];
+      uint32_t& s = t.slot[key[i]];
+      if (s == 0) {
+        t.key.push_back(key[i]);
+        t.off.push_back(t.val.size());
+        t.len.push_back(v.size);
+        t.val.insert(t.val.end(), v.data, v.data + v.size);
+        s = t.key.size();
+        continue;
+      }
+      size_t j = s - 1;
+      if (v.size > t.len[j]) {
+        // move it to the end with the longer length
+        size_t off = t.val.size();
+        t.val.resize(off + v.size, 0);
+        std::copy(t.val.begin() + t.off[j], t.val.begin() + t.off[j] + t.len[j],
+                  t.val.begin() + off);
+        t.off[j] = off;
+        t.len[j] = v.size;
+      }
+      V* sum = t.val.data() + t.off[j];
+      for (size_t k = 0; k < v.size; ++k) sum[k] += v.data[k];
+    }
+    added_ += n;
+  }
+
+  /**
+   * \brief calls f(n, key, val) with the summed pushes of \a cmd, and then
+   * clears them. The values are valid during the call
+   */
+  template <typename F>
+  void Take(int cmd, const F& f) {
+    for (auto& t : tables_) {
+      if (t.cmd != cmd || t.key.empty()) continue;
+      size_t n = t.key.size();
+      push_.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        push_[i] = Blob<const V>(t.val.data() + t.off[i], t.len[i]);
+      }
+      f(n, t.key.data(), push_.data());
+      applied_ += n;
+      t.Clear();
+    }
+  }
+
+  /// \brief drops the pushes not applied
+  void Clear() { tables_.clear(); }
+
+  /// \brief the number of keys pushed since the beginning
+  size_t added() const { return added_; }
+
+  /// \brief the number of keys applied since the beginning
+  size_t applied() const { return applied_; }
+
+ private:
+  struct Table {
+    int cmd;
+    /// the slot of a key plus 1
+    FlatHashMap<K, uint32_t> slot;
+    std::vector<K> key;
+    /// the values of slot i are val[off[i], off[i] + len[i])
+    std::vector<size_t> off;
+    std::vector<uint32_t> len;
+    std::vector<V> val;
+
+    /// clears it but keeps the memory for the next window
+    void Clear() {
+      size_t n = key.size();
+      slot.clear(); slot.reserve(n);
+      key.clear(); off.clear(); len.clear(); val.clear();
+    }
+  };
+
+  Table& GetTable(int cmd) {
+    for (auto& t : tables_) if (t.cmd == cmd) return t;
+    tables_.emplace_back();
+    tables_.back().cmd = cmd;
+    return tables_.back();
+  }
+
+  std::vector<Table> tables_;
+  std::vector<Blob<const V>> push_;
+  size_t added_ = 0, applied_ = 0;
+};
+
+}  // namespace ps
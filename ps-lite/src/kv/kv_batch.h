@@ -0,0 +1,329 @@
+/**
+ * @file   kv_batch.h
+ * @brief  Calls the handle of a KV store for a batch of keys
+ */
+#pragma once
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+#include "ps/blob.h"
+#include "base/flat_hash_map.h"
+#include "kv/kv_admission.h"
+#include "kv/kv_eviction.h"
+#include "kv/kv_indexed_file.h"
+#include "kv/kv_delta.h"
+#include "kv/kv_aggregator.h"
+namespace ps {
+
+/// \brief prefetches the slot of key \a k, a no-op for tables not supporting it
+template <typename Map, typename K>
+PS_ALWAYS_INLINE void PrefetchKey(const Map& data, K k) { }
+
+template <typename K, typename V>
+PS_ALWAYS_INLINE void PrefetchKey(const FlatHashMap<K, V>& data, K k) {
+  data.prefetch(k);
+}
+
+/**
+ * \brief guarantees \a n more keys can be inserted without moving the entries
+ *
+ * A no-op for node-based tables such as std::unordered_map, whose reserve may
+ * rehash the whole table even if it is large enough.
+ */
+template <typename Map>
+inline void ReserveKeys(Map* data, size_t n) { }
+
+template <typename K, typename V>
+inline void ReserveKeys(FlatHashMap<K, V>* data, size_t n) {
+  data->reserve(data->size() + n);
+}
+
+/**
+ * \brief removes the entries whose Empty() is true and shrinks the table
+ *
+ * @return the bytes of the table reclaimed. It is estimated from the node and
+ * bucket sizes for std::unordered_map, and excludes memory owned by entries.
+ */
+template <typename Map>
+inline size_t EraseEmpty(Map* data) {
+  auto bytes = [](const Map& d) {
+    return d.size() * (sizeof(typename Map::value_type) + sizeof(void*)) +
+        d.bucket_count() * sizeof(void*);
+  };
+  size_t before = bytes(*data);
+  for (auto it = data->begin(); it != data->end(); ) {
+    it = it->second.Empty() ? data->erase(it) : std::next(it);
+  }
+  data->rehash(0);
+  return before - bytes(*data);
+}
+
+template <typename K, typename V>
+inline size_t EraseEmpty(FlatHashMap<K, V>* data) {
+  size_t before = data->bytes();
+  for (auto it = data->begin(); it != data->end(); ) {
+    it = it->second.Empty() ? data->erase(it) : ++it;
+  }
+  data->shrink_to_fit();
+  return before - data->bytes();
+}
+
+/**
+ * \brief value is true if \a Handle implements
+ *
+ * \code
+ * void PushBatch(size_t n, const K* key, const Blob<const V>* val, E** entry);
+ * \endcode
+ */
+template <typename Handle, typename K, typename E, typename V>
+class HasPushBatch {
+  template <typename H> static auto Test(int) -> decltype(
+      std::declval<H&>().PushBatch(
+          (size_t)0, (const K*)0, (const Blob<const V>*)0, (E**)0),
+      std::true_type());
+  template <typename H> static std::false_type Test(...);
+ public:
+  static const bool value = decltype(Test<Handle>(0))::value;
+};
+
+/**
+ * \brief value is true if \a Handle implements
+ *
+ * \code
+ * void PullBatch(size_t n, const K* key, const E* const* entry, Blob<V>* val);
+ * \endcode
+ */
+template <typename Handle, typename K, typename E, typename V>
+class HasPullBatch {
+  template <typename H> static auto Test(int) -> decltype(
+      std::declval<H&>().PullBatch(
+          (size_t)0, (const K*)0, (const E* const*)0, (Blob<V>*)0),
+      std::true_type());
+  template <typename H> static std::false_type Test(...);
+ public:
+  static const bool value = decltype(Test<Handle>(0))::value;
+};
+
+/**
+ * \brief Applies a batch of pushes or pulls on a hash table with the handle
+ *
+ * If the handle implements `PushBatch` (`PullBatch`), the entries of all keys
+ * are resolved first and then passed to the handle in one call, where the
+ * handle can prefetch, vectorize or amortize the work across keys. Otherwise
+ * the per-key `Push` (`Pull`) is called for each key, see \ref IOnlineHandle.
+ *
+ * The entry pointers are valid during the call, since the table is reserved
+ * for all pushed keys before resolving them, and pulls never insert. Keys in a
+ * batch must be unique. The handle may point the pulled values into the
+ * entries, so they are valid until the next call.
+ *
+ * Keys are resolved in two overlapped phases: the slot of key `i + prefetch`
+ * is hashed and prefetched before key `i` is probed, so that the cache misses
+ * of a window of keys are in flight at the same time instead of one after
+ * another.
+ *
+ * If \ref admission is enabled, pushes on keys without an entry are dropped
+ * until the key is admitted. If \ref eviction is enabled, the pushed and pulled
+ * entries are touched, and a few slots of the table are swept after each push,
+ * and for a pull at the start of the next call, since the sweep may erase or
+ * move the pulled entries. If \ref cold is enabled, the requested keys found
+ * in it are promoted into the table before the entries are resolved, and the
+ * eviction demotes entries into it. If \ref lazy is enabled, the requested
+ * keys found in neither are loaded from the indexed model in the same way. If
+ * \ref dirty is enabled, the pushed keys are recorded into it.
+ *
+ * It also holds the buffers a store thread needs to build a batch, so use one
+ * instance per thread.
+ */
+template <typename K, typename E, typename V, typename Handle, typename Map>
+class KVBatch {
+ public:
+  /// \brief pushes val[i] into key[i] for i in [0, n)
+  void Push(Handle& h, Map& data, size_t n, const K* key,
+            const Blob<const V>* val) {
+    eviction.Tick(n);
+    if (cold.enabled() || lazy.enabled()) Promote(data, n, key);
+    if (admission.enabled()) {
+      n = Admit(data, n, key, val);
+      key = adm_key_.data(); val = adm_val_.data();
+    }
+    dirty.Add(n, key);
+    Push(h, data, n, key, val, std::integral_constant<
+         bool, HasPushBatch<Handle, K, E, V>::value>());
+    if (eviction.enabled()) eviction.Step(&data, n + unswept_);
+    unswept_ = 0;
+  }
+
+  /**
+   * \brief pulls key[i] into val[i] for i in [0, n)
+   *
+   * A key which does not exist is pulled from a default constructed entry
+   * without being inserted.
+   */
+  void Pull(Handle& h, Map& data, size_t n, const K* key, Blob<V>* val) {
+    if (unswept_) {
+      eviction.Step(&data, unswept_);
+      unswept_ = 0;
+    }
+    eviction.Tick(n);
+    if (cold.enabled()) {
+      auto tv = std::chrono::steady_clock::now();
+      Promote(data, n, key);
+      auto& s = cold.stats();
+      s.pulled += n;
+      s.pull_sec += std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - tv).count();
+    } else if (lazy.enabled()) {
+      Promote(data, n, key);
+    }
+    Pull(h, data, n, key, val, std::integral_constant<
+         bool, HasPullBatch<Handle, K, E, V>::value>());
+    if (eviction.enabled()) unswept_ = n;
+  }
+
+  /// \brief buffers for the caller to build a batch
+  std::vector<K> key;
+  std::vector<Blob<const V>> push;
+  std::vector<Blob<V>> pull;
+  std::vector<V> val;
+
+  /// \brief the number of keys prefetched ahead, 0 disables prefetching ahead
+  size_t prefetch = 16;
+
+  /// \brief the admission of new keys, disabled in default
+  KVAdmission<K> admission;
+
+  /// \brief the eviction of old keys, disabled in default
+  KVEviction<K, E, Map> eviction;
+
+  /// \brief the cold tier of the table, disabled in default
+  KVColdTier<K, E> cold;
+
+  /// \brief the entries of an indexed model not loaded yet, disabled in default
+  KVLazyLoad<K, E> lazy;
+
+  /// \brief the keys changed since the last checkpoint, disabled in default
+  KVDirtyKeys<K> dirty;
+
+  /// \brief the pushes summed by the store before calling \ref Push, used if
+  /// the store aggregates pushes
+  KVAggregator<K, V> aggr;
+
+ private:
+  /// moves the keys found in the cold tier or the indexed model into the table
+  void Promote(Map& data, size_t n, const K* key) {
+    auto& s = cold.stats();
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      if (data.find(key[i]) != data.end()) {
+        ++ s.hot;
+      } else if ((cold.enabled() && cold.Take(key[i], &promoted_)) ||
+                 (lazy.enabled() && lazy.Take(key[i], &promoted_))) {
+        E& e = data[key[i]];
+        e = std::move(promoted_);
+        eviction.Touch(e);
+      } else {
+        ++ s.miss;
+      }
+    }
+  }
+
+  /// keeps the pushes on existing or admitted keys in adm_key_ and adm_val_,
+  /// returns their number
+  size_t Admit(const Map& data, size_t n, const K* key,
+               const Blob<const V>* val) {
+    adm_key_.clear(); adm_val_.clear();
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      if (data.find(key[i]) == data.end() && !admission.Admit(key[i])) continue;
+      adm_key_.push_back(key[i]);
+      adm_val_.push_back(val[i]);
+    }
+    return adm_key_.size();
+  }
+
+  void Push(Handle& h, Map& data, size_t n, const K* key,
+            const Blob<const V>* val, std::true_type) {
+    if (n == 0) return;
+    Resolve(data, n, key);
+    h.PushBatch(n, key, val, entry_.data());
+    for (size_t i = 0; i < n; ++i) eviction.Touch(*entry_[i]);
+  }
+
+  void Push(Handle& h, Map& data, size_t n, const K* key,
+            const Blob<const V>* val, std::false_type) {
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      E& e = data[key[i]];
+      h.Push(key[i], val[i], e);
+      eviction.Touch(e);
+    }
+  }
+
+  void Pull(Handle& h, Map& data, size_t n, const K* key, Blob<V>* val,
+            std::true_type) {
+    if (n == 0) return;
+    found_.resize(n);
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      found_[i] = &Find(data, key[i]);
+    }
+    h.PullBatch(n, key, found_.data(), val);
+  }
+
+  void Pull(Handle& h, Map& data, size_t n, const K* key, Blob<V>* val,
+            std::false_type) {
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      h.Pull(key[i], Find(data, key[i]), val[i]);
+    }
+  }
+
+  /// returns the entry of key k touched, or the default one if not exist
+  inline const E& Find(Map& data, K k) {
+    auto it = data.find(k);
+    if (it == data.end()) return default_;
+    if (eviction.enabled()) eviction.Touch(it->second);
+    return it->second;
+  }
+
+  void Resolve(Map& data, size_t n, const K* key) {
+    ReserveKeys(&data, n);
+    entry_.resize(n);
+    PrefetchWindow(data, n, key);
+    for (size_t i = 0; i < n; ++i) {
+      Prefetch(data, n, key, i + prefetch);
+      entry_[i] = &data[key[i]];
+    }
+  }
+
+  /// prefetches key[0, prefetch) to fill the window before the first probe
+  PS_ALWAYS_INLINE void PrefetchWindow(const Map& data, size_t n, const K* key) {
+    for (size_t j = 0; j < std::min(n, prefetch); ++j) PrefetchKey(data, key[j]);
+  }
+
+  /// prefetches key[i], or the last key if i >= n
+  PS_ALWAYS_INLINE void Prefetch(const Map& data, size_t n, const K* key, size_t i) {
+    PrefetchKey(data, key[std::min(i, n - 1)]);
+  }
+
+  std::vector<E*> entry_;
+  std::vector<const E*> found_;
+  E promoted_;
+  std::vector<K> adm_key_;
+  std::vector<Blob<const V>> adm_val_;
+  /// the value pulled for a key which does not exist
+  E default_;
+  /// the keys of the last pull, whose sweep is deferred to the next call
+  size_t unswept_ = 0;
+};
+
+}  // namespace ps
@@ -1,7 +1,11 @@
 #pragma once
+#include <atomic>
+#include <chrono>
 #include "ps/shared_array.h"
 #include "ps/app.h"
+#include "ps/node_info.h"
 #include "base/parallel_ordered_match.h"
+#include "kv/kv_hot_key_router.h"
 namespace ps {
 
 template <typename K, typename V>
@@ -12,10 +16,19 @@ class KVCache : public Customer {
 
   /// called by users ///
 
+  /**
+   * \brief sends the hot keys to their replicas, see \ref KVHotKeyRouter.
+   * The hot keys are pulled from the servers every \a refresh_sec seconds
+   */
+  void ReplicateHotKeys(int refresh_sec) {
+    hot_refresh_usec_ = refresh_sec * 1000000LL;
+  }
+
   inline int Push(const Task& req, const SArray<K>& keys,
                   const SArray<V>& vals, const SArray<int>& vals_size,
                   const Message::Callback& cb) {
     CHECK(IsKeysOrderd(keys)) << "keys must in non-decreasing order";
+    if (hot_refresh_usec_) RefreshHotKeys();
     Message msg(req, kServerGroup);
     msg.set_key(keys);
     msg.add_value(vals);
@@ -64,10 +77,23 @@ class KVCache : public Customer {
 
   void Slice(const Message& request, const std::vector<Range<Key>>& krs,
              std::vector<Message*>* msgs) {
-    SliceMessage<K>(request, krs, msgs, request.task.param().dyn_val_size());
+    const auto& call = request.task.param();
+    if (call.has_hot_key()) {
+      for (auto m : *msgs) m->valid = true;
+      return;
+    }
+    if (hot_refresh_usec_ &&
+        hot_.Slice(request, krs, NodeInfo::MyRank(), msgs)) {
+      return;
+    }
+    SliceMessage<K>(request, krs, msgs, call.dyn_val_size());
   }
 
   void ProcessResponse(Message* msg) {
+    if (msg->task.param().has_hot_key()) {
+      hot_.Update(msg->sender, SArray<K>(msg->key));
+      return;
+    }
     // only need to process pull response
     if (msg->task.param().push()) return;
 
@@ -86,18 +112,21 @@ class KVCache : public Customer {
             recv_key, recv_size, kv.key, &val_size, 1, AsOp::ASSIGN);
         CHECK_EQ(n, recv_size.size());
         kv.matched_num += n;
-        kv.recv.push_back(std::make_pair(recv_key[0], SArray<V>(msg->value[0])));
+        kv.recv.push_back(Recv{recv_key, recv_size, SArray<V>(msg->value[0])});
       }
 
       if (kv.matched_num != kv.key.size()) return;
 
       // CHECK_EQ(kv.matched_num, kv.key.size());
-      std::sort(kv.recv.begin(), kv.recv.end(), [](
-          const std::pair<K, SArray<V>>& a, const std::pair<K, SArray<V>>& b) {
-                  return a.first < b.first;
-                });
+      std::sort(kv.recv.begin(), kv.recv.end(), [](const Recv& a, const Recv& b) {
+          return a.key[0] < b.key[0];
+        });
       size_t len = 0;
-      for (const auto& l : kv.recv) len += l.second.size();
+      bool overlap = false;
+      for (size_t i = 0; i < kv.recv.size(); ++i) {
+        len += kv.recv[i].val.size();
+        if (i && kv.recv[i].key[0] <= kv.recv[i-1].key.back()) overlap = true;
+      }
       V* ptr = NULL;
       if (kv.val_vec) {
         kv.val_vec->resize(len);
@@ -106,9 +135,28 @@ class KVCache : public Customer {
         CHECK_EQ(kv.len_val, len);
         ptr = kv.val;
       }
-      for (const auto& l : kv.recv) {
-        memcpy(ptr, l.second.data(), l.second.size() * sizeof(V));
-        ptr += l.second.size();
+      if (overlap) {
+        // the hot keys were sent to their replicas, place the values by keys
+        std::vector<size_t> off(kv.key.size() + 1, 0);
+        for (size_t i = 0; i < kv.key.size(); ++i) {
+          off[i+1] = off[i] + kv.val_size[i];
+        }
+        for (const auto& l : kv.recv) {
+          size_t j = 0, p = 0;
+          for (size_t t = 0; t < l.key.size(); ++t) {
+            j = std::lower_bound(kv.key.begin() + j, kv.key.end(), l.key[t]) -
+                kv.key.begin();
+            CHECK_LT(j, kv.key.size());
+            memcpy(ptr + off[j], l.val.data() + p, l.size[t] * sizeof(V));
+            p += l.size[t];
+            ++ j;
+          }
+        }
+      } else {
+        for (const auto& l : kv.recv) {
+          memcpy(ptr, l.val.data(), l.val.size() * sizeof(V));
+          ptr += l.val.size();
+        }
       }
       kv.recv.clear();
     } else {
@@ -139,6 +187,7 @@ class KVCache : public Customer {
                    V* vals, size_t len_vals, std::vector<V>* vals_vec,
                    int* vals_size) {
     CHECK(IsKeysOrderd(keys)) << "keys must in non-decreasing order";
+    if (hot_refresh_usec_) RefreshHotKeys();
     Message msg(req, kServerGroup);
 
     mu_.lock();
@@ -186,6 +235,21 @@ class KVCache : public Customer {
     return Submit(&msg);
   }
 
+  /// pulls the hot keys from the servers if the last pull is too old
+  void RefreshHotKeys() {
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t last = hot_time_;
+    if (now - last < hot_refresh_usec_ ||
+        !hot_time_.compare_exchange_strong(last, now)) {
+      return;
+    }
+    Message msg(Task(), kServerGroup);
+    msg.task.mutable_param()->set_push(false);
+    msg.task.mutable_param()->set_hot_key(ParamCall::HOT_KEYS);
+    Submit(&msg);
+  }
+
   inline bool IsKeysOrderd(const SArray<K>& keys) {
     for (size_t i = 0; i < keys.size() -1 ; ++i) {
       if (keys[i+1] < keys[i]) { return false; }
@@ -193,6 +257,13 @@ class KVCache : public Customer {
     return true;
   }
 
+  // a dynamic length pull response
+  struct Recv {
+    SArray<K> key;
+    SArray<int> size;
+    SArray<V> val;
+  };
+
   struct KVPair {
     // [key_0,  ..., key_n]
     SArray<K> key;
@@ -207,7 +278,7 @@ class KVCache : public Customer {
     int* val_size = NULL;
 
     // for match dynamic vals
-    std::vector<std::pair<K, SArray<V>>> recv;
+    std::vector<Recv> recv;
 
     int recv_num = 0;
     size_t matched_num = 0;
@@ -216,6 +287,11 @@ class KVCache : public Customer {
   std::unordered_map<int, KVPair> pull_data_;
   std::mutex mu_;
   int chl_ = 0;
+
+  // the hot key replication, see ReplicateHotKeys
+  KVHotKeyRouter<K> hot_;
+  int64_t hot_refresh_usec_ = 0;
+  std::atomic<int64_t> hot_time_{0};
 };
 
 }  // namespace ps
@@ -0,0 +1,294 @@
+/**
+ * @file   kv_cold_tier.h
+ * @brief  Spills the cold entries of a KV store into a memory-mapped file
+ */
+#pragma once
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string>
+#include <type_traits>
+#include "dmlc/io.h"
+#include "dmlc/memory_io.h"
+#include "base/flat_hash_map.h"
+namespace ps {
+
+/**
+ * \brief The configuration of the two-tier storage of a KV store
+ */
+struct KVTierConf {
+  /// the prefix of the files storing the cold entries, on a local SSD. empty
+  /// disables the cold tier
+  std::string path;
+  /// the number of entries kept in RAM, the least recently pushed ones beyond
+  /// it are demoted into the files
+  size_t hot_keys = 0;
+
+  bool enabled() const { return path.size() > 0; }
+};
+
+/**
+ * \brief The statistics of the two-tier storage
+ */
+struct KVTierStats {
+  /// the number of pushed and pulled keys found in RAM
+  size_t hot = 0;
+  /// the number of keys found in the file, which are promoted into RAM
+  size_t cold = 0;
+  /// the number of keys found in neither
+  size_t miss = 0;
+  /// the number of entries demoted into the file
+  size_t demoted = 0;
+  /// the number of pulled keys
+  size_t pulled = 0;
+  /// the seconds pulls spent on looking up and promoting keys
+  double pull_sec = 0;
+  /// the number of entries in the file
+  size_t cold_keys = 0;
+  /// the size of the file, including records of promoted entries
+  size_t file_bytes = 0;
+
+  KVTierStats& operator+=(const KVTierStats& s) {
+    hot += s.hot; cold += s.cold; miss += s.miss; demoted += s.demoted;
+    pulled += s.pulled; pull_sec += s.pull_sec;
+    cold_keys += s.cold_keys; file_bytes += s.file_bytes;
+    return *this;
+  }
+
+  /// \brief returns a log line of the changes since \a last
+  std::string Print(const KVTierStats& last) const {
+    double n = (hot - last.hot) + (cold - last.cold) + (miss - last.miss);
+    double m = pulled - last.pulled;
+    char buf[256];
+    snprintf(buf, 256, "tier: hot %.2f%%, cold %.2f%%, miss %.2f%%, "
+             "demoted %zu, %zu cold keys in %.1f MB, pull +%.3f usec/key",
+             n > 0 ? (hot - last.hot) / n * 100 : 0,
+             n > 0 ? (cold - last.cold) / n * 100 : 0,
+             n > 0 ? (miss - last.miss) / n * 100 : 0,
+             demoted - last.demoted, cold_keys, file_bytes / 1e6,
+             m > 0 ? (pull_sec - last.pull_sec) / m * 1e6 : 0);
+    return std::string(buf);
+  }
+};
+
+/**
+ * \brief value is true if \a E implements `void Reload(dmlc::Stream*)`, which
+ * is \a Load without side effects such as updating statistics
+ */
+template <typename E>
+class HasReload {
+  template <typename T> static auto Test(int) -> decltype(
+      std::declval<T&>().Reload((dmlc::Stream*)0), std::true_type());
+  template <typename T> static std::false_type Test(...);
+ public:
+  static const bool value = decltype(Test<E>(0))::value;
+};
+
+/**
+ * \brief The cold tier of a bucket: an append-only file with an in-memory index
+ *
+ * An entry is demoted by appending the bytes of its `Save` into the file, and
+ * is promoted by reading them back through `Reload` (or `Load`) and dropping
+ * the record from the index. Appends are buffered, and reads go through a
+ * memory mapping of the file, so a promotion costs one page fault at most. The
+ * records of promoted entries are garbage, and the file is rewritten when they
+ * take more than half of it.
+ *
+ * The file is a cache, it is removed when the tier is destroyed. It is not
+ * thread-safe, use one per bucket.
+ */
+template <typename K, typename E>
+class KVColdTier {
+ public:
+  KVColdTier() { }
+  ~KVColdTier() { Close(); }
+
+  KVColdTier(KVColdTier&& t) { *this = std::move(t); }
+  KVColdTier& operator=(KVColdTier&& t) {
+    if (this == &t) return *this;
+    Close();
+    index_ = std::move(t.index_); file_ = std::move(t.file_);
+    wbuf_ = std::move(t.wbuf_); stats_ = t.stats_;
+    fd_ = t.fd_; map_ = t.map_; map_size_ = t.map_size_;
+    file_size_ = t.file_size_; live_ = t.live_;
+    t.fd_ = -1; t.map_ = nullptr; t.map_size_ = 0;
+    return *this;
+  }
+  KVColdTier(const KVColdTier&) = delete;
+  KVColdTier& operator=(const KVColdTier&) = delete;
+
+  /// \brief creates the file, truncating it if exists
+  void Open(const std::string& file) {
+    Close();
+    file_ = file;
+    fd_ = open(file_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    CHECK_GE(fd_, 0) << "failed to open " << file_;
+  }
+
+  bool enabled() const { return fd_ >= 0; }
+
+  /// \brief appends the entry of key \a k, which must not be in the file
+  void Put(K k, const E& e) {
+    size_t off = file_size_ + wbuf_.size();
+    dmlc::MemoryStringStream fo(&wbuf_);
+    fo.Seek(wbuf_.size());
+    e.Save(&fo);
+    Record r; r.off = off; r.len = file_size_ + wbuf_.size() - off;
+    index_[k] = r;
+    live_ += r.len;
+    ++ stats_.demoted;
+    if (wbuf_.size() >= kFlushBytes) Flush();
+  }
+
+  /**
+   * \brief moves the entry of key \a k out of the file into \a e
+   *
+   * @return false if \a k is not in the file
+   */
+  bool Take(K k, E* e) {
+    auto it = index_.find(k);
+    if (it == index_.end()) return false;
+    Read(it->second, e);
+    live_ -= it->second.len;
+    index_.erase(it);
+    ++ stats_.cold;
+    if (file_size_ + wbuf_.size() > kMinRewriteBytes + 2 * live_) Rewrite();
+    return true;
+  }
+
+  /// \brief calls f(key, entry) for every entry in the file
+  template <typename F>
+  void ForEach(const F& f) const {
+    for (const auto& it : index_) {
+      E e;
+      Read(it.second, &e);
+      f(it.first, e);
+    }
+  }
+
+  /// \brief removes the entry of key \a k if it is in the file
+  void Erase(K k) {
+    auto it = index_.find(k);
+    if (it == index_.end()) return;
+    live_ -= it->second.len;
+    index_.erase(it);
+  }
+
+  /// \brief calls f(key) for every key in the file
+  template <typename F>
+  void ForEachKey(const F& f) const {
+    for (const auto& it : index_) f(it.first);
+  }
+
+  /**
+   * \brief reads the entry of key \a k into \a e, and keeps it in the file
+   *
+   * @return false if \a k is not in the file
+   */
+  bool Get(K k, E* e) const {
+    auto it = index_.find(k);
+    if (it == index_.end()) return false;
+    Read(it->second, e);
+    return true;
+  }
+
+  /// \brief the statistics, the pull fields are updated by the caller
+  KVTierStats& stats() {
+    stats_.cold_keys = index_.size();
+    stats_.file_bytes = file_size_ + wbuf_.size();
+    return stats_;
+  }
+
+ private:
+  static const size_t kFlushBytes = 1 << 22;
+  static const size_t kMinRewriteBytes = 1 << 26;
+
+  struct Record {
+    uint64 off;
+    uint32 len;
+  };
+
+  void Read(const Record& r, E* e) const {
+    dmlc::MemoryFixedSizeStream fi(const_cast<char*>(Data(r)), r.len);
+    Load(&fi, e, std::integral_constant<bool, HasReload<E>::value>());
+  }
+  static void Load(dmlc::Stream* fi, E* e, std::true_type) { e->Reload(fi); }
+  static void Load(dmlc::Stream* fi, E* e, std::false_type) { e->Load(fi); }
+
+  /// returns the bytes of a record, mapping the file again if it has grown
+  const char* Data(const Record& r) const {
+    if (r.off >= file_size_) return wbuf_.data() + (r.off - file_size_);
+    if (r.off + r.len > map_size_) {
+      if (map_) munmap(map_, map_size_);
+      map_size_ = file_size_;
+      map_ = (char*)mmap(NULL, map_size_, PROT_READ, MAP_SHARED, fd_, 0);
+      CHECK(map_ != MAP_FAILED) << "failed to map " << file_;
+    }
+    return map_ + r.off;
+  }
+
+  void Flush() {
+    Write(fd_, wbuf_);
+    file_size_ += wbuf_.size();
+    wbuf_.clear();
+  }
+
+  static void Write(int fd, const std::string& buf) {
+    for (size_t n = 0; n < buf.size(); ) {
+      ssize_t w = write(fd, buf.data() + n, buf.size() - n);
+      CHECK_GT(w, 0) << "failed to write the cold tier";
+      n += w;
+    }
+  }
+
+  /// copies the live records into a new file
+  void Rewrite() {
+    std::string tmp = file_ + ".tmp";
+    int fd = open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    CHECK_GE(fd, 0) << "failed to open " << tmp;
+    std::string buf;
+    size_t size = 0;
+    for (auto& it : index_) {
+      Record& r = it.second;
+      buf.append(Data(r), r.len);
+      r.off = size + buf.size() - r.len;
+      if (buf.size() >= kFlushBytes) {
+        Write(fd, buf); size += buf.size(); buf.clear();
+      }
+    }
+    Write(fd, buf); size += buf.size();
+    if (map_) munmap(map_, map_size_);
+    map_ = nullptr; map_size_ = 0;
+    close(fd_);
+    CHECK_EQ(rename(tmp.c_str(), file_.c_str()), 0) << "failed to rename " << tmp;
+    fd_ = fd;
+    file_size_ = size;
+    wbuf_.clear();
+    live_ = size;
+  }
+
+  void Close() {
+    if (map_) munmap(map_, map_size_);
+    if (fd_ >= 0) { close(fd_); unlink(file_.c_str()); }
+    fd_ = -1; map_ = nullptr; map_size_ = 0;
+    index_.clear(); wbuf_.clear();
+    file_size_ = live_ = 0;
+  }
+
+  FlatHashMap<K, Record> index_;
+  std::string file_;
+  int fd_ = -1;
+  /// the mapping of the first map_size_ bytes of the file
+  mutable char* map_ = nullptr;
+  mutable size_t map_size_ = 0;
+  /// the bytes written into the file
+  size_t file_size_ = 0;
+  /// the appended bytes not written yet
+  std::string wbuf_;
+  /// the bytes of the records in the index
+  size_t live_ = 0;
+  KVTierStats stats_;
+};
+
+}  // namespace ps
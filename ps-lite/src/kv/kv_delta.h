@@ -0,0 +1,162 @@
+/**
+ * @file   kv_delta.h
+ * @brief  Incremental checkpoints of a KV store
+ */
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+#include "kv/kv_indexed_file.h"
+namespace ps {
+
+/**
+ * \brief The keys of a bucket changed since the last checkpoint
+ *
+ * The keys of a push are appended into a log, which is a sequential write even
+ * for large pushes. The log is sorted and deduplicated when it doubles since
+ * the last time, so it takes at most twice the memory of the changed keys, and
+ * the amortized cost per key is small. It is not thread-safe, use one per
+ * bucket.
+ */
+template <typename K>
+class KVDirtyKeys {
+ public:
+  void Enable() { enabled_ = true; }
+
+  bool enabled() const { return enabled_; }
+
+  /// \brief marks key[0, n) as changed
+  void Add(size_t n, const K* key) {
+    if (!enabled_) return;
+    key_.insert(key_.end(), key, key + n);
+    if (key_.size() > 2 * unique_ + kMinKeys) Dedup();
+  }
+
+  void Add(K key) { Add(1, &key); }
+
+  /// \brief returns the sorted changed keys, and then clears them
+  std::vector<K> Take() {
+    Dedup();
+    std::vector<K> key;
+    key.swap(key_);
+    unique_ = 0;
+    return key;
+  }
+
+  void Clear() { std::vector<K>().swap(key_); unique_ = 0; }
+
+ private:
+  static const size_t kMinKeys = 1 << 16;
+
+  /// key_[0, unique_) is sorted and unique already
+  void Dedup() {
+    auto mid = key_.begin() + unique_;
+    std::sort(mid, key_.end());
+    std::inplace_merge(key_.begin(), mid, key_.end());
+    key_.erase(std::unique(key_.begin(), key_.end()), key_.end());
+    unique_ = key_.size();
+  }
+
+  bool enabled_ = false;
+  std::vector<K> key_;
+  size_t unique_ = 0;
+};
+
+/**
+ * \brief returns the parent of an indexed model, which is empty if it is not a
+ * delta, and the offset of the handle state in its meta in \a handle_off
+ */
+inline std::string KVDeltaParent(const KVIndexedFile& file, size_t* handle_off) {
+  size_t len;
+  const char* meta = file.meta(&len);
+  std::string parent;
+  *handle_off = 0;
+  if (file.delta()) {
+    dmlc::MemoryFixedSizeStream fi(const_cast<char*>(meta), len);
+    CHECK(static_cast<dmlc::Stream*>(&fi)->Read(&parent))
+        << "corrupted delta " << file.name();
+    *handle_off = fi.Tell();
+  }
+  return parent;
+}
+
+/// \brief returns the models of the delta chain ending at \a name, from the
+/// base to \a name
+inline std::vector<std::string> KVDeltaChain(const std::string& name) {
+  std::vector<std::string> chain;
+  for (std::string m = name; m.size(); ) {
+    chain.push_back(m);
+    if (!IsIndexedModel(m)) break;
+    KVIndexedFile file;
+    file.Open(m);
+    if (!file.delta()) break;
+    size_t off;
+    m = KVDeltaParent(file, &off);
+  }
+  std::reverse(chain.begin(), chain.end());
+  return chain;
+}
+
+/**
+ * \brief Folds the delta chain ending at \a name into one indexed model \a out
+ *
+ * The models of the chain are merged by their sorted keys without parsing the
+ * values, the newest value of a key is kept, and the deleted keys are dropped.
+ * The handle state is the one of \a name. So the base of the chain must be an
+ * indexed model, or a delta of an empty model.
+ *
+ * @return the number of KV pairs in \a out
+ */
+inline size_t FoldDeltas(const std::string& name, const std::string& out) {
+  auto chain = KVDeltaChain(name);
+  int n = chain.size();
+  std::vector<std::unique_ptr<KVIndexedFile>> file(n);
+  for (int i = 0; i < n; ++i) {
+    CHECK(IsIndexedModel(chain[i])) << chain[i] << " is not an indexed model, "
+                                    << "save the base with index_model";
+    file[i].reset(new KVIndexedFile());
+    file[i]->Open(chain[i]);
+    CHECK_EQ(file[i]->key_bytes(), file[0]->key_bytes());
+  }
+  std::unique_ptr<dmlc::Stream> fo(
+      CHECK_NOTNULL(dmlc::Stream::Create(out.c_str(), "w")));
+  KVIndexedWriter writer(fo.get(), file[0]->key_bytes());
+  {
+    size_t len, off;
+    KVDeltaParent(*file[n-1], &off);
+    const char* meta = file[n-1]->meta(&len);
+    writer.meta()->Write(meta + off, len - off);
+  }
+
+  // a heap of (key, n-1-i) for the next key of file i, so the newest file
+  // comes first among the same keys
+  typedef std::pair<uint64, int> Item;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> heap;
+  std::vector<size_t> pos(n, 0);
+  auto next = [&](int i) {
+    if (pos[i] < file[i]->size()) heap.push(Item(file[i]->key(pos[i]), n-1-i));
+  };
+  for (int i = 0; i < n; ++i) next(i);
+  while (!heap.empty()) {
+    uint64 key = heap.top().first;
+    int i = n - 1 - heap.top().second;
+    heap.pop();
+    size_t len;
+    const char* val = file[i]->value(pos[i], &len);
+    if (len) writer.AddRaw(key, val, len);
+    ++ pos[i]; next(i);
+    // skip the older values of the key
+    while (!heap.empty() && heap.top().first == key) {
+      int j = n - 1 - heap.top().second;
+      heap.pop();
+      ++ pos[j]; next(j);
+    }
+  }
+  return writer.Finish();
+}
+
+}  // namespace ps
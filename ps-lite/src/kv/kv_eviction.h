@@ -0,0 +1,248 @@
+/**
+ * @file   kv_eviction.h
+ * @brief  Evicts the keys of a KV store which have not been requested for long
+ */
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "dmlc/io.h"
+#include "dmlc/memory_io.h"
+#include "base/flat_hash_map.h"
+#include "kv/kv_cold_tier.h"
+#include "kv/kv_delta.h"
+namespace ps {
+
+/**
+ * \brief The eviction policy of a KV store
+ */
+struct KVEvictionConf {
+  /// evict the keys not pushed or pulled for ttl ticks, 0 disables it
+  int ttl = 0;
+  /// the seconds of a tick
+  int tick_sec = 3600;
+  /// if not 0, a tick is this number of requested keys rather than tick_sec
+  size_t tick_keys = 0;
+  /// evict the least recently requested keys if the store has more keys, 0
+  /// disables it
+  size_t max_keys = 0;
+  /// if not NULL, the evicted KV pairs are appended into it in the format of
+  /// \ref KVStore::Save
+  dmlc::Stream* archive = nullptr;
+
+  bool enabled() const { return ttl > 0 || max_keys > 0; }
+};
+
+/**
+ * \brief value is true if \a E has a member `uint16 touched`
+ */
+template <typename E>
+class HasTouched {
+  template <typename T> static auto Test(int) -> decltype(
+      std::declval<T&>().touched = (uint16)0, std::true_type());
+  template <typename T> static std::false_type Test(...);
+ public:
+  static const bool value = decltype(Test<E>(0))::value;
+};
+
+/**
+ * \brief Evicts the keys of a bucket by the time they are last requested
+ *
+ * The entry \a E keeps the tick it was last pushed or pulled in a `uint16
+ * touched` member, which is set by \ref Touch. A tick is a coarse wall clock
+ * period, or a number of requested keys, and the age of an entry is `now - touched` in 16-bit
+ * arithmetic.
+ *
+ * The bucket is swept incrementally: each \ref Step visits a few slots of the
+ * table after the previous step, and evicts the visited entries whose age is
+ * not smaller than the cutoff. The cutoff is the TTL, lowered to the age of the
+ * least recently requested keys if the bucket has more than `max_keys` keys. The
+ * latter is estimated from the histogram of the ages in the previous sweep, so
+ * it is an approximate LRU which needs no list.
+ *
+ * The evicted entries are either dropped, optionally archived, or demoted into
+ * a \ref KVColdTier.
+ *
+ * It is not thread-safe, use one per bucket.
+ */
+template <typename K, typename E, typename Map>
+class KVEviction {
+ public:
+  /**
+   * @param conf the policy, with max_keys for this bucket
+   * @param bucket the bucket id, for logging
+   * @param archive_mu the lock of conf.archive, shared by all buckets
+   * @param cold if not NULL, the evicted entries are demoted into it
+   */
+  void Init(const KVEvictionConf& conf, int bucket, std::mutex* archive_mu,
+            KVColdTier<K, E>* cold = nullptr) {
+    conf_ = conf;
+    bucket_ = bucket;
+    cold_ = cold;
+    if (!conf_.enabled()) return;
+    CHECK(HasTouched<E>::value) << "the entry has no touched member";
+    CHECK_LT(conf_.ttl, 1 << 16);
+    CHECK_GT(conf_.tick_sec, 0);
+    archive_mu_ = archive_mu;
+    start_ = std::chrono::steady_clock::now();
+    hist_.assign(kBins, 0);
+  }
+
+  bool enabled() const { return conf_.enabled(); }
+
+  /// \brief records the keys evicted without a cold tier into \a dirty, since
+  /// they are deleted from the model
+  void set_dirty(KVDirtyKeys<K>* dirty) { dirty_ = dirty; }
+
+  /// \brief updates the clock, called before a push or a pull of \a n keys
+  void Tick(size_t n) {
+    if (!enabled()) return;
+    if (conf_.tick_keys) {
+      pushed_ += n;
+      now_ = (uint16)(pushed_ / conf_.tick_keys);
+      return;
+    }
+    auto sec = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - start_).count();
+    now_ = (uint16)(sec / conf_.tick_sec);
+  }
+
+  /// \brief marks \a e as requested now
+  PS_ALWAYS_INLINE void Touch(E& e) const {
+    Touch(e, std::integral_constant<bool, HasTouched<E>::value>());
+  }
+
+  /**
+   * \brief sweeps the next slots of \a data after a request of \a n keys
+   *
+   * The number of slots visited is proportional to \a n, so the keys are
+   * swept faster than new keys are inserted.
+   */
+  void Step(Map* data, size_t n) {
+    size_t m = n * kSweepRatio + kMinSweep;
+    int cutoff = conf_.ttl > 0 ? std::min(conf_.ttl, lru_cutoff_) : lru_cutoff_;
+    dmlc::MemoryStringStream fo(&buf_);
+    auto evict = [this, cutoff, &fo](K key, E& e) {
+      uint16 age = now_ - Touched(e);
+      if (age >= cutoff) {
+        if (cold_) {
+          cold_->Put(key, e);
+        } else {
+          if (conf_.archive) { fo.Write(&key, sizeof(K)); e.Save(&fo); }
+          if (dirty_) dirty_->Add(key);
+        }
+        ++ evicted_;
+        return true;
+      }
+      ++ hist_[std::min<int>(age, kBins - 1)];
+      return false;
+    };
+    if (Sweep(data, &cursor_, m, evict)) EndSweep(*data);
+    if (buf_.size()) {
+      std::lock_guard<std::mutex> lk(*archive_mu_);
+      conf_.archive->Write(buf_.data(), buf_.size());
+      buf_.clear();
+    }
+  }
+
+ private:
+  /// ages not smaller than kBins - 1 ticks share the last bin
+  static const int kBins = 1024;
+  static const size_t kSweepRatio = 4;
+  static const size_t kMinSweep = 64;
+
+  void Touch(E& e, std::true_type) const { e.touched = now_; }
+  void Touch(E& e, std::false_type) const { }
+
+  static uint16 Touched(const E& e) {
+    return Touched(e, std::integral_constant<bool, HasTouched<E>::value>());
+  }
+  template <typename T>
+  static uint16 Touched(const T& e, std::true_type) { return e.touched; }
+  template <typename T>
+  static uint16 Touched(const T& e, std::false_type) { return 0; }
+
+  /// computes the LRU cutoff of the next sweep from the histogram of the keys
+  /// kept in this one
+  void EndSweep(const Map& data) {
+    size_t size = data.size();
+    lru_cutoff_ = 1 << 16;
+    if (conf_.max_keys > 0 && size > conf_.max_keys) {
+      // evict the oldest keys until 90% of max_keys are left
+      size_t excess = size - conf_.max_keys * 9 / 10, old = 0;
+      int b = kBins - 1;
+      for (; b > 1; --b) {
+        old += hist_[b];
+        if (old >= excess) break;
+      }
+      lru_cutoff_ = b;
+    }
+    if (evicted_ && !cold_) {
+      LOG(INFO) << "bucket " << bucket_ << ": evicted " << evicted_
+                << " keys in the last sweep, " << size << " left";
+    }
+    evicted_ = 0;
+    hist_.assign(kBins, 0);
+  }
+
+  /// visits the next \a n buckets of a std::unordered_map, returns true if a
+  /// sweep is finished
+  template <typename M, typename F>
+  bool Sweep(M* data, size_t* cursor, size_t n, const F& evict) {
+    size_t end = data->bucket_count();
+    if (*cursor >= end) *cursor = 0;
+    size_t stop = std::min(*cursor + n, end);
+    for (size_t b = *cursor; b < stop; ++b) {
+      for (auto it = data->begin(b); it != data->end(b); ++it) {
+        if (evict(it->first, it->second)) key_.push_back(it->first);
+      }
+    }
+    for (K k : key_) data->erase(k);
+    key_.clear();
+    *cursor = stop;
+    return stop == end;
+  }
+
+  /// visits the next \a n slots of a FlatHashMap
+  template <typename F>
+  bool Sweep(FlatHashMap<K, E>* data, size_t* cursor, size_t n,
+             const F& evict) {
+    typedef typename FlatHashMap<K, E>::iterator Iter;
+    size_t end = data->capacity() + 1;
+    if (*cursor >= end) *cursor = 0;
+    size_t stop = std::min(*cursor + n, end);
+    for (Iter it(data, *cursor); it.pos() < stop; ) {
+      if (evict(it->first, it->second)) {
+        it = data->erase(it);
+      } else {
+        ++ it;
+      }
+    }
+    *cursor = stop;
+    return stop == end;
+  }
+
+  KVEvictionConf conf_;
+  int bucket_ = 0;
+  std::mutex* archive_mu_ = nullptr;
+  KVColdTier<K, E>* cold_ = nullptr;
+  KVDirtyKeys<K>* dirty_ = nullptr;
+  std::chrono::steady_clock::time_point start_;
+  uint16 now_ = 0;
+  size_t pushed_ = 0;
+  /// the next slot to visit
+  size_t cursor_ = 0;
+  /// the LRU cutoff age of the current sweep, 2^16 if not limited
+  int lru_cutoff_ = 1 << 16;
+  /// the histogram of the ages of the keys kept in the current sweep
+  std::vector<size_t> hist_;
+  size_t evicted_ = 0;
+  /// the keys to evict from a std::unordered_map
+  std::vector<K> key_;
+  /// the evicted KV pairs to append into the archive
+  std::string buf_;
+};
+
+}  // namespace ps
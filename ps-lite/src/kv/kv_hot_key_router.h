@@ -0,0 +1,149 @@
+/**
+ * @file   kv_hot_key_router.h
+ * @brief  Sends the hot keys of the requests of a worker to their replicas
+ */
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ps/shared_array.h"
+#include "system/message.h"
+namespace ps {
+
+/**
+ * \brief Routes the hot keys of the requests of a worker to their replicas
+ *
+ * The servers reply the hot keys they replicate, and a hot key is sent to the
+ * server `(Hash(key) + rank) % num_servers`, so the workers with different
+ * ranks spread the pulls and pushes of the key over all servers. The other
+ * keys are sent to their owners as \ref SliceMessage does. It is thread-safe.
+ */
+template <typename K>
+class KVHotKeyRouter {
+ public:
+  /// \brief sets the hot keys replied by \a server
+  void Update(const std::string& server, const SArray<K>& keys) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto& k = server_keys_[server];
+    if (k.size() == keys.size() && std::equal(k.begin(), k.end(), keys.begin())) {
+      return;
+    }
+    k.assign(keys.begin(), keys.end());
+    std::shared_ptr<std::vector<K>> all(new std::vector<K>());
+    for (const auto& it : server_keys_) {
+      all->insert(all->end(), it.second.begin(), it.second.end());
+    }
+    std::sort(all->begin(), all->end());
+    keys_ = all;
+  }
+
+  /**
+   * \brief slices a push or pull \a msg as \ref SliceMessage does, but sends
+   * the hot keys to their replicas. Returns false without changing \a rets if
+   * \a msg has no hot key.
+   */
+  bool Slice(const Message& msg, const std::vector<Range<Key>>& krs,
+             int rank, std::vector<Message*>* rets) {
+    std::shared_ptr<const std::vector<K>> hot;
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      hot = keys_;
+    }
+    SArray<K> key(msg.key);
+    size_t n = key.size(), ns = krs.size();
+    if (!hot || hot->empty() || n == 0 || ns < 2) return false;
+
+    // the receiver of each key
+    dst_.resize(n);
+    bool found = false;
+    size_t s = 0, h = 0;
+    for (size_t i = 0; i < n; ++i) {
+      K k = key[i];
+      while (s + 1 < ns && (Key)k >= krs[s].end()) ++ s;
+      while (h < hot->size() && (*hot)[h] < k) ++ h;
+      if (h < hot->size() && (*hot)[h] == k) {
+        dst_[i] = (Hash(k) + rank) % ns;
+        found = true;
+      } else {
+        dst_[i] = s;
+      }
+    }
+    if (!found) return false;
+
+    std::vector<size_t> cnt(ns, 0);
+    for (size_t i = 0; i < n; ++i) ++ cnt[dst_[i]];
+    for (size_t r = 0; r < ns; ++r) {
+      Message* ret = CHECK_NOTNULL((*rets)[r]);
+      ret->valid = cnt[r] > 0;
+      if (!ret->valid) continue;
+      SArray<K> k(cnt[r]);
+      for (size_t i = 0, j = 0; i < n; ++i) if (dst_[i] == r) k[j++] = key[i];
+      ret->set_key(k);
+    }
+
+    if (msg.task.param().dyn_val_size()) {
+      CHECK_EQ(msg.value.size() % 2, (size_t)0);
+      for (size_t v = 0; v < msg.value.size(); v += 2) {
+        SArray<int> len(msg.value[v+1]);
+        size_t total = 0;
+        for (int l : len) total += l;
+        size_t k = total ? msg.value[v].size() / total : 0;
+        CHECK_EQ(total * k, msg.value[v].size());
+        SliceValue(msg.value[v], len.data(), k, ns, rets);
+        std::vector<int> ones(n, 1);
+        SliceValue(msg.value[v+1], ones.data(), sizeof(int), ns, rets);
+      }
+    } else {
+      std::vector<int> ones(n, 1);
+      for (const auto& v : msg.value) {
+        size_t k = v.size() / n;
+        CHECK_EQ(k * n, v.size());
+        SliceValue(v, ones.data(), k, ns, rets);
+      }
+    }
+    return true;
+  }
+
+ private:
+  static uint32 Hash(K k) {
+    uint64 h = (uint64)k * 0x9E3779B97F4A7C15ULL;
+    return (uint32)(h >> 32);
+  }
+
+  /// appends the value pieces of the keys of each receiver, where key i has
+  /// len[i] * k bytes
+  void SliceValue(const SArray<char>& val, const int* len, size_t k, size_t ns,
+                  std::vector<Message*>* rets) const {
+    size_t n = dst_.size();
+    std::vector<size_t> bytes(ns, 0);
+    for (size_t i = 0; i < n; ++i) bytes[dst_[i]] += len[i] * k;
+    std::vector<SArray<char>> out(ns);
+    std::vector<char*> ptr(ns);
+    for (size_t r = 0; r < ns; ++r) {
+      out[r].resize(bytes[r]);
+      ptr[r] = out[r].data();
+    }
+    const char* p = val.data();
+    for (size_t i = 0; i < n; ++i) {
+      size_t b = len[i] * k;
+      memcpy(ptr[dst_[i]], p, b);
+      ptr[dst_[i]] += b; p += b;
+    }
+    for (size_t r = 0; r < ns; ++r) {
+      if ((*rets)[r]->valid) (*rets)[r]->value.push_back(out[r]);
+    }
+  }
+
+  std::mutex mu_;
+  std::map<std::string, std::vector<K>> server_keys_;
+  std::shared_ptr<const std::vector<K>> keys_;
+  /// the receiver of each key, only used in Slice which is called under the
+  /// lock of the executor
+  std::vector<size_t> dst_;
+};
+
+}  // namespace ps
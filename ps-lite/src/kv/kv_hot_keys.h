@@ -0,0 +1,243 @@
+/**
+ * @file   kv_hot_keys.h
+ * @brief  Replicates the hot keys of a server on the other servers
+ */
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "ps/blob.h"
+#include "base/countmin.h"
+#include "base/flat_hash_map.h"
+#include "system/message.h"
+#include "kv/kv_cold_tier.h"
+#include "kv/kv_aggregator.h"
+namespace ps {
+
+/**
+ * \brief The configuration of the hot key replication, see \ref
+ * KVStore::SetHotKeys
+ */
+struct KVHotKeyConf {
+  /// the maximal number of hot keys of a server, 0 disables it
+  size_t max_keys = 0;
+  /// a key is hot if it is pulled by at least this fraction of the pull
+  /// requests a server receives from workers
+  double min_share = 0.05;
+  /// the seconds of a round
+  int round_sec = 10;
+  /// the counters of the sketch of a bucket
+  int sketch_size = 1 << 16;
+
+  bool enabled() const { return max_keys > 0; }
+};
+
+/**
+ * \brief The pulls a server served in a round of the hot key replication
+ */
+struct KVHotKeyStats {
+  /// the pulled keys it owns
+  size_t own = 0;
+  /// the pulled keys served by its replicas of the other servers' hot keys
+  size_t replica = 0;
+  /// the pulled keys not found in its replicas, which got the default entry
+  size_t miss = 0;
+  /// the pulls of its own hot keys served by the replicas on the others
+  size_t remote = 0;
+
+  /**
+   * \brief returns a log line of the load in a round of \a sec seconds, and
+   * the load it would have without replication, i.e. own + remote
+   */
+  std::string Print(double sec, size_t hot, size_t published) const {
+    sec = std::max(sec, 1e-3);
+    char buf[256];
+    snprintf(buf, 256, "hot keys: %zu hot, %zu replicated. load %.0f pulled "
+             "keys/sec (own %zu, replica %zu, miss %zu), %.0f without "
+             "replication (own %zu, remote %zu)", hot, published,
+             (own + replica) / sec, own, replica, miss,
+             (own + remote) / sec, own, remote);
+    return std::string(buf);
+  }
+};
+
+/**
+ * \brief Finds the heavy-hitter keys of a bucket by their pulls
+ *
+ * The pulls are counted by a count-min sketch with 32-bit counters, and a key
+ * whose count reaches the current threshold is kept as a candidate with its
+ * count. When the candidates are full, the ones below the threshold, which
+ * grows with the pull requests, are dropped. So the memory is fixed, and a key
+ * pulled by a large share of the requests is always found. It is not
+ * thread-safe, use one per bucket.
+ */
+template <typename K>
+class KVHeavyHitters {
+ public:
+  /**
+   * @param sketch_size the number of counters
+   * @param max_candidates the maximal number of candidates
+   */
+  void Init(int sketch_size, size_t max_candidates) {
+    sketch_size_ = sketch_size;
+    max_ = std::max(max_candidates, (size_t)1);
+    sketch_.resize(sketch_size_, 2, kMaxCount);
+    cand_.reserve(max_);
+  }
+
+  /// \brief counts \a w pulls of key \a k, and keeps it as a candidate if its
+  /// count reaches \a min_count
+  void Count(K k, uint32 w, uint32 min_count) {
+    sketch_.insert(k, w);
+    uint32 c = sketch_.query(k);
+    if (c < min_count) return;
+    auto it = cand_.find(k);
+    if (it != cand_.end()) {
+      it->second = c;
+      return;
+    }
+    if (cand_.size() >= max_) {
+      for (auto it = cand_.begin(); it != cand_.end(); ) {
+        it = it->second < min_count ? cand_.erase(it) : ++it;
+      }
+    }
+    if (cand_.size() < max_) cand_[k] = c;
+  }
+
+  /// \brief appends the candidates whose counts reach \a min_count into \a
+  /// out as (count, key), and starts counting again
+  void Take(uint32 min_count, std::vector<std::pair<uint32, K>>* out) {
+    for (const auto& it : cand_) {
+      if (it.second >= min_count) out->emplace_back(it.second, it.first);
+    }
+    cand_.clear();
+    cand_.reserve(max_);
+    sketch_.resize(sketch_size_, 2, kMaxCount);
+  }
+
+ private:
+  static const uint32 kMaxCount = 0xFFFFFFFF;
+  CountMin<K, uint32> sketch_;
+  FlatHashMap<K, uint32> cand_;
+  int sketch_size_ = 0;
+  size_t max_ = 0;
+};
+
+/**
+ * \brief The replicas of the hot keys of the other servers on a server
+ *
+ * An owner sends the entries of its hot keys every round, which replace the
+ * replicas. A key the owner stops sending is kept for \ref kRounds more
+ * rounds, since workers learn the change later. Pulls are served from the
+ * replicas, and the pushes are summed by a \ref KVAggregator and taken every
+ * round to forward to the owners, together with the number of pulls of each
+ * key. So a replica lags behind its owner by up to a round, as if the pushes
+ * were delayed.
+ *
+ * It is not thread-safe. The entries are created in the calling thread's
+ * bucket, see \ref KVStoreBucket.
+ */
+template <typename K, typename E, typename V, typename Handle, typename Map>
+class KVHotReplicas {
+ public:
+  /// \brief the rounds a key is kept after its owner stops sending it
+  static const int kRounds = 3;
+
+  /**
+   * \brief replaces the replicas of \a owner with the keys of a message, whose
+   * entry i is serialized in val[off[i], off[i+1])
+   */
+  void Update(const std::string& owner, size_t n, const K* key,
+              const char* val, const uint64* off) {
+    int o = Owner(owner);
+    for (size_t i = 0; i < n; ++i) {
+      dmlc::MemoryFixedSizeStream fi(const_cast<char*>(val + off[i]),
+                                     off[i+1] - off[i]);
+      Load(&fi, &data_[key[i]],
+           std::integral_constant<bool, HasReload<E>::value>());
+      age_[key[i]] = Age{o, -1};
+    }
+    // the keys not sent this time get older
+    for (auto it = age_.begin(); it != age_.end(); ) {
+      auto& a = it->second;
+      if (a.owner == o && ++ a.rounds > kRounds) {
+        data_.erase(it->first);
+        it = age_.erase(it);
+      } else {
+        ++ it;
+      }
+    }
+  }
+
+  /// \brief pulls key[i] into val[i] for i in [0, n), a key without replica
+  /// is pulled from the default entry
+  template <typename Batch>
+  void Pull(Handle& h, Batch& batch, size_t n, const K* key, Blob<V>* val) {
+    for (size_t i = 0; i < n; ++i) {
+      ++ pulls_[key[i]];
+      if (data_.find(key[i]) == data_.end()) ++ stats_.miss;
+    }
+    stats_.replica += n;
+    batch.Pull(h, data_, n, key, val);
+  }
+
+  /// \brief sums the pushes of val[i] into key[i] with \a cmd
+  void Push(int cmd, size_t n, const K* key, const Blob<const V>* val) {
+    if (std::find(cmds_.begin(), cmds_.end(), cmd) == cmds_.end()) {
+      cmds_.push_back(cmd);
+    }
+    aggr_.Add(cmd, n, key, val);
+  }
+
+  /// \brief calls f(cmd, n, key, val) with the summed pushes of each cmd, and
+  /// then clears them
+  template <typename F>
+  void TakePushes(const F& f) {
+    for (int cmd : cmds_) {
+      aggr_.Take(cmd, [&f, cmd](size_t n, const K* key, const Blob<const V>* val) {
+          f(cmd, n, key, val); });
+    }
+  }
+
+  /// \brief calls f(key, pulls) for each key pulled, and then clears them
+  template <typename F>
+  void TakePulls(const F& f) {
+    for (const auto& it : pulls_) f(it.first, it.second);
+    pulls_.clear();
+  }
+
+  size_t size() const { return data_.size(); }
+
+  KVHotKeyStats& stats() { return stats_; }
+
+ private:
+  struct Age {
+    int owner;
+    /// the rounds since the owner sent it last time
+    int rounds;
+  };
+
+  int Owner(const std::string& id) {
+    auto it = std::find(owners_.begin(), owners_.end(), id);
+    if (it != owners_.end()) return it - owners_.begin();
+    owners_.push_back(id);
+    return owners_.size() - 1;
+  }
+
+  static void Load(dmlc::Stream* fi, E* e, std::true_type) { e->Reload(fi); }
+  static void Load(dmlc::Stream* fi, E* e, std::false_type) { e->Load(fi); }
+
+  Map data_;
+  std::unordered_map<K, Age> age_;
+  std::vector<std::string> owners_;
+  std::unordered_map<K, uint32> pulls_;
+  KVAggregator<K, V> aggr_;
+  std::vector<int> cmds_;
+  KVHotKeyStats stats_;
+};
+
+}  // namespace ps
@@ -0,0 +1,426 @@
+/**
+ * @file   kv_indexed_file.h
+ * @brief  A model file with sorted keys and an index, which can be memory-mapped
+ */
+#pragma once
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dmlc/io.h"
+#include "dmlc/memory_io.h"
+#include "ps/base.h"
+namespace ps {
+
+/**
+ * \brief The header of an indexed model
+ *
+ * An indexed model is one file with the following sections:
+ *
+ * \code
+ * header   KVIndexedHeader
+ * meta     the state of the handle
+ * values   the values in the order of the keys, each in the format of its Save
+ * keys     num_keys sorted keys of key_bytes each
+ * offsets  num_keys+1 uint64, value i is the bytes [offsets[i], offsets[i+1])
+ * fences   keys[0], keys[fence_stride], keys[2*fence_stride], ...
+ * footer   KVIndexedFooter
+ * \endcode
+ *
+ * The arrays are 8-byte aligned in the file, so they can be used in place when
+ * the file is memory-mapped. The offsets of the sections are in the footer,
+ * so the file is written in one pass.
+ *
+ * If \ref kDelta is set in flags, the file only has the changes of a model
+ * relative to its parent model, see \ref KVDirtyKeys. The meta begins with the
+ * name of the parent as a string of dmlc serializer, and a value of zero bytes
+ * means the key is deleted.
+ */
+struct KVIndexedHeader {
+  uint32 magic = kMagic;
+  uint32 version = 1;
+  uint32 key_bytes = 8;
+  uint32 flags = 0;
+
+  static const uint32 kMagic = 0x5849564B;  // "KVIX"
+  static const uint32 kDelta = 1;
+};
+
+/**
+ * \brief The footer of an indexed model, see \ref KVIndexedHeader
+ */
+struct KVIndexedFooter {
+  uint64 num_keys = 0;
+  uint64 fence_stride = 0;
+  uint64 meta_off = 0;
+  uint64 values_off = 0;
+  uint64 keys_off = 0;
+  uint64 offsets_off = 0;
+  uint64 fences_off = 0;
+  uint32 magic = KVIndexedHeader::kMagic;
+  uint32 reserved = 0;
+};
+
+/// \brief returns true if \a name is an indexed model
+inline bool IsIndexedModel(const std::string& name) {
+  std::unique_ptr<dmlc::Stream> fi(
+      dmlc::Stream::Create(name.c_str(), "r", true));
+  KVIndexedHeader h;
+  return fi && fi->Read(&h, sizeof(h)) == sizeof(h) &&
+      h.magic == KVIndexedHeader::kMagic;
+}
+
+/**
+ * \brief Writes an indexed model through a stream
+ *
+ * The meta is written into \ref meta first, then the KV pairs are added in the
+ * increasing order of the keys, and \ref Finish writes the index. The keys and
+ * the offsets are kept in memory until then, 16 bytes per key.
+ */
+class KVIndexedWriter {
+ public:
+  /**
+   * @param fo the output stream
+   * @param key_bytes the bytes of a key, 4 or 8
+   * @param flags the flags of \ref KVIndexedHeader
+   * @param fence_stride the number of keys between two fences
+   */
+  KVIndexedWriter(dmlc::Stream* fo, int key_bytes, uint32 flags = 0,
+                  int fence_stride = 256)
+      : out_(fo) {
+    CHECK(key_bytes == 4 || key_bytes == 8);
+    CHECK_GT(fence_stride, 0);
+    KVIndexedHeader head;
+    head.key_bytes = key_bytes_ = key_bytes;
+    head.flags = flags;
+    out_.Write(&head, sizeof(head));
+    foot_.meta_off = out_.pos;
+    foot_.fence_stride = fence_stride;
+  }
+
+  /// \brief the stream of the meta, it must be written before any \ref Add
+  dmlc::Stream* meta() {
+    CHECK(key_.empty()) << "write the meta before adding KV pairs";
+    return &out_;
+  }
+
+  /// \brief adds the KV pair of \a key, which is larger than the ones added
+  template <typename E>
+  void Add(uint64 key, const E& val) {
+    Begin(key);
+    val.Save(&out_);
+  }
+
+  /// \brief adds \a key with the bytes of its value
+  void AddRaw(uint64 key, const char* data, size_t len) {
+    Begin(key);
+    out_.Write(data, len);
+  }
+
+  /// \brief writes the index, returns the number of KV pairs
+  size_t Finish() {
+    if (key_.empty()) foot_.values_off = out_.pos;
+    offset_.push_back(out_.pos);
+    foot_.num_keys = key_.size();
+
+    Align();
+    foot_.keys_off = out_.pos;
+    WriteKeys(key_.data(), key_.size());
+
+    Align();
+    foot_.offsets_off = out_.pos;
+    out_.Write(offset_.data(), offset_.size() * sizeof(uint64));
+
+    std::vector<uint64> fence;
+    for (size_t i = 0; i < key_.size(); i += foot_.fence_stride) {
+      fence.push_back(key_[i]);
+    }
+    Align();
+    foot_.fences_off = out_.pos;
+    WriteKeys(fence.data(), fence.size());
+
+    out_.Write(&foot_, sizeof(foot_));
+    return key_.size();
+  }
+
+ private:
+  /// counts the bytes written
+  struct CountingStream : public dmlc::Stream {
+    explicit CountingStream(dmlc::Stream* fo) : fo(fo) { }
+    size_t Read(void* ptr, size_t size) override {
+      LOG(FATAL) << "cannot read a KVIndexedWriter";
+      return 0;
+    }
+    void Write(const void* ptr, size_t size) override {
+      fo->Write(ptr, size); pos += size;
+    }
+    dmlc::Stream* fo;
+    uint64 pos = 0;
+  };
+
+  void Begin(uint64 key) {
+    if (key_.empty()) {
+      foot_.values_off = out_.pos;
+    } else {
+      CHECK_GT(key, key_.back()) << "keys must be added in increasing order";
+    }
+    key_.push_back(key);
+    offset_.push_back(out_.pos);
+  }
+
+  void Align() {
+    char zero[8] = {0};
+    if (out_.pos % 8) out_.Write(zero, 8 - out_.pos % 8);
+  }
+
+  void WriteKeys(const uint64* key, size_t n) {
+    if (key_bytes_ == 8) {
+      out_.Write(key, n * sizeof(uint64));
+      return;
+    }
+    std::vector<uint32> buf;
+    for (size_t i = 0; i < n; i += kChunk) {
+      buf.assign(key + i, key + std::min(n, i + kChunk));
+      out_.Write(buf.data(), buf.size() * sizeof(uint32));
+    }
+  }
+
+  static const size_t kChunk = 1 << 16;
+  CountingStream out_;
+  int key_bytes_;
+  KVIndexedFooter foot_;
+  std::vector<uint64> key_, offset_;
+};
+
+/**
+ * \brief A read-only indexed model
+ *
+ * A local file is memory-mapped, so opening it costs no parse, and only the
+ * pages of the queried keys and values are read from the disk. Files on the
+ * other filesystems of dmlc are read into memory.
+ *
+ * A key is found by a binary search over the fences, which are copied into
+ * memory, and then over one block of fence_stride keys, which spans one or two
+ * pages of the file. It is thread-safe.
+ */
+class KVIndexedFile {
+ public:
+  KVIndexedFile() { }
+  ~KVIndexedFile() { Close(); }
+  KVIndexedFile(const KVIndexedFile&) = delete;
+  KVIndexedFile& operator=(const KVIndexedFile&) = delete;
+
+  void Open(const std::string& name) {
+    Close();
+    name_ = name;
+    bool local = name.find("://") == std::string::npos ||
+                 name.compare(0, 7, "file://") == 0;
+    if (local) {
+      std::string path = name.compare(0, 7, "file://") == 0 ? name.substr(7) : name;
+      int fd = open(path.c_str(), O_RDONLY);
+      CHECK_GE(fd, 0) << "failed to open " << name;
+      struct stat st;
+      CHECK_EQ(fstat(fd, &st), 0) << "failed to stat " << name;
+      size_ = st.st_size;
+      CHECK_GT(size_, sizeof(KVIndexedHeader) + sizeof(KVIndexedFooter))
+          << name << " is not an indexed model";
+      void* p = mmap(NULL, size_, PROT_READ, MAP_SHARED, fd, 0);
+      close(fd);
+      CHECK(p != MAP_FAILED) << "failed to map " << name;
+      data_ = (const char*)p;
+      mapped_ = true;
+    } else {
+      std::unique_ptr<dmlc::Stream> fi(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "r")));
+      char buf[1 << 16];
+      for (size_t n; (n = fi->Read(buf, sizeof(buf))) > 0; ) buf_.append(buf, n);
+      size_ = buf_.size();
+      CHECK_GT(size_, sizeof(KVIndexedHeader) + sizeof(KVIndexedFooter))
+          << name << " is not an indexed model";
+      data_ = buf_.data();
+    }
+
+    memcpy(&head_, data_, sizeof(head_));
+    memcpy(&foot_, data_ + size_ - sizeof(foot_), sizeof(foot_));
+    CHECK_EQ(head_.magic, KVIndexedHeader::kMagic) << name << " is not an indexed model";
+    CHECK_EQ(foot_.magic, KVIndexedHeader::kMagic) << name << " is truncated";
+    CHECK_EQ(head_.version, (uint32)1) << "unknown version of " << name;
+    keys_ = data_ + foot_.keys_off;
+    offsets_ = (const uint64*)(data_ + foot_.offsets_off);
+    size_t nf = foot_.num_keys ? (foot_.num_keys - 1) / foot_.fence_stride + 1 : 0;
+    fence_.resize(nf);
+    for (size_t i = 0; i < nf; ++i) fence_[i] = Key(data_ + foot_.fences_off, i);
+  }
+
+  void Close() {
+    if (mapped_) munmap(const_cast<char*>(data_), size_);
+    mapped_ = false; data_ = nullptr; size_ = 0;
+    buf_.clear(); fence_.clear();
+    foot_ = KVIndexedFooter();
+  }
+
+  /// \brief the number of keys
+  size_t size() const { return foot_.num_keys; }
+
+  /// \brief the bytes of a key
+  int key_bytes() const { return head_.key_bytes; }
+
+  /// \brief true if it is a delta, see \ref KVIndexedHeader
+  bool delta() const { return head_.flags & KVIndexedHeader::kDelta; }
+
+  /// \brief the i-th smallest key
+  uint64 key(size_t i) const { return Key(keys_, i); }
+
+  /// \brief the index of the first key not less than \a k
+  size_t LowerBound(uint64 k) const {
+    size_t f = std::upper_bound(fence_.begin(), fence_.end(), k) - fence_.begin();
+    if (f == 0) return 0;
+    size_t lo = (f - 1) * foot_.fence_stride;
+    size_t hi = std::min(lo + foot_.fence_stride, size());
+    if (head_.key_bytes == 4) {
+      const uint32* p = (const uint32*)keys_;
+      return std::lower_bound(p + lo, p + hi, k) - p;
+    }
+    const uint64* p = (const uint64*)keys_;
+    return std::lower_bound(p + lo, p + hi, k) - p;
+  }
+
+  /// \brief the index of key \a k, or size() if it does not exist
+  size_t Find(uint64 k) const {
+    size_t i = LowerBound(k);
+    return i < size() && key(i) == k ? i : size();
+  }
+
+  /// \brief the bytes of the i-th value
+  const char* value(size_t i, size_t* len) const {
+    *len = offsets_[i+1] - offsets_[i];
+    return data_ + offsets_[i];
+  }
+
+  /// \brief loads the i-th value into \a val
+  template <typename E>
+  void Load(size_t i, E* val) const {
+    size_t len;
+    const char* p = value(i, &len);
+    dmlc::MemoryFixedSizeStream fi(const_cast<char*>(p), len);
+    val->Load(&fi);
+  }
+
+  /// \brief the bytes of the meta
+  const char* meta(size_t* len) const {
+    *len = foot_.values_off - foot_.meta_off;
+    return data_ + foot_.meta_off;
+  }
+
+  const std::string& name() const { return name_; }
+
+ private:
+  uint64 Key(const char* keys, size_t i) const {
+    return head_.key_bytes == 4 ? ((const uint32*)keys)[i] :
+        ((const uint64*)keys)[i];
+  }
+
+  std::string name_;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  /// the content of a file which is not mapped
+  std::string buf_;
+  KVIndexedHeader head_;
+  KVIndexedFooter foot_;
+  const char* keys_ = nullptr;
+  const uint64* offsets_ = nullptr;
+  std::vector<uint64> fence_;
+};
+
+/**
+ * \brief Loads the entries of a bucket from an indexed model on demand
+ *
+ * The bucket owns the keys [begin, end) of the file, which is shared by all
+ * buckets. The entry of a key is loaded by the first \ref Take, i.e. the first
+ * push or pull of the key, and then marked as taken, so it is never loaded
+ * again even if it is evicted or compacted away later. A server can then start
+ * serving a large model right after the file is mapped.
+ *
+ * It is not thread-safe, use one per bucket.
+ */
+template <typename K, typename E>
+class KVLazyLoad {
+ public:
+  void Init(const KVIndexedFile* file, size_t begin, size_t end) {
+    file_ = file; begin_ = begin; end_ = end;
+    taken_.assign(end - begin, false);
+    left_ = end - begin;
+  }
+
+  void Clear() {
+    file_ = nullptr; begin_ = end_ = left_ = 0;
+    std::vector<bool>().swap(taken_);
+  }
+
+  /// \brief true if some entries are not taken yet
+  bool enabled() const { return left_ > 0; }
+
+  /**
+   * \brief loads the entry of key \a k into \a e if it is not taken yet
+   *
+   * @return false if \a k is not in the file or is taken
+   */
+  bool Take(K k, E* e) {
+    size_t i = file_->Find(k);
+    if (i < begin_ || i >= end_ || taken_[i - begin_]) return false;
+    taken_[i - begin_] = true;
+    -- left_;
+    file_->Load(i, e);
+    return true;
+  }
+
+  /**
+   * \brief returns the bytes of the entry of key \a k if it is not taken yet,
+   * otherwise nullptr
+   */
+  const char* Find(K k, size_t* len) const {
+    if (!enabled()) return nullptr;
+    size_t i = file_->Find(k);
+    if (i < begin_ || i >= end_ || taken_[i - begin_]) return nullptr;
+    return file_->value(i, len);
+  }
+
+  /// \brief calls f(key, data, len) for the entries not taken, with the bytes of
+  /// their Save, in the increasing order of the keys
+  template <typename F>
+  void ForEach(const F& f) const {
+    if (!enabled()) return;
+    for (size_t i = begin_; i < end_; ++i) {
+      if (taken_[i - begin_]) continue;
+      size_t len;
+      const char* data = file_->value(i, &len);
+      f((K)file_->key(i), data, len);
+    }
+  }
+
+  /// \brief marks the entry of key \a k as taken without loading it, e.g. when
+  /// it is replaced or deleted by a delta
+  void Drop(K k) {
+    if (!enabled()) return;
+    size_t i = file_->Find(k);
+    if (i < begin_ || i >= end_ || taken_[i - begin_]) return;
+    taken_[i - begin_] = true;
+    -- left_;
+  }
+
+  /// \brief the number of entries not taken
+  size_t size() const { return left_; }
+
+ private:
+  const KVIndexedFile* file_ = nullptr;
+  size_t begin_ = 0, end_ = 0, left_ = 0;
+  std::vector<bool> taken_;
+};
+
+}  // namespace ps
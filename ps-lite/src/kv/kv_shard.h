@@ -0,0 +1,179 @@
+/**
+ * @file   kv_shard.h
+ * @brief  The sharded model files of a KV store
+ */
+#pragma once
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <lz4.h>
+#include "dmlc/io.h"
+#include "ps/base.h"
+
+#if __LZ4_VERSION_MINOR__ < 7
+#define LZ4_compress_default LZ4_compress_limitedOutput
+#endif
+
+namespace ps {
+
+/**
+ * \brief The header of a sharded model
+ *
+ * A sharded model `name` consists of the file `name`, with this header
+ * followed by the state of the handle, and the shard files `name_shard-i` for
+ * i in [0, num_shards). A shard has the KV pairs of one bucket of the saving
+ * store in the format of \ref KVStore::Save, i.e. a key followed by the value,
+ * written through \ref KVShardOutStream. The buckets are recorded, so a store
+ * with the same buckets loads shard i into bucket i without checking the other
+ * buckets.
+ */
+struct KVShardHeader {
+  uint32 magic = kMagic;
+  uint32 version = 1;
+  uint32 num_shards = 1;
+  uint32 reserved = 0;
+  /// the key range of bucket i is [min_key + i * bucket_size, min_key + (i+1)
+  /// * bucket_size)
+  uint64 min_key = 0;
+  uint64 bucket_size = 0;
+
+  static const uint32 kMagic = 0x4853564B;  // "KVSH"
+
+  void Save(dmlc::Stream* fo) const { fo->Write(this, sizeof(*this)); }
+
+  /// \brief returns false if \a fi is not a sharded model
+  bool Load(dmlc::Stream* fi) {
+    if (fi->Read(this, sizeof(*this)) != sizeof(*this)) return false;
+    if (magic != kMagic) return false;
+    CHECK_EQ(version, (uint32)1) << "unknown version of the sharded model";
+    return true;
+  }
+};
+
+/// \brief the filename of shard \a i of the sharded model \a name
+inline std::string KVShardName(const std::string& name, int i) {
+  return name + "_shard-" + std::to_string(i);
+}
+
+/// \brief returns true if \a name is a sharded model
+inline bool IsShardedModel(const std::string& name) {
+  std::unique_ptr<dmlc::Stream> fi(
+      dmlc::Stream::Create(name.c_str(), "r", true));
+  KVShardHeader h;
+  return fi && h.Load(fi.get());
+}
+
+/**
+ * \brief Writes a shard through a stream in large blocks, optionally compressed
+ * by LZ4
+ *
+ * The bytes are buffered into blocks, and a block is written as two uint32,
+ * the original size and the stored size, followed by the stored bytes. A block
+ * is stored as it is if compression does not make it smaller. So the small
+ * writes of the KV pairs become a few large writes of the underlying stream,
+ * which is efficient for both local files and the remote filesystems of dmlc.
+ */
+class KVShardOutStream : public dmlc::Stream {
+ public:
+  KVShardOutStream(dmlc::Stream* fo, bool compress)
+      : fo_(fo), compress_(compress) {
+    buf_.reserve(kBlockBytes);
+  }
+  virtual ~KVShardOutStream() { Flush(); }
+
+  size_t Read(void* ptr, size_t size) override {
+    LOG(FATAL) << "cannot read a KVShardOutStream";
+    return 0;
+  }
+
+  void Write(const void* ptr, size_t size) override {
+    buf_.append((const char*)ptr, size);
+    if (buf_.size() >= kBlockBytes) Flush();
+  }
+
+  /// \brief writes the buffered bytes as a block
+  void Flush() {
+    if (buf_.empty()) return;
+    uint32 head[2] = {(uint32)buf_.size(), (uint32)buf_.size()};
+    const char* data = buf_.data();
+    if (compress_) {
+      zbuf_.resize(LZ4_compressBound(buf_.size()));
+      int n = LZ4_compress_default(buf_.data(), &zbuf_[0], buf_.size(),
+                                   zbuf_.size());
+      CHECK_GT(n, 0) << "failed to compress";
+      if ((uint32)n < head[0]) { head[1] = n; data = zbuf_.data(); }
+    }
+    fo_->Write(head, sizeof(head));
+    fo_->Write(data, head[1]);
+    raw_bytes_ += head[0];
+    bytes_ += sizeof(head) + head[1];
+    buf_.clear();
+  }
+
+  /// \brief the bytes written into the stream
+  size_t bytes() const { return bytes_; }
+
+  /// \brief the bytes before compression
+  size_t raw_bytes() const { return raw_bytes_; }
+
+  /// the bytes of a block, which is also the bytes written at once
+  static const size_t kBlockBytes = 1 << 22;
+
+ private:
+  dmlc::Stream* fo_;
+  bool compress_;
+  std::string buf_, zbuf_;
+  size_t bytes_ = 0, raw_bytes_ = 0;
+};
+
+/**
+ * \brief Reads a shard written by \ref KVShardOutStream
+ */
+class KVShardInStream : public dmlc::Stream {
+ public:
+  explicit KVShardInStream(dmlc::Stream* fi) : fi_(fi) { }
+  virtual ~KVShardInStream() { }
+
+  size_t Read(void* ptr, size_t size) override {
+    char* p = (char*)ptr;
+    size_t n = 0;
+    while (n < size) {
+      if (pos_ == buf_.size() && !NextBlock()) break;
+      size_t m = std::min(size - n, buf_.size() - pos_);
+      memcpy(p + n, buf_.data() + pos_, m);
+      pos_ += m; n += m;
+    }
+    return n;
+  }
+
+  void Write(const void* ptr, size_t size) override {
+    LOG(FATAL) << "cannot write a KVShardInStream";
+  }
+
+ private:
+  /// reads the next block, returns false at the end of the shard
+  bool NextBlock() {
+    uint32 head[2];
+    size_t n = fi_->Read(head, sizeof(head));
+    if (n == 0) return false;
+    CHECK_EQ(n, sizeof(head)) << "truncated shard";
+    buf_.resize(head[0]);
+    pos_ = 0;
+    if (head[0] == head[1]) {
+      CHECK_EQ(fi_->Read(&buf_[0], head[1]), (size_t)head[1]) << "truncated shard";
+    } else {
+      zbuf_.resize(head[1]);
+      CHECK_EQ(fi_->Read(&zbuf_[0], head[1]), (size_t)head[1]) << "truncated shard";
+      CHECK_EQ(LZ4_decompress_safe(zbuf_.data(), &buf_[0], head[1], head[0]),
+               (int)head[0]) << "corrupted shard";
+    }
+    return true;
+  }
+
+  dmlc::Stream* fi_;
+  std::string buf_, zbuf_;
+  size_t pos_ = 0;
+};
+
+}  // namespace ps
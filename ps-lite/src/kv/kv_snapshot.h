@@ -0,0 +1,235 @@
+/**
+ * @file   kv_snapshot.h
+ * @brief  Saves a point-in-time image of a KV store in the background
+ */
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dmlc/io.h"
+#include "dmlc/memory_io.h"
+#include "kv/kv_shard.h"
+#include "kv/kv_indexed_file.h"
+namespace ps {
+
+/**
+ * \brief The model a snapshot is saved into
+ */
+struct KVSaveConf {
+  enum Format {
+    /// the format of \ref KVStore::Save
+    kStream,
+    /// see \ref KVStore::SaveShards
+    kShards,
+    /// see \ref KVStore::SaveIndexed
+    kIndexed,
+    /// see \ref KVStore::SaveDelta
+    kDelta
+  };
+  Format format = kStream;
+  std::string name;
+  /// compress the shards
+  bool compress = false;
+  /// the parent of a delta
+  std::string parent;
+};
+
+/**
+ * \brief The serialized KV pairs of a bucket, in the order they are added
+ */
+template <typename K>
+struct KVImage {
+  std::vector<K> key;
+  /// value i is val[off[i], off[i+1])
+  std::vector<uint64> off = std::vector<uint64>(1, 0);
+  std::string val;
+
+  template <typename E>
+  void Add(K k, const E& e) {
+    dmlc::MemoryStringStream fo(&val);
+    fo.Seek(val.size());
+    e.Save(&fo);
+    key.push_back(k);
+    off.push_back(val.size());
+  }
+
+  void AddRaw(K k, const char* data, size_t len) {
+    val.append(data, len);
+    key.push_back(k);
+    off.push_back(val.size());
+  }
+
+  size_t size() const { return key.size(); }
+
+  /// \brief writes the KV pairs into \a out, whose keys are smaller
+  void Save(KVIndexedWriter* out) const {
+    for (size_t i = 0; i < key.size(); ++i) {
+      out->AddRaw(key[i], val.data() + off[i], off[i+1] - off[i]);
+    }
+  }
+
+  /// \brief writes the KV pairs into \a fo in the format of \ref KVStore::Save
+  void Save(dmlc::Stream* fo) const {
+    for (size_t i = 0; i < key.size(); ++i) {
+      fo->Write(&key[i], sizeof(K));
+      fo->Write(val.data() + off[i], off[i+1] - off[i]);
+    }
+  }
+
+  void Clear() { KVImage<K>().Swap(this); }
+
+  void Swap(KVImage<K>* img) {
+    key.swap(img->key); off.swap(img->off); val.swap(img->val);
+  }
+};
+
+/**
+ * \brief Saves a point-in-time image of the buckets of a store in the
+ * background, with copy-on-write at the bucket level
+ *
+ * \ref Start marks all buckets as pending, which is the snapshot point and
+ * costs nothing, and then a thread writes the buckets one by one. A pending
+ * bucket is captured into a \ref KVImage, i.e. serialized into memory, either
+ * by the writer when it is its turn, or by \ref Cow, which the store calls
+ * before it accesses the bucket for a push, a pull or any other change. So
+ * every bucket is captured as it was at the snapshot point, while pushes and
+ * pulls go on, and only the first access of a bucket after the snapshot point
+ * waits for the capture, which is much faster than writing the bucket into a
+ * file. The memory of an image is freed once it is written.
+ *
+ * The store must call \ref Start when no bucket is being accessed, e.g. under
+ * a lock held by its request handlers.
+ */
+template <typename K>
+class KVSnapshot {
+ public:
+  /**
+   * \brief captures bucket i into the image, with the sorted keys of a delta
+   */
+  typedef std::function<void(int i, const std::vector<K>& keys, KVImage<K>*)>
+  Capture;
+
+  KVSnapshot() { }
+  ~KVSnapshot() { Wait(); }
+
+  /**
+   * \brief starts to save a snapshot, after waiting the previous one
+   *
+   * @param conf the model to save
+   * @param handle the state of the handle
+   * @param head the buckets, its num_shards is the number of buckets
+   * @param keys the sorted changed keys of each bucket for a delta
+   * @param capture the function to capture a bucket
+   */
+  void Start(const KVSaveConf& conf, const std::string& handle,
+             const KVShardHeader& head, std::vector<std::vector<K>>&& keys,
+             const Capture& capture) {
+    Wait();
+    int nb = head.num_shards;
+    if (!pending_) {
+      num_buckets_ = nb;
+      pending_.reset(new std::atomic<bool>[nb]);
+      mu_.reset(new std::mutex[nb]);
+      for (int i = 0; i < nb; ++i) pending_[i] = false;
+    }
+    CHECK_EQ(nb, num_buckets_);
+    conf_ = conf; handle_ = handle; head_ = head;
+    keys_ = std::move(keys);
+    keys_.resize(nb);
+    capture_ = capture;
+    images_.resize(nb);
+    start_ = std::chrono::steady_clock::now();
+    for (int i = 0; i < nb; ++i) pending_[i].store(true, std::memory_order_release);
+    writer_ = std::thread(&KVSnapshot::Write, this);
+  }
+
+  /// \brief captures bucket \a i if it is pending, called before accessing it
+  PS_ALWAYS_INLINE void Cow(int i) {
+    if (pending_ && pending_[i].load(std::memory_order_acquire)) Take(i);
+  }
+
+  /// \brief waits until the snapshot is saved
+  void Wait() {
+    if (writer_.joinable()) writer_.join();
+  }
+
+ private:
+  void Take(int i) {
+    std::lock_guard<std::mutex> lk(mu_[i]);
+    if (!pending_[i].load(std::memory_order_relaxed)) return;
+    capture_(i, keys_[i], &images_[i]);
+    std::vector<K>().swap(keys_[i]);
+    pending_[i].store(false, std::memory_order_release);
+  }
+
+  /// returns the image of bucket i, capturing it if pending
+  const KVImage<K>& Image(int i) {
+    Cow(i);
+    return images_[i];
+  }
+
+  void Write() {
+    size_t n = 0;
+    const auto& name = conf_.name;
+    if (conf_.format == KVSaveConf::kShards) {
+      {
+        std::unique_ptr<dmlc::Stream> fo(
+            CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+        head_.Save(fo.get());
+        fo->Write(handle_.data(), handle_.size());
+      }
+      for (int i = 0; i < num_buckets_; ++i) {
+        auto file = KVShardName(name, i);
+        std::unique_ptr<dmlc::Stream> fo(
+            CHECK_NOTNULL(dmlc::Stream::Create(file.c_str(), "w")));
+        KVShardOutStream out(fo.get(), conf_.compress);
+        n += Image(i).size();
+        Image(i).Save(&out);
+        images_[i].Clear();
+      }
+    } else {
+      std::unique_ptr<dmlc::Stream> fo(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+      if (conf_.format == KVSaveConf::kStream) {
+        fo->Write(handle_.data(), handle_.size());
+        for (int i = 0; i < num_buckets_; ++i) {
+          n += Image(i).size();
+          Image(i).Save(fo.get());
+          images_[i].Clear();
+        }
+      } else {
+        bool delta = conf_.format == KVSaveConf::kDelta;
+        KVIndexedWriter out(fo.get(), sizeof(K), delta ? KVIndexedHeader::kDelta : 0);
+        if (delta) out.meta()->Write(conf_.parent);
+        out.meta()->Write(handle_.data(), handle_.size());
+        for (int i = 0; i < num_buckets_; ++i) {
+          Image(i).Save(&out);
+          images_[i].Clear();
+        }
+        n = out.Finish();
+      }
+    }
+    LOG(INFO) << "saved the snapshot of " << n << " kv pairs into " << name
+              << " in the background in " << std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start_).count() << " sec";
+  }
+
+  KVSaveConf conf_;
+  std::string handle_;
+  KVShardHeader head_;
+  int num_buckets_ = 0;
+  std::unique_ptr<std::atomic<bool>[]> pending_;
+  std::unique_ptr<std::mutex[]> mu_;
+  std::vector<std::vector<K>> keys_;
+  std::vector<KVImage<K>> images_;
+  Capture capture_;
+  std::chrono::steady_clock::time_point start_;
+  std::thread writer_;
+};
+
+}  // namespace ps
@@ -1,9 +1,91 @@
 #pragma once
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include "ps/app.h"
 #include "proto/param.pb.h"
 #include "dmlc/io.h"
+#include "kv/kv_admission.h"
+#include "kv/kv_eviction.h"
+#include "kv/kv_shard.h"
+#include "kv/kv_indexed_file.h"
+#include "kv/kv_delta.h"
+#include "kv/kv_snapshot.h"
+#include "kv/kv_hot_keys.h"
+#include "base/numa.h"
 namespace ps {
 
+/**
+ * \brief The bucket of a KV store the calling thread is working on
+ *
+ * A multi-threaded KV store partitions its key range into buckets, and a bucket
+ * is only processed by one thread at a time. The store sets the bucket before
+ * calling the handle or the value's Load, so that per-bucket resources indexed
+ * by \ref Get, such as the arenas of a \ref SlabAllocator, can be used without
+ * locks. It is always 0 for a single-threaded store.
+ *
+ * If the buckets are placed on NUMA nodes, see \ref KVStore::SetNuma, setting
+ * the bucket also sets the node the calling thread allocates on, see \ref
+ * NumaMemory::SetNode.
+ */
+class KVStoreBucket {
+ public:
+  static int Get() { return bucket(); }
+  static void Set(int b) {
+    bucket() = b;
+    const auto& n = nodes();
+    if (!n.empty()) NumaMemory::SetNode(n[b % n.size()]);
+  }
+  /// \brief sets the NUMA node of each bucket, empty means no placement.
+  /// called before any thread sets a bucket
+  static void SetNodes(const std::vector<int>& nodes_of_buckets) {
+    nodes() = nodes_of_buckets;
+  }
+ private:
+  static int& bucket() { static thread_local int b = 0; return b; }
+  static std::vector<int>& nodes() { static std::vector<int> n; return n; }
+};
+
+/**
+ * \brief Lets the requests of a KV store run together, but excludes them
+ * from an operation which needs a point between requests, such as taking a
+ * snapshot
+ */
+class KVRequestGate {
+ public:
+  /// \brief called when a request starts, waits if the gate is closed
+  void Enter() {
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [this] { return !closed_; });
+    ++ active_;
+  }
+
+  /// \brief called when a request finishes
+  void Leave() {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (-- active_ == 0 && closed_) cond_.notify_all();
+  }
+
+  /// \brief closes the gate, and waits until no request is running
+  void Close() {
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [this] { return !closed_; });
+    closed_ = true;
+    cond_.wait(lk, [this] { return active_ == 0; });
+  }
+
+  void Open() {
+    { std::lock_guard<std::mutex> lk(mu_); closed_ = false; }
+    cond_.notify_all();
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cond_;
+  int active_ = 0;
+  bool closed_ = false;
+};
+
 class KVStore : public Customer {
  public:
   KVStore(int id) : Customer(id) { }
@@ -14,6 +96,195 @@ class KVStore : public Customer {
   virtual void Save(dmlc::Stream *fo) const = 0;
   virtual void Clear() = 0;
 
+  /**
+   * \brief Saves the KV pairs into the shard files of the model \a name, one
+   * per bucket, in parallel, see \ref KVShardHeader
+   *
+   * @param name the model name, which stores the header and the handle
+   * @param compress compress the shards by LZ4
+   */
+  virtual void SaveShards(const std::string& name, bool compress) {
+    LOG(FATAL) << "this store does not support sharded models";
+  }
+
+  /// \brief Loads a model saved by \ref SaveShards, the shards are read in
+  /// parallel
+  virtual void LoadShards(const std::string& name) {
+    LOG(FATAL) << "this store does not support sharded models";
+  }
+
+  /**
+   * \brief Saves the KV pairs into the indexed model \a name, sorted by the
+   * keys, see \ref KVIndexedHeader
+   */
+  virtual void SaveIndexed(const std::string& name) {
+    LOG(FATAL) << "this store does not support indexed models";
+  }
+
+  /**
+   * \brief Loads an indexed model saved by \ref SaveIndexed or \ref SaveDelta
+   *
+   * @param lazy only maps the file, and loads the entry of a key at its first
+   * push or pull, see \ref KVLazyLoad
+   */
+  virtual void LoadIndexed(const std::string& name, bool lazy) {
+    LOG(FATAL) << "this store does not support indexed models";
+  }
+
+  /**
+   * \brief Starts to record the keys changed by pushes or deleted by eviction,
+   * which are saved by \ref SaveDelta, see \ref KVDirtyKeys
+   */
+  virtual void TrackChanges() {
+    LOG(FATAL) << "this store does not support delta models";
+  }
+
+  /// \brief Forgets the changes recorded, called after saving a full model
+  virtual void ClearChanges() { }
+
+  /**
+   * \brief Saves the KV pairs changed since the last \ref ClearChanges or
+   * SaveDelta into the indexed delta \a name, see \ref KVIndexedHeader
+   *
+   * @param parent the model the changes are relative to, which is loaded first
+   * when loading \a name. empty means an empty model
+   */
+  virtual void SaveDelta(const std::string& name, const std::string& parent) {
+    LOG(FATAL) << "this store does not support delta models";
+  }
+
+  /**
+   * \brief Saves a snapshot of the KV pairs in the background, see \ref
+   * KVSnapshot. It returns at the snapshot point, and the pushes and pulls
+   * after it are applied while the snapshot is written. For a delta, the
+   * changes are the ones before the snapshot point
+   */
+  virtual void SaveAsync(const KVSaveConf& conf) {
+    LOG(FATAL) << "this store does not support saving asynchronously";
+  }
+
+  /// \brief Waits until the snapshot saved by \ref SaveAsync is written
+  virtual void WaitSave() { }
+
+  /**
+   * \brief Loads the model \a name, whose format is detected: one saved by
+   * \ref Save, \ref SaveShards, \ref SaveIndexed, or \ref SaveDelta, whose
+   * parents are loaded first
+   *
+   * @param lazy load an indexed model lazily, see \ref LoadIndexed
+   */
+  void LoadFile(const std::string& name, bool lazy) {
+    WaitSave();
+    if (IsIndexedModel(name)) {
+      LoadIndexed(name, lazy);
+    } else if (IsShardedModel(name)) {
+      LoadShards(name);
+    } else {
+      std::unique_ptr<dmlc::Stream> fi(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "r")));
+      Load(fi.get());
+    }
+  }
+
+  /**
+   * \brief Removes the KV pairs which would be skipped by Save because they
+   * are Empty(), returns the reclaimed memory in bytes
+   */
+  virtual size_t Compact() { return 0; }
+
+  /**
+   * \brief Creates the entry of a new key only after it has been pushed \a
+   * threshold times, see \ref KVAdmission
+   *
+   * @param threshold 0 or 1 admits all keys
+   * @param sketch_size the total number of sketch counters, i.e. bytes
+   * @param num_hashes the number of counters a key is hashed into
+   */
+  virtual void SetAdmission(int threshold, int sketch_size, int num_hashes) {
+    CHECK_LE(threshold, 1) << "this store does not support admission";
+  }
+
+  /// \brief returns the statistics of the admission since the beginning
+  virtual KVAdmissionStats GetAdmissionStats() const {
+    return KVAdmissionStats();
+  }
+
+  /**
+   * \brief Evicts the keys which have not been pushed for long, see \ref
+   * KVEviction. The entry needs a `uint16 touched` member
+   */
+  virtual void SetEviction(const KVEvictionConf& conf) {
+    CHECK(!conf.enabled()) << "this store does not support eviction";
+  }
+
+  /**
+   * \brief Keeps the recently pushed entries in RAM, and demotes the others
+   * into files, see \ref KVColdTier. It cannot be used with \ref SetEviction
+   */
+  virtual void SetTier(const KVTierConf& conf) {
+    CHECK(!conf.enabled()) << "this store does not support tiering";
+  }
+
+  /// \brief returns the statistics of the tiers since the beginning
+  virtual KVTierStats GetTierStats() { return KVTierStats(); }
+
+  /**
+   * \brief Sums the pushes of a key within a window, and applies them as one
+   * push, see \ref KVAggregator
+   *
+   * A window ends after \a max_requests push requests or \a max_usec
+   * microseconds, whichever comes first, where 0 means no limit. The pulls
+   * within a window do not see its pushes. It is disabled if both are 0 or
+   * max_requests is 1
+   */
+  virtual void SetAggregation(int max_requests, int max_usec) {
+    CHECK(max_requests == 1 || (max_requests <= 0 && max_usec <= 0))
+        << "this store does not support aggregating pushes";
+  }
+
+  /// \brief Applies the pushes being aggregated, which must be called before
+  /// \ref Save. The other saves call it
+  virtual void FlushPushes() { }
+
+  /**
+   * \brief Processes up to \a num_requests push and pull requests at the same
+   * time, each by one thread, see \ref Executor::ParallelizeRequests. A
+   * request locks the buckets it accesses one by one, so the requests with
+   * different buckets do not wait each other. 0 or 1 processes one request at
+   * a time
+   */
+  virtual void SetConcurrency(int num_requests) {
+    CHECK_LE(num_requests, 1) << "this store does not support concurrent requests";
+  }
+
+  /**
+   * \brief Replicates the hot keys of this server on the other servers, see
+   * \ref KVHotKeyConf
+   *
+   * A server counts the pulls of its keys, and every round it sends the
+   * entries of the most pulled ones to the others, which keep them as
+   * replicas, see \ref KVHotReplicas. Workers pulling the hot keys, see \ref
+   * KVWorker::ReplicateHotKeys, send them to the replicas, which serve the
+   * pulls and sum the pushes, and forward the sums to the owner every round.
+   * All servers must use the same configuration
+   */
+  virtual void SetHotKeys(const KVHotKeyConf& conf) {
+    CHECK(!conf.enabled()) << "this store does not support hot key replication";
+  }
+
+  /**
+   * \brief Places the buckets on NUMA nodes, see \ref NumaPlacement
+   *
+   * The thread of each bucket is pinned to a cpu, and the hash table and the
+   * value arenas of the bucket are allocated on the node of the cpu. The large
+   * buffers are backed by huge pages if asked. It must be called before any
+   * key is inserted
+   */
+  virtual void SetNuma(const NumaConf& conf) {
+    CHECK(!conf.pin) << "this store does not support numa placement";
+    NumaMemory::SetHugePages(conf.huge_pages);
+  }
+
   // handle system call
   void ProcessRequest(Message* request) {
     const auto& call = request->task.param();
@@ -24,7 +295,10 @@ class KVStore : public Customer {
       response = new Message(*request);
     }
 
-    if (call.replica()) {
+    if (call.has_hot_key() && call.hot_key() != ParamCall::HOT_PUSHES) {
+      // the hot key replication, the forwarded pushes are normal pushes
+      HandleHotKeys(request, response);
+    } else if (call.replica()) {
       // a replication request
       if (push) {
         SetReplica(request);
@@ -54,6 +328,10 @@ class KVStore : public Customer {
   ///  my_val_[msg->key[0]] = msg->value(0)[0];
   virtual void HandlePush(const Message* msg) = 0;
 
+  /// @brief handles a message of the hot key replication other than the
+  /// forwarded pushes, see \ref SetHotKeys. \a response is null for a push
+  virtual void HandleHotKeys(Message* request, Message* response) { }
+
   /// @brief the message contains the backup KV pairs sent by the master node of the key
   /// segment to its replica node. merge these pairs into my replica, say
   /// replica_[msg->sender] = ...
@@ -66,6 +344,24 @@ class KVStore : public Customer {
   /// @brief a new server node fill its own datastructure via the the replica data from
   /// the dead's replica node
   virtual void Recover(Message* msg) { }
+
+  /// @brief logs the changes of GetTierStats() every minute
+  void LogTierStats() {
+    // skip if another request is logging
+    std::unique_lock<std::mutex> lk(tier_log_mu_, std::try_to_lock);
+    if (!lk) return;
+    auto now = std::chrono::steady_clock::now();
+    if (now - tier_log_time_ < std::chrono::seconds(60)) return;
+    tier_log_time_ = now;
+    auto s = GetTierStats();
+    LOG(INFO) << s.Print(tier_log_);
+    tier_log_ = s;
+  }
+
+ private:
+  std::mutex tier_log_mu_;
+  KVTierStats tier_log_;
+  std::chrono::steady_clock::time_point tier_log_time_;
 };
 
 }  // namespace ps
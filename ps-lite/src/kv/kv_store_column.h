@@ -0,0 +1,296 @@
+/**
+ * @file   kv_store_column.h
+ * @brief  A KV store keeping every field of the values in its own array
+ */
+#pragma once
+#include "kv/kv_store.h"
+#include "base/thread_pool.h"
+#include "kv/kv_batch.h"
+#include "ps/node_info.h"
+namespace ps {
+
+/**
+ * \brief A KV store in the struct-of-arrays layout
+ *
+ * A key is mapped to a dense slot index of its bucket, and the value \a E is
+ * split into `sizeof(E) / sizeof(V)` columns, each of which is a contiguous
+ * array indexed by the slot. So \a E must be a plain struct of \a V, e.g. `{w,
+ * z, sq_cum_grad}`.
+ *
+ * A push request is applied per bucket in three steps: the columns of the
+ * pushed keys are gathered into contiguous buffers, the handle updates the
+ * whole batch by
+ *
+ * \code
+ * void PushColumns(size_t n, const V* grad, V* const* col);
+ * \endcode
+ *
+ * where `col[c][i]` is the c-th field of the i-th key and `grad[i]` its
+ * gradient, and then the buffers are scattered back. The buffers of the
+ * columns start at 16-byte aligned addresses. Only pushes with one value per
+ * key are supported.
+ *
+ * A pull request gathers each value into an \a E and calls the handle's
+ * per-key `Pull`. A pulled key which does not exist is not inserted. Load and
+ * Save use the per-key `Load` and `Save` of \a E, so the file format is the
+ * same as the other stores.
+ */
+template<typename K, typename E, typename V, typename Handle>
+class KVStoreColumn : public KVStore {
+ public:
+  KVStoreColumn(int id, Handle handle, int pull_val_len, int nt)
+      : KVStore(id), handle_(handle), k_(pull_val_len), nt_(nt), pool_(nt) {
+    CHECK_GT(k_, 0); CHECK_GT(nt_, 0); CHECK_LT(nt_, 30);
+    data_.resize(nt_);
+    auto kr = NodeInfo::KeyRange();
+    min_key_ = kr.begin();
+    bucket_size_ = (kr.end() - kr.begin() -1 ) / nt_ + 1;
+    key_pos_.resize(nt_+1);
+    if (nt_ > 1) pool_.StartWorkers();
+  }
+
+  virtual ~KVStoreColumn() { }
+
+  void Clear() override {
+    for (auto& b : data_) b = Bucket();
+  }
+
+  size_t Compact() override {
+    std::vector<size_t> bytes(nt_), size(nt_);
+    Run([this, &bytes, &size](int i) {
+        KVStoreBucket::Set(i);
+        auto& data = data_[i];
+        size[i] = data.key.size();
+        bytes[i] = Bytes(data);
+        Bucket keep;
+        E val;
+        for (size_t s = 0; s < data.key.size(); ++s) {
+          Gather(data, s, &val);
+          if (!val.Empty()) Scatter(val, keep, Slot(data.key[s], keep));
+        }
+        keep.slot.shrink_to_fit();
+        keep.key.shrink_to_fit();
+        for (auto& c : keep.col) c.shrink_to_fit();
+        data = std::move(keep);
+        size[i] -= data.key.size();
+        bytes[i] -= Bytes(data);
+      });
+    size_t b = 0, s = 0;
+    for (int i = 0; i < nt_; ++i) { b += bytes[i]; s += size[i]; }
+    LOG(INFO) << "compaction removed " << s << " kv pairs, reclaimed "
+              << b / 1e6 << " MB";
+    return b;
+  }
+
+  // process a pull message
+  void HandlePull(Message* msg) {
+    int ts = msg->task.time();
+    handle_.Start(false, ts, msg->task.cmd(), (void*)msg);
+    CHECK(!msg->task.param().dyn_val_size())
+        << "the column store only supports fixed length values";
+    SArray<K> key(msg->key);
+    size_t n = key.size();
+    SArray<V> val(n * k_);
+    SliceKey(key.data(), n);
+    Run([this, &key, &val](int i) { ThreadPull(key.data(), val.data(), i); });
+    msg->add_value(val);
+
+    FinishReceivedRequest(ts, msg->sender);
+    handle_.Finish();
+  }
+
+  // process a push message
+  void HandlePush(const Message* msg) {
+    int ts = msg->task.time();
+    handle_.Start(true, ts, msg->task.cmd(), (void*)msg);
+    CHECK(!msg->task.param().dyn_val_size())
+        << "the column store only supports fixed length values";
+    SArray<K> key(msg->key);
+    size_t n = key.size();
+    if (n) {
+      CHECK_EQ(msg->value.size(), (size_t)1);
+      SArray<V> val(msg->value[0]);
+      CHECK_EQ(val.size(), n) << "the column store needs one value per key";
+      SliceKey(key.data(), n);
+      Run([this, &key, &val](int i) { ThreadPush(key.data(), val.data(), i); });
+    }
+
+    FinishReceivedRequest(ts, msg->sender);
+    handle_.Finish();
+  }
+
+  virtual void Load(dmlc::Stream *fi) {
+    handle_.Load(fi);
+    K key;
+    E val;
+    while (true) {
+      if (fi->Read(&key, sizeof(K)) != sizeof(K)) break;
+      int b = (key - min_key_) / bucket_size_;
+      KVStoreBucket::Set(b);
+      val = E();
+      val.Load(fi);
+      auto& data = data_[b];
+      Scatter(val, data, Slot(key, data));
+    }
+    size_t size = 0;
+    for (const auto& b : data_) size += b.key.size();
+    LOG(INFO) << "loaded " << size << " kv pairs in total";
+  }
+
+  virtual void Save(dmlc::Stream *fo) const {
+    handle_.Save(fo);
+    size_t saved = 0;
+    for (const auto& data : data_) {
+      E val;
+      for (size_t i = 0; i < data.key.size(); ++i) {
+        Gather(data, i, &val);
+        if (val.Empty()) continue;
+        fo->Write(&data.key[i], sizeof(K));
+        val.Save(fo);
+        ++ saved;
+      }
+    }
+    LOG(INFO) << "saved " << saved << " kv pairs in total";
+  }
+
+ private:
+  static const int kCols = sizeof(E) / sizeof(V);
+  /// the number of keys whose slots are prefetched ahead
+  static const int kPrefetch = 16;
+  static_assert(sizeof(E) == kCols * sizeof(V),
+                "the value must be a plain struct of V");
+
+  struct Bucket {
+    /// key -> slot
+    FlatHashMap<K, uint32> slot;
+    /// slot -> key
+    std::vector<K> key;
+    /// the fields of the values, indexed by slot
+    std::vector<V> col[kCols];
+    /// the slots of the keys in the current request
+    std::vector<uint32> idx;
+    /// the gathered columns of the current request
+    std::vector<V> buf;
+  };
+
+  std::vector<Bucket> data_;
+  Handle handle_;
+  int k_, nt_;
+
+  K min_key_;
+  K bucket_size_;
+
+  ThreadPool pool_;
+
+  std::vector<int> key_pos_;
+
+  void SliceKey(K* key, int n) {
+    key_pos_[0] = 0;
+    for (int i = 1; i < nt_; ++i) {
+      K k = min_key_ + bucket_size_ * i;
+      key_pos_[i] = std::lower_bound(key + key_pos_[i-1], key + n, k) - key;
+    }
+    key_pos_[nt_] = n;
+  }
+
+  /// runs func(bucket) for all buckets, bucket i always by the i-th worker
+  template <typename F>
+  void Run(const F& func) {
+    if (nt_ == 1) { func(0); return; }
+    for (int i = 0; i < nt_; ++i) pool_.Add([&func, i]() { func(i); }, i);
+    pool_.Wait();
+  }
+
+  /// returns the slot of key, inserting a zero value if not exist
+  static uint32 Slot(K key, Bucket& data) {
+    uint32 s = data.key.size();
+    auto r = data.slot.find(key);
+    if (r != data.slot.end()) return r->second;
+    data.slot[key] = s;
+    data.key.push_back(key);
+    for (auto& c : data.col) c.push_back(0);
+    return s;
+  }
+
+  /// the memory in bytes held by a bucket
+  static size_t Bytes(const Bucket& data) {
+    size_t b = data.slot.bytes() + data.key.capacity() * sizeof(K) +
+               data.idx.capacity() * sizeof(uint32) +
+               data.buf.capacity() * sizeof(V);
+    for (const auto& c : data.col) b += c.capacity() * sizeof(V);
+    return b;
+  }
+
+  static void Gather(const Bucket& data, uint32 s, E* val) {
+    V* v = reinterpret_cast<V*>(val);
+    for (int c = 0; c < kCols; ++c) v[c] = data.col[c][s];
+  }
+
+  static void Scatter(const E& val, Bucket& data, uint32 s) {
+    const V* v = reinterpret_cast<const V*>(&val);
+    for (int c = 0; c < kCols; ++c) data.col[c][s] = v[c];
+  }
+
+  void ThreadPush(K* key, V* val, int tid) {
+    KVStoreBucket::Set(tid);
+    auto& data = data_[tid];
+    int begin = key_pos_[tid], n = key_pos_[tid+1] - begin;
+    if (n == 0) return;
+
+    data.idx.resize(n);
+    data.slot.reserve(data.slot.size() + n);
+    key += begin;
+    // hash and prefetch key i + kPrefetch before probing key i
+    for (int i = 0; i < n && i < kPrefetch; ++i) PrefetchKey(data.slot, key[i]);
+    for (int i = 0; i < n; ++i) {
+      if (i + kPrefetch < n) PrefetchKey(data.slot, key[i + kPrefetch]);
+      data.idx[i] = Slot(key[i], data);
+    }
+
+    // gather, with the stride rounded up to 16 bytes
+    size_t stride = (n * sizeof(V) + 15) / 16 * 16 / sizeof(V);
+    data.buf.resize(stride * kCols);
+    V* col[kCols];
+    const uint32* idx = data.idx.data();
+    for (int c = 0; c < kCols; ++c) {
+      col[c] = data.buf.data() + stride * c;
+      const V* src = data.col[c].data();
+      for (int i = 0; i < n; ++i) col[c][i] = src[idx[i]];
+    }
+
+    handle_.PushColumns(n, val + begin, col);
+
+    // scatter
+    for (int c = 0; c < kCols; ++c) {
+      V* dst = data.col[c].data();
+      for (int i = 0; i < n; ++i) dst[idx[i]] = col[c][i];
+    }
+  }
+
+  void ThreadPull(K* key, V* val, int tid) {
+    KVStoreBucket::Set(tid);
+    const auto& data = data_[tid];
+    val += key_pos_[tid] * k_;
+    E entry;
+    int end = key_pos_[tid+1];
+    for (int i = key_pos_[tid]; i < end && i < key_pos_[tid] + kPrefetch; ++i) {
+      PrefetchKey(data.slot, key[i]);
+    }
+    for (int i = key_pos_[tid]; i < end; ++i, val += k_) {
+      if (i + kPrefetch < end) PrefetchKey(data.slot, key[i + kPrefetch]);
+      auto it = data.slot.find(key[i]);
+      if (it == data.slot.end()) {
+        entry = E();
+      } else {
+        Gather(data, it->second, &entry);
+      }
+      Blob<V> pull(val, k_);
+      handle_.Pull(key[i], entry, pull);
+      CHECK_EQ(pull.size, (size_t)k_) << "use dyanmic pull";
+      if (pull.data != val) {
+        memcpy(val, pull.data, sizeof(V)*k_);
+      }
+    }
+  }
+};
+}  // namespace ps
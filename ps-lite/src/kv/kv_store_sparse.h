@@ -1,103 +1,360 @@
 #pragma once
+#include <cmath>
+#include <functional>
+#include <iterator>
 #include "kv/kv_store.h"
+#include "kv/kv_batch.h"
+#include "kv/kv_hot_keys.h"
 #include "base/thread_pool.h"
 #include "ps/node_info.h"
 namespace ps {
 
-template<typename K, typename E, typename V, typename Handle>
+template<typename K, typename E, typename V, typename Handle,
+         typename Map = std::unordered_map<K, E>>
 class KVStoreSparse : public KVStore {
  public:
   KVStoreSparse(int id, Handle handle, int pull_val_len, int nt)
       : KVStore(id), handle_(handle), k_(pull_val_len), nt_(nt), pool_(nt) {
     CHECK_GT(k_, 0); CHECK_GT(nt_, 0); CHECK_LT(nt_, 30);
     data_.resize(nt_);
+    batch_.resize(nt_);
+    bucket_mu_.reset(new std::mutex[nt_]);
     auto kr = NodeInfo::KeyRange();
     min_key_ = kr.begin();
+    max_key_ = kr.end();
     bucket_size_ = (kr.end() - kr.begin() -1 ) / nt_ + 1;
-    key_pos_.resize(nt_+1);
+    lanes_.emplace_back(new Lane(&handle_, nt_, 0));
     pool_.StartWorkers();
   }
 
-  virtual ~KVStoreSparse() { }
+  virtual ~KVStoreSparse() { snapshot_.Wait(); }
 
   void Clear() override {
+    snapshot_.Wait();
     data_.clear();
+    for (auto& b : batch_) { b.lazy.Clear(); b.aggr.Clear(); }
+    indexed_.reset();
+  }
+
+  size_t Compact() override {
+    gate_.Close();
+    if (aggr_) ApplyPushes(lanes_[0].get());
+    std::vector<size_t> bytes(nt_), size(nt_);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &bytes, &size, i]() {
+          KVStoreBucket::Set(i);
+          snapshot_.Cow(i);
+          size[i] = data_[i].size();
+          bytes[i] = EraseEmpty(&data_[i]);
+          size[i] -= data_[i].size();
+        }, i);
+    }
+    pool_.Wait();
+    gate_.Open();
+    size_t b = 0, s = 0;
+    for (int i = 0; i < nt_; ++i) { b += bytes[i]; s += size[i]; }
+    LOG(INFO) << "compaction removed " << s << " kv pairs, reclaimed "
+              << b / 1e6 << " MB";
+    return b;
+  }
+
+  void SetAdmission(int threshold, int sketch_size, int num_hashes) override {
+    for (auto& b : batch_) {
+      b.admission.Init(threshold, (sketch_size - 1) / nt_ + 1, num_hashes);
+    }
+  }
+
+  KVAdmissionStats GetAdmissionStats() const override {
+    KVAdmissionStats s;
+    for (int i = 0; i < nt_; ++i) {
+      std::lock_guard<std::mutex> lk(bucket_mu_[i]);
+      s += batch_[i].admission.stats();
+    }
+    return s;
+  }
+
+  void SetEviction(const KVEvictionConf& conf) override {
+    CHECK(!hot_keys_) << "eviction cannot be used with tiering";
+    if (conf.archive) handle_.Save(conf.archive);
+    KVEvictionConf c = conf;
+    if (c.max_keys) c.max_keys = (c.max_keys - 1) / nt_ + 1;
+    for (int i = 0; i < nt_; ++i) batch_[i].eviction.Init(c, i, &archive_mu_);
+  }
+
+  void SetTier(const KVTierConf& conf) override {
+    if (!conf.enabled()) return;
+    CHECK_GT(conf.hot_keys, (size_t)0);
+    CHECK(!batch_[0].eviction.enabled()) << "tiering cannot be used with eviction";
+    KVEvictionConf c;
+    c.max_keys = hot_keys_ = (conf.hot_keys - 1) / nt_ + 1;
+    // so the pushes of the last max_keys keys span about 64 ticks
+    c.tick_keys = (hot_keys_ - 1) / 64 + 1;
+    for (int i = 0; i < nt_; ++i) {
+      batch_[i].cold.Open(conf.path + "_bucket-" + std::to_string(i));
+      batch_[i].eviction.Init(c, i, &archive_mu_, &batch_[i].cold);
+    }
+  }
+
+  KVTierStats GetTierStats() override {
+    KVTierStats s;
+    for (int i = 0; i < nt_; ++i) {
+      std::lock_guard<std::mutex> lk(bucket_mu_[i]);
+      s += batch_[i].cold.stats();
+    }
+    return s;
+  }
+
+  void SetAggregation(int max_requests, int max_usec) override {
+    if (max_requests == 1 || (max_requests <= 0 && max_usec <= 0)) return;
+    aggr_requests_ = std::max(max_requests, 0);
+    aggr_usec_ = std::max(max_usec, 0);
+    aggr_ = true;
+    LOG(INFO) << "aggregate the pushes of " << aggr_requests_ << " requests or "
+              << aggr_usec_ << " usec (0 means no limit)";
+  }
+
+  void FlushPushes() override {
+    if (!aggr_) return;
+    gate_.Close();
+    ApplyPushes(lanes_[0].get());
+    gate_.Open();
+  }
+
+  void SetConcurrency(int num_requests) override {
+    if (num_requests <= 1) return;
+    CHECK_EQ(lanes_.size(), (size_t)1) << "the concurrency is already set";
+    // the other lanes use copies of the handle
+    for (int i = 1; i < num_requests; ++i) {
+      lanes_.emplace_back(new Lane(nullptr, nt_, i));
+    }
+    CopyHandle();
+    for (auto& l : lanes_) free_lanes_.push_back(l.get());
+    concurrent_ = true;
+    exec_.ParallelizeRequests(num_requests);
+    LOG(INFO) << "process " << num_requests << " requests at the same time "
+              << "with " << nt_ << " buckets";
+  }
+
+  void SetHotKeys(const KVHotKeyConf& conf) override {
+    if (!conf.enabled()) return;
+    CHECK_GT(conf.round_sec, 0);
+    hot_ = conf;
+    heavy_.resize(nt_);
+    for (auto& h : heavy_) {
+      h.Init((conf.sketch_size - 1) / nt_ + 1, 4 * conf.max_keys);
+    }
+    hot_start_ = NowUsec();
+    LOG(INFO) << "replicate up to " << conf.max_keys << " hot keys, pulled by "
+              << conf.min_share * 100 << "% of the requests, every "
+              << conf.round_sec << " sec";
+  }
+
+  void SetNuma(const NumaConf& conf) override {
+    NumaMemory::SetHugePages(conf.huge_pages);
+    if (!conf.pin) return;
+    for (const auto& m : data_) CHECK(m.empty()) << "numa placement must be set before loading";
+    numa_.Init(conf, nt_);
+    KVStoreBucket::SetNodes(numa_.nodes());
+    // bucket i is always processed by the i-th worker of pool_, except in the
+    // concurrent mode, where the request threads are not pinned, but the
+    // memory of a bucket is still allocated on its node
+    std::vector<int> pinned(nt_);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &pinned, i]() {
+          pinned[i] = NumaMemory::PinThread(numa_.cpu(i));
+          KVStoreBucket::Set(i);
+        }, i);
+    }
+    pool_.Wait();
+    LOG(INFO) << NumaTopology::Get().Print();
+    LOG(INFO) << numa_.Print();
+    for (int i = 0; i < nt_; ++i) {
+      LOG_IF(WARNING, !pinned[i]) << "failed to pin bucket " << i
+                                  << " to cpu " << numa_.cpu(i);
+    }
+  }
+
+  void Slice(const Message& request, const std::vector<Range<Key>>& krs,
+             std::vector<Message*>* msgs) override {
+    const auto& call = request.task.param();
+    if (call.hot_key() == ParamCall::HOT_ENTRIES) {
+      // the entries go to all the other servers
+      auto my = NodeInfo::KeyRange();
+      for (size_t i = 0; i < krs.size(); ++i) {
+        Message* m = (*msgs)[i];
+        m->valid = !(krs[i] == my);
+        m->key = request.key;
+        m->value = request.value;
+      }
+    } else {
+      // the forwarded pushes and pulls go to the owners
+      SliceMessage<K>(request, krs, msgs, call.dyn_val_size());
+    }
+  }
+
+  void HandleHotKeys(Message* request, Message* response) override {
+    const auto& call = request->task.param();
+    if (call.hot_key() == ParamCall::HOT_KEYS) {
+      std::lock_guard<std::mutex> lk(hot_mu_);
+      response->set_key(hot_published_);
+      return;
+    }
+    CHECK(hot_.enabled()) << "the hot key replication is not set on "
+                          << NodeInfo::MyID();
+    SArray<K> key(request->key);
+    int n = key.size();
+    if (call.hot_key() == ParamCall::HOT_ENTRIES) {
+      CHECK_EQ(request->value.size(), (size_t)2);
+      SArray<char> val(request->value[0]);
+      SArray<uint64> off(request->value[1]);
+      CHECK_EQ(off.size(), (size_t)n + 1);
+      gate_.Enter();
+      WithReplicas([this, request, n, &key, &val, &off]() {
+          replicas_.Update(request->sender, n, key.data(), val.data(), off.data());
+        });
+      gate_.Leave();
+    } else if (call.hot_key() == ParamCall::HOT_PULLS && n) {
+      // count the pulls of the replicas as pulls on this server
+      CHECK_EQ(request->value.size(), (size_t)1);
+      SArray<int> cnt(request->value[0]);
+      CHECK_EQ(cnt.size(), (size_t)n);
+      gate_.Enter();
+      Lane* lane = AcquireLane();
+      SliceKey(lane, key.data(), 0, n);
+      uint32 min_count = MinCount(hot_requests_);
+      ForBuckets(lane, [this, lane, &key, &cnt, min_count](int i) {
+          for (int j = lane->key_pos[i]; j < lane->key_pos[i+1]; ++j) {
+            heavy_[i].Count(key[j], cnt[j], min_count);
+          }
+        });
+      ReleaseLane(lane);
+      gate_.Leave();
+      int64_t s = 0;
+      for (int c : cnt) s += c;
+      hot_remote_ += s;
+    }
   }
 
   // process a pull message
   void HandlePull(Message* msg) {
+    gate_.Enter();
+    Lane* lane = AcquireLane();
     int ts = msg->task.time();
-    handle_.Start(false, ts, msg->task.cmd(), (void*)msg);
+    lane->handle->Start(false, ts, msg->task.cmd(), (void*)msg);
     SArray<K> key(msg->key);
     size_t n = key.size();
     SArray<V> val(n * k_);
     bool dyn = msg->task.param().dyn_val_size();
+    // the keys out of [lo, hi) are the hot keys of others replicated here
+    int lo = 0, hi = n;
+    if (hot_.enabled()) {
+      OwnKeys(key.data(), n, &lo, &hi);
+      lane->hot_min = MinCount(++ hot_requests_);
+      hot_own_ += hi - lo;
+    }
+    bool replica = lo > 0 || hi < (int)n;
     if (dyn) {
       SArray<int> val_size(n);
-      size_t start = 0;
-      for (size_t i = 0; i < n; ++i) {
-        K key_i = key[i];
-        size_t len = val.size() - start;
-        while (len < (size_t)k_) {
-          val.resize(val.size()*2 + 5); len = val.size() - start;
-        }
-        V* val_data = val.data() + start;
-        Blob<V> pull(val_data, len);
-        handle_.Pull(key_i, data_[0][key_i], pull);
-        if (pull.data != val_data) {
-          while ((start + pull.size) > val.size()) val.resize(val.size()*2 + 5);
-          memcpy(val.data()+start, pull.data, sizeof(V)*pull.size);
+
+      SliceKey(lane, key.data(), lo, hi);
+
+      auto& dyn_val = lane->dyn_val;
+      for (auto& v : dyn_val) v.clear();
+      ForBuckets(lane, [this, lane, &key, &val_size](int i) {
+          ThreadDynPull(lane, key.data(), val_size.data(), i); });
+      auto& hot_val = lane->hot_val;
+      hot_val.clear();
+      lane->hot_split = 0;
+      if (replica) {
+        PullReplicas(lane, key.data(), n, lo, hi, nullptr, val_size.data());
+      }
+
+      // concatenate the values pulled by each thread, after the replicas of
+      // the keys before lo and before the ones of the keys after hi
+      std::vector<size_t> val_pos(nt_+1, lane->hot_split);
+      for (int i = 0; i < nt_; ++i) {
+        val_pos[i+1] = val_pos[i] + dyn_val[i].size();
+      }
+      val = SArray<V>(val_pos[nt_] + hot_val.size() - lane->hot_split);
+      for (int i = 0; i < nt_; ++i) {
+        auto copy = [&val, &val_pos, &dyn_val, i]() {
+          memcpy(val.data() + val_pos[i], dyn_val[i].data(),
+                 dyn_val[i].size() * sizeof(V)); };
+        if (concurrent_) {
+          copy();
         } else {
-          CHECK_LE(pull.size, len);
+          pool_.Add(copy, i);
         }
-        start += pull.size;
-        val_size[i] = pull.size;
       }
-      val.resize(start);
+      if (!concurrent_) pool_.Wait();
+      if (replica) {
+        size_t split = lane->hot_split;
+        memcpy(val.data(), hot_val.data(), split * sizeof(V));
+        memcpy(val.data() + val_pos[nt_], hot_val.data() + split,
+               (hot_val.size() - split) * sizeof(V));
+      }
+
       msg->add_value(val);
       msg->add_value(val_size);
     } else {
 
-      SliceKey(key.data(), n);
+      SliceKey(lane, key.data(), lo, hi);
 
-      for (int i = 0; i < nt_; ++i) {
-        pool_.Add([this, &key, &val, n, i](){
-            ThreadPull(key.data(), val.data(), n, k_, i); });
-      }
-      pool_.Wait();
+      ForBuckets(lane, [this, lane, &key, &val, n](int i) {
+          ThreadPull(lane, key.data(), val.data(), n, k_, i); });
+      if (replica) PullReplicas(lane, key.data(), n, lo, hi, val.data(), nullptr);
 
       msg->add_value(val);
     }
+    if (hot_keys_) LogTierStats();
 
     FinishReceivedRequest(ts, msg->sender);
-    handle_.Finish();
+    lane->handle->Finish();
+    if (aggr_) EndWindow(lane, false);
+    if (hot_.enabled()) EndRound(lane);
+    ReleaseLane(lane);
+    gate_.Leave();
   }
 
   // process a push message
   void HandlePush(const Message* msg) {
+    gate_.Enter();
+    Lane* lane = AcquireLane();
     int ts = msg->task.time();
-    handle_.Start(true, ts, msg->task.cmd(), (void*)msg);
+    lane->cmd = msg->task.cmd();
+    lane->handle->Start(true, ts, lane->cmd, (void*)msg);
 
     SArray<K> key(msg->key);
     size_t n = key.size();
     bool dyn = msg->task.param().dyn_val_size();
+    // the keys out of [lo, hi) are the hot keys of others replicated here
+    int lo = 0, hi = n;
+    if (hot_.enabled()) OwnKeys(key.data(), n, &lo, &hi);
 
     if (dyn && n) {
       CHECK_EQ(msg->value.size(), (size_t)2);
       SArray<V> val(msg->value[0]);
       SArray<int> val_size(msg->value[1]);
       CHECK_EQ(val_size.size(), n);
+      SliceKey(lane, key.data(), lo, hi);
+
+      // the value offset of the first key each thread processes
+      std::vector<size_t> val_pos(nt_+1, 0);
       size_t len = 0;
-      for (int i : val_size) len += i;
+      for (int i = 0; i < lo; ++i) len += val_size[i];
+      val_pos[0] = len;
+      for (int t = 0, i = lo; t < nt_; ++t) {
+        for (; i < lane->key_pos[t+1]; ++i) len += val_size[i];
+        val_pos[t+1] = len;
+      }
+      for (size_t i = hi; i < n; ++i) len += val_size[i];
       CHECK_EQ(len, val.size());
 
-      V* val_data = val.data();
-      for (size_t i = 0; i < n; ++i) {
-        K key_i = key[i];
-        size_t k = val_size[i];
-        if (k == 0) continue;
-        handle_.Push(key_i, Blob<const V>(val_data, k), data_[0][key_i]);
-        val_data += k;
+      ForBuckets(lane, [this, lane, &key, &val, &val_size, &val_pos](int i) {
+          ThreadDynPush(lane, key.data(), val.data() + val_pos[i],
+                        val_size.data(), i); });
+      if (lo > 0 || hi < (int)n) {
+        PushReplicas(lane, key.data(), n, lo, hi, val.data(), val_size.data(), 0);
       }
     } else if (!dyn && n) {
       CHECK_EQ(msg->value.size(), (size_t)1);
@@ -105,99 +362,995 @@ class KVStoreSparse : public KVStore {
       size_t k = val.size() / n;
       CHECK_EQ(k * n, val.size());
 
-      SliceKey(key.data(), n);
+      SliceKey(lane, key.data(), lo, hi);
 
-      for (int i = 0; i < nt_; ++i) {
-        pool_.Add([this, &key, &val, n, k, i](){
-            ThreadPush(key.data(), val.data(), n, k, i); });
+      ForBuckets(lane, [this, lane, &key, &val, n, k](int i) {
+          ThreadPush(lane, key.data(), val.data(), n, k, i); });
+      if (lo > 0 || hi < (int)n) {
+        PushReplicas(lane, key.data(), n, lo, hi, val.data(), nullptr, k);
       }
-      pool_.Wait();
     }
 
     FinishReceivedRequest(ts, msg->sender);
-    handle_.Finish();
+    lane->handle->Finish();
+    if (aggr_ && n) EndWindow(lane, true);
+    ReleaseLane(lane);
+    gate_.Leave();
   }
 
   virtual void Load(dmlc::Stream *fi) {
     handle_.Load(fi);
+    CopyHandle();
     K key;
     while (true) {
       if (fi->Read(&key, sizeof(K)) != sizeof(K)) break;
-      GetValue(key).Load(fi);
-    }
-    int size = 0;
-    for (int i = 0; i < nt_; ++i) {
-      LOG(INFO) << "bucket " << i << " [" <<
-          min_key_ + i * bucket_size_ << ", " <<
-          min_key_ + (i+1) * bucket_size_ << ") " <<
-          data_[i].size();
-      size += data_[i].size();
+      LoadValue(Bucket(key), key, fi);
     }
-    LOG(INFO) << "loaded " << size << " kv pairs in total";
+    LogLoaded();
   }
 
   virtual void Save(dmlc::Stream *fo) const {
+    snapshot_.Wait();
     handle_.Save(fo);
-    int saved = 0;
+    size_t saved = 0;
+    for (int i = 0; i < nt_; ++i) saved += SaveBucket(i, fo);
+    LOG(INFO) << "saved " << saved << " kv pairs in total";
+  }
 
+  void SaveShards(const std::string& name, bool compress) override {
+    FlushPushes();
+    snapshot_.Wait();
+    auto start = std::chrono::steady_clock::now();
+    {
+      std::unique_ptr<dmlc::Stream> fo(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+      KVShardHeader head;
+      head.num_shards = nt_;
+      head.min_key = min_key_;
+      head.bucket_size = bucket_size_;
+      head.Save(fo.get());
+      handle_.Save(fo.get());
+    }
+    std::vector<size_t> saved(nt_), bytes(nt_), raw_bytes(nt_);
     for (int i = 0; i < nt_; ++i) {
-      int s = 0;
-      for (const auto& it : data_[i]) {
-        if (it.second.Empty()) continue;
-        fo->Write(&it.first, sizeof(K));
-        it.second.Save(fo);
-        ++ s;
+      pool_.Add([this, &name, compress, &saved, &bytes, &raw_bytes, i]() {
+          auto file = KVShardName(name, i);
+          std::unique_ptr<dmlc::Stream> fo(
+              CHECK_NOTNULL(dmlc::Stream::Create(file.c_str(), "w")));
+          KVShardOutStream out(fo.get(), compress);
+          saved[i] = SaveBucket(i, &out);
+          out.Flush();
+          bytes[i] = out.bytes();
+          raw_bytes[i] = out.raw_bytes();
+        }, i);
+    }
+    pool_.Wait();
+    size_t n = 0, b = 0, r = 0;
+    for (int i = 0; i < nt_; ++i) {
+      n += saved[i]; b += bytes[i]; r += raw_bytes[i];
+    }
+    double sec = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    LOG(INFO) << "saved " << n << " kv pairs into " << nt_ << " shards, "
+              << b / 1e6 << " MB (" << r / 1e6 << " MB uncompressed) in "
+              << sec << " sec";
+  }
+
+  void LoadShards(const std::string& name) override {
+    auto start = std::chrono::steady_clock::now();
+    KVShardHeader head;
+    {
+      std::unique_ptr<dmlc::Stream> fi(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "r")));
+      CHECK(head.Load(fi.get())) << name << " is not a sharded model";
+      handle_.Load(fi.get());
+      CopyHandle();
+    }
+    // if the buckets are the same, shard i is loaded into bucket i by thread
+    // i. otherwise a thread loads shards into any bucket, under its lock
+    int ns = head.num_shards;
+    bool same = ns == nt_ && head.min_key == (uint64)min_key_ &&
+                head.bucket_size == (uint64)bucket_size_;
+    std::unique_ptr<std::mutex[]> mu(same ? nullptr : new std::mutex[nt_]);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &name, ns, same, &mu, i]() {
+          for (int j = i; j < ns; j += nt_) {
+            auto file = KVShardName(name, j);
+            std::unique_ptr<dmlc::Stream> fi(
+                CHECK_NOTNULL(dmlc::Stream::Create(file.c_str(), "r")));
+            KVShardInStream in(fi.get());
+            K key;
+            while (in.Read(&key, sizeof(K)) == sizeof(K)) {
+              int b = Bucket(key);
+              if (same) {
+                CHECK_EQ(b, i) << "key " << key << " is not in shard " << j;
+                LoadValue(b, key, &in);
+              } else {
+                std::lock_guard<std::mutex> lk(mu[b]);
+                LoadValue(b, key, &in);
+              }
+            }
+          }
+        }, i);
+    }
+    pool_.Wait();
+    LogLoaded();
+    LOG(INFO) << "loaded " << ns << " shards in "
+              << std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count() << " sec";
+  }
+
+  void SaveIndexed(const std::string& name) override {
+    FlushPushes();
+    snapshot_.Wait();
+    auto start = std::chrono::steady_clock::now();
+    // the buckets are in the order of keys, so only sort within each one
+    std::vector<std::vector<K>> keys(nt_);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &keys, i]() { keys[i] = SortedKeys(i); }, i);
+    }
+    pool_.Wait();
+    std::unique_ptr<dmlc::Stream> fo(
+        CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+    KVIndexedWriter out(fo.get(), sizeof(K));
+    handle_.Save(out.meta());
+    for (int i = 0; i < nt_; ++i) {
+      SaveSorted(i, keys[i], false, &out);
+      std::vector<K>().swap(keys[i]);
+    }
+    size_t n = out.Finish();
+    LOG(INFO) << "saved " << n << " kv pairs into the indexed model " << name
+              << " in " << std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count() << " sec";
+  }
+
+  void LoadIndexed(const std::string& name, bool lazy) override {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<KVIndexedFile> file(new KVIndexedFile());
+    file->Open(name);
+    size_t off;
+    auto parent = KVDeltaParent(*file, &off);
+    if (parent.size()) LoadFile(parent, lazy);
+    {
+      size_t len;
+      const char* meta = file->meta(&len);
+      dmlc::MemoryFixedSizeStream fi(const_cast<char*>(meta + off), len - off);
+      handle_.Load(&fi);
+      CopyHandle();
+    }
+    auto pos = BucketRanges(*file);
+    size_t n = file->size();
+
+    if (file->delta()) {
+      ApplyDelta(*file, pos);
+      LogLoaded();
+      LOG(INFO) << "applied " << n << " changes of the delta " << name << " in "
+                << std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count() << " sec";
+      return;
+    }
+    for (auto& b : batch_) b.lazy.Clear();
+    indexed_ = std::move(file);
+    if (lazy) {
+      for (int i = 0; i < nt_; ++i) {
+        batch_[i].lazy.Init(indexed_.get(), pos[i], pos[i+1]);
       }
-      LOG(INFO) << "bucket " << i << " [" <<
-          min_key_ + i * bucket_size_ << ", " <<
-          min_key_ + (i+1) * bucket_size_ << "): " << s;
-      saved += s;
+      LOG(INFO) << "mapped " << n << " kv pairs of " << name << " to load lazily";
+      return;
     }
-    LOG(INFO) << "saved " << saved << " kv pairs in total";
+    const auto& f = *indexed_;
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &f, &pos, i]() {
+          size_t m = pos[i+1] - pos[i];
+          ReserveKeys(&data_[i], hot_keys_ ? std::min(m, hot_keys_) : m);
+          for (size_t j = pos[i]; j < pos[i+1]; ++j) {
+            size_t len;
+            const char* val = f.value(j, &len);
+            dmlc::MemoryFixedSizeStream fi(const_cast<char*>(val), len);
+            LoadValue(i, (K)f.key(j), &fi);
+          }
+        }, i);
+    }
+    pool_.Wait();
+    indexed_.reset();
+    LogLoaded();
+    LOG(INFO) << "loaded the indexed model " << name << " in "
+              << std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count() << " sec";
+  }
+
+  void TrackChanges() override {
+    for (auto& b : batch_) {
+      b.dirty.Enable();
+      b.eviction.set_dirty(&b.dirty);
+    }
+  }
+
+  void ClearChanges() override {
+    for (auto& b : batch_) b.dirty.Clear();
+  }
+
+  void SaveDelta(const std::string& name, const std::string& parent) override {
+    CHECK(batch_[0].dirty.enabled()) << "changes are not tracked";
+    FlushPushes();
+    snapshot_.Wait();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::vector<K>> keys(nt_);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &keys, i]() { keys[i] = batch_[i].dirty.Take(); }, i);
+    }
+    pool_.Wait();
+    std::unique_ptr<dmlc::Stream> fo(
+        CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+    KVIndexedWriter out(fo.get(), sizeof(K), KVIndexedHeader::kDelta);
+    out.meta()->Write(parent);
+    handle_.Save(out.meta());
+    for (int i = 0; i < nt_; ++i) {
+      SaveSorted(i, keys[i], true, &out);
+      std::vector<K>().swap(keys[i]);
+    }
+    size_t n = out.Finish();
+    LOG(INFO) << "saved " << n << " changes since " << parent
+              << " into the delta " << name << " in "
+              << std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count() << " sec";
   }
 
+  void SaveAsync(const KVSaveConf& conf) override {
+    snapshot_.Wait();
+    // the snapshot point, between two requests
+    gate_.Close();
+    if (aggr_) ApplyPushes(lanes_[0].get());
+    std::string handle;
+    {
+      dmlc::MemoryStringStream fo(&handle);
+      handle_.Save(&fo);
+    }
+    bool delta = conf.format == KVSaveConf::kDelta;
+    CHECK(!delta || batch_[0].dirty.enabled()) << "changes are not tracked";
+    std::vector<std::vector<K>> keys(nt_);
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &keys, delta, i]() {
+          if (delta) {
+            keys[i] = batch_[i].dirty.Take();
+          } else {
+            batch_[i].dirty.Clear();
+          }
+        }, i);
+    }
+    pool_.Wait();
+    KVShardHeader head;
+    head.num_shards = nt_;
+    head.min_key = min_key_;
+    head.bucket_size = bucket_size_;
+    snapshot_.Start(conf, handle, head, std::move(keys),
+                    [this, delta](int i, const std::vector<K>& keys, KVImage<K>* img) {
+                      if (delta) {
+                        SaveSorted(i, keys, true, img);
+                      } else {
+                        SaveSorted(i, SortedKeys(i), false, img);
+                      }
+                    });
+    gate_.Open();
+    LOG(INFO) << "took a snapshot to save into " << conf.name;
+  }
+
+  void WaitSave() override { snapshot_.Wait(); }
+
  private:
-  std::vector<std::unordered_map<K, E>> data_;
+  std::vector<Map> data_;
   Handle handle_;
   int k_, nt_;
 
   K min_key_;
   K bucket_size_;
+  // the end of the key range
+  K max_key_;
 
   ThreadPool pool_;
+  // the nodes and cpus of the buckets, see SetNuma
+  NumaPlacement numa_;
+
+  // the state of a request being processed
+  struct Lane {
+    Lane(Handle* h, int nt, int i)
+        : handle(h), key_pos(nt+1), dyn_val(nt), id(i) { }
+    // the handle_ for the first lane, otherwise a copy of it
+    Handle* handle;
+    std::unique_ptr<Handle> copy;
+    // the keys of bucket i are [key_pos[i], key_pos[i+1])
+    std::vector<int> key_pos;
+    // per bucket buffers for dynamic length pull
+    std::vector<std::vector<V>> dyn_val;
+    int id;
+    // the cmd of the push
+    int cmd = 0;
+    // the count for a pulled key to be a hot key candidate
+    uint32 hot_min = 0;
+    // buffers for the keys pulled from or pushed into the replicas
+    std::vector<K> hot_key;
+    std::vector<Blob<V>> hot_pull;
+    std::vector<Blob<const V>> hot_push;
+    std::vector<V> hot_buf;
+    // the dynamic length values pulled from the replicas, the first hot_split
+    // ones are of the keys before the key range
+    std::vector<V> hot_val;
+    size_t hot_split = 0;
+  };
+
+  // one lane per request processed at the same time
+  std::vector<std::unique_ptr<Lane>> lanes_;
+  std::vector<Lane*> free_lanes_;
+  std::mutex lane_mu_;
+
+  // process requests concurrently, each by one thread, see SetConcurrency
+  bool concurrent_ = false;
+
+  // per bucket batches
+  std::vector<KVBatch<K, E, V, Handle, Map>> batch_;
 
-  std::vector<int> key_pos_;
+  // the locks of the buckets, held by a concurrent request accessing one
+  std::unique_ptr<std::mutex[]> bucket_mu_;
 
-  void SliceKey(K* key, int n) {
-    key_pos_[0] = 0;
+  // the lock of the eviction archive
+  std::mutex archive_mu_;
+
+  // the number of entries of a bucket kept in RAM if tiering, otherwise 0
+  size_t hot_keys_ = 0;
+
+  // the indexed model the lazy entries of the buckets are loaded from
+  std::unique_ptr<KVIndexedFile> indexed_;
+
+  // entered by a request, so a snapshot is taken between requests
+  KVRequestGate gate_;
+
+  // aggregate pushes within a window, see SetAggregation
+  bool aggr_ = false;
+  int aggr_requests_ = 0, aggr_usec_ = 0;
+  // the push requests and the start time of the window
+  std::atomic<int> aggr_count_{0};
+  std::atomic<int64_t> aggr_start_{0};
+  // a request is applying the window
+  std::atomic<bool> aggr_applying_{false};
+  // the cmds of the aggregated pushes
+  std::vector<int> aggr_cmds_;
+  std::mutex aggr_mu_;
+  std::chrono::steady_clock::time_point aggr_log_time_;
+
+  // the snapshot being saved in the background
+  mutable KVSnapshot<K> snapshot_;
+
+  // replicate the hot keys, see SetHotKeys
+  KVHotKeyConf hot_;
+  // per bucket heavy hitters of the pulls
+  std::vector<KVHeavyHitters<K>> heavy_;
+  // the replicas of the hot keys of the others, in bucket 0
+  KVHotReplicas<K, E, V, Handle, Map> replicas_;
+  KVBatch<K, E, V, Handle, Map> replica_batch_;
+  // the pull requests from workers, the pulled own keys, and the pulls
+  // forwarded by the replicas of the round
+  std::atomic<int64_t> hot_requests_{0}, hot_own_{0}, hot_remote_{0};
+  std::atomic<int64_t> hot_start_{0};
+  // a request is running the round
+  std::atomic<bool> hot_running_{false};
+  // the sorted hot keys of the last round
+  std::vector<K> hot_last_;
+  // the hot keys replicated on the others, replied to workers
+  SArray<K> hot_published_;
+  std::mutex hot_mu_;
+
+  Lane* AcquireLane() {
+    if (!concurrent_) return lanes_[0].get();
+    std::lock_guard<std::mutex> lk(lane_mu_);
+    CHECK(!free_lanes_.empty());
+    Lane* lane = free_lanes_.back();
+    free_lanes_.pop_back();
+    return lane;
+  }
+
+  void ReleaseLane(Lane* lane) {
+    if (!concurrent_) return;
+    std::lock_guard<std::mutex> lk(lane_mu_);
+    free_lanes_.push_back(lane);
+  }
+
+  /// copies handle_ into the other lanes
+  void CopyHandle() {
+    for (size_t i = 1; i < lanes_.size(); ++i) {
+      lanes_[i]->copy.reset(new Handle(handle_));
+      lanes_[i]->handle = lanes_[i]->copy.get();
+    }
+  }
+
+  /// slices the keys [lo, hi) of \a key, which are in the key range of this
+  /// server, into the buckets
+  void SliceKey(Lane* lane, const K* key, int lo, int hi) {
+    auto& pos = lane->key_pos;
+    pos[0] = lo;
     for (int i = 1; i < nt_; ++i) {
       K k = min_key_ + bucket_size_ * i;
-      key_pos_[i] = std::lower_bound(key + key_pos_[i-1], key + n, k) - key;
-      LOG(ERROR) << key_pos_[i] - key_pos_[i-1];
+      pos[i] = std::lower_bound(key + pos[i-1], key + hi, k) - key;
     }
-    key_pos_[nt_] = n;
+    pos[nt_] = hi;
   }
 
-  E& GetValue(K key) {
-    return data_[(key - min_key_) / bucket_size_][key];
+  /**
+   * \brief runs f(i) for each bucket i, with the keys sliced into \a lane
+   *
+   * The buckets are run by the pool in parallel. But in the concurrent mode,
+   * the calling thread runs the buckets with keys one by one under their
+   * locks. It starts from a different bucket per lane and skips the locked
+   * ones, so concurrent requests mostly access different buckets, and only
+   * waits when all the remaining buckets are locked.
+   */
+  template <typename F>
+  void ForBuckets(const Lane* lane, const F& f) {
+    const auto& pos = lane->key_pos;
+    uint32_t todo = 0;
+    for (int i = 0; i < nt_; ++i) {
+      if (pos[i] < pos[i+1]) todo |= 1U << i;
+    }
+    RunBuckets(lane, todo, f);
+  }
+
+  /// runs f(i) for all buckets in the same way as ForBuckets
+  template <typename F>
+  void ForAllBuckets(const Lane* lane, const F& f) {
+    RunBuckets(lane, (1U << nt_) - 1, f);
+  }
+
+  /// runs f(i) for each bucket i, or only the ones in the bit mask \a todo in
+  /// the concurrent mode, see ForBuckets
+  template <typename F>
+  void RunBuckets(const Lane* lane, uint32_t todo, const F& f) {
+    if (!concurrent_) {
+      for (int i = 0; i < nt_; ++i) pool_.Add([&f, i]() { f(i); }, i);
+      pool_.Wait();
+      return;
+    }
+    bool wait = false;
+    while (todo) {
+      bool progress = false;
+      for (int j = 0; j < nt_; ++j) {
+        int i = (lane->id + j) % nt_;
+        if (!(todo >> i & 1)) continue;
+        std::unique_lock<std::mutex> lk(bucket_mu_[i], std::defer_lock);
+        if (wait) {
+          lk.lock();
+        } else if (!lk.try_lock()) {
+          continue;
+        }
+        f(i);
+        todo &= ~(1U << i);
+        progress = true;
+        wait = false;
+      }
+      // wait the next one if all the remaining buckets were locked
+      wait = !progress;
+    }
+  }
+
+  static int64_t NowUsec() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /// counts a push request into the window, and applies the window by \a lane
+  /// if it ends, unless another request is applying it
+  void EndWindow(Lane* lane, bool push) {
+    int n = push ? ++ aggr_count_ : aggr_count_.load();
+    if (n == 0) return;
+    if (push && n == 1) aggr_start_ = NowUsec();
+    bool end = (aggr_requests_ && n >= aggr_requests_) ||
+               (aggr_usec_ && NowUsec() - aggr_start_ >= aggr_usec_);
+    if (push) {
+      std::lock_guard<std::mutex> lk(aggr_mu_);
+      if (std::find(aggr_cmds_.begin(), aggr_cmds_.end(), lane->cmd) ==
+          aggr_cmds_.end()) {
+        aggr_cmds_.push_back(lane->cmd);
+      }
+    }
+    if (!end) return;
+    bool applying = false;
+    if (!aggr_applying_.compare_exchange_strong(applying, true)) return;
+    ApplyPushes(lane);
+    aggr_applying_ = false;
   }
 
-  void ThreadPush(K* key, V* val, int n, int k, int tid) {
-    auto& data = data_[tid];
-    val += key_pos_[tid] * k;
-    for (int i = key_pos_[tid]; i < key_pos_[tid+1]; ++i, val += k) {
-      K key_i = key[i];
-      handle_.Push(key_i, Blob<const V>(val, k), data[key_i]);
+  /// pushes the sums of the window per cmd with the handle of \a lane
+  void ApplyPushes(Lane* lane) {
+    aggr_count_ = 0;
+    std::vector<int> cmds;
+    {
+      std::lock_guard<std::mutex> lk(aggr_mu_);
+      cmds = aggr_cmds_;
+    }
+    std::vector<size_t> added(nt_), applied(nt_);
+    for (int cmd : cmds) {
+      lane->handle->Start(true, -1, cmd, nullptr);
+      ForAllBuckets(lane, [this, lane, cmd, &added, &applied](int i) {
+          KVStoreBucket::Set(i);
+          snapshot_.Cow(i);
+          auto& batch = batch_[i];
+          batch.aggr.Take(cmd, [this, lane, &batch, i](
+              size_t n, const K* key, const Blob<const V>* val) {
+              batch.Push(*lane->handle, data_[i], n, key, val); });
+          added[i] = batch.aggr.added();
+          applied[i] = batch.aggr.applied();
+        });
+      lane->handle->Finish();
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - aggr_log_time_ < std::chrono::seconds(60)) return;
+    aggr_log_time_ = now;
+    size_t a = 0, b = 0;
+    for (int i = 0; i < nt_; ++i) { a += added[i]; b += applied[i]; }
+    LOG(INFO) << "aggregated " << a << " pushed keys into " << b << " updates";
+  }
+
+  /// the keys of the sorted key[0, n) in the key range of this server are
+  /// [lo, hi), the others are the hot keys of others replicated here
+  void OwnKeys(const K* key, int n, int* lo, int* hi) const {
+    *lo = std::lower_bound(key, key + n, min_key_) - key;
+    *hi = std::lower_bound(key + *lo, key + n, max_key_) - key;
+  }
+
+  /// the count for a key to be hot after \a requests pull requests
+  uint32 MinCount(int64_t requests) const {
+    return std::max<uint32>(2, std::ceil(hot_.min_share * requests));
+  }
+
+  /// counts the pulls of key[0, m) in bucket \a tid
+  void CountPulls(const Lane* lane, const K* key, int m, int tid) {
+    auto& h = heavy_[tid];
+    for (int i = 0; i < m; ++i) h.Count(key[i], 1, lane->hot_min);
+  }
+
+  /// runs f() on the replicas, in bucket 0 whose arenas their entries use
+  template <typename F>
+  void WithReplicas(const F& f) {
+    std::unique_lock<std::mutex> lk(bucket_mu_[0], std::defer_lock);
+    if (concurrent_) lk.lock();
+    KVStoreBucket::Set(0);
+    snapshot_.Cow(0);
+    f();
+  }
+
+  /**
+   * \brief pulls the keys out of [lo, hi) from the replicas
+   *
+   * A fixed length value is pulled into \a val. A dynamic length one is
+   * pulled into lane->hot_val with its size in \a val_size, where the ones of
+   * the keys before \a lo are the first lane->hot_split values.
+   */
+  void PullReplicas(Lane* lane, const K* key, int n, int lo, int hi, V* val,
+                    int* val_size) {
+    auto& hk = lane->hot_key;
+    hk.assign(key, key + lo);
+    hk.insert(hk.end(), key + hi, key + n);
+    int m = hk.size();
+    auto& pull = lane->hot_pull;
+    pull.resize(m);
+    auto& buf = lane->hot_buf;
+    if (val_size) buf.resize((size_t)m * k_);
+    for (int j = 0; j < m; ++j) {
+      int i = j < lo ? j : j - lo + hi;
+      pull[j] = val_size ? Blob<V>(buf.data() + (size_t)j * k_, k_) :
+                Blob<V>(val + (size_t)i * k_, k_);
+    }
+    WithReplicas([this, lane, &hk, &pull, &buf, m, lo, hi, val, val_size]() {
+        replicas_.Pull(*lane->handle, replica_batch_, m, hk.data(), pull.data());
+        // copy while the replicas are locked
+        auto& hot_val = lane->hot_val;
+        for (int j = 0; j < m; ++j) {
+          int i = j < lo ? j : j - lo + hi;
+          const auto& p = pull[j];
+          if (j == lo) lane->hot_split = hot_val.size();
+          if (val_size) {
+            hot_val.insert(hot_val.end(), p.data, p.data + p.size);
+            val_size[i] = p.size;
+          } else {
+            CHECK_EQ(p.size, (size_t)k_) << "use dyanmic pull";
+            V* v = val + (size_t)i * k_;
+            if (p.data != v) memcpy(v, p.data, sizeof(V) * k_);
+          }
+        }
+        if (lo == m) lane->hot_split = hot_val.size();
+      });
+  }
+
+  /**
+   * \brief pushes the keys out of [lo, hi) into the replicas, with \a k values
+   * per key, or \a val_size for dynamic length values
+   */
+  void PushReplicas(Lane* lane, const K* key, int n, int lo, int hi,
+                    const V* val, const int* val_size, size_t k) {
+    auto& hk = lane->hot_key;
+    auto& push = lane->hot_push;
+    hk.clear(); push.clear();
+    size_t off = 0;
+    for (int i = 0; i < n; ++i) {
+      size_t len = val_size ? val_size[i] : k;
+      if ((i < lo || i >= hi) && len) {
+        hk.push_back(key[i]);
+        push.push_back(Blob<const V>(val + off, len));
+      }
+      off += len;
+    }
+    WithReplicas([this, lane, &hk, &push]() {
+        replicas_.Push(lane->cmd, hk.size(), hk.data(), push.data());
+      });
+  }
+
+  /// runs the round of the hot key replication by \a lane if it ends, unless
+  /// another request is running it
+  void EndRound(Lane* lane) {
+    if (NowUsec() - hot_start_ < hot_.round_sec * 1000000LL) return;
+    bool running = false;
+    if (!hot_running_.compare_exchange_strong(running, true)) return;
+    HotKeyRound(lane);
+    hot_running_ = false;
+  }
+
+  /**
+   * \brief finds the hot keys of the round and sends their entries to the
+   * others, then forwards the pushes and pulls on the replicas to the owners
+   *
+   * A key stays hot with half of the count, so it does not flip when its
+   * pulls forwarded by the replicas arrive in the next round. A hot key is
+   * replied to workers after it has been sent once, so the replicas have it
+   * before the pulls arrive.
+   */
+  void HotKeyRound(Lane* lane) {
+    int64_t now = NowUsec();
+    double sec = (now - hot_start_) / 1e6;
+    hot_start_ = now;
+    uint32 min_count = MinCount(hot_requests_.exchange(0));
+
+    // the candidates of the buckets
+    std::vector<std::vector<std::pair<uint32, K>>> cand(nt_);
+    ForAllBuckets(lane, [this, &cand, min_count](int i) {
+        heavy_[i].Take(min_count / 2, &cand[i]); });
+    std::vector<std::pair<uint32, K>> all;
+    for (const auto& c : cand) {
+      for (const auto& it : c) {
+        if (it.first >= min_count || std::binary_search(
+                hot_last_.begin(), hot_last_.end(), it.second)) {
+          all.push_back(it);
+        }
+      }
+    }
+    if (all.size() > hot_.max_keys) {
+      std::partial_sort(all.begin(), all.begin() + hot_.max_keys, all.end(),
+                        std::greater<std::pair<uint32, K>>());
+      all.resize(hot_.max_keys);
+    }
+    std::vector<K> hot(all.size());
+    for (size_t i = 0; i < all.size(); ++i) hot[i] = all[i].second;
+    std::sort(hot.begin(), hot.end());
+
+    // send the entries to the others
+    std::vector<KVImage<K>> img(nt_);
+    SliceKey(lane, hot.data(), 0, hot.size());
+    ForBuckets(lane, [this, lane, &hot, &img](int i) {
+        KVStoreBucket::Set(i);
+        for (int j = lane->key_pos[i]; j < lane->key_pos[i+1]; ++j) {
+          auto it = data_[i].find(hot[j]);
+          if (it != data_[i].end() && !it->second.Empty()) {
+            img[i].Add(hot[j], it->second);
+          }
+        }
+      });
+    size_t nk = 0, nb = 0;
+    for (const auto& m : img) { nk += m.size(); nb += m.val.size(); }
+    SArray<K> key(nk);
+    SArray<char> val(nb);
+    SArray<uint64> off(nk + 1);
+    off[0] = 0;
+    for (size_t i = 0, j = 0, b = 0; i < img.size(); ++i) {
+      const auto& m = img[i];
+      for (size_t t = 0; t < m.size(); ++t, ++j) {
+        key[j] = m.key[t];
+        off[j+1] = b + m.off[t+1];
+      }
+      memcpy(val.data() + b, m.val.data(), m.val.size());
+      b += m.val.size();
+    }
+    std::vector<Message> msgs;
+    msgs.push_back(HotKeyMessage(ParamCall::HOT_ENTRIES));
+    msgs.back().set_key(key);
+    msgs.back().add_value(val);
+    msgs.back().add_value(off);
+
+    // the keys hot in the last round have been sent
+    std::vector<K> published;
+    std::set_intersection(hot.begin(), hot.end(), hot_last_.begin(),
+                          hot_last_.end(), std::back_inserter(published));
+    hot_last_ = hot;
+    {
+      std::lock_guard<std::mutex> lk(hot_mu_);
+      hot_published_ = SArray<K>(published);
+    }
+
+    // forward the pushes and pulls on the replicas
+    KVHotKeyStats stats;
+    WithReplicas([this, &msgs, &stats]() {
+        replicas_.TakePushes([this, &msgs](
+            int cmd, size_t n, const K* key, const Blob<const V>* val) {
+            std::vector<size_t> idx(n);
+            for (size_t i = 0; i < n; ++i) idx[i] = i;
+            std::sort(idx.begin(), idx.end(), [key](size_t a, size_t b) {
+                return key[a] < key[b]; });
+            SArray<K> k(n);
+            SArray<int> len(n);
+            size_t total = 0;
+            for (size_t i = 0; i < n; ++i) total += val[i].size;
+            SArray<V> v(total);
+            for (size_t i = 0, p = 0; i < n; ++i) {
+              const auto& b = val[idx[i]];
+              k[i] = key[idx[i]];
+              len[i] = b.size;
+              memcpy(v.data() + p, b.data, b.size * sizeof(V));
+              p += b.size;
+            }
+            msgs.push_back(HotKeyMessage(ParamCall::HOT_PUSHES));
+            auto& m = msgs.back();
+            m.task.set_cmd(cmd);
+            m.task.mutable_param()->set_dyn_val_size(true);
+            m.set_key(k);
+            m.add_value(v);
+            m.add_value(len);
+          });
+        std::vector<std::pair<K, int>> pulls;
+        replicas_.TakePulls([&pulls](K k, uint32 c) { pulls.emplace_back(k, c); });
+        if (pulls.size()) {
+          std::sort(pulls.begin(), pulls.end());
+          SArray<K> k(pulls.size());
+          SArray<int> c(pulls.size());
+          for (size_t i = 0; i < pulls.size(); ++i) {
+            k[i] = pulls[i].first; c[i] = pulls[i].second;
+          }
+          msgs.push_back(HotKeyMessage(ParamCall::HOT_PULLS));
+          msgs.back().set_key(k);
+          msgs.back().add_value(c);
+        }
+        stats = replicas_.stats();
+        replicas_.stats() = KVHotKeyStats();
+      });
+    for (auto& m : msgs) Submit(&m);
+
+    stats.own = hot_own_.exchange(0);
+    stats.remote = hot_remote_.exchange(0);
+    LOG(INFO) << stats.Print(sec, hot.size(), published.size());
+  }
+
+  /// returns a request of the hot key replication to the servers
+  static Message HotKeyMessage(ParamCall::HotKeyCall call) {
+    Message msg(Task(), kServerGroup);
+    msg.task.mutable_param()->set_hot_key(call);
+    msg.task.mutable_param()->set_push(true);
+    return msg;
+  }
+
+  int Bucket(K key) const {
+    int b = (key - min_key_) / bucket_size_;
+    CHECK_LT((unsigned)b, (unsigned)nt_) << "key " << key << " is out of range";
+    return b;
+  }
+
+  /// loads the value of \a key into bucket \a b
+  void LoadValue(int b, K key, dmlc::Stream* fi) {
+    KVStoreBucket::Set(b);
+    if (hot_keys_ && data_[b].size() >= hot_keys_) {
+      // demote directly when RAM is full
+      E val;
+      val.Load(fi);
+      batch_[b].cold.Put(key, val);
+    } else {
+      data_[b][key].Load(fi);
+    }
+  }
+
+  /// saves the non-empty KV pairs of bucket \a i, returns the number of them
+  size_t SaveBucket(int i, dmlc::Stream* fo) const {
+    size_t s = 0;
+    for (const auto& it : data_[i]) {
+      if (it.second.Empty()) continue;
+      fo->Write(&it.first, sizeof(K));
+      it.second.Save(fo);
+      ++ s;
+    }
+    if (batch_[i].cold.enabled()) {
+      KVStoreBucket::Set(i);
+      batch_[i].cold.ForEach([fo, &s](K key, const E& val) {
+          if (val.Empty()) return;
+          fo->Write(&key, sizeof(K));
+          val.Save(fo);
+          ++ s;
+        });
+    }
+    batch_[i].lazy.ForEach([fo, &s](K key, const char* val, size_t len) {
+        fo->Write(&key, sizeof(K));
+        fo->Write(val, len);
+        ++ s;
+      });
+    LOG(INFO) << "bucket " << i << " [" <<
+        min_key_ + i * bucket_size_ << ", " <<
+        min_key_ + (i+1) * bucket_size_ << "): " << s;
+    return s;
+  }
+
+  /// returns the sorted keys of the non-empty KV pairs of bucket \a i
+  std::vector<K> SortedKeys(int i) const {
+    const auto& b = batch_[i];
+    std::vector<K> keys;
+    keys.reserve(data_[i].size() + b.lazy.size());
+    for (const auto& it : data_[i]) {
+      if (!it.second.Empty()) keys.push_back(it.first);
+    }
+    // the empty ones in the cold tier are skipped by SaveSorted
+    if (b.cold.enabled()) b.cold.ForEachKey([&keys](K k) { keys.push_back(k); });
+    b.lazy.ForEach([&keys](K k, const char* val, size_t len) { keys.push_back(k); });
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  }
+
+  /**
+   * \brief adds the KV pairs of the sorted \a keys of bucket \a i into \a
+   * out, a \ref KVIndexedWriter or \ref KVImage. for a \a delta, the keys not
+   * found or empty are added as deleted
+   */
+  template <typename Out>
+  void SaveSorted(int i, const std::vector<K>& keys, bool delta, Out* out) const {
+    KVStoreBucket::Set(i);
+    const auto& b = batch_[i];
+    for (K k : keys) {
+      auto it = data_[i].find(k);
+      if (it != data_[i].end()) {
+        if (!it->second.Empty()) {
+          out->Add(k, it->second);
+        } else if (delta) {
+          out->AddRaw(k, nullptr, 0);
+        }
+        continue;
+      }
+      size_t len;
+      const char* val = b.lazy.Find(k, &len);
+      if (val) {
+        out->AddRaw(k, val, len);
+        continue;
+      }
+      E e;
+      bool cold = b.cold.enabled() && b.cold.Get(k, &e);
+      CHECK(cold || delta) << "key " << k << " is lost";
+      if (cold && !e.Empty()) {
+        out->Add(k, e);
+      } else if (delta) {
+        out->AddRaw(k, nullptr, 0);
+      }
+    }
+  }
+
+  /// returns the ranges of the keys of the buckets in \a file, bucket i has
+  /// [pos[i], pos[i+1])
+  std::vector<size_t> BucketRanges(const KVIndexedFile& file) const {
+    size_t n = file.size();
+    if (n) { Bucket(file.key(0)); Bucket(file.key(n-1)); }
+    std::vector<size_t> pos(nt_+1, 0);
+    for (int i = 1; i < nt_; ++i) {
+      pos[i] = file.LowerBound((uint64)min_key_ + (uint64)bucket_size_ * i);
+    }
+    pos[nt_] = n;
+    return pos;
+  }
+
+  /// replaces or deletes the KV pairs in the delta \a file
+  void ApplyDelta(const KVIndexedFile& file, const std::vector<size_t>& pos) {
+    for (int i = 0; i < nt_; ++i) {
+      pool_.Add([this, &file, &pos, i]() {
+          KVStoreBucket::Set(i);
+          auto& b = batch_[i];
+          for (size_t j = pos[i]; j < pos[i+1]; ++j) {
+            K key = file.key(j);
+            data_[i].erase(key);
+            b.lazy.Drop(key);
+            if (b.cold.enabled()) b.cold.Erase(key);
+            size_t len;
+            const char* val = file.value(j, &len);
+            if (len == 0) continue;
+            dmlc::MemoryFixedSizeStream fi(const_cast<char*>(val), len);
+            LoadValue(i, key, &fi);
+          }
+        }, i);
+    }
+    pool_.Wait();
+  }
+
+  void LogLoaded() const {
+    size_t size = 0;
+    for (int i = 0; i < nt_; ++i) {
+      LOG(INFO) << "bucket " << i << " [" <<
+          min_key_ + i * bucket_size_ << ", " <<
+          min_key_ + (i+1) * bucket_size_ << ") " <<
+          data_[i].size();
+      size += data_[i].size();
+    }
+    LOG(INFO) << "loaded " << size << " kv pairs in total";
+    if (!numa_.empty()) LOG(INFO) << NumaMemory::Print();
+  }
+
+  void ThreadPush(Lane* lane, K* key, V* val, int n, int k, int tid) {
+    KVStoreBucket::Set(tid);
+    snapshot_.Cow(tid);
+    auto& batch = batch_[tid];
+    int begin = lane->key_pos[tid], m = lane->key_pos[tid+1] - begin;
+    val += begin * k;
+    batch.push.resize(m);
+    for (int i = 0; i < m; ++i) batch.push[i] = Blob<const V>(val + i * k, k);
+    if (aggr_) {
+      batch.aggr.Add(lane->cmd, m, key + begin, batch.push.data());
+    } else {
+      batch.Push(*lane->handle, data_[tid], m, key + begin, batch.push.data());
+    }
+  }
+
+  void ThreadDynPush(Lane* lane, K* key, V* val, int* val_size, int tid) {
+    KVStoreBucket::Set(tid);
+    snapshot_.Cow(tid);
+    auto& batch = batch_[tid];
+    batch.key.clear(); batch.push.clear();
+    for (int i = lane->key_pos[tid]; i < lane->key_pos[tid+1]; ++i) {
+      size_t k = val_size[i];
+      if (k == 0) continue;
+      batch.key.push_back(key[i]);
+      batch.push.push_back(Blob<const V>(val, k));
+      val += k;
+    }
+    if (aggr_) {
+      batch.aggr.Add(lane->cmd, batch.key.size(), batch.key.data(),
+                     batch.push.data());
+    } else {
+      batch.Push(*lane->handle, data_[tid], batch.key.size(), batch.key.data(),
+                 batch.push.data());
+    }
+  }
+
+  void ThreadDynPull(Lane* lane, K* key, int* val_size, int tid) {
+    KVStoreBucket::Set(tid);
+    snapshot_.Cow(tid);
+    auto& batch = batch_[tid];
+    int begin = lane->key_pos[tid], m = lane->key_pos[tid+1] - begin;
+    batch.val.resize((size_t)m * k_);
+    batch.pull.resize(m);
+    for (int i = 0; i < m; ++i) {
+      batch.pull[i] = Blob<V>(batch.val.data() + (size_t)i * k_, k_);
+    }
+    batch.Pull(*lane->handle, data_[tid], m, key + begin, batch.pull.data());
+    if (hot_.enabled()) CountPulls(lane, key + begin, m, tid);
+
+    // copied by their sizes, so a value pointing out of batch.val can have
+    // any length
+    auto& val = lane->dyn_val[tid];
+    val.clear();
+    for (int i = 0; i < m; ++i) {
+      const auto& pull = batch.pull[i];
+      val.insert(val.end(), pull.data, pull.data + pull.size);
+      val_size[begin + i] = pull.size;
     }
   }
 
-  void ThreadPull(K* key, V* val, int n, int k, int tid) {
-    auto& data = data_[tid];
-    val += key_pos_[tid] * k;
-    for (int i = key_pos_[tid]; i < key_pos_[tid+1]; ++i, val += k) {
-      K key_i = key[i];
-      Blob<V> pull(val, k);
-      handle_.Pull(key_i, data[key_i], pull);
+  void ThreadPull(Lane* lane, K* key, V* val, int n, int k, int tid) {
+    KVStoreBucket::Set(tid);
+    snapshot_.Cow(tid);
+    auto& batch = batch_[tid];
+    int begin = lane->key_pos[tid], m = lane->key_pos[tid+1] - begin;
+    val += begin * k;
+    batch.pull.resize(m);
+    for (int i = 0; i < m; ++i) batch.pull[i] = Blob<V>(val + i * k, k);
+    batch.Pull(*lane->handle, data_[tid], m, key + begin, batch.pull.data());
+    if (hot_.enabled()) CountPulls(lane, key + begin, m, tid);
+    for (int i = 0; i < m; ++i, val += k) {
+      const auto& pull = batch.pull[i];
       CHECK_EQ(pull.size, (size_t)k) << "use dyanmic pull";
       if (pull.data != val) {
         memcpy(val, pull.data, sizeof(V)*k);
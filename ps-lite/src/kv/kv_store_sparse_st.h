@@ -1,8 +1,10 @@
 #pragma once
 #include "kv/kv_store.h"
+#include "kv/kv_batch.h"
 namespace ps {
 
-template<typename K, typename E, typename V, typename Handle>
+template<typename K, typename E, typename V, typename Handle,
+         typename Map = std::unordered_map<K, E>>
 class KVStoreSparseST : public KVStore {
  public:
   KVStoreSparseST(int id, Handle handle, int pull_val_len)
@@ -10,50 +12,97 @@ class KVStoreSparseST : public KVStore {
     CHECK_GT(k_, 0);
   }
 
-  virtual ~KVStoreSparseST() { }
+  virtual ~KVStoreSparseST() { snapshot_.Wait(); }
 
   void Clear() override {
+    snapshot_.Wait();
     data_.clear();
+    batch_.lazy.Clear();
+    indexed_.reset();
   }
 
+  size_t Compact() override {
+    std::lock_guard<std::mutex> lk(request_mu_);
+    snapshot_.Cow(0);
+    size_t s = data_.size();
+    size_t b = EraseEmpty(&data_);
+    LOG(INFO) << "compaction removed " << s - data_.size() << " kv pairs, "
+              << "reclaimed " << b / 1e6 << " MB";
+    return b;
+  }
+
+  void SetAdmission(int threshold, int sketch_size, int num_hashes) override {
+    batch_.admission.Init(threshold, sketch_size, num_hashes);
+  }
+
+  KVAdmissionStats GetAdmissionStats() const override {
+    return batch_.admission.stats();
+  }
+
+  void SetEviction(const KVEvictionConf& conf) override {
+    CHECK(!batch_.cold.enabled()) << "eviction cannot be used with tiering";
+    if (conf.archive) handle_.Save(conf.archive);
+    batch_.eviction.Init(conf, 0, &archive_mu_);
+  }
+
+  void SetTier(const KVTierConf& conf) override {
+    if (!conf.enabled()) return;
+    CHECK_GT(conf.hot_keys, (size_t)0);
+    CHECK(!batch_.eviction.enabled()) << "tiering cannot be used with eviction";
+    KVEvictionConf c;
+    c.max_keys = hot_keys_ = conf.hot_keys;
+    // so the pushes of the last max_keys keys span about 64 ticks
+    c.tick_keys = (hot_keys_ - 1) / 64 + 1;
+    batch_.cold.Open(conf.path + "_bucket-0");
+    batch_.eviction.Init(c, 0, &archive_mu_, &batch_.cold);
+  }
+
+  KVTierStats GetTierStats() override { return batch_.cold.stats(); }
+
   // process a pull message
   void HandlePull(Message* msg) {
+    std::lock_guard<std::mutex> lk(request_mu_);
+    snapshot_.Cow(0);
     int ts = msg->task.time();
     handle_.Start(false, ts, msg->task.cmd(), (void*)msg);
     SArray<K> key(msg->key);
     size_t n = key.size();
-    SArray<V> val(n * k_);
     bool dyn = msg->task.param().dyn_val_size();
     if (dyn) {
       SArray<int> val_size(n);
-      size_t start = 0;
+      batch_.val.resize(n * k_);
+      batch_.pull.resize(n);
       for (size_t i = 0; i < n; ++i) {
-        K key_i = key[i];
-        size_t len = val.size() - start;
-        while (len < (size_t)k_) {
-          val.resize(val.size()*2 + 5); len = val.size() - start;
-        }
-        V* val_data = val.data() + start;
-        Blob<V> pull(val_data, len);
-        handle_.Pull(key_i, data_[key_i], pull);
-        if (pull.data != val_data) {
-          while ((start + pull.size) > val.size()) val.resize(val.size()*2 + 5);
-          memcpy(val.data()+start, pull.data, sizeof(V)*pull.size);
-        } else {
-          CHECK_LE(pull.size, len);
-        }
-        start += pull.size;
+        batch_.pull[i] = Blob<V>(batch_.val.data() + i * k_, k_);
+      }
+      batch_.Pull(handle_, data_, n, key.data(), batch_.pull.data());
+
+      // copied by their sizes, so a value pointing out of batch_.val can
+      // have any length
+      size_t len = 0;
+      for (size_t i = 0; i < n; ++i) {
+        const auto& pull = batch_.pull[i];
         val_size[i] = pull.size;
+        len += pull.size;
+      }
+      SArray<V> val(len);
+      V* val_data = val.data();
+      for (const auto& pull : batch_.pull) {
+        memcpy(val_data, pull.data, sizeof(V)*pull.size);
+        val_data += pull.size;
       }
-      val.resize(start);
       msg->add_value(val);
       msg->add_value(val_size);
     } else {
+      SArray<V> val(n * k_);
       V* val_data = val.data();
+      batch_.pull.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        batch_.pull[i] = Blob<V>(val_data + i * k_, k_);
+      }
+      batch_.Pull(handle_, data_, n, key.data(), batch_.pull.data());
       for (size_t i = 0; i < n; ++i, val_data += k_) {
-        K key_i = key[i];
-        Blob<V> pull(val_data, k_);
-        handle_.Pull(key_i, data_[key_i], pull);
+        const auto& pull = batch_.pull[i];
         CHECK_EQ(pull.size, (size_t)k_) << "use dyanmic pull";
         if (pull.data != val_data) {
           memcpy(val_data, pull.data, sizeof(V)*k_);
@@ -61,6 +110,7 @@ class KVStoreSparseST : public KVStore {
       }
       msg->add_value(val);
     }
+    if (hot_keys_) LogTierStats();
 
     FinishReceivedRequest(ts, msg->sender);
     handle_.Finish();
@@ -68,6 +118,8 @@ class KVStoreSparseST : public KVStore {
 
   // process a push message
   void HandlePush(const Message* msg) {
+    std::lock_guard<std::mutex> lk(request_mu_);
+    snapshot_.Cow(0);
     int ts = msg->task.time();
     handle_.Start(true, ts, msg->task.cmd(), (void*)msg);
 
@@ -85,24 +137,27 @@ class KVStoreSparseST : public KVStore {
       CHECK_EQ(len, val.size());
 
       V* val_data = val.data();
+      batch_.key.clear(); batch_.push.clear();
       for (size_t i = 0; i < n; ++i) {
-        K key_i = key[i];
         size_t k = val_size[i];
         if (k == 0) continue;
-        handle_.Push(key_i, Blob<const V>(val_data, k), data_[key_i]);
+        batch_.key.push_back(key[i]);
+        batch_.push.push_back(Blob<const V>(val_data, k));
         val_data += k;
       }
+      batch_.Push(handle_, data_, batch_.key.size(), batch_.key.data(),
+                  batch_.push.data());
     } else if (!dyn && n) {
       CHECK_EQ(msg->value.size(), (size_t)1);
       SArray<V> val(msg->value[0]);
       size_t k = val.size() / n;
       CHECK_EQ(k * n, val.size());
 
-      V* val_data = val.data();
-      for (size_t i = 0; i < n; ++i, val_data += k) {
-        K key_i = key[i];
-        handle_.Push(key_i, Blob<const V>(val_data, k), data_[key_i]);
+      batch_.push.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        batch_.push[i] = Blob<const V>(val.data() + i * k, k);
       }
+      batch_.Push(handle_, data_, n, key.data(), batch_.push.data());
     }
 
     FinishReceivedRequest(ts, msg->sender);
@@ -113,30 +168,277 @@ class KVStoreSparseST : public KVStore {
     //LOG(INFO) << "begin to load handle...";
     handle_.Load(fi);
     //LOG(INFO) << "end of loading handle...";
+    LoadPairs(fi);
+    LOG(INFO) << "loaded " << data_.size() << " kv pairs";
+  }
+
+  virtual void Save(dmlc::Stream *fo) const {
+    snapshot_.Wait();
+    handle_.Save(fo);
+    LOG(INFO) << "saved " << SavePairs(fo) << " kv pairs";
+  }
+
+  void SaveShards(const std::string& name, bool compress) override {
+    snapshot_.Wait();
+    {
+      std::unique_ptr<dmlc::Stream> fo(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+      KVShardHeader head;
+      head.bucket_size = (uint64)-1;
+      head.Save(fo.get());
+      handle_.Save(fo.get());
+    }
+    auto file = KVShardName(name, 0);
+    std::unique_ptr<dmlc::Stream> fo(
+        CHECK_NOTNULL(dmlc::Stream::Create(file.c_str(), "w")));
+    KVShardOutStream out(fo.get(), compress);
+    size_t saved = SavePairs(&out);
+    out.Flush();
+    LOG(INFO) << "saved " << saved << " kv pairs, " << out.bytes() / 1e6
+              << " MB (" << out.raw_bytes() / 1e6 << " MB uncompressed)";
+  }
+
+  void LoadShards(const std::string& name) override {
+    KVShardHeader head;
+    {
+      std::unique_ptr<dmlc::Stream> fi(
+          CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "r")));
+      CHECK(head.Load(fi.get())) << name << " is not a sharded model";
+      handle_.Load(fi.get());
+    }
+    for (uint32 i = 0; i < head.num_shards; ++i) {
+      auto file = KVShardName(name, i);
+      std::unique_ptr<dmlc::Stream> fi(
+          CHECK_NOTNULL(dmlc::Stream::Create(file.c_str(), "r")));
+      KVShardInStream in(fi.get());
+      LoadPairs(&in);
+    }
+    LOG(INFO) << "loaded " << data_.size() << " kv pairs from "
+              << head.num_shards << " shards";
+  }
+
+  void SaveIndexed(const std::string& name) override {
+    snapshot_.Wait();
+    auto keys = SortedKeys();
+    std::unique_ptr<dmlc::Stream> fo(
+        CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+    KVIndexedWriter out(fo.get(), sizeof(K));
+    handle_.Save(out.meta());
+    SaveSorted(keys, false, &out);
+    LOG(INFO) << "saved " << out.Finish() << " kv pairs into the indexed model "
+              << name;
+  }
+
+  void LoadIndexed(const std::string& name, bool lazy) override {
+    std::unique_ptr<KVIndexedFile> file(new KVIndexedFile());
+    file->Open(name);
+    size_t off;
+    auto parent = KVDeltaParent(*file, &off);
+    if (parent.size()) LoadFile(parent, lazy);
+    {
+      size_t len;
+      const char* meta = file->meta(&len);
+      dmlc::MemoryFixedSizeStream fi(const_cast<char*>(meta + off), len - off);
+      handle_.Load(&fi);
+    }
+    if (file->delta()) {
+      ApplyDelta(*file);
+      LOG(INFO) << "applied " << file->size() << " changes of the delta " << name
+                << ", " << data_.size() << " kv pairs";
+      return;
+    }
+    batch_.lazy.Clear();
+    indexed_ = std::move(file);
+    const auto& f = *indexed_;
+    if (lazy) {
+      batch_.lazy.Init(&f, 0, f.size());
+      LOG(INFO) << "mapped " << f.size() << " kv pairs of " << name
+                << " to load lazily";
+      return;
+    }
+    ReserveKeys(&data_, hot_keys_ ? std::min(f.size(), hot_keys_) : f.size());
+    for (size_t i = 0; i < f.size(); ++i) {
+      size_t len;
+      const char* val = f.value(i, &len);
+      dmlc::MemoryFixedSizeStream fi(const_cast<char*>(val), len);
+      LoadValue(f.key(i), &fi);
+    }
+    indexed_.reset();
+    LOG(INFO) << "loaded " << data_.size() << " kv pairs";
+  }
+
+  void TrackChanges() override {
+    batch_.dirty.Enable();
+    batch_.eviction.set_dirty(&batch_.dirty);
+  }
+
+  void ClearChanges() override { batch_.dirty.Clear(); }
+
+  void SaveDelta(const std::string& name, const std::string& parent) override {
+    CHECK(batch_.dirty.enabled()) << "changes are not tracked";
+    snapshot_.Wait();
+    std::unique_ptr<dmlc::Stream> fo(
+        CHECK_NOTNULL(dmlc::Stream::Create(name.c_str(), "w")));
+    KVIndexedWriter out(fo.get(), sizeof(K), KVIndexedHeader::kDelta);
+    out.meta()->Write(parent);
+    handle_.Save(out.meta());
+    SaveSorted(batch_.dirty.Take(), true, &out);
+    LOG(INFO) << "saved " << out.Finish() << " changes since " << parent
+              << " into the delta " << name;
+  }
+
+  void SaveAsync(const KVSaveConf& conf) override {
+    snapshot_.Wait();
+    // the snapshot point, between two requests
+    std::lock_guard<std::mutex> lk(request_mu_);
+    std::string handle;
+    {
+      dmlc::MemoryStringStream fo(&handle);
+      handle_.Save(&fo);
+    }
+    bool delta = conf.format == KVSaveConf::kDelta;
+    CHECK(!delta || batch_.dirty.enabled()) << "changes are not tracked";
+    std::vector<std::vector<K>> keys(1);
+    if (delta) {
+      keys[0] = batch_.dirty.Take();
+    } else {
+      batch_.dirty.Clear();
+    }
+    KVShardHeader head;
+    head.bucket_size = (uint64)-1;
+    snapshot_.Start(conf, handle, head, std::move(keys),
+                    [this, delta](int i, const std::vector<K>& keys, KVImage<K>* img) {
+                      if (delta) {
+                        SaveSorted(keys, true, img);
+                      } else {
+                        SaveSorted(SortedKeys(), false, img);
+                      }
+                    });
+    LOG(INFO) << "took a snapshot to save into " << conf.name;
+  }
+
+  void WaitSave() override { snapshot_.Wait(); }
+
+ private:
+  void LoadPairs(dmlc::Stream *fi) {
     K key;
     while (true) {
       if (fi->Read(&key, sizeof(K)) != sizeof(K)) break;
-      //LOG(INFO) << "key: " << key ;
+      LoadValue(key, fi);
+    }
+  }
+
+  void LoadValue(K key, dmlc::Stream *fi) {
+    if (hot_keys_ && data_.size() >= hot_keys_) {
+      // demote directly when RAM is full
+      E val;
+      val.Load(fi);
+      batch_.cold.Put(key, val);
+    } else {
       data_[key].Load(fi);
     }
-    LOG(INFO) << "loaded " << data_.size() << " kv pairs";
   }
 
-  virtual void Save(dmlc::Stream *fo) const {
-    handle_.Save(fo);
-    int saved = 0;
+  /// returns the sorted keys of the non-empty KV pairs, the empty ones in the
+  /// cold tier are skipped by SaveSorted
+  std::vector<K> SortedKeys() const {
+    std::vector<K> keys;
+    keys.reserve(data_.size() + batch_.lazy.size());
+    for (const auto& it : data_) {
+      if (!it.second.Empty()) keys.push_back(it.first);
+    }
+    if (batch_.cold.enabled()) {
+      batch_.cold.ForEachKey([&keys](K k) { keys.push_back(k); });
+    }
+    batch_.lazy.ForEach([&keys](K k, const char* val, size_t len) {
+        keys.push_back(k); });
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  }
+
+  /// adds the KV pairs of the sorted \a keys into \a out, a \ref
+  /// KVIndexedWriter or \ref KVImage. for a \a delta, the keys not found or
+  /// empty are added as deleted
+  template <typename Out>
+  void SaveSorted(const std::vector<K>& keys, bool delta, Out* out) const {
+    for (K k : keys) {
+      auto it = data_.find(k);
+      if (it != data_.end()) {
+        if (!it->second.Empty()) {
+          out->Add(k, it->second);
+        } else if (delta) {
+          out->AddRaw(k, nullptr, 0);
+        }
+        continue;
+      }
+      size_t len;
+      const char* val = batch_.lazy.Find(k, &len);
+      if (val) {
+        out->AddRaw(k, val, len);
+        continue;
+      }
+      E e;
+      bool cold = batch_.cold.enabled() && batch_.cold.Get(k, &e);
+      CHECK(cold || delta) << "key " << k << " is lost";
+      if (cold && !e.Empty()) {
+        out->Add(k, e);
+      } else if (delta) {
+        out->AddRaw(k, nullptr, 0);
+      }
+    }
+  }
+
+  /// replaces or deletes the KV pairs in the delta \a file
+  void ApplyDelta(const KVIndexedFile& file) {
+    for (size_t i = 0; i < file.size(); ++i) {
+      K key = file.key(i);
+      data_.erase(key);
+      batch_.lazy.Drop(key);
+      if (batch_.cold.enabled()) batch_.cold.Erase(key);
+      size_t len;
+      const char* val = file.value(i, &len);
+      if (len == 0) continue;
+      dmlc::MemoryFixedSizeStream fi(const_cast<char*>(val), len);
+      LoadValue(key, &fi);
+    }
+  }
+
+  size_t SavePairs(dmlc::Stream *fo) const {
+    size_t saved = 0;
     for (const auto& it : data_) {
       if (it.second.Empty()) continue;
       fo->Write(&it.first, sizeof(K));
       it.second.Save(fo);
       saved++;
     }
-    LOG(INFO) << "saved " << saved << " kv pairs";
+    if (batch_.cold.enabled()) {
+      batch_.cold.ForEach([fo, &saved](K key, const E& val) {
+          if (val.Empty()) return;
+          fo->Write(&key, sizeof(K));
+          val.Save(fo);
+          saved++;
+        });
+    }
+    batch_.lazy.ForEach([fo, &saved](K key, const char* val, size_t len) {
+        fo->Write(&key, sizeof(K));
+        fo->Write(val, len);
+        saved++;
+      });
+    return saved;
   }
 
- private:
-  std::unordered_map<K, E> data_;
+  Map data_;
   Handle handle_;
   int k_;
+  KVBatch<K, E, V, Handle, Map> batch_;
+  std::mutex archive_mu_;
+  size_t hot_keys_ = 0;
+  // the indexed model the lazy entries are loaded from
+  std::unique_ptr<KVIndexedFile> indexed_;
+  // held by a request and by a compaction, so a snapshot is taken between
+  // them, and a compaction does not erase the entries a request uses
+  std::mutex request_mu_;
+  // the snapshot being saved in the background
+  mutable KVSnapshot<K> snapshot_;
 };
 }  // namespace ps
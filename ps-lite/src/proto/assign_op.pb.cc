@@ -0,0 +1,79 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/assign_op.proto
+
+#include "proto/assign_op.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+}  // namespace ps
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2fassign_5fop_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fassign_5fop_2eproto = nullptr;
+const uint32_t TableStruct_proto_2fassign_5fop_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_proto_2fassign_5fop_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025proto/assign_op.proto\022\002ps*X\n\004AsOp\022\n\n\006A"
+  "SSIGN\020\000\022\010\n\004PLUS\020\001\022\t\n\005MINUS\020\002\022\t\n\005TIMES\020\003\022"
+  "\n\n\006DIVIDE\020\004\022\007\n\003AND\020\005\022\006\n\002OR\020\006\022\007\n\003XOR\020\007"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fassign_5fop_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fassign_5fop_2eproto = {
+    false, false, 117, descriptor_table_protodef_proto_2fassign_5fop_2eproto,
+    "proto/assign_op.proto",
+    &descriptor_table_proto_2fassign_5fop_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_proto_2fassign_5fop_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_proto_2fassign_5fop_2eproto,
+    file_level_service_descriptors_proto_2fassign_5fop_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fassign_5fop_2eproto_getter() {
+  return &descriptor_table_proto_2fassign_5fop_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fassign_5fop_2eproto(&descriptor_table_proto_2fassign_5fop_2eproto);
+namespace ps {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AsOp_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fassign_5fop_2eproto);
+  return file_level_enum_descriptors_proto_2fassign_5fop_2eproto[0];
+}
+bool AsOp_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
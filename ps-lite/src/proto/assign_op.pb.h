@@ -0,0 +1,112 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/assign_op.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fassign_5fop_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fassign_5fop_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fassign_5fop_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fassign_5fop_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fassign_5fop_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum AsOp : int {
+  ASSIGN = 0,
+  PLUS = 1,
+  MINUS = 2,
+  TIMES = 3,
+  DIVIDE = 4,
+  AND = 5,
+  OR = 6,
+  XOR = 7
+};
+bool AsOp_IsValid(int value);
+constexpr AsOp AsOp_MIN = ASSIGN;
+constexpr AsOp AsOp_MAX = XOR;
+constexpr int AsOp_ARRAYSIZE = AsOp_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AsOp_descriptor();
+template<typename T>
+inline const std::string& AsOp_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, AsOp>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function AsOp_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    AsOp_descriptor(), enum_t_value);
+}
+inline bool AsOp_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, AsOp* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<AsOp>(
+    AsOp_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::AsOp> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::AsOp>() {
+  return ::ps::AsOp_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fassign_5fop_2eproto
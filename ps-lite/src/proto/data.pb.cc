@@ -0,0 +1,1106 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/data.proto
+
+#include "proto/data.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR DataConfig::DataConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_)*/{}
+  , /*decltype(_impl_.range_)*/nullptr
+  , /*decltype(_impl_.hdfs_)*/nullptr
+  , /*decltype(_impl_.ignore_feature_group_)*/false
+  , /*decltype(_impl_.shuffle_)*/false
+  , /*decltype(_impl_.replica_)*/1
+  , /*decltype(_impl_.format_)*/1
+  , /*decltype(_impl_.text_)*/1
+  , /*decltype(_impl_.max_num_files_per_worker_)*/-1
+  , /*decltype(_impl_.max_num_lines_per_file_)*/-1} {}
+struct DataConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DataConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DataConfigDefaultTypeInternal() {}
+  union {
+    DataConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataConfigDefaultTypeInternal _DataConfig_default_instance_;
+PROTOBUF_CONSTEXPR HDFSConfig::HDFSConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.home_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ugi_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.namenode_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct HDFSConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HDFSConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HDFSConfigDefaultTypeInternal() {}
+  union {
+    HDFSConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HDFSConfigDefaultTypeInternal _HDFSConfig_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2fdata_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2fdata_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fdata_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.file_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.hdfs_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.ignore_feature_group_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.max_num_files_per_worker_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.max_num_lines_per_file_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.shuffle_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.range_),
+  PROTOBUF_FIELD_OFFSET(::ps::DataConfig, _impl_.replica_),
+  5,
+  6,
+  ~0u,
+  1,
+  2,
+  7,
+  8,
+  3,
+  0,
+  4,
+  PROTOBUF_FIELD_OFFSET(::ps::HDFSConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::HDFSConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::HDFSConfig, _impl_.home_),
+  PROTOBUF_FIELD_OFFSET(::ps::HDFSConfig, _impl_.ugi_),
+  PROTOBUF_FIELD_OFFSET(::ps::HDFSConfig, _impl_.namenode_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 16, -1, sizeof(::ps::DataConfig)},
+  { 26, 35, -1, sizeof(::ps::HDFSConfig)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_DataConfig_default_instance_._instance,
+  &::ps::_HDFSConfig_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020proto/data.proto\022\002ps\032\021proto/range.prot"
+  "o\"\314\003\n\nDataConfig\022)\n\006format\030\001 \002(\0162\031.ps.Da"
+  "taConfig.DataFormat\022\'\n\004text\030\002 \001(\0162\031.ps.D"
+  "ataConfig.TextFormat\022\014\n\004file\030\003 \003(\t\022\034\n\004hd"
+  "fs\030\005 \001(\0132\016.ps.HDFSConfig\022\034\n\024ignore_featu"
+  "re_group\030\006 \001(\010\022$\n\030max_num_files_per_work"
+  "er\030\007 \001(\005:\002-1\022\"\n\026max_num_lines_per_file\030\010"
+  " \001(\005:\002-1\022\026\n\007shuffle\030\t \001(\010:\005false\022\032\n\005rang"
+  "e\030\004 \001(\0132\013.ps.PbRange\022\022\n\007replica\030\n \001(\005:\0011"
+  "\"*\n\nDataFormat\022\007\n\003BIN\020\001\022\t\n\005PROTO\020\002\022\010\n\004TE"
+  "XT\020\003\"b\n\nTextFormat\022\t\n\005DENSE\020\001\022\n\n\006SPARSE\020"
+  "\002\022\021\n\rSPARSE_BINARY\020\003\022\t\n\005ADFEA\020\004\022\n\n\006LIBSV"
+  "M\020\005\022\013\n\007TERAFEA\020\006\022\006\n\002VW\020\007\"9\n\nHDFSConfig\022\014"
+  "\n\004home\030\001 \001(\t\022\013\n\003ugi\030\002 \001(\t\022\020\n\010namenode\030\004 "
+  "\001(\t"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fdata_2eproto_deps[1] = {
+  &::descriptor_table_proto_2frange_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fdata_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fdata_2eproto = {
+    false, false, 563, descriptor_table_protodef_proto_2fdata_2eproto,
+    "proto/data.proto",
+    &descriptor_table_proto_2fdata_2eproto_once, descriptor_table_proto_2fdata_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_proto_2fdata_2eproto::offsets,
+    file_level_metadata_proto_2fdata_2eproto, file_level_enum_descriptors_proto_2fdata_2eproto,
+    file_level_service_descriptors_proto_2fdata_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fdata_2eproto_getter() {
+  return &descriptor_table_proto_2fdata_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fdata_2eproto(&descriptor_table_proto_2fdata_2eproto);
+namespace ps {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataConfig_DataFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fdata_2eproto);
+  return file_level_enum_descriptors_proto_2fdata_2eproto[0];
+}
+bool DataConfig_DataFormat_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DataConfig_DataFormat DataConfig::BIN;
+constexpr DataConfig_DataFormat DataConfig::PROTO;
+constexpr DataConfig_DataFormat DataConfig::TEXT;
+constexpr DataConfig_DataFormat DataConfig::DataFormat_MIN;
+constexpr DataConfig_DataFormat DataConfig::DataFormat_MAX;
+constexpr int DataConfig::DataFormat_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataConfig_TextFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fdata_2eproto);
+  return file_level_enum_descriptors_proto_2fdata_2eproto[1];
+}
+bool DataConfig_TextFormat_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DataConfig_TextFormat DataConfig::DENSE;
+constexpr DataConfig_TextFormat DataConfig::SPARSE;
+constexpr DataConfig_TextFormat DataConfig::SPARSE_BINARY;
+constexpr DataConfig_TextFormat DataConfig::ADFEA;
+constexpr DataConfig_TextFormat DataConfig::LIBSVM;
+constexpr DataConfig_TextFormat DataConfig::TERAFEA;
+constexpr DataConfig_TextFormat DataConfig::VW;
+constexpr DataConfig_TextFormat DataConfig::TextFormat_MIN;
+constexpr DataConfig_TextFormat DataConfig::TextFormat_MAX;
+constexpr int DataConfig::TextFormat_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class DataConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DataConfig>()._impl_._has_bits_);
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::ps::HDFSConfig& hdfs(const DataConfig* msg);
+  static void set_has_hdfs(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ignore_feature_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_max_num_files_per_worker(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_max_num_lines_per_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_shuffle(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ps::PbRange& range(const DataConfig* msg);
+  static void set_has_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replica(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000020) ^ 0x00000020) != 0;
+  }
+};
+
+const ::ps::HDFSConfig&
+DataConfig::_Internal::hdfs(const DataConfig* msg) {
+  return *msg->_impl_.hdfs_;
+}
+const ::ps::PbRange&
+DataConfig::_Internal::range(const DataConfig* msg) {
+  return *msg->_impl_.range_;
+}
+void DataConfig::clear_range() {
+  if (_impl_.range_ != nullptr) _impl_.range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+DataConfig::DataConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.DataConfig)
+}
+DataConfig::DataConfig(const DataConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DataConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_){from._impl_.file_}
+    , decltype(_impl_.range_){nullptr}
+    , decltype(_impl_.hdfs_){nullptr}
+    , decltype(_impl_.ignore_feature_group_){}
+    , decltype(_impl_.shuffle_){}
+    , decltype(_impl_.replica_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.max_num_files_per_worker_){}
+    , decltype(_impl_.max_num_lines_per_file_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_range()) {
+    _this->_impl_.range_ = new ::ps::PbRange(*from._impl_.range_);
+  }
+  if (from._internal_has_hdfs()) {
+    _this->_impl_.hdfs_ = new ::ps::HDFSConfig(*from._impl_.hdfs_);
+  }
+  ::memcpy(&_impl_.ignore_feature_group_, &from._impl_.ignore_feature_group_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_num_lines_per_file_) -
+    reinterpret_cast<char*>(&_impl_.ignore_feature_group_)) + sizeof(_impl_.max_num_lines_per_file_));
+  // @@protoc_insertion_point(copy_constructor:ps.DataConfig)
+}
+
+inline void DataConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_){arena}
+    , decltype(_impl_.range_){nullptr}
+    , decltype(_impl_.hdfs_){nullptr}
+    , decltype(_impl_.ignore_feature_group_){false}
+    , decltype(_impl_.shuffle_){false}
+    , decltype(_impl_.replica_){1}
+    , decltype(_impl_.format_){1}
+    , decltype(_impl_.text_){1}
+    , decltype(_impl_.max_num_files_per_worker_){-1}
+    , decltype(_impl_.max_num_lines_per_file_){-1}
+  };
+}
+
+DataConfig::~DataConfig() {
+  // @@protoc_insertion_point(destructor:ps.DataConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DataConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.range_;
+  if (this != internal_default_instance()) delete _impl_.hdfs_;
+}
+
+void DataConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DataConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.DataConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.range_ != nullptr);
+      _impl_.range_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.hdfs_ != nullptr);
+      _impl_.hdfs_->Clear();
+    }
+  }
+  ::memset(&_impl_.ignore_feature_group_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.shuffle_) -
+      reinterpret_cast<char*>(&_impl_.ignore_feature_group_)) + sizeof(_impl_.shuffle_));
+  if (cached_has_bits & 0x000000f0u) {
+    _impl_.replica_ = 1;
+    _impl_.format_ = 1;
+    _impl_.text_ = 1;
+    _impl_.max_num_files_per_worker_ = -1;
+  }
+  _impl_.max_num_lines_per_file_ = -1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DataConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ps.DataConfig.DataFormat format = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::DataConfig_DataFormat_IsValid(val))) {
+            _internal_set_format(static_cast<::ps::DataConfig_DataFormat>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.DataConfig.TextFormat text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::DataConfig_TextFormat_IsValid(val))) {
+            _internal_set_text(static_cast<::ps::DataConfig_TextFormat>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string file = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_file();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "ps.DataConfig.file");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.PbRange range = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.HDFSConfig hdfs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hdfs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool ignore_feature_group = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_ignore_feature_group(&has_bits);
+          _impl_.ignore_feature_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_num_files_per_worker = 7 [default = -1];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_max_num_files_per_worker(&has_bits);
+          _impl_.max_num_files_per_worker_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_num_lines_per_file = 8 [default = -1];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_max_num_lines_per_file(&has_bits);
+          _impl_.max_num_lines_per_file_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool shuffle = 9 [default = false];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_shuffle(&has_bits);
+          _impl_.shuffle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 replica = 10 [default = 1];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_replica(&has_bits);
+          _impl_.replica_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DataConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.DataConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ps.DataConfig.DataFormat format = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_format(), target);
+  }
+
+  // optional .ps.DataConfig.TextFormat text = 2;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_text(), target);
+  }
+
+  // repeated string file = 3;
+  for (int i = 0, n = this->_internal_file_size(); i < n; i++) {
+    const auto& s = this->_internal_file(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.DataConfig.file");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // optional .ps.PbRange range = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::range(this),
+        _Internal::range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .ps.HDFSConfig hdfs = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::hdfs(this),
+        _Internal::hdfs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool ignore_feature_group = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_ignore_feature_group(), target);
+  }
+
+  // optional int32 max_num_files_per_worker = 7 [default = -1];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_max_num_files_per_worker(), target);
+  }
+
+  // optional int32 max_num_lines_per_file = 8 [default = -1];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_max_num_lines_per_file(), target);
+  }
+
+  // optional bool shuffle = 9 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_shuffle(), target);
+  }
+
+  // optional int32 replica = 10 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_replica(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.DataConfig)
+  return target;
+}
+
+size_t DataConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.DataConfig)
+  size_t total_size = 0;
+
+  // required .ps.DataConfig.DataFormat format = 1;
+  if (_internal_has_format()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string file = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.file_.size());
+  for (int i = 0, n = _impl_.file_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.file_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .ps.PbRange range = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.range_);
+    }
+
+    // optional .ps.HDFSConfig hdfs = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hdfs_);
+    }
+
+    // optional bool ignore_feature_group = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool shuffle = 9 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 replica = 10 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica());
+    }
+
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    // optional .ps.DataConfig.TextFormat text = 2;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_text());
+    }
+
+    // optional int32 max_num_files_per_worker = 7 [default = -1];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_num_files_per_worker());
+    }
+
+  }
+  // optional int32 max_num_lines_per_file = 8 [default = -1];
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_num_lines_per_file());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DataConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DataConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DataConfig::GetClassData() const { return &_class_data_; }
+
+
+void DataConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DataConfig*>(&to_msg);
+  auto& from = static_cast<const DataConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.DataConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.file_.MergeFrom(from._impl_.file_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_range()->::ps::PbRange::MergeFrom(
+          from._internal_range());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_hdfs()->::ps::HDFSConfig::MergeFrom(
+          from._internal_hdfs());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ignore_feature_group_ = from._impl_.ignore_feature_group_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.shuffle_ = from._impl_.shuffle_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.replica_ = from._impl_.replica_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.format_ = from._impl_.format_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.text_ = from._impl_.text_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.max_num_files_per_worker_ = from._impl_.max_num_files_per_worker_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_max_num_lines_per_file(from._internal_max_num_lines_per_file());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DataConfig::CopyFrom(const DataConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.DataConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DataConfig::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_range()) {
+    if (!_impl_.range_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void DataConfig::InternalSwap(DataConfig* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.file_.InternalSwap(&other->_impl_.file_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DataConfig, _impl_.shuffle_)
+      + sizeof(DataConfig::_impl_.shuffle_)
+      - PROTOBUF_FIELD_OFFSET(DataConfig, _impl_.range_)>(
+          reinterpret_cast<char*>(&_impl_.range_),
+          reinterpret_cast<char*>(&other->_impl_.range_));
+  swap(_impl_.replica_, other->_impl_.replica_);
+  swap(_impl_.format_, other->_impl_.format_);
+  swap(_impl_.text_, other->_impl_.text_);
+  swap(_impl_.max_num_files_per_worker_, other->_impl_.max_num_files_per_worker_);
+  swap(_impl_.max_num_lines_per_file_, other->_impl_.max_num_lines_per_file_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DataConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fdata_2eproto_getter, &descriptor_table_proto_2fdata_2eproto_once,
+      file_level_metadata_proto_2fdata_2eproto[0]);
+}
+
+// ===================================================================
+
+class HDFSConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HDFSConfig>()._impl_._has_bits_);
+  static void set_has_home(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ugi(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_namenode(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+HDFSConfig::HDFSConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.HDFSConfig)
+}
+HDFSConfig::HDFSConfig(const HDFSConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HDFSConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.home_){}
+    , decltype(_impl_.ugi_){}
+    , decltype(_impl_.namenode_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.home_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.home_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_home()) {
+    _this->_impl_.home_.Set(from._internal_home(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ugi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ugi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ugi()) {
+    _this->_impl_.ugi_.Set(from._internal_ugi(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.namenode_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namenode_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_namenode()) {
+    _this->_impl_.namenode_.Set(from._internal_namenode(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ps.HDFSConfig)
+}
+
+inline void HDFSConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.home_){}
+    , decltype(_impl_.ugi_){}
+    , decltype(_impl_.namenode_){}
+  };
+  _impl_.home_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.home_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ugi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ugi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.namenode_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namenode_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HDFSConfig::~HDFSConfig() {
+  // @@protoc_insertion_point(destructor:ps.HDFSConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HDFSConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.home_.Destroy();
+  _impl_.ugi_.Destroy();
+  _impl_.namenode_.Destroy();
+}
+
+void HDFSConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HDFSConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.HDFSConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.home_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.ugi_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.namenode_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HDFSConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string home = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_home();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.HDFSConfig.home");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string ugi = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ugi();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.HDFSConfig.ugi");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string namenode = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_namenode();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.HDFSConfig.namenode");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HDFSConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.HDFSConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string home = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_home().data(), static_cast<int>(this->_internal_home().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.HDFSConfig.home");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_home(), target);
+  }
+
+  // optional string ugi = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ugi().data(), static_cast<int>(this->_internal_ugi().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.HDFSConfig.ugi");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_ugi(), target);
+  }
+
+  // optional string namenode = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_namenode().data(), static_cast<int>(this->_internal_namenode().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.HDFSConfig.namenode");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_namenode(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.HDFSConfig)
+  return target;
+}
+
+size_t HDFSConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.HDFSConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string home = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_home());
+    }
+
+    // optional string ugi = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_ugi());
+    }
+
+    // optional string namenode = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_namenode());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HDFSConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HDFSConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HDFSConfig::GetClassData() const { return &_class_data_; }
+
+
+void HDFSConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HDFSConfig*>(&to_msg);
+  auto& from = static_cast<const HDFSConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.HDFSConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_home(from._internal_home());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_ugi(from._internal_ugi());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_namenode(from._internal_namenode());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HDFSConfig::CopyFrom(const HDFSConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.HDFSConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HDFSConfig::IsInitialized() const {
+  return true;
+}
+
+void HDFSConfig::InternalSwap(HDFSConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.home_, lhs_arena,
+      &other->_impl_.home_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ugi_, lhs_arena,
+      &other->_impl_.ugi_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.namenode_, lhs_arena,
+      &other->_impl_.namenode_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HDFSConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fdata_2eproto_getter, &descriptor_table_proto_2fdata_2eproto_once,
+      file_level_metadata_proto_2fdata_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::DataConfig*
+Arena::CreateMaybeMessage< ::ps::DataConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::DataConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::HDFSConfig*
+Arena::CreateMaybeMessage< ::ps::HDFSConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::HDFSConfig >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
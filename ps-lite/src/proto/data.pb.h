@@ -0,0 +1,1405 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/data.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fdata_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "proto/range.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fdata_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fdata_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fdata_2eproto;
+namespace ps {
+class DataConfig;
+struct DataConfigDefaultTypeInternal;
+extern DataConfigDefaultTypeInternal _DataConfig_default_instance_;
+class HDFSConfig;
+struct HDFSConfigDefaultTypeInternal;
+extern HDFSConfigDefaultTypeInternal _HDFSConfig_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::DataConfig* Arena::CreateMaybeMessage<::ps::DataConfig>(Arena*);
+template<> ::ps::HDFSConfig* Arena::CreateMaybeMessage<::ps::HDFSConfig>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum DataConfig_DataFormat : int {
+  DataConfig_DataFormat_BIN = 1,
+  DataConfig_DataFormat_PROTO = 2,
+  DataConfig_DataFormat_TEXT = 3
+};
+bool DataConfig_DataFormat_IsValid(int value);
+constexpr DataConfig_DataFormat DataConfig_DataFormat_DataFormat_MIN = DataConfig_DataFormat_BIN;
+constexpr DataConfig_DataFormat DataConfig_DataFormat_DataFormat_MAX = DataConfig_DataFormat_TEXT;
+constexpr int DataConfig_DataFormat_DataFormat_ARRAYSIZE = DataConfig_DataFormat_DataFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataConfig_DataFormat_descriptor();
+template<typename T>
+inline const std::string& DataConfig_DataFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DataConfig_DataFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DataConfig_DataFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DataConfig_DataFormat_descriptor(), enum_t_value);
+}
+inline bool DataConfig_DataFormat_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DataConfig_DataFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DataConfig_DataFormat>(
+    DataConfig_DataFormat_descriptor(), name, value);
+}
+enum DataConfig_TextFormat : int {
+  DataConfig_TextFormat_DENSE = 1,
+  DataConfig_TextFormat_SPARSE = 2,
+  DataConfig_TextFormat_SPARSE_BINARY = 3,
+  DataConfig_TextFormat_ADFEA = 4,
+  DataConfig_TextFormat_LIBSVM = 5,
+  DataConfig_TextFormat_TERAFEA = 6,
+  DataConfig_TextFormat_VW = 7
+};
+bool DataConfig_TextFormat_IsValid(int value);
+constexpr DataConfig_TextFormat DataConfig_TextFormat_TextFormat_MIN = DataConfig_TextFormat_DENSE;
+constexpr DataConfig_TextFormat DataConfig_TextFormat_TextFormat_MAX = DataConfig_TextFormat_VW;
+constexpr int DataConfig_TextFormat_TextFormat_ARRAYSIZE = DataConfig_TextFormat_TextFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataConfig_TextFormat_descriptor();
+template<typename T>
+inline const std::string& DataConfig_TextFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DataConfig_TextFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DataConfig_TextFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DataConfig_TextFormat_descriptor(), enum_t_value);
+}
+inline bool DataConfig_TextFormat_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DataConfig_TextFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DataConfig_TextFormat>(
+    DataConfig_TextFormat_descriptor(), name, value);
+}
+// ===================================================================
+
+class DataConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.DataConfig) */ {
+ public:
+  inline DataConfig() : DataConfig(nullptr) {}
+  ~DataConfig() override;
+  explicit PROTOBUF_CONSTEXPR DataConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DataConfig(const DataConfig& from);
+  DataConfig(DataConfig&& from) noexcept
+    : DataConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline DataConfig& operator=(const DataConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DataConfig& operator=(DataConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DataConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DataConfig* internal_default_instance() {
+    return reinterpret_cast<const DataConfig*>(
+               &_DataConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(DataConfig& a, DataConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DataConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DataConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DataConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DataConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DataConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DataConfig& from) {
+    DataConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DataConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.DataConfig";
+  }
+  protected:
+  explicit DataConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef DataConfig_DataFormat DataFormat;
+  static constexpr DataFormat BIN =
+    DataConfig_DataFormat_BIN;
+  static constexpr DataFormat PROTO =
+    DataConfig_DataFormat_PROTO;
+  static constexpr DataFormat TEXT =
+    DataConfig_DataFormat_TEXT;
+  static inline bool DataFormat_IsValid(int value) {
+    return DataConfig_DataFormat_IsValid(value);
+  }
+  static constexpr DataFormat DataFormat_MIN =
+    DataConfig_DataFormat_DataFormat_MIN;
+  static constexpr DataFormat DataFormat_MAX =
+    DataConfig_DataFormat_DataFormat_MAX;
+  static constexpr int DataFormat_ARRAYSIZE =
+    DataConfig_DataFormat_DataFormat_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  DataFormat_descriptor() {
+    return DataConfig_DataFormat_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& DataFormat_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DataFormat>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DataFormat_Name.");
+    return DataConfig_DataFormat_Name(enum_t_value);
+  }
+  static inline bool DataFormat_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      DataFormat* value) {
+    return DataConfig_DataFormat_Parse(name, value);
+  }
+
+  typedef DataConfig_TextFormat TextFormat;
+  static constexpr TextFormat DENSE =
+    DataConfig_TextFormat_DENSE;
+  static constexpr TextFormat SPARSE =
+    DataConfig_TextFormat_SPARSE;
+  static constexpr TextFormat SPARSE_BINARY =
+    DataConfig_TextFormat_SPARSE_BINARY;
+  static constexpr TextFormat ADFEA =
+    DataConfig_TextFormat_ADFEA;
+  static constexpr TextFormat LIBSVM =
+    DataConfig_TextFormat_LIBSVM;
+  static constexpr TextFormat TERAFEA =
+    DataConfig_TextFormat_TERAFEA;
+  static constexpr TextFormat VW =
+    DataConfig_TextFormat_VW;
+  static inline bool TextFormat_IsValid(int value) {
+    return DataConfig_TextFormat_IsValid(value);
+  }
+  static constexpr TextFormat TextFormat_MIN =
+    DataConfig_TextFormat_TextFormat_MIN;
+  static constexpr TextFormat TextFormat_MAX =
+    DataConfig_TextFormat_TextFormat_MAX;
+  static constexpr int TextFormat_ARRAYSIZE =
+    DataConfig_TextFormat_TextFormat_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  TextFormat_descriptor() {
+    return DataConfig_TextFormat_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& TextFormat_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, TextFormat>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function TextFormat_Name.");
+    return DataConfig_TextFormat_Name(enum_t_value);
+  }
+  static inline bool TextFormat_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      TextFormat* value) {
+    return DataConfig_TextFormat_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileFieldNumber = 3,
+    kRangeFieldNumber = 4,
+    kHdfsFieldNumber = 5,
+    kIgnoreFeatureGroupFieldNumber = 6,
+    kShuffleFieldNumber = 9,
+    kReplicaFieldNumber = 10,
+    kFormatFieldNumber = 1,
+    kTextFieldNumber = 2,
+    kMaxNumFilesPerWorkerFieldNumber = 7,
+    kMaxNumLinesPerFileFieldNumber = 8,
+  };
+  // repeated string file = 3;
+  int file_size() const;
+  private:
+  int _internal_file_size() const;
+  public:
+  void clear_file();
+  const std::string& file(int index) const;
+  std::string* mutable_file(int index);
+  void set_file(int index, const std::string& value);
+  void set_file(int index, std::string&& value);
+  void set_file(int index, const char* value);
+  void set_file(int index, const char* value, size_t size);
+  std::string* add_file();
+  void add_file(const std::string& value);
+  void add_file(std::string&& value);
+  void add_file(const char* value);
+  void add_file(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& file() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_file();
+  private:
+  const std::string& _internal_file(int index) const;
+  std::string* _internal_add_file();
+  public:
+
+  // optional .ps.PbRange range = 4;
+  bool has_range() const;
+  private:
+  bool _internal_has_range() const;
+  public:
+  void clear_range();
+  const ::ps::PbRange& range() const;
+  PROTOBUF_NODISCARD ::ps::PbRange* release_range();
+  ::ps::PbRange* mutable_range();
+  void set_allocated_range(::ps::PbRange* range);
+  private:
+  const ::ps::PbRange& _internal_range() const;
+  ::ps::PbRange* _internal_mutable_range();
+  public:
+  void unsafe_arena_set_allocated_range(
+      ::ps::PbRange* range);
+  ::ps::PbRange* unsafe_arena_release_range();
+
+  // optional .ps.HDFSConfig hdfs = 5;
+  bool has_hdfs() const;
+  private:
+  bool _internal_has_hdfs() const;
+  public:
+  void clear_hdfs();
+  const ::ps::HDFSConfig& hdfs() const;
+  PROTOBUF_NODISCARD ::ps::HDFSConfig* release_hdfs();
+  ::ps::HDFSConfig* mutable_hdfs();
+  void set_allocated_hdfs(::ps::HDFSConfig* hdfs);
+  private:
+  const ::ps::HDFSConfig& _internal_hdfs() const;
+  ::ps::HDFSConfig* _internal_mutable_hdfs();
+  public:
+  void unsafe_arena_set_allocated_hdfs(
+      ::ps::HDFSConfig* hdfs);
+  ::ps::HDFSConfig* unsafe_arena_release_hdfs();
+
+  // optional bool ignore_feature_group = 6;
+  bool has_ignore_feature_group() const;
+  private:
+  bool _internal_has_ignore_feature_group() const;
+  public:
+  void clear_ignore_feature_group();
+  bool ignore_feature_group() const;
+  void set_ignore_feature_group(bool value);
+  private:
+  bool _internal_ignore_feature_group() const;
+  void _internal_set_ignore_feature_group(bool value);
+  public:
+
+  // optional bool shuffle = 9 [default = false];
+  bool has_shuffle() const;
+  private:
+  bool _internal_has_shuffle() const;
+  public:
+  void clear_shuffle();
+  bool shuffle() const;
+  void set_shuffle(bool value);
+  private:
+  bool _internal_shuffle() const;
+  void _internal_set_shuffle(bool value);
+  public:
+
+  // optional int32 replica = 10 [default = 1];
+  bool has_replica() const;
+  private:
+  bool _internal_has_replica() const;
+  public:
+  void clear_replica();
+  int32_t replica() const;
+  void set_replica(int32_t value);
+  private:
+  int32_t _internal_replica() const;
+  void _internal_set_replica(int32_t value);
+  public:
+
+  // required .ps.DataConfig.DataFormat format = 1;
+  bool has_format() const;
+  private:
+  bool _internal_has_format() const;
+  public:
+  void clear_format();
+  ::ps::DataConfig_DataFormat format() const;
+  void set_format(::ps::DataConfig_DataFormat value);
+  private:
+  ::ps::DataConfig_DataFormat _internal_format() const;
+  void _internal_set_format(::ps::DataConfig_DataFormat value);
+  public:
+
+  // optional .ps.DataConfig.TextFormat text = 2;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  ::ps::DataConfig_TextFormat text() const;
+  void set_text(::ps::DataConfig_TextFormat value);
+  private:
+  ::ps::DataConfig_TextFormat _internal_text() const;
+  void _internal_set_text(::ps::DataConfig_TextFormat value);
+  public:
+
+  // optional int32 max_num_files_per_worker = 7 [default = -1];
+  bool has_max_num_files_per_worker() const;
+  private:
+  bool _internal_has_max_num_files_per_worker() const;
+  public:
+  void clear_max_num_files_per_worker();
+  int32_t max_num_files_per_worker() const;
+  void set_max_num_files_per_worker(int32_t value);
+  private:
+  int32_t _internal_max_num_files_per_worker() const;
+  void _internal_set_max_num_files_per_worker(int32_t value);
+  public:
+
+  // optional int32 max_num_lines_per_file = 8 [default = -1];
+  bool has_max_num_lines_per_file() const;
+  private:
+  bool _internal_has_max_num_lines_per_file() const;
+  public:
+  void clear_max_num_lines_per_file();
+  int32_t max_num_lines_per_file() const;
+  void set_max_num_lines_per_file(int32_t value);
+  private:
+  int32_t _internal_max_num_lines_per_file() const;
+  void _internal_set_max_num_lines_per_file(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.DataConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> file_;
+    ::ps::PbRange* range_;
+    ::ps::HDFSConfig* hdfs_;
+    bool ignore_feature_group_;
+    bool shuffle_;
+    int32_t replica_;
+    int format_;
+    int text_;
+    int32_t max_num_files_per_worker_;
+    int32_t max_num_lines_per_file_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HDFSConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.HDFSConfig) */ {
+ public:
+  inline HDFSConfig() : HDFSConfig(nullptr) {}
+  ~HDFSConfig() override;
+  explicit PROTOBUF_CONSTEXPR HDFSConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HDFSConfig(const HDFSConfig& from);
+  HDFSConfig(HDFSConfig&& from) noexcept
+    : HDFSConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline HDFSConfig& operator=(const HDFSConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HDFSConfig& operator=(HDFSConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HDFSConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HDFSConfig* internal_default_instance() {
+    return reinterpret_cast<const HDFSConfig*>(
+               &_HDFSConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(HDFSConfig& a, HDFSConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HDFSConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HDFSConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HDFSConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HDFSConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HDFSConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HDFSConfig& from) {
+    HDFSConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HDFSConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.HDFSConfig";
+  }
+  protected:
+  explicit HDFSConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHomeFieldNumber = 1,
+    kUgiFieldNumber = 2,
+    kNamenodeFieldNumber = 4,
+  };
+  // optional string home = 1;
+  bool has_home() const;
+  private:
+  bool _internal_has_home() const;
+  public:
+  void clear_home();
+  const std::string& home() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_home(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_home();
+  PROTOBUF_NODISCARD std::string* release_home();
+  void set_allocated_home(std::string* home);
+  private:
+  const std::string& _internal_home() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_home(const std::string& value);
+  std::string* _internal_mutable_home();
+  public:
+
+  // optional string ugi = 2;
+  bool has_ugi() const;
+  private:
+  bool _internal_has_ugi() const;
+  public:
+  void clear_ugi();
+  const std::string& ugi() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ugi(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ugi();
+  PROTOBUF_NODISCARD std::string* release_ugi();
+  void set_allocated_ugi(std::string* ugi);
+  private:
+  const std::string& _internal_ugi() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ugi(const std::string& value);
+  std::string* _internal_mutable_ugi();
+  public:
+
+  // optional string namenode = 4;
+  bool has_namenode() const;
+  private:
+  bool _internal_has_namenode() const;
+  public:
+  void clear_namenode();
+  const std::string& namenode() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_namenode(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_namenode();
+  PROTOBUF_NODISCARD std::string* release_namenode();
+  void set_allocated_namenode(std::string* namenode);
+  private:
+  const std::string& _internal_namenode() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_namenode(const std::string& value);
+  std::string* _internal_mutable_namenode();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.HDFSConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr home_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ugi_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr namenode_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// DataConfig
+
+// required .ps.DataConfig.DataFormat format = 1;
+inline bool DataConfig::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool DataConfig::has_format() const {
+  return _internal_has_format();
+}
+inline void DataConfig::clear_format() {
+  _impl_.format_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::ps::DataConfig_DataFormat DataConfig::_internal_format() const {
+  return static_cast< ::ps::DataConfig_DataFormat >(_impl_.format_);
+}
+inline ::ps::DataConfig_DataFormat DataConfig::format() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.format)
+  return _internal_format();
+}
+inline void DataConfig::_internal_set_format(::ps::DataConfig_DataFormat value) {
+  assert(::ps::DataConfig_DataFormat_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.format_ = value;
+}
+inline void DataConfig::set_format(::ps::DataConfig_DataFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.format)
+}
+
+// optional .ps.DataConfig.TextFormat text = 2;
+inline bool DataConfig::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool DataConfig::has_text() const {
+  return _internal_has_text();
+}
+inline void DataConfig::clear_text() {
+  _impl_.text_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::ps::DataConfig_TextFormat DataConfig::_internal_text() const {
+  return static_cast< ::ps::DataConfig_TextFormat >(_impl_.text_);
+}
+inline ::ps::DataConfig_TextFormat DataConfig::text() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.text)
+  return _internal_text();
+}
+inline void DataConfig::_internal_set_text(::ps::DataConfig_TextFormat value) {
+  assert(::ps::DataConfig_TextFormat_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.text_ = value;
+}
+inline void DataConfig::set_text(::ps::DataConfig_TextFormat value) {
+  _internal_set_text(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.text)
+}
+
+// repeated string file = 3;
+inline int DataConfig::_internal_file_size() const {
+  return _impl_.file_.size();
+}
+inline int DataConfig::file_size() const {
+  return _internal_file_size();
+}
+inline void DataConfig::clear_file() {
+  _impl_.file_.Clear();
+}
+inline std::string* DataConfig::add_file() {
+  std::string* _s = _internal_add_file();
+  // @@protoc_insertion_point(field_add_mutable:ps.DataConfig.file)
+  return _s;
+}
+inline const std::string& DataConfig::_internal_file(int index) const {
+  return _impl_.file_.Get(index);
+}
+inline const std::string& DataConfig::file(int index) const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.file)
+  return _internal_file(index);
+}
+inline std::string* DataConfig::mutable_file(int index) {
+  // @@protoc_insertion_point(field_mutable:ps.DataConfig.file)
+  return _impl_.file_.Mutable(index);
+}
+inline void DataConfig::set_file(int index, const std::string& value) {
+  _impl_.file_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.file)
+}
+inline void DataConfig::set_file(int index, std::string&& value) {
+  _impl_.file_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ps.DataConfig.file)
+}
+inline void DataConfig::set_file(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.file_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ps.DataConfig.file)
+}
+inline void DataConfig::set_file(int index, const char* value, size_t size) {
+  _impl_.file_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ps.DataConfig.file)
+}
+inline std::string* DataConfig::_internal_add_file() {
+  return _impl_.file_.Add();
+}
+inline void DataConfig::add_file(const std::string& value) {
+  _impl_.file_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ps.DataConfig.file)
+}
+inline void DataConfig::add_file(std::string&& value) {
+  _impl_.file_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ps.DataConfig.file)
+}
+inline void DataConfig::add_file(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.file_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ps.DataConfig.file)
+}
+inline void DataConfig::add_file(const char* value, size_t size) {
+  _impl_.file_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ps.DataConfig.file)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+DataConfig::file() const {
+  // @@protoc_insertion_point(field_list:ps.DataConfig.file)
+  return _impl_.file_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+DataConfig::mutable_file() {
+  // @@protoc_insertion_point(field_mutable_list:ps.DataConfig.file)
+  return &_impl_.file_;
+}
+
+// optional .ps.HDFSConfig hdfs = 5;
+inline bool DataConfig::_internal_has_hdfs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hdfs_ != nullptr);
+  return value;
+}
+inline bool DataConfig::has_hdfs() const {
+  return _internal_has_hdfs();
+}
+inline void DataConfig::clear_hdfs() {
+  if (_impl_.hdfs_ != nullptr) _impl_.hdfs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::ps::HDFSConfig& DataConfig::_internal_hdfs() const {
+  const ::ps::HDFSConfig* p = _impl_.hdfs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::HDFSConfig&>(
+      ::ps::_HDFSConfig_default_instance_);
+}
+inline const ::ps::HDFSConfig& DataConfig::hdfs() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.hdfs)
+  return _internal_hdfs();
+}
+inline void DataConfig::unsafe_arena_set_allocated_hdfs(
+    ::ps::HDFSConfig* hdfs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hdfs_);
+  }
+  _impl_.hdfs_ = hdfs;
+  if (hdfs) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.DataConfig.hdfs)
+}
+inline ::ps::HDFSConfig* DataConfig::release_hdfs() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ps::HDFSConfig* temp = _impl_.hdfs_;
+  _impl_.hdfs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::HDFSConfig* DataConfig::unsafe_arena_release_hdfs() {
+  // @@protoc_insertion_point(field_release:ps.DataConfig.hdfs)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ps::HDFSConfig* temp = _impl_.hdfs_;
+  _impl_.hdfs_ = nullptr;
+  return temp;
+}
+inline ::ps::HDFSConfig* DataConfig::_internal_mutable_hdfs() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.hdfs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::HDFSConfig>(GetArenaForAllocation());
+    _impl_.hdfs_ = p;
+  }
+  return _impl_.hdfs_;
+}
+inline ::ps::HDFSConfig* DataConfig::mutable_hdfs() {
+  ::ps::HDFSConfig* _msg = _internal_mutable_hdfs();
+  // @@protoc_insertion_point(field_mutable:ps.DataConfig.hdfs)
+  return _msg;
+}
+inline void DataConfig::set_allocated_hdfs(::ps::HDFSConfig* hdfs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hdfs_;
+  }
+  if (hdfs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hdfs);
+    if (message_arena != submessage_arena) {
+      hdfs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hdfs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.hdfs_ = hdfs;
+  // @@protoc_insertion_point(field_set_allocated:ps.DataConfig.hdfs)
+}
+
+// optional bool ignore_feature_group = 6;
+inline bool DataConfig::_internal_has_ignore_feature_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DataConfig::has_ignore_feature_group() const {
+  return _internal_has_ignore_feature_group();
+}
+inline void DataConfig::clear_ignore_feature_group() {
+  _impl_.ignore_feature_group_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool DataConfig::_internal_ignore_feature_group() const {
+  return _impl_.ignore_feature_group_;
+}
+inline bool DataConfig::ignore_feature_group() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.ignore_feature_group)
+  return _internal_ignore_feature_group();
+}
+inline void DataConfig::_internal_set_ignore_feature_group(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ignore_feature_group_ = value;
+}
+inline void DataConfig::set_ignore_feature_group(bool value) {
+  _internal_set_ignore_feature_group(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.ignore_feature_group)
+}
+
+// optional int32 max_num_files_per_worker = 7 [default = -1];
+inline bool DataConfig::_internal_has_max_num_files_per_worker() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool DataConfig::has_max_num_files_per_worker() const {
+  return _internal_has_max_num_files_per_worker();
+}
+inline void DataConfig::clear_max_num_files_per_worker() {
+  _impl_.max_num_files_per_worker_ = -1;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t DataConfig::_internal_max_num_files_per_worker() const {
+  return _impl_.max_num_files_per_worker_;
+}
+inline int32_t DataConfig::max_num_files_per_worker() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.max_num_files_per_worker)
+  return _internal_max_num_files_per_worker();
+}
+inline void DataConfig::_internal_set_max_num_files_per_worker(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.max_num_files_per_worker_ = value;
+}
+inline void DataConfig::set_max_num_files_per_worker(int32_t value) {
+  _internal_set_max_num_files_per_worker(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.max_num_files_per_worker)
+}
+
+// optional int32 max_num_lines_per_file = 8 [default = -1];
+inline bool DataConfig::_internal_has_max_num_lines_per_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool DataConfig::has_max_num_lines_per_file() const {
+  return _internal_has_max_num_lines_per_file();
+}
+inline void DataConfig::clear_max_num_lines_per_file() {
+  _impl_.max_num_lines_per_file_ = -1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t DataConfig::_internal_max_num_lines_per_file() const {
+  return _impl_.max_num_lines_per_file_;
+}
+inline int32_t DataConfig::max_num_lines_per_file() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.max_num_lines_per_file)
+  return _internal_max_num_lines_per_file();
+}
+inline void DataConfig::_internal_set_max_num_lines_per_file(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.max_num_lines_per_file_ = value;
+}
+inline void DataConfig::set_max_num_lines_per_file(int32_t value) {
+  _internal_set_max_num_lines_per_file(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.max_num_lines_per_file)
+}
+
+// optional bool shuffle = 9 [default = false];
+inline bool DataConfig::_internal_has_shuffle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool DataConfig::has_shuffle() const {
+  return _internal_has_shuffle();
+}
+inline void DataConfig::clear_shuffle() {
+  _impl_.shuffle_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool DataConfig::_internal_shuffle() const {
+  return _impl_.shuffle_;
+}
+inline bool DataConfig::shuffle() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.shuffle)
+  return _internal_shuffle();
+}
+inline void DataConfig::_internal_set_shuffle(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.shuffle_ = value;
+}
+inline void DataConfig::set_shuffle(bool value) {
+  _internal_set_shuffle(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.shuffle)
+}
+
+// optional .ps.PbRange range = 4;
+inline bool DataConfig::_internal_has_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.range_ != nullptr);
+  return value;
+}
+inline bool DataConfig::has_range() const {
+  return _internal_has_range();
+}
+inline const ::ps::PbRange& DataConfig::_internal_range() const {
+  const ::ps::PbRange* p = _impl_.range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::PbRange&>(
+      ::ps::_PbRange_default_instance_);
+}
+inline const ::ps::PbRange& DataConfig::range() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.range)
+  return _internal_range();
+}
+inline void DataConfig::unsafe_arena_set_allocated_range(
+    ::ps::PbRange* range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.range_);
+  }
+  _impl_.range_ = range;
+  if (range) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.DataConfig.range)
+}
+inline ::ps::PbRange* DataConfig::release_range() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ps::PbRange* temp = _impl_.range_;
+  _impl_.range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::PbRange* DataConfig::unsafe_arena_release_range() {
+  // @@protoc_insertion_point(field_release:ps.DataConfig.range)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ps::PbRange* temp = _impl_.range_;
+  _impl_.range_ = nullptr;
+  return temp;
+}
+inline ::ps::PbRange* DataConfig::_internal_mutable_range() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::PbRange>(GetArenaForAllocation());
+    _impl_.range_ = p;
+  }
+  return _impl_.range_;
+}
+inline ::ps::PbRange* DataConfig::mutable_range() {
+  ::ps::PbRange* _msg = _internal_mutable_range();
+  // @@protoc_insertion_point(field_mutable:ps.DataConfig.range)
+  return _msg;
+}
+inline void DataConfig::set_allocated_range(::ps::PbRange* range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.range_);
+  }
+  if (range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(range));
+    if (message_arena != submessage_arena) {
+      range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.range_ = range;
+  // @@protoc_insertion_point(field_set_allocated:ps.DataConfig.range)
+}
+
+// optional int32 replica = 10 [default = 1];
+inline bool DataConfig::_internal_has_replica() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool DataConfig::has_replica() const {
+  return _internal_has_replica();
+}
+inline void DataConfig::clear_replica() {
+  _impl_.replica_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t DataConfig::_internal_replica() const {
+  return _impl_.replica_;
+}
+inline int32_t DataConfig::replica() const {
+  // @@protoc_insertion_point(field_get:ps.DataConfig.replica)
+  return _internal_replica();
+}
+inline void DataConfig::_internal_set_replica(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.replica_ = value;
+}
+inline void DataConfig::set_replica(int32_t value) {
+  _internal_set_replica(value);
+  // @@protoc_insertion_point(field_set:ps.DataConfig.replica)
+}
+
+// -------------------------------------------------------------------
+
+// HDFSConfig
+
+// optional string home = 1;
+inline bool HDFSConfig::_internal_has_home() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HDFSConfig::has_home() const {
+  return _internal_has_home();
+}
+inline void HDFSConfig::clear_home() {
+  _impl_.home_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HDFSConfig::home() const {
+  // @@protoc_insertion_point(field_get:ps.HDFSConfig.home)
+  return _internal_home();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HDFSConfig::set_home(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.home_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.HDFSConfig.home)
+}
+inline std::string* HDFSConfig::mutable_home() {
+  std::string* _s = _internal_mutable_home();
+  // @@protoc_insertion_point(field_mutable:ps.HDFSConfig.home)
+  return _s;
+}
+inline const std::string& HDFSConfig::_internal_home() const {
+  return _impl_.home_.Get();
+}
+inline void HDFSConfig::_internal_set_home(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.home_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::_internal_mutable_home() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.home_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::release_home() {
+  // @@protoc_insertion_point(field_release:ps.HDFSConfig.home)
+  if (!_internal_has_home()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.home_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.home_.IsDefault()) {
+    _impl_.home_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HDFSConfig::set_allocated_home(std::string* home) {
+  if (home != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.home_.SetAllocated(home, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.home_.IsDefault()) {
+    _impl_.home_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.HDFSConfig.home)
+}
+
+// optional string ugi = 2;
+inline bool HDFSConfig::_internal_has_ugi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HDFSConfig::has_ugi() const {
+  return _internal_has_ugi();
+}
+inline void HDFSConfig::clear_ugi() {
+  _impl_.ugi_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& HDFSConfig::ugi() const {
+  // @@protoc_insertion_point(field_get:ps.HDFSConfig.ugi)
+  return _internal_ugi();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HDFSConfig::set_ugi(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.ugi_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.HDFSConfig.ugi)
+}
+inline std::string* HDFSConfig::mutable_ugi() {
+  std::string* _s = _internal_mutable_ugi();
+  // @@protoc_insertion_point(field_mutable:ps.HDFSConfig.ugi)
+  return _s;
+}
+inline const std::string& HDFSConfig::_internal_ugi() const {
+  return _impl_.ugi_.Get();
+}
+inline void HDFSConfig::_internal_set_ugi(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ugi_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::_internal_mutable_ugi() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.ugi_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::release_ugi() {
+  // @@protoc_insertion_point(field_release:ps.HDFSConfig.ugi)
+  if (!_internal_has_ugi()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.ugi_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ugi_.IsDefault()) {
+    _impl_.ugi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HDFSConfig::set_allocated_ugi(std::string* ugi) {
+  if (ugi != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.ugi_.SetAllocated(ugi, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ugi_.IsDefault()) {
+    _impl_.ugi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.HDFSConfig.ugi)
+}
+
+// optional string namenode = 4;
+inline bool HDFSConfig::_internal_has_namenode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HDFSConfig::has_namenode() const {
+  return _internal_has_namenode();
+}
+inline void HDFSConfig::clear_namenode() {
+  _impl_.namenode_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& HDFSConfig::namenode() const {
+  // @@protoc_insertion_point(field_get:ps.HDFSConfig.namenode)
+  return _internal_namenode();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HDFSConfig::set_namenode(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.namenode_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.HDFSConfig.namenode)
+}
+inline std::string* HDFSConfig::mutable_namenode() {
+  std::string* _s = _internal_mutable_namenode();
+  // @@protoc_insertion_point(field_mutable:ps.HDFSConfig.namenode)
+  return _s;
+}
+inline const std::string& HDFSConfig::_internal_namenode() const {
+  return _impl_.namenode_.Get();
+}
+inline void HDFSConfig::_internal_set_namenode(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.namenode_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::_internal_mutable_namenode() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.namenode_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HDFSConfig::release_namenode() {
+  // @@protoc_insertion_point(field_release:ps.HDFSConfig.namenode)
+  if (!_internal_has_namenode()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.namenode_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namenode_.IsDefault()) {
+    _impl_.namenode_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HDFSConfig::set_allocated_namenode(std::string* namenode) {
+  if (namenode != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.namenode_.SetAllocated(namenode, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namenode_.IsDefault()) {
+    _impl_.namenode_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.HDFSConfig.namenode)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::DataConfig_DataFormat> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::DataConfig_DataFormat>() {
+  return ::ps::DataConfig_DataFormat_descriptor();
+}
+template <> struct is_proto_enum< ::ps::DataConfig_TextFormat> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::DataConfig_TextFormat>() {
+  return ::ps::DataConfig_TextFormat_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fdata_2eproto
@@ -0,0 +1,847 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/filter.proto
+
+#include "proto/filter.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR Filter_FixedFloatConfig::Filter_FixedFloatConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_value_)*/-1
+  , /*decltype(_impl_.max_value_)*/1} {}
+struct Filter_FixedFloatConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Filter_FixedFloatConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Filter_FixedFloatConfigDefaultTypeInternal() {}
+  union {
+    Filter_FixedFloatConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Filter_FixedFloatConfigDefaultTypeInternal _Filter_FixedFloatConfig_default_instance_;
+PROTOBUF_CONSTEXPR Filter::Filter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.uncompressed_size_)*/{}
+  , /*decltype(_impl_.fixed_point_)*/{}
+  , /*decltype(_impl_.signature_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.std_)*/0
+  , /*decltype(_impl_.clear_cache_)*/false
+  , /*decltype(_impl_.type_)*/1
+  , /*decltype(_impl_.num_bytes_)*/3} {}
+struct FilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FilterDefaultTypeInternal() {}
+  union {
+    Filter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FilterDefaultTypeInternal _Filter_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2ffilter_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2ffilter_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2ffilter_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2ffilter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::Filter_FixedFloatConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter_FixedFloatConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::Filter_FixedFloatConfig, _impl_.min_value_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter_FixedFloatConfig, _impl_.max_value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.clear_cache_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.num_bytes_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.std_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.fixed_point_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.signature_),
+  PROTOBUF_FIELD_OFFSET(::ps::Filter, _impl_.uncompressed_size_),
+  4,
+  3,
+  5,
+  1,
+  2,
+  ~0u,
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::ps::Filter_FixedFloatConfig)},
+  { 10, 24, -1, sizeof(::ps::Filter)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_Filter_FixedFloatConfig_default_instance_._instance,
+  &::ps::_Filter_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2ffilter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022proto/filter.proto\022\002ps\"\377\002\n\006Filter\022\035\n\004t"
+  "ype\030\001 \002(\0162\017.ps.Filter.Type\022\032\n\013clear_cach"
+  "e\030\024 \001(\010:\005false\022\024\n\tnum_bytes\030\005 \001(\005:\0013\022\014\n\004"
+  "mean\030\006 \001(\002\022\013\n\003std\030\007 \001(\002\0220\n\013fixed_point\030\004"
+  " \003(\0132\033.ps.Filter.FixedFloatConfig\022\021\n\tsig"
+  "nature\030\002 \001(\004\022\031\n\021uncompressed_size\030\003 \003(\004\032"
+  "\?\n\020FixedFloatConfig\022\025\n\tmin_value\030\001 \001(\002:\002"
+  "-1\022\024\n\tmax_value\030\002 \001(\002:\0011\"h\n\004Type\022\017\n\013KEY_"
+  "CACHING\020\001\022\017\n\013COMPRESSING\020\002\022\020\n\014FIXING_FLO"
+  "AT\020\003\022\t\n\005NOISE\020\004\022\r\n\tDELTA_KEY\020\005\022\022\n\016TRUNCA"
+  "TE_FLOAT\020\006"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2ffilter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2ffilter_2eproto = {
+    false, false, 410, descriptor_table_protodef_proto_2ffilter_2eproto,
+    "proto/filter.proto",
+    &descriptor_table_proto_2ffilter_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_proto_2ffilter_2eproto::offsets,
+    file_level_metadata_proto_2ffilter_2eproto, file_level_enum_descriptors_proto_2ffilter_2eproto,
+    file_level_service_descriptors_proto_2ffilter_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2ffilter_2eproto_getter() {
+  return &descriptor_table_proto_2ffilter_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2ffilter_2eproto(&descriptor_table_proto_2ffilter_2eproto);
+namespace ps {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Filter_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2ffilter_2eproto);
+  return file_level_enum_descriptors_proto_2ffilter_2eproto[0];
+}
+bool Filter_Type_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Filter_Type Filter::KEY_CACHING;
+constexpr Filter_Type Filter::COMPRESSING;
+constexpr Filter_Type Filter::FIXING_FLOAT;
+constexpr Filter_Type Filter::NOISE;
+constexpr Filter_Type Filter::DELTA_KEY;
+constexpr Filter_Type Filter::TRUNCATE_FLOAT;
+constexpr Filter_Type Filter::Type_MIN;
+constexpr Filter_Type Filter::Type_MAX;
+constexpr int Filter::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Filter_FixedFloatConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Filter_FixedFloatConfig>()._impl_._has_bits_);
+  static void set_has_min_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Filter_FixedFloatConfig::Filter_FixedFloatConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.Filter.FixedFloatConfig)
+}
+Filter_FixedFloatConfig::Filter_FixedFloatConfig(const Filter_FixedFloatConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Filter_FixedFloatConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_value_){}
+    , decltype(_impl_.max_value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_value_, &from._impl_.min_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_value_) -
+    reinterpret_cast<char*>(&_impl_.min_value_)) + sizeof(_impl_.max_value_));
+  // @@protoc_insertion_point(copy_constructor:ps.Filter.FixedFloatConfig)
+}
+
+inline void Filter_FixedFloatConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_value_){-1}
+    , decltype(_impl_.max_value_){1}
+  };
+}
+
+Filter_FixedFloatConfig::~Filter_FixedFloatConfig() {
+  // @@protoc_insertion_point(destructor:ps.Filter.FixedFloatConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Filter_FixedFloatConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Filter_FixedFloatConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Filter_FixedFloatConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.Filter.FixedFloatConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.min_value_ = -1;
+    _impl_.max_value_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Filter_FixedFloatConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float min_value = 1 [default = -1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_min_value(&has_bits);
+          _impl_.min_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float max_value = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_max_value(&has_bits);
+          _impl_.max_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Filter_FixedFloatConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.Filter.FixedFloatConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float min_value = 1 [default = -1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_min_value(), target);
+  }
+
+  // optional float max_value = 2 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_max_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.Filter.FixedFloatConfig)
+  return target;
+}
+
+size_t Filter_FixedFloatConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.Filter.FixedFloatConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional float min_value = 1 [default = -1];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float max_value = 2 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Filter_FixedFloatConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Filter_FixedFloatConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Filter_FixedFloatConfig::GetClassData() const { return &_class_data_; }
+
+
+void Filter_FixedFloatConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Filter_FixedFloatConfig*>(&to_msg);
+  auto& from = static_cast<const Filter_FixedFloatConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.Filter.FixedFloatConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_value_ = from._impl_.min_value_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_value_ = from._impl_.max_value_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Filter_FixedFloatConfig::CopyFrom(const Filter_FixedFloatConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.Filter.FixedFloatConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Filter_FixedFloatConfig::IsInitialized() const {
+  return true;
+}
+
+void Filter_FixedFloatConfig::InternalSwap(Filter_FixedFloatConfig* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.min_value_, other->_impl_.min_value_);
+  swap(_impl_.max_value_, other->_impl_.max_value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Filter_FixedFloatConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2ffilter_2eproto_getter, &descriptor_table_proto_2ffilter_2eproto_once,
+      file_level_metadata_proto_2ffilter_2eproto[0]);
+}
+
+// ===================================================================
+
+class Filter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Filter>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_clear_cache(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_num_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_mean(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_std(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_signature(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000010) ^ 0x00000010) != 0;
+  }
+};
+
+Filter::Filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.Filter)
+}
+Filter::Filter(const Filter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Filter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uncompressed_size_){from._impl_.uncompressed_size_}
+    , decltype(_impl_.fixed_point_){from._impl_.fixed_point_}
+    , decltype(_impl_.signature_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.std_){}
+    , decltype(_impl_.clear_cache_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.num_bytes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.signature_, &from._impl_.signature_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_bytes_) -
+    reinterpret_cast<char*>(&_impl_.signature_)) + sizeof(_impl_.num_bytes_));
+  // @@protoc_insertion_point(copy_constructor:ps.Filter)
+}
+
+inline void Filter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uncompressed_size_){arena}
+    , decltype(_impl_.fixed_point_){arena}
+    , decltype(_impl_.signature_){uint64_t{0u}}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.std_){0}
+    , decltype(_impl_.clear_cache_){false}
+    , decltype(_impl_.type_){1}
+    , decltype(_impl_.num_bytes_){3}
+  };
+}
+
+Filter::~Filter() {
+  // @@protoc_insertion_point(destructor:ps.Filter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Filter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uncompressed_size_.~RepeatedField();
+  _impl_.fixed_point_.~RepeatedPtrField();
+}
+
+void Filter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Filter::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.Filter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uncompressed_size_.Clear();
+  _impl_.fixed_point_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.signature_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clear_cache_) -
+        reinterpret_cast<char*>(&_impl_.signature_)) + sizeof(_impl_.clear_cache_));
+    _impl_.type_ = 1;
+    _impl_.num_bytes_ = 3;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Filter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ps.Filter.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::Filter_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::ps::Filter_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 signature = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_signature(&has_bits);
+          _impl_.signature_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 uncompressed_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_uncompressed_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_uncompressed_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ps.Filter.FixedFloatConfig fixed_point = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_fixed_point(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_bytes = 5 [default = 3];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_num_bytes(&has_bits);
+          _impl_.num_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float mean = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_mean(&has_bits);
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float std = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_std(&has_bits);
+          _impl_.std_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool clear_cache = 20 [default = false];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_clear_cache(&has_bits);
+          _impl_.clear_cache_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Filter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.Filter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ps.Filter.Type type = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional uint64 signature = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_signature(), target);
+  }
+
+  // repeated uint64 uncompressed_size = 3;
+  for (int i = 0, n = this->_internal_uncompressed_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_uncompressed_size(i), target);
+  }
+
+  // repeated .ps.Filter.FixedFloatConfig fixed_point = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_fixed_point_size()); i < n; i++) {
+    const auto& repfield = this->_internal_fixed_point(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional int32 num_bytes = 5 [default = 3];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_num_bytes(), target);
+  }
+
+  // optional float mean = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_mean(), target);
+  }
+
+  // optional float std = 7;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_std(), target);
+  }
+
+  // optional bool clear_cache = 20 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(20, this->_internal_clear_cache(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.Filter)
+  return target;
+}
+
+size_t Filter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.Filter)
+  size_t total_size = 0;
+
+  // required .ps.Filter.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 uncompressed_size = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.uncompressed_size_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_uncompressed_size_size());
+    total_size += data_size;
+  }
+
+  // repeated .ps.Filter.FixedFloatConfig fixed_point = 4;
+  total_size += 1UL * this->_internal_fixed_point_size();
+  for (const auto& msg : this->_impl_.fixed_point_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint64 signature = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_signature());
+    }
+
+    // optional float mean = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float std = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool clear_cache = 20 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 + 1;
+    }
+
+  }
+  // optional int32 num_bytes = 5 [default = 3];
+  if (cached_has_bits & 0x00000020u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Filter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Filter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Filter::GetClassData() const { return &_class_data_; }
+
+
+void Filter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Filter*>(&to_msg);
+  auto& from = static_cast<const Filter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.Filter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.uncompressed_size_.MergeFrom(from._impl_.uncompressed_size_);
+  _this->_impl_.fixed_point_.MergeFrom(from._impl_.fixed_point_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.signature_ = from._impl_.signature_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.mean_ = from._impl_.mean_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.std_ = from._impl_.std_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.clear_cache_ = from._impl_.clear_cache_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.num_bytes_ = from._impl_.num_bytes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Filter::CopyFrom(const Filter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.Filter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Filter::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Filter::InternalSwap(Filter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.uncompressed_size_.InternalSwap(&other->_impl_.uncompressed_size_);
+  _impl_.fixed_point_.InternalSwap(&other->_impl_.fixed_point_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Filter, _impl_.clear_cache_)
+      + sizeof(Filter::_impl_.clear_cache_)
+      - PROTOBUF_FIELD_OFFSET(Filter, _impl_.signature_)>(
+          reinterpret_cast<char*>(&_impl_.signature_),
+          reinterpret_cast<char*>(&other->_impl_.signature_));
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.num_bytes_, other->_impl_.num_bytes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Filter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2ffilter_2eproto_getter, &descriptor_table_proto_2ffilter_2eproto_once,
+      file_level_metadata_proto_2ffilter_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::Filter_FixedFloatConfig*
+Arena::CreateMaybeMessage< ::ps::Filter_FixedFloatConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::Filter_FixedFloatConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::Filter*
+Arena::CreateMaybeMessage< ::ps::Filter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::Filter >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,933 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/filter.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2ffilter_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2ffilter_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2ffilter_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2ffilter_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2ffilter_2eproto;
+namespace ps {
+class Filter;
+struct FilterDefaultTypeInternal;
+extern FilterDefaultTypeInternal _Filter_default_instance_;
+class Filter_FixedFloatConfig;
+struct Filter_FixedFloatConfigDefaultTypeInternal;
+extern Filter_FixedFloatConfigDefaultTypeInternal _Filter_FixedFloatConfig_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::Filter* Arena::CreateMaybeMessage<::ps::Filter>(Arena*);
+template<> ::ps::Filter_FixedFloatConfig* Arena::CreateMaybeMessage<::ps::Filter_FixedFloatConfig>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum Filter_Type : int {
+  Filter_Type_KEY_CACHING = 1,
+  Filter_Type_COMPRESSING = 2,
+  Filter_Type_FIXING_FLOAT = 3,
+  Filter_Type_NOISE = 4,
+  Filter_Type_DELTA_KEY = 5,
+  Filter_Type_TRUNCATE_FLOAT = 6
+};
+bool Filter_Type_IsValid(int value);
+constexpr Filter_Type Filter_Type_Type_MIN = Filter_Type_KEY_CACHING;
+constexpr Filter_Type Filter_Type_Type_MAX = Filter_Type_TRUNCATE_FLOAT;
+constexpr int Filter_Type_Type_ARRAYSIZE = Filter_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Filter_Type_descriptor();
+template<typename T>
+inline const std::string& Filter_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Filter_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Filter_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Filter_Type_descriptor(), enum_t_value);
+}
+inline bool Filter_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Filter_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Filter_Type>(
+    Filter_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class Filter_FixedFloatConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Filter.FixedFloatConfig) */ {
+ public:
+  inline Filter_FixedFloatConfig() : Filter_FixedFloatConfig(nullptr) {}
+  ~Filter_FixedFloatConfig() override;
+  explicit PROTOBUF_CONSTEXPR Filter_FixedFloatConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Filter_FixedFloatConfig(const Filter_FixedFloatConfig& from);
+  Filter_FixedFloatConfig(Filter_FixedFloatConfig&& from) noexcept
+    : Filter_FixedFloatConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline Filter_FixedFloatConfig& operator=(const Filter_FixedFloatConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Filter_FixedFloatConfig& operator=(Filter_FixedFloatConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Filter_FixedFloatConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Filter_FixedFloatConfig* internal_default_instance() {
+    return reinterpret_cast<const Filter_FixedFloatConfig*>(
+               &_Filter_FixedFloatConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Filter_FixedFloatConfig& a, Filter_FixedFloatConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Filter_FixedFloatConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Filter_FixedFloatConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Filter_FixedFloatConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Filter_FixedFloatConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Filter_FixedFloatConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Filter_FixedFloatConfig& from) {
+    Filter_FixedFloatConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Filter_FixedFloatConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Filter.FixedFloatConfig";
+  }
+  protected:
+  explicit Filter_FixedFloatConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMinValueFieldNumber = 1,
+    kMaxValueFieldNumber = 2,
+  };
+  // optional float min_value = 1 [default = -1];
+  bool has_min_value() const;
+  private:
+  bool _internal_has_min_value() const;
+  public:
+  void clear_min_value();
+  float min_value() const;
+  void set_min_value(float value);
+  private:
+  float _internal_min_value() const;
+  void _internal_set_min_value(float value);
+  public:
+
+  // optional float max_value = 2 [default = 1];
+  bool has_max_value() const;
+  private:
+  bool _internal_has_max_value() const;
+  public:
+  void clear_max_value();
+  float max_value() const;
+  void set_max_value(float value);
+  private:
+  float _internal_max_value() const;
+  void _internal_set_max_value(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.Filter.FixedFloatConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float min_value_;
+    float max_value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2ffilter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Filter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Filter) */ {
+ public:
+  inline Filter() : Filter(nullptr) {}
+  ~Filter() override;
+  explicit PROTOBUF_CONSTEXPR Filter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Filter(const Filter& from);
+  Filter(Filter&& from) noexcept
+    : Filter() {
+    *this = ::std::move(from);
+  }
+
+  inline Filter& operator=(const Filter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Filter& operator=(Filter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Filter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Filter* internal_default_instance() {
+    return reinterpret_cast<const Filter*>(
+               &_Filter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Filter& a, Filter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Filter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Filter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Filter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Filter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Filter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Filter& from) {
+    Filter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Filter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Filter";
+  }
+  protected:
+  explicit Filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Filter_FixedFloatConfig FixedFloatConfig;
+
+  typedef Filter_Type Type;
+  static constexpr Type KEY_CACHING =
+    Filter_Type_KEY_CACHING;
+  static constexpr Type COMPRESSING =
+    Filter_Type_COMPRESSING;
+  static constexpr Type FIXING_FLOAT =
+    Filter_Type_FIXING_FLOAT;
+  static constexpr Type NOISE =
+    Filter_Type_NOISE;
+  static constexpr Type DELTA_KEY =
+    Filter_Type_DELTA_KEY;
+  static constexpr Type TRUNCATE_FLOAT =
+    Filter_Type_TRUNCATE_FLOAT;
+  static inline bool Type_IsValid(int value) {
+    return Filter_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Filter_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Filter_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Filter_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return Filter_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Filter_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return Filter_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUncompressedSizeFieldNumber = 3,
+    kFixedPointFieldNumber = 4,
+    kSignatureFieldNumber = 2,
+    kMeanFieldNumber = 6,
+    kStdFieldNumber = 7,
+    kClearCacheFieldNumber = 20,
+    kTypeFieldNumber = 1,
+    kNumBytesFieldNumber = 5,
+  };
+  // repeated uint64 uncompressed_size = 3;
+  int uncompressed_size_size() const;
+  private:
+  int _internal_uncompressed_size_size() const;
+  public:
+  void clear_uncompressed_size();
+  private:
+  uint64_t _internal_uncompressed_size(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_uncompressed_size() const;
+  void _internal_add_uncompressed_size(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_uncompressed_size();
+  public:
+  uint64_t uncompressed_size(int index) const;
+  void set_uncompressed_size(int index, uint64_t value);
+  void add_uncompressed_size(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      uncompressed_size() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_uncompressed_size();
+
+  // repeated .ps.Filter.FixedFloatConfig fixed_point = 4;
+  int fixed_point_size() const;
+  private:
+  int _internal_fixed_point_size() const;
+  public:
+  void clear_fixed_point();
+  ::ps::Filter_FixedFloatConfig* mutable_fixed_point(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter_FixedFloatConfig >*
+      mutable_fixed_point();
+  private:
+  const ::ps::Filter_FixedFloatConfig& _internal_fixed_point(int index) const;
+  ::ps::Filter_FixedFloatConfig* _internal_add_fixed_point();
+  public:
+  const ::ps::Filter_FixedFloatConfig& fixed_point(int index) const;
+  ::ps::Filter_FixedFloatConfig* add_fixed_point();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter_FixedFloatConfig >&
+      fixed_point() const;
+
+  // optional uint64 signature = 2;
+  bool has_signature() const;
+  private:
+  bool _internal_has_signature() const;
+  public:
+  void clear_signature();
+  uint64_t signature() const;
+  void set_signature(uint64_t value);
+  private:
+  uint64_t _internal_signature() const;
+  void _internal_set_signature(uint64_t value);
+  public:
+
+  // optional float mean = 6;
+  bool has_mean() const;
+  private:
+  bool _internal_has_mean() const;
+  public:
+  void clear_mean();
+  float mean() const;
+  void set_mean(float value);
+  private:
+  float _internal_mean() const;
+  void _internal_set_mean(float value);
+  public:
+
+  // optional float std = 7;
+  bool has_std() const;
+  private:
+  bool _internal_has_std() const;
+  public:
+  void clear_std();
+  float std() const;
+  void set_std(float value);
+  private:
+  float _internal_std() const;
+  void _internal_set_std(float value);
+  public:
+
+  // optional bool clear_cache = 20 [default = false];
+  bool has_clear_cache() const;
+  private:
+  bool _internal_has_clear_cache() const;
+  public:
+  void clear_clear_cache();
+  bool clear_cache() const;
+  void set_clear_cache(bool value);
+  private:
+  bool _internal_clear_cache() const;
+  void _internal_set_clear_cache(bool value);
+  public:
+
+  // required .ps.Filter.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::ps::Filter_Type type() const;
+  void set_type(::ps::Filter_Type value);
+  private:
+  ::ps::Filter_Type _internal_type() const;
+  void _internal_set_type(::ps::Filter_Type value);
+  public:
+
+  // optional int32 num_bytes = 5 [default = 3];
+  bool has_num_bytes() const;
+  private:
+  bool _internal_has_num_bytes() const;
+  public:
+  void clear_num_bytes();
+  int32_t num_bytes() const;
+  void set_num_bytes(int32_t value);
+  private:
+  int32_t _internal_num_bytes() const;
+  void _internal_set_num_bytes(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.Filter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > uncompressed_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter_FixedFloatConfig > fixed_point_;
+    uint64_t signature_;
+    float mean_;
+    float std_;
+    bool clear_cache_;
+    int type_;
+    int32_t num_bytes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2ffilter_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Filter_FixedFloatConfig
+
+// optional float min_value = 1 [default = -1];
+inline bool Filter_FixedFloatConfig::_internal_has_min_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Filter_FixedFloatConfig::has_min_value() const {
+  return _internal_has_min_value();
+}
+inline void Filter_FixedFloatConfig::clear_min_value() {
+  _impl_.min_value_ = -1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float Filter_FixedFloatConfig::_internal_min_value() const {
+  return _impl_.min_value_;
+}
+inline float Filter_FixedFloatConfig::min_value() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.FixedFloatConfig.min_value)
+  return _internal_min_value();
+}
+inline void Filter_FixedFloatConfig::_internal_set_min_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_value_ = value;
+}
+inline void Filter_FixedFloatConfig::set_min_value(float value) {
+  _internal_set_min_value(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.FixedFloatConfig.min_value)
+}
+
+// optional float max_value = 2 [default = 1];
+inline bool Filter_FixedFloatConfig::_internal_has_max_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Filter_FixedFloatConfig::has_max_value() const {
+  return _internal_has_max_value();
+}
+inline void Filter_FixedFloatConfig::clear_max_value() {
+  _impl_.max_value_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Filter_FixedFloatConfig::_internal_max_value() const {
+  return _impl_.max_value_;
+}
+inline float Filter_FixedFloatConfig::max_value() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.FixedFloatConfig.max_value)
+  return _internal_max_value();
+}
+inline void Filter_FixedFloatConfig::_internal_set_max_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_value_ = value;
+}
+inline void Filter_FixedFloatConfig::set_max_value(float value) {
+  _internal_set_max_value(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.FixedFloatConfig.max_value)
+}
+
+// -------------------------------------------------------------------
+
+// Filter
+
+// required .ps.Filter.Type type = 1;
+inline bool Filter::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Filter::has_type() const {
+  return _internal_has_type();
+}
+inline void Filter::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::ps::Filter_Type Filter::_internal_type() const {
+  return static_cast< ::ps::Filter_Type >(_impl_.type_);
+}
+inline ::ps::Filter_Type Filter::type() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.type)
+  return _internal_type();
+}
+inline void Filter::_internal_set_type(::ps::Filter_Type value) {
+  assert(::ps::Filter_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void Filter::set_type(::ps::Filter_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.type)
+}
+
+// optional bool clear_cache = 20 [default = false];
+inline bool Filter::_internal_has_clear_cache() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Filter::has_clear_cache() const {
+  return _internal_has_clear_cache();
+}
+inline void Filter::clear_clear_cache() {
+  _impl_.clear_cache_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool Filter::_internal_clear_cache() const {
+  return _impl_.clear_cache_;
+}
+inline bool Filter::clear_cache() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.clear_cache)
+  return _internal_clear_cache();
+}
+inline void Filter::_internal_set_clear_cache(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.clear_cache_ = value;
+}
+inline void Filter::set_clear_cache(bool value) {
+  _internal_set_clear_cache(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.clear_cache)
+}
+
+// optional int32 num_bytes = 5 [default = 3];
+inline bool Filter::_internal_has_num_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Filter::has_num_bytes() const {
+  return _internal_has_num_bytes();
+}
+inline void Filter::clear_num_bytes() {
+  _impl_.num_bytes_ = 3;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Filter::_internal_num_bytes() const {
+  return _impl_.num_bytes_;
+}
+inline int32_t Filter::num_bytes() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.num_bytes)
+  return _internal_num_bytes();
+}
+inline void Filter::_internal_set_num_bytes(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.num_bytes_ = value;
+}
+inline void Filter::set_num_bytes(int32_t value) {
+  _internal_set_num_bytes(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.num_bytes)
+}
+
+// optional float mean = 6;
+inline bool Filter::_internal_has_mean() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Filter::has_mean() const {
+  return _internal_has_mean();
+}
+inline void Filter::clear_mean() {
+  _impl_.mean_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Filter::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline float Filter::mean() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.mean)
+  return _internal_mean();
+}
+inline void Filter::_internal_set_mean(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mean_ = value;
+}
+inline void Filter::set_mean(float value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.mean)
+}
+
+// optional float std = 7;
+inline bool Filter::_internal_has_std() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Filter::has_std() const {
+  return _internal_has_std();
+}
+inline void Filter::clear_std() {
+  _impl_.std_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Filter::_internal_std() const {
+  return _impl_.std_;
+}
+inline float Filter::std() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.std)
+  return _internal_std();
+}
+inline void Filter::_internal_set_std(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.std_ = value;
+}
+inline void Filter::set_std(float value) {
+  _internal_set_std(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.std)
+}
+
+// repeated .ps.Filter.FixedFloatConfig fixed_point = 4;
+inline int Filter::_internal_fixed_point_size() const {
+  return _impl_.fixed_point_.size();
+}
+inline int Filter::fixed_point_size() const {
+  return _internal_fixed_point_size();
+}
+inline void Filter::clear_fixed_point() {
+  _impl_.fixed_point_.Clear();
+}
+inline ::ps::Filter_FixedFloatConfig* Filter::mutable_fixed_point(int index) {
+  // @@protoc_insertion_point(field_mutable:ps.Filter.fixed_point)
+  return _impl_.fixed_point_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter_FixedFloatConfig >*
+Filter::mutable_fixed_point() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Filter.fixed_point)
+  return &_impl_.fixed_point_;
+}
+inline const ::ps::Filter_FixedFloatConfig& Filter::_internal_fixed_point(int index) const {
+  return _impl_.fixed_point_.Get(index);
+}
+inline const ::ps::Filter_FixedFloatConfig& Filter::fixed_point(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Filter.fixed_point)
+  return _internal_fixed_point(index);
+}
+inline ::ps::Filter_FixedFloatConfig* Filter::_internal_add_fixed_point() {
+  return _impl_.fixed_point_.Add();
+}
+inline ::ps::Filter_FixedFloatConfig* Filter::add_fixed_point() {
+  ::ps::Filter_FixedFloatConfig* _add = _internal_add_fixed_point();
+  // @@protoc_insertion_point(field_add:ps.Filter.fixed_point)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter_FixedFloatConfig >&
+Filter::fixed_point() const {
+  // @@protoc_insertion_point(field_list:ps.Filter.fixed_point)
+  return _impl_.fixed_point_;
+}
+
+// optional uint64 signature = 2;
+inline bool Filter::_internal_has_signature() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Filter::has_signature() const {
+  return _internal_has_signature();
+}
+inline void Filter::clear_signature() {
+  _impl_.signature_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Filter::_internal_signature() const {
+  return _impl_.signature_;
+}
+inline uint64_t Filter::signature() const {
+  // @@protoc_insertion_point(field_get:ps.Filter.signature)
+  return _internal_signature();
+}
+inline void Filter::_internal_set_signature(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.signature_ = value;
+}
+inline void Filter::set_signature(uint64_t value) {
+  _internal_set_signature(value);
+  // @@protoc_insertion_point(field_set:ps.Filter.signature)
+}
+
+// repeated uint64 uncompressed_size = 3;
+inline int Filter::_internal_uncompressed_size_size() const {
+  return _impl_.uncompressed_size_.size();
+}
+inline int Filter::uncompressed_size_size() const {
+  return _internal_uncompressed_size_size();
+}
+inline void Filter::clear_uncompressed_size() {
+  _impl_.uncompressed_size_.Clear();
+}
+inline uint64_t Filter::_internal_uncompressed_size(int index) const {
+  return _impl_.uncompressed_size_.Get(index);
+}
+inline uint64_t Filter::uncompressed_size(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Filter.uncompressed_size)
+  return _internal_uncompressed_size(index);
+}
+inline void Filter::set_uncompressed_size(int index, uint64_t value) {
+  _impl_.uncompressed_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ps.Filter.uncompressed_size)
+}
+inline void Filter::_internal_add_uncompressed_size(uint64_t value) {
+  _impl_.uncompressed_size_.Add(value);
+}
+inline void Filter::add_uncompressed_size(uint64_t value) {
+  _internal_add_uncompressed_size(value);
+  // @@protoc_insertion_point(field_add:ps.Filter.uncompressed_size)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Filter::_internal_uncompressed_size() const {
+  return _impl_.uncompressed_size_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Filter::uncompressed_size() const {
+  // @@protoc_insertion_point(field_list:ps.Filter.uncompressed_size)
+  return _internal_uncompressed_size();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Filter::_internal_mutable_uncompressed_size() {
+  return &_impl_.uncompressed_size_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Filter::mutable_uncompressed_size() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Filter.uncompressed_size)
+  return _internal_mutable_uncompressed_size();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::Filter_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::Filter_Type>() {
+  return ::ps::Filter_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2ffilter_2eproto
@@ -0,0 +1,785 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/heartbeat.proto
+
+#include "proto/heartbeat.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR HeartbeatReport::HeartbeatReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hostname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.task_id_)*/0
+  , /*decltype(_impl_.seconds_since_epoch_)*/0u
+  , /*decltype(_impl_.busy_time_milli_)*/0u
+  , /*decltype(_impl_.net_in_mb_)*/0u
+  , /*decltype(_impl_.net_out_mb_)*/0u
+  , /*decltype(_impl_.process_cpu_usage_)*/0u
+  , /*decltype(_impl_.host_cpu_usage_)*/0u
+  , /*decltype(_impl_.process_rss_mb_)*/0u
+  , /*decltype(_impl_.process_virt_mb_)*/0u
+  , /*decltype(_impl_.host_in_use_gb_)*/0u
+  , /*decltype(_impl_.host_net_in_bw_)*/0u
+  , /*decltype(_impl_.host_net_out_bw_)*/0u
+  , /*decltype(_impl_.total_time_milli_)*/0u
+  , /*decltype(_impl_.host_in_use_percentage_)*/0u} {}
+struct HeartbeatReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatReportDefaultTypeInternal() {}
+  union {
+    HeartbeatReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatReportDefaultTypeInternal _HeartbeatReport_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2fheartbeat_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fheartbeat_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fheartbeat_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fheartbeat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.hostname_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.seconds_since_epoch_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.total_time_milli_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.busy_time_milli_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.net_in_mb_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.net_out_mb_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.process_cpu_usage_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.host_cpu_usage_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.process_rss_mb_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.process_virt_mb_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.host_in_use_gb_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.host_in_use_percentage_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.host_net_in_bw_),
+  PROTOBUF_FIELD_OFFSET(::ps::HeartbeatReport, _impl_.host_net_out_bw_),
+  1,
+  0,
+  2,
+  13,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  14,
+  11,
+  12,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 21, -1, sizeof(::ps::HeartbeatReport)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_HeartbeatReport_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fheartbeat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025proto/heartbeat.proto\022\002ps\"\373\002\n\017Heartbea"
+  "tReport\022\022\n\007task_id\030\001 \001(\005:\0010\022\020\n\010hostname\030"
+  "\016 \001(\t\022\033\n\023seconds_since_epoch\030\002 \001(\r\022\030\n\020to"
+  "tal_time_milli\030\r \001(\r\022\027\n\017busy_time_milli\030"
+  "\003 \001(\r\022\021\n\tnet_in_mb\030\004 \001(\r\022\022\n\nnet_out_mb\030\005"
+  " \001(\r\022\031\n\021process_cpu_usage\030\006 \001(\r\022\026\n\016host_"
+  "cpu_usage\030\007 \001(\r\022\026\n\016process_rss_mb\030\010 \001(\r\022"
+  "\027\n\017process_virt_mb\030\t \001(\r\022\026\n\016host_in_use_"
+  "gb\030\n \001(\r\022\036\n\026host_in_use_percentage\030\017 \001(\r"
+  "\022\026\n\016host_net_in_bw\030\013 \001(\r\022\027\n\017host_net_out"
+  "_bw\030\014 \001(\r"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fheartbeat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fheartbeat_2eproto = {
+    false, false, 409, descriptor_table_protodef_proto_2fheartbeat_2eproto,
+    "proto/heartbeat.proto",
+    &descriptor_table_proto_2fheartbeat_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_proto_2fheartbeat_2eproto::offsets,
+    file_level_metadata_proto_2fheartbeat_2eproto, file_level_enum_descriptors_proto_2fheartbeat_2eproto,
+    file_level_service_descriptors_proto_2fheartbeat_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fheartbeat_2eproto_getter() {
+  return &descriptor_table_proto_2fheartbeat_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fheartbeat_2eproto(&descriptor_table_proto_2fheartbeat_2eproto);
+namespace ps {
+
+// ===================================================================
+
+class HeartbeatReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HeartbeatReport>()._impl_._has_bits_);
+  static void set_has_task_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_hostname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_seconds_since_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_total_time_milli(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_busy_time_milli(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_net_in_mb(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_net_out_mb(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_process_cpu_usage(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_host_cpu_usage(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_process_rss_mb(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_process_virt_mb(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_host_in_use_gb(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_host_in_use_percentage(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_host_net_in_bw(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_host_net_out_bw(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+};
+
+HeartbeatReport::HeartbeatReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.HeartbeatReport)
+}
+HeartbeatReport::HeartbeatReport(const HeartbeatReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HeartbeatReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hostname_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.seconds_since_epoch_){}
+    , decltype(_impl_.busy_time_milli_){}
+    , decltype(_impl_.net_in_mb_){}
+    , decltype(_impl_.net_out_mb_){}
+    , decltype(_impl_.process_cpu_usage_){}
+    , decltype(_impl_.host_cpu_usage_){}
+    , decltype(_impl_.process_rss_mb_){}
+    , decltype(_impl_.process_virt_mb_){}
+    , decltype(_impl_.host_in_use_gb_){}
+    , decltype(_impl_.host_net_in_bw_){}
+    , decltype(_impl_.host_net_out_bw_){}
+    , decltype(_impl_.total_time_milli_){}
+    , decltype(_impl_.host_in_use_percentage_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hostname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hostname()) {
+    _this->_impl_.hostname_.Set(from._internal_hostname(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.task_id_, &from._impl_.task_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.host_in_use_percentage_) -
+    reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.host_in_use_percentage_));
+  // @@protoc_insertion_point(copy_constructor:ps.HeartbeatReport)
+}
+
+inline void HeartbeatReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hostname_){}
+    , decltype(_impl_.task_id_){0}
+    , decltype(_impl_.seconds_since_epoch_){0u}
+    , decltype(_impl_.busy_time_milli_){0u}
+    , decltype(_impl_.net_in_mb_){0u}
+    , decltype(_impl_.net_out_mb_){0u}
+    , decltype(_impl_.process_cpu_usage_){0u}
+    , decltype(_impl_.host_cpu_usage_){0u}
+    , decltype(_impl_.process_rss_mb_){0u}
+    , decltype(_impl_.process_virt_mb_){0u}
+    , decltype(_impl_.host_in_use_gb_){0u}
+    , decltype(_impl_.host_net_in_bw_){0u}
+    , decltype(_impl_.host_net_out_bw_){0u}
+    , decltype(_impl_.total_time_milli_){0u}
+    , decltype(_impl_.host_in_use_percentage_){0u}
+  };
+  _impl_.hostname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HeartbeatReport::~HeartbeatReport() {
+  // @@protoc_insertion_point(destructor:ps.HeartbeatReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HeartbeatReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hostname_.Destroy();
+}
+
+void HeartbeatReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HeartbeatReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.HeartbeatReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.hostname_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.task_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.host_cpu_usage_) -
+        reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.host_cpu_usage_));
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    ::memset(&_impl_.process_rss_mb_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.host_in_use_percentage_) -
+        reinterpret_cast<char*>(&_impl_.process_rss_mb_)) + sizeof(_impl_.host_in_use_percentage_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HeartbeatReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 task_id = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_task_id(&has_bits);
+          _impl_.task_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 seconds_since_epoch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_seconds_since_epoch(&has_bits);
+          _impl_.seconds_since_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 busy_time_milli = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_busy_time_milli(&has_bits);
+          _impl_.busy_time_milli_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 net_in_mb = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_net_in_mb(&has_bits);
+          _impl_.net_in_mb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 net_out_mb = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_net_out_mb(&has_bits);
+          _impl_.net_out_mb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 process_cpu_usage = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_process_cpu_usage(&has_bits);
+          _impl_.process_cpu_usage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_cpu_usage = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_host_cpu_usage(&has_bits);
+          _impl_.host_cpu_usage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 process_rss_mb = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_process_rss_mb(&has_bits);
+          _impl_.process_rss_mb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 process_virt_mb = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_process_virt_mb(&has_bits);
+          _impl_.process_virt_mb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_in_use_gb = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_host_in_use_gb(&has_bits);
+          _impl_.host_in_use_gb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_net_in_bw = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_host_net_in_bw(&has_bits);
+          _impl_.host_net_in_bw_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_net_out_bw = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_host_net_out_bw(&has_bits);
+          _impl_.host_net_out_bw_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 total_time_milli = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_total_time_milli(&has_bits);
+          _impl_.total_time_milli_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string hostname = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_hostname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.HeartbeatReport.hostname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_in_use_percentage = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_host_in_use_percentage(&has_bits);
+          _impl_.host_in_use_percentage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HeartbeatReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.HeartbeatReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 task_id = 1 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_task_id(), target);
+  }
+
+  // optional uint32 seconds_since_epoch = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_seconds_since_epoch(), target);
+  }
+
+  // optional uint32 busy_time_milli = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_busy_time_milli(), target);
+  }
+
+  // optional uint32 net_in_mb = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_net_in_mb(), target);
+  }
+
+  // optional uint32 net_out_mb = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_net_out_mb(), target);
+  }
+
+  // optional uint32 process_cpu_usage = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_process_cpu_usage(), target);
+  }
+
+  // optional uint32 host_cpu_usage = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_host_cpu_usage(), target);
+  }
+
+  // optional uint32 process_rss_mb = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_process_rss_mb(), target);
+  }
+
+  // optional uint32 process_virt_mb = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_process_virt_mb(), target);
+  }
+
+  // optional uint32 host_in_use_gb = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_host_in_use_gb(), target);
+  }
+
+  // optional uint32 host_net_in_bw = 11;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_host_net_in_bw(), target);
+  }
+
+  // optional uint32 host_net_out_bw = 12;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_host_net_out_bw(), target);
+  }
+
+  // optional uint32 total_time_milli = 13;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_total_time_milli(), target);
+  }
+
+  // optional string hostname = 14;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_hostname().data(), static_cast<int>(this->_internal_hostname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.HeartbeatReport.hostname");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_hostname(), target);
+  }
+
+  // optional uint32 host_in_use_percentage = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_host_in_use_percentage(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.HeartbeatReport)
+  return target;
+}
+
+size_t HeartbeatReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.HeartbeatReport)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string hostname = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_hostname());
+    }
+
+    // optional int32 task_id = 1 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+    }
+
+    // optional uint32 seconds_since_epoch = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seconds_since_epoch());
+    }
+
+    // optional uint32 busy_time_milli = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_busy_time_milli());
+    }
+
+    // optional uint32 net_in_mb = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_net_in_mb());
+    }
+
+    // optional uint32 net_out_mb = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_net_out_mb());
+    }
+
+    // optional uint32 process_cpu_usage = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_process_cpu_usage());
+    }
+
+    // optional uint32 host_cpu_usage = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_cpu_usage());
+    }
+
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    // optional uint32 process_rss_mb = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_process_rss_mb());
+    }
+
+    // optional uint32 process_virt_mb = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_process_virt_mb());
+    }
+
+    // optional uint32 host_in_use_gb = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_in_use_gb());
+    }
+
+    // optional uint32 host_net_in_bw = 11;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_net_in_bw());
+    }
+
+    // optional uint32 host_net_out_bw = 12;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_net_out_bw());
+    }
+
+    // optional uint32 total_time_milli = 13;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_total_time_milli());
+    }
+
+    // optional uint32 host_in_use_percentage = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_in_use_percentage());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartbeatReport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HeartbeatReport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartbeatReport::GetClassData() const { return &_class_data_; }
+
+
+void HeartbeatReport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HeartbeatReport*>(&to_msg);
+  auto& from = static_cast<const HeartbeatReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.HeartbeatReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_hostname(from._internal_hostname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.task_id_ = from._impl_.task_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.seconds_since_epoch_ = from._impl_.seconds_since_epoch_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.busy_time_milli_ = from._impl_.busy_time_milli_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.net_in_mb_ = from._impl_.net_in_mb_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.net_out_mb_ = from._impl_.net_out_mb_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.process_cpu_usage_ = from._impl_.process_cpu_usage_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.host_cpu_usage_ = from._impl_.host_cpu_usage_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.process_rss_mb_ = from._impl_.process_rss_mb_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.process_virt_mb_ = from._impl_.process_virt_mb_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.host_in_use_gb_ = from._impl_.host_in_use_gb_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.host_net_in_bw_ = from._impl_.host_net_in_bw_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.host_net_out_bw_ = from._impl_.host_net_out_bw_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.total_time_milli_ = from._impl_.total_time_milli_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.host_in_use_percentage_ = from._impl_.host_in_use_percentage_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HeartbeatReport::CopyFrom(const HeartbeatReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.HeartbeatReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HeartbeatReport::IsInitialized() const {
+  return true;
+}
+
+void HeartbeatReport::InternalSwap(HeartbeatReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hostname_, lhs_arena,
+      &other->_impl_.hostname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HeartbeatReport, _impl_.host_in_use_percentage_)
+      + sizeof(HeartbeatReport::_impl_.host_in_use_percentage_)
+      - PROTOBUF_FIELD_OFFSET(HeartbeatReport, _impl_.task_id_)>(
+          reinterpret_cast<char*>(&_impl_.task_id_),
+          reinterpret_cast<char*>(&other->_impl_.task_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HeartbeatReport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fheartbeat_2eproto_getter, &descriptor_table_proto_2fheartbeat_2eproto_once,
+      file_level_metadata_proto_2fheartbeat_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::HeartbeatReport*
+Arena::CreateMaybeMessage< ::ps::HeartbeatReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::HeartbeatReport >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,914 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/heartbeat.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fheartbeat_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fheartbeat_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fheartbeat_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fheartbeat_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fheartbeat_2eproto;
+namespace ps {
+class HeartbeatReport;
+struct HeartbeatReportDefaultTypeInternal;
+extern HeartbeatReportDefaultTypeInternal _HeartbeatReport_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::HeartbeatReport* Arena::CreateMaybeMessage<::ps::HeartbeatReport>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+// ===================================================================
+
+class HeartbeatReport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.HeartbeatReport) */ {
+ public:
+  inline HeartbeatReport() : HeartbeatReport(nullptr) {}
+  ~HeartbeatReport() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HeartbeatReport(const HeartbeatReport& from);
+  HeartbeatReport(HeartbeatReport&& from) noexcept
+    : HeartbeatReport() {
+    *this = ::std::move(from);
+  }
+
+  inline HeartbeatReport& operator=(const HeartbeatReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HeartbeatReport& operator=(HeartbeatReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HeartbeatReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatReport* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatReport*>(
+               &_HeartbeatReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(HeartbeatReport& a, HeartbeatReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HeartbeatReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartbeatReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HeartbeatReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatReport>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatReport& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatReport& from) {
+    HeartbeatReport::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HeartbeatReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.HeartbeatReport";
+  }
+  protected:
+  explicit HeartbeatReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHostnameFieldNumber = 14,
+    kTaskIdFieldNumber = 1,
+    kSecondsSinceEpochFieldNumber = 2,
+    kBusyTimeMilliFieldNumber = 3,
+    kNetInMbFieldNumber = 4,
+    kNetOutMbFieldNumber = 5,
+    kProcessCpuUsageFieldNumber = 6,
+    kHostCpuUsageFieldNumber = 7,
+    kProcessRssMbFieldNumber = 8,
+    kProcessVirtMbFieldNumber = 9,
+    kHostInUseGbFieldNumber = 10,
+    kHostNetInBwFieldNumber = 11,
+    kHostNetOutBwFieldNumber = 12,
+    kTotalTimeMilliFieldNumber = 13,
+    kHostInUsePercentageFieldNumber = 15,
+  };
+  // optional string hostname = 14;
+  bool has_hostname() const;
+  private:
+  bool _internal_has_hostname() const;
+  public:
+  void clear_hostname();
+  const std::string& hostname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hostname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hostname();
+  PROTOBUF_NODISCARD std::string* release_hostname();
+  void set_allocated_hostname(std::string* hostname);
+  private:
+  const std::string& _internal_hostname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hostname(const std::string& value);
+  std::string* _internal_mutable_hostname();
+  public:
+
+  // optional int32 task_id = 1 [default = 0];
+  bool has_task_id() const;
+  private:
+  bool _internal_has_task_id() const;
+  public:
+  void clear_task_id();
+  int32_t task_id() const;
+  void set_task_id(int32_t value);
+  private:
+  int32_t _internal_task_id() const;
+  void _internal_set_task_id(int32_t value);
+  public:
+
+  // optional uint32 seconds_since_epoch = 2;
+  bool has_seconds_since_epoch() const;
+  private:
+  bool _internal_has_seconds_since_epoch() const;
+  public:
+  void clear_seconds_since_epoch();
+  uint32_t seconds_since_epoch() const;
+  void set_seconds_since_epoch(uint32_t value);
+  private:
+  uint32_t _internal_seconds_since_epoch() const;
+  void _internal_set_seconds_since_epoch(uint32_t value);
+  public:
+
+  // optional uint32 busy_time_milli = 3;
+  bool has_busy_time_milli() const;
+  private:
+  bool _internal_has_busy_time_milli() const;
+  public:
+  void clear_busy_time_milli();
+  uint32_t busy_time_milli() const;
+  void set_busy_time_milli(uint32_t value);
+  private:
+  uint32_t _internal_busy_time_milli() const;
+  void _internal_set_busy_time_milli(uint32_t value);
+  public:
+
+  // optional uint32 net_in_mb = 4;
+  bool has_net_in_mb() const;
+  private:
+  bool _internal_has_net_in_mb() const;
+  public:
+  void clear_net_in_mb();
+  uint32_t net_in_mb() const;
+  void set_net_in_mb(uint32_t value);
+  private:
+  uint32_t _internal_net_in_mb() const;
+  void _internal_set_net_in_mb(uint32_t value);
+  public:
+
+  // optional uint32 net_out_mb = 5;
+  bool has_net_out_mb() const;
+  private:
+  bool _internal_has_net_out_mb() const;
+  public:
+  void clear_net_out_mb();
+  uint32_t net_out_mb() const;
+  void set_net_out_mb(uint32_t value);
+  private:
+  uint32_t _internal_net_out_mb() const;
+  void _internal_set_net_out_mb(uint32_t value);
+  public:
+
+  // optional uint32 process_cpu_usage = 6;
+  bool has_process_cpu_usage() const;
+  private:
+  bool _internal_has_process_cpu_usage() const;
+  public:
+  void clear_process_cpu_usage();
+  uint32_t process_cpu_usage() const;
+  void set_process_cpu_usage(uint32_t value);
+  private:
+  uint32_t _internal_process_cpu_usage() const;
+  void _internal_set_process_cpu_usage(uint32_t value);
+  public:
+
+  // optional uint32 host_cpu_usage = 7;
+  bool has_host_cpu_usage() const;
+  private:
+  bool _internal_has_host_cpu_usage() const;
+  public:
+  void clear_host_cpu_usage();
+  uint32_t host_cpu_usage() const;
+  void set_host_cpu_usage(uint32_t value);
+  private:
+  uint32_t _internal_host_cpu_usage() const;
+  void _internal_set_host_cpu_usage(uint32_t value);
+  public:
+
+  // optional uint32 process_rss_mb = 8;
+  bool has_process_rss_mb() const;
+  private:
+  bool _internal_has_process_rss_mb() const;
+  public:
+  void clear_process_rss_mb();
+  uint32_t process_rss_mb() const;
+  void set_process_rss_mb(uint32_t value);
+  private:
+  uint32_t _internal_process_rss_mb() const;
+  void _internal_set_process_rss_mb(uint32_t value);
+  public:
+
+  // optional uint32 process_virt_mb = 9;
+  bool has_process_virt_mb() const;
+  private:
+  bool _internal_has_process_virt_mb() const;
+  public:
+  void clear_process_virt_mb();
+  uint32_t process_virt_mb() const;
+  void set_process_virt_mb(uint32_t value);
+  private:
+  uint32_t _internal_process_virt_mb() const;
+  void _internal_set_process_virt_mb(uint32_t value);
+  public:
+
+  // optional uint32 host_in_use_gb = 10;
+  bool has_host_in_use_gb() const;
+  private:
+  bool _internal_has_host_in_use_gb() const;
+  public:
+  void clear_host_in_use_gb();
+  uint32_t host_in_use_gb() const;
+  void set_host_in_use_gb(uint32_t value);
+  private:
+  uint32_t _internal_host_in_use_gb() const;
+  void _internal_set_host_in_use_gb(uint32_t value);
+  public:
+
+  // optional uint32 host_net_in_bw = 11;
+  bool has_host_net_in_bw() const;
+  private:
+  bool _internal_has_host_net_in_bw() const;
+  public:
+  void clear_host_net_in_bw();
+  uint32_t host_net_in_bw() const;
+  void set_host_net_in_bw(uint32_t value);
+  private:
+  uint32_t _internal_host_net_in_bw() const;
+  void _internal_set_host_net_in_bw(uint32_t value);
+  public:
+
+  // optional uint32 host_net_out_bw = 12;
+  bool has_host_net_out_bw() const;
+  private:
+  bool _internal_has_host_net_out_bw() const;
+  public:
+  void clear_host_net_out_bw();
+  uint32_t host_net_out_bw() const;
+  void set_host_net_out_bw(uint32_t value);
+  private:
+  uint32_t _internal_host_net_out_bw() const;
+  void _internal_set_host_net_out_bw(uint32_t value);
+  public:
+
+  // optional uint32 total_time_milli = 13;
+  bool has_total_time_milli() const;
+  private:
+  bool _internal_has_total_time_milli() const;
+  public:
+  void clear_total_time_milli();
+  uint32_t total_time_milli() const;
+  void set_total_time_milli(uint32_t value);
+  private:
+  uint32_t _internal_total_time_milli() const;
+  void _internal_set_total_time_milli(uint32_t value);
+  public:
+
+  // optional uint32 host_in_use_percentage = 15;
+  bool has_host_in_use_percentage() const;
+  private:
+  bool _internal_has_host_in_use_percentage() const;
+  public:
+  void clear_host_in_use_percentage();
+  uint32_t host_in_use_percentage() const;
+  void set_host_in_use_percentage(uint32_t value);
+  private:
+  uint32_t _internal_host_in_use_percentage() const;
+  void _internal_set_host_in_use_percentage(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.HeartbeatReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hostname_;
+    int32_t task_id_;
+    uint32_t seconds_since_epoch_;
+    uint32_t busy_time_milli_;
+    uint32_t net_in_mb_;
+    uint32_t net_out_mb_;
+    uint32_t process_cpu_usage_;
+    uint32_t host_cpu_usage_;
+    uint32_t process_rss_mb_;
+    uint32_t process_virt_mb_;
+    uint32_t host_in_use_gb_;
+    uint32_t host_net_in_bw_;
+    uint32_t host_net_out_bw_;
+    uint32_t total_time_milli_;
+    uint32_t host_in_use_percentage_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fheartbeat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HeartbeatReport
+
+// optional int32 task_id = 1 [default = 0];
+inline bool HeartbeatReport::_internal_has_task_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_task_id() const {
+  return _internal_has_task_id();
+}
+inline void HeartbeatReport::clear_task_id() {
+  _impl_.task_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t HeartbeatReport::_internal_task_id() const {
+  return _impl_.task_id_;
+}
+inline int32_t HeartbeatReport::task_id() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.task_id)
+  return _internal_task_id();
+}
+inline void HeartbeatReport::_internal_set_task_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.task_id_ = value;
+}
+inline void HeartbeatReport::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.task_id)
+}
+
+// optional string hostname = 14;
+inline bool HeartbeatReport::_internal_has_hostname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_hostname() const {
+  return _internal_has_hostname();
+}
+inline void HeartbeatReport::clear_hostname() {
+  _impl_.hostname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HeartbeatReport::hostname() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.hostname)
+  return _internal_hostname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HeartbeatReport::set_hostname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.hostname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.hostname)
+}
+inline std::string* HeartbeatReport::mutable_hostname() {
+  std::string* _s = _internal_mutable_hostname();
+  // @@protoc_insertion_point(field_mutable:ps.HeartbeatReport.hostname)
+  return _s;
+}
+inline const std::string& HeartbeatReport::_internal_hostname() const {
+  return _impl_.hostname_.Get();
+}
+inline void HeartbeatReport::_internal_set_hostname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hostname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HeartbeatReport::_internal_mutable_hostname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.hostname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HeartbeatReport::release_hostname() {
+  // @@protoc_insertion_point(field_release:ps.HeartbeatReport.hostname)
+  if (!_internal_has_hostname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.hostname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hostname_.IsDefault()) {
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HeartbeatReport::set_allocated_hostname(std::string* hostname) {
+  if (hostname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.hostname_.SetAllocated(hostname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hostname_.IsDefault()) {
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.HeartbeatReport.hostname)
+}
+
+// optional uint32 seconds_since_epoch = 2;
+inline bool HeartbeatReport::_internal_has_seconds_since_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_seconds_since_epoch() const {
+  return _internal_has_seconds_since_epoch();
+}
+inline void HeartbeatReport::clear_seconds_since_epoch() {
+  _impl_.seconds_since_epoch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t HeartbeatReport::_internal_seconds_since_epoch() const {
+  return _impl_.seconds_since_epoch_;
+}
+inline uint32_t HeartbeatReport::seconds_since_epoch() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.seconds_since_epoch)
+  return _internal_seconds_since_epoch();
+}
+inline void HeartbeatReport::_internal_set_seconds_since_epoch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.seconds_since_epoch_ = value;
+}
+inline void HeartbeatReport::set_seconds_since_epoch(uint32_t value) {
+  _internal_set_seconds_since_epoch(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.seconds_since_epoch)
+}
+
+// optional uint32 total_time_milli = 13;
+inline bool HeartbeatReport::_internal_has_total_time_milli() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_total_time_milli() const {
+  return _internal_has_total_time_milli();
+}
+inline void HeartbeatReport::clear_total_time_milli() {
+  _impl_.total_time_milli_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint32_t HeartbeatReport::_internal_total_time_milli() const {
+  return _impl_.total_time_milli_;
+}
+inline uint32_t HeartbeatReport::total_time_milli() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.total_time_milli)
+  return _internal_total_time_milli();
+}
+inline void HeartbeatReport::_internal_set_total_time_milli(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.total_time_milli_ = value;
+}
+inline void HeartbeatReport::set_total_time_milli(uint32_t value) {
+  _internal_set_total_time_milli(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.total_time_milli)
+}
+
+// optional uint32 busy_time_milli = 3;
+inline bool HeartbeatReport::_internal_has_busy_time_milli() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_busy_time_milli() const {
+  return _internal_has_busy_time_milli();
+}
+inline void HeartbeatReport::clear_busy_time_milli() {
+  _impl_.busy_time_milli_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t HeartbeatReport::_internal_busy_time_milli() const {
+  return _impl_.busy_time_milli_;
+}
+inline uint32_t HeartbeatReport::busy_time_milli() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.busy_time_milli)
+  return _internal_busy_time_milli();
+}
+inline void HeartbeatReport::_internal_set_busy_time_milli(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.busy_time_milli_ = value;
+}
+inline void HeartbeatReport::set_busy_time_milli(uint32_t value) {
+  _internal_set_busy_time_milli(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.busy_time_milli)
+}
+
+// optional uint32 net_in_mb = 4;
+inline bool HeartbeatReport::_internal_has_net_in_mb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_net_in_mb() const {
+  return _internal_has_net_in_mb();
+}
+inline void HeartbeatReport::clear_net_in_mb() {
+  _impl_.net_in_mb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t HeartbeatReport::_internal_net_in_mb() const {
+  return _impl_.net_in_mb_;
+}
+inline uint32_t HeartbeatReport::net_in_mb() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.net_in_mb)
+  return _internal_net_in_mb();
+}
+inline void HeartbeatReport::_internal_set_net_in_mb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.net_in_mb_ = value;
+}
+inline void HeartbeatReport::set_net_in_mb(uint32_t value) {
+  _internal_set_net_in_mb(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.net_in_mb)
+}
+
+// optional uint32 net_out_mb = 5;
+inline bool HeartbeatReport::_internal_has_net_out_mb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_net_out_mb() const {
+  return _internal_has_net_out_mb();
+}
+inline void HeartbeatReport::clear_net_out_mb() {
+  _impl_.net_out_mb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t HeartbeatReport::_internal_net_out_mb() const {
+  return _impl_.net_out_mb_;
+}
+inline uint32_t HeartbeatReport::net_out_mb() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.net_out_mb)
+  return _internal_net_out_mb();
+}
+inline void HeartbeatReport::_internal_set_net_out_mb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.net_out_mb_ = value;
+}
+inline void HeartbeatReport::set_net_out_mb(uint32_t value) {
+  _internal_set_net_out_mb(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.net_out_mb)
+}
+
+// optional uint32 process_cpu_usage = 6;
+inline bool HeartbeatReport::_internal_has_process_cpu_usage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_process_cpu_usage() const {
+  return _internal_has_process_cpu_usage();
+}
+inline void HeartbeatReport::clear_process_cpu_usage() {
+  _impl_.process_cpu_usage_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t HeartbeatReport::_internal_process_cpu_usage() const {
+  return _impl_.process_cpu_usage_;
+}
+inline uint32_t HeartbeatReport::process_cpu_usage() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.process_cpu_usage)
+  return _internal_process_cpu_usage();
+}
+inline void HeartbeatReport::_internal_set_process_cpu_usage(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.process_cpu_usage_ = value;
+}
+inline void HeartbeatReport::set_process_cpu_usage(uint32_t value) {
+  _internal_set_process_cpu_usage(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.process_cpu_usage)
+}
+
+// optional uint32 host_cpu_usage = 7;
+inline bool HeartbeatReport::_internal_has_host_cpu_usage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_host_cpu_usage() const {
+  return _internal_has_host_cpu_usage();
+}
+inline void HeartbeatReport::clear_host_cpu_usage() {
+  _impl_.host_cpu_usage_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t HeartbeatReport::_internal_host_cpu_usage() const {
+  return _impl_.host_cpu_usage_;
+}
+inline uint32_t HeartbeatReport::host_cpu_usage() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.host_cpu_usage)
+  return _internal_host_cpu_usage();
+}
+inline void HeartbeatReport::_internal_set_host_cpu_usage(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.host_cpu_usage_ = value;
+}
+inline void HeartbeatReport::set_host_cpu_usage(uint32_t value) {
+  _internal_set_host_cpu_usage(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.host_cpu_usage)
+}
+
+// optional uint32 process_rss_mb = 8;
+inline bool HeartbeatReport::_internal_has_process_rss_mb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_process_rss_mb() const {
+  return _internal_has_process_rss_mb();
+}
+inline void HeartbeatReport::clear_process_rss_mb() {
+  _impl_.process_rss_mb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t HeartbeatReport::_internal_process_rss_mb() const {
+  return _impl_.process_rss_mb_;
+}
+inline uint32_t HeartbeatReport::process_rss_mb() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.process_rss_mb)
+  return _internal_process_rss_mb();
+}
+inline void HeartbeatReport::_internal_set_process_rss_mb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.process_rss_mb_ = value;
+}
+inline void HeartbeatReport::set_process_rss_mb(uint32_t value) {
+  _internal_set_process_rss_mb(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.process_rss_mb)
+}
+
+// optional uint32 process_virt_mb = 9;
+inline bool HeartbeatReport::_internal_has_process_virt_mb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_process_virt_mb() const {
+  return _internal_has_process_virt_mb();
+}
+inline void HeartbeatReport::clear_process_virt_mb() {
+  _impl_.process_virt_mb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t HeartbeatReport::_internal_process_virt_mb() const {
+  return _impl_.process_virt_mb_;
+}
+inline uint32_t HeartbeatReport::process_virt_mb() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.process_virt_mb)
+  return _internal_process_virt_mb();
+}
+inline void HeartbeatReport::_internal_set_process_virt_mb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.process_virt_mb_ = value;
+}
+inline void HeartbeatReport::set_process_virt_mb(uint32_t value) {
+  _internal_set_process_virt_mb(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.process_virt_mb)
+}
+
+// optional uint32 host_in_use_gb = 10;
+inline bool HeartbeatReport::_internal_has_host_in_use_gb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_host_in_use_gb() const {
+  return _internal_has_host_in_use_gb();
+}
+inline void HeartbeatReport::clear_host_in_use_gb() {
+  _impl_.host_in_use_gb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t HeartbeatReport::_internal_host_in_use_gb() const {
+  return _impl_.host_in_use_gb_;
+}
+inline uint32_t HeartbeatReport::host_in_use_gb() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.host_in_use_gb)
+  return _internal_host_in_use_gb();
+}
+inline void HeartbeatReport::_internal_set_host_in_use_gb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.host_in_use_gb_ = value;
+}
+inline void HeartbeatReport::set_host_in_use_gb(uint32_t value) {
+  _internal_set_host_in_use_gb(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.host_in_use_gb)
+}
+
+// optional uint32 host_in_use_percentage = 15;
+inline bool HeartbeatReport::_internal_has_host_in_use_percentage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_host_in_use_percentage() const {
+  return _internal_has_host_in_use_percentage();
+}
+inline void HeartbeatReport::clear_host_in_use_percentage() {
+  _impl_.host_in_use_percentage_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t HeartbeatReport::_internal_host_in_use_percentage() const {
+  return _impl_.host_in_use_percentage_;
+}
+inline uint32_t HeartbeatReport::host_in_use_percentage() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.host_in_use_percentage)
+  return _internal_host_in_use_percentage();
+}
+inline void HeartbeatReport::_internal_set_host_in_use_percentage(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.host_in_use_percentage_ = value;
+}
+inline void HeartbeatReport::set_host_in_use_percentage(uint32_t value) {
+  _internal_set_host_in_use_percentage(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.host_in_use_percentage)
+}
+
+// optional uint32 host_net_in_bw = 11;
+inline bool HeartbeatReport::_internal_has_host_net_in_bw() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_host_net_in_bw() const {
+  return _internal_has_host_net_in_bw();
+}
+inline void HeartbeatReport::clear_host_net_in_bw() {
+  _impl_.host_net_in_bw_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t HeartbeatReport::_internal_host_net_in_bw() const {
+  return _impl_.host_net_in_bw_;
+}
+inline uint32_t HeartbeatReport::host_net_in_bw() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.host_net_in_bw)
+  return _internal_host_net_in_bw();
+}
+inline void HeartbeatReport::_internal_set_host_net_in_bw(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.host_net_in_bw_ = value;
+}
+inline void HeartbeatReport::set_host_net_in_bw(uint32_t value) {
+  _internal_set_host_net_in_bw(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.host_net_in_bw)
+}
+
+// optional uint32 host_net_out_bw = 12;
+inline bool HeartbeatReport::_internal_has_host_net_out_bw() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool HeartbeatReport::has_host_net_out_bw() const {
+  return _internal_has_host_net_out_bw();
+}
+inline void HeartbeatReport::clear_host_net_out_bw() {
+  _impl_.host_net_out_bw_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t HeartbeatReport::_internal_host_net_out_bw() const {
+  return _impl_.host_net_out_bw_;
+}
+inline uint32_t HeartbeatReport::host_net_out_bw() const {
+  // @@protoc_insertion_point(field_get:ps.HeartbeatReport.host_net_out_bw)
+  return _internal_host_net_out_bw();
+}
+inline void HeartbeatReport::_internal_set_host_net_out_bw(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.host_net_out_bw_ = value;
+}
+inline void HeartbeatReport::set_host_net_out_bw(uint32_t value) {
+  _internal_set_host_net_out_bw(value);
+  // @@protoc_insertion_point(field_set:ps.HeartbeatReport.host_net_out_bw)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fheartbeat_2eproto
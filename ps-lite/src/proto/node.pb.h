@@ -0,0 +1,711 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/node.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fnode_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fnode_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "proto/range.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fnode_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fnode_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fnode_2eproto;
+namespace ps {
+class Node;
+struct NodeDefaultTypeInternal;
+extern NodeDefaultTypeInternal _Node_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::Node* Arena::CreateMaybeMessage<::ps::Node>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum Node_Role : int {
+  Node_Role_SERVER = 0,
+  Node_Role_WORKER = 1,
+  Node_Role_SCHEDULER = 3,
+  Node_Role_GROUP = 4,
+  Node_Role_UNUSED = 5
+};
+bool Node_Role_IsValid(int value);
+constexpr Node_Role Node_Role_Role_MIN = Node_Role_SERVER;
+constexpr Node_Role Node_Role_Role_MAX = Node_Role_UNUSED;
+constexpr int Node_Role_Role_ARRAYSIZE = Node_Role_Role_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_Role_descriptor();
+template<typename T>
+inline const std::string& Node_Role_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Node_Role>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Node_Role_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Node_Role_descriptor(), enum_t_value);
+}
+inline bool Node_Role_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Node_Role* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Node_Role>(
+    Node_Role_descriptor(), name, value);
+}
+// ===================================================================
+
+class Node final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Node) */ {
+ public:
+  inline Node() : Node(nullptr) {}
+  ~Node() override;
+  explicit PROTOBUF_CONSTEXPR Node(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Node(const Node& from);
+  Node(Node&& from) noexcept
+    : Node() {
+    *this = ::std::move(from);
+  }
+
+  inline Node& operator=(const Node& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Node& operator=(Node&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Node& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Node* internal_default_instance() {
+    return reinterpret_cast<const Node*>(
+               &_Node_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Node& a, Node& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Node* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Node* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Node* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Node>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Node& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Node& from) {
+    Node::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Node* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Node";
+  }
+  protected:
+  explicit Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Node_Role Role;
+  static constexpr Role SERVER =
+    Node_Role_SERVER;
+  static constexpr Role WORKER =
+    Node_Role_WORKER;
+  static constexpr Role SCHEDULER =
+    Node_Role_SCHEDULER;
+  static constexpr Role GROUP =
+    Node_Role_GROUP;
+  static constexpr Role UNUSED =
+    Node_Role_UNUSED;
+  static inline bool Role_IsValid(int value) {
+    return Node_Role_IsValid(value);
+  }
+  static constexpr Role Role_MIN =
+    Node_Role_Role_MIN;
+  static constexpr Role Role_MAX =
+    Node_Role_Role_MAX;
+  static constexpr int Role_ARRAYSIZE =
+    Node_Role_Role_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Role_descriptor() {
+    return Node_Role_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Role_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Role>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Role_Name.");
+    return Node_Role_Name(enum_t_value);
+  }
+  static inline bool Role_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Role* value) {
+    return Node_Role_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 2,
+    kHostnameFieldNumber = 3,
+    kKeyFieldNumber = 6,
+    kRoleFieldNumber = 1,
+    kPortFieldNumber = 4,
+    kRankFieldNumber = 5,
+  };
+  // optional string id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // optional string hostname = 3;
+  bool has_hostname() const;
+  private:
+  bool _internal_has_hostname() const;
+  public:
+  void clear_hostname();
+  const std::string& hostname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hostname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hostname();
+  PROTOBUF_NODISCARD std::string* release_hostname();
+  void set_allocated_hostname(std::string* hostname);
+  private:
+  const std::string& _internal_hostname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hostname(const std::string& value);
+  std::string* _internal_mutable_hostname();
+  public:
+
+  // optional .ps.PbRange key = 6;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const ::ps::PbRange& key() const;
+  PROTOBUF_NODISCARD ::ps::PbRange* release_key();
+  ::ps::PbRange* mutable_key();
+  void set_allocated_key(::ps::PbRange* key);
+  private:
+  const ::ps::PbRange& _internal_key() const;
+  ::ps::PbRange* _internal_mutable_key();
+  public:
+  void unsafe_arena_set_allocated_key(
+      ::ps::PbRange* key);
+  ::ps::PbRange* unsafe_arena_release_key();
+
+  // required .ps.Node.Role role = 1;
+  bool has_role() const;
+  private:
+  bool _internal_has_role() const;
+  public:
+  void clear_role();
+  ::ps::Node_Role role() const;
+  void set_role(::ps::Node_Role value);
+  private:
+  ::ps::Node_Role _internal_role() const;
+  void _internal_set_role(::ps::Node_Role value);
+  public:
+
+  // optional int32 port = 4;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // optional int32 rank = 5;
+  bool has_rank() const;
+  private:
+  bool _internal_has_rank() const;
+  public:
+  void clear_rank();
+  int32_t rank() const;
+  void set_rank(int32_t value);
+  private:
+  int32_t _internal_rank() const;
+  void _internal_set_rank(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.Node)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hostname_;
+    ::ps::PbRange* key_;
+    int role_;
+    int32_t port_;
+    int32_t rank_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fnode_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Node
+
+// required .ps.Node.Role role = 1;
+inline bool Node::_internal_has_role() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Node::has_role() const {
+  return _internal_has_role();
+}
+inline void Node::clear_role() {
+  _impl_.role_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::ps::Node_Role Node::_internal_role() const {
+  return static_cast< ::ps::Node_Role >(_impl_.role_);
+}
+inline ::ps::Node_Role Node::role() const {
+  // @@protoc_insertion_point(field_get:ps.Node.role)
+  return _internal_role();
+}
+inline void Node::_internal_set_role(::ps::Node_Role value) {
+  assert(::ps::Node_Role_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.role_ = value;
+}
+inline void Node::set_role(::ps::Node_Role value) {
+  _internal_set_role(value);
+  // @@protoc_insertion_point(field_set:ps.Node.role)
+}
+
+// optional string id = 2;
+inline bool Node::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Node::has_id() const {
+  return _internal_has_id();
+}
+inline void Node::clear_id() {
+  _impl_.id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Node::id() const {
+  // @@protoc_insertion_point(field_get:ps.Node.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.Node.id)
+}
+inline std::string* Node::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:ps.Node.id)
+  return _s;
+}
+inline const std::string& Node::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void Node::_internal_set_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_id() {
+  // @@protoc_insertion_point(field_release:ps.Node.id)
+  if (!_internal_has_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.Node.id)
+}
+
+// optional int32 rank = 5;
+inline bool Node::_internal_has_rank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Node::has_rank() const {
+  return _internal_has_rank();
+}
+inline void Node::clear_rank() {
+  _impl_.rank_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Node::_internal_rank() const {
+  return _impl_.rank_;
+}
+inline int32_t Node::rank() const {
+  // @@protoc_insertion_point(field_get:ps.Node.rank)
+  return _internal_rank();
+}
+inline void Node::_internal_set_rank(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.rank_ = value;
+}
+inline void Node::set_rank(int32_t value) {
+  _internal_set_rank(value);
+  // @@protoc_insertion_point(field_set:ps.Node.rank)
+}
+
+// optional string hostname = 3;
+inline bool Node::_internal_has_hostname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Node::has_hostname() const {
+  return _internal_has_hostname();
+}
+inline void Node::clear_hostname() {
+  _impl_.hostname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Node::hostname() const {
+  // @@protoc_insertion_point(field_get:ps.Node.hostname)
+  return _internal_hostname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_hostname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.hostname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.Node.hostname)
+}
+inline std::string* Node::mutable_hostname() {
+  std::string* _s = _internal_mutable_hostname();
+  // @@protoc_insertion_point(field_mutable:ps.Node.hostname)
+  return _s;
+}
+inline const std::string& Node::_internal_hostname() const {
+  return _impl_.hostname_.Get();
+}
+inline void Node::_internal_set_hostname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hostname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_hostname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.hostname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_hostname() {
+  // @@protoc_insertion_point(field_release:ps.Node.hostname)
+  if (!_internal_has_hostname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.hostname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hostname_.IsDefault()) {
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_hostname(std::string* hostname) {
+  if (hostname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.hostname_.SetAllocated(hostname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hostname_.IsDefault()) {
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.Node.hostname)
+}
+
+// optional int32 port = 4;
+inline bool Node::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Node::has_port() const {
+  return _internal_has_port();
+}
+inline void Node::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Node::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t Node::port() const {
+  // @@protoc_insertion_point(field_get:ps.Node.port)
+  return _internal_port();
+}
+inline void Node::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.port_ = value;
+}
+inline void Node::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:ps.Node.port)
+}
+
+// optional .ps.PbRange key = 6;
+inline bool Node::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_ != nullptr);
+  return value;
+}
+inline bool Node::has_key() const {
+  return _internal_has_key();
+}
+inline const ::ps::PbRange& Node::_internal_key() const {
+  const ::ps::PbRange* p = _impl_.key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::PbRange&>(
+      ::ps::_PbRange_default_instance_);
+}
+inline const ::ps::PbRange& Node::key() const {
+  // @@protoc_insertion_point(field_get:ps.Node.key)
+  return _internal_key();
+}
+inline void Node::unsafe_arena_set_allocated_key(
+    ::ps::PbRange* key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  _impl_.key_ = key;
+  if (key) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.Node.key)
+}
+inline ::ps::PbRange* Node::release_key() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ps::PbRange* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::PbRange* Node::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:ps.Node.key)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ps::PbRange* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+  return temp;
+}
+inline ::ps::PbRange* Node::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::PbRange>(GetArenaForAllocation());
+    _impl_.key_ = p;
+  }
+  return _impl_.key_;
+}
+inline ::ps::PbRange* Node::mutable_key() {
+  ::ps::PbRange* _msg = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:ps.Node.key)
+  return _msg;
+}
+inline void Node::set_allocated_key(::ps::PbRange* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key));
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:ps.Node.key)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::Node_Role> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::Node_Role>() {
+  return ::ps::Node_Role_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fnode_2eproto
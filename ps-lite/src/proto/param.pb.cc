@@ -0,0 +1,1627 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/param.proto
+
+#include "proto/param.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR ParamCall::ParamCall(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.backup_)*/{}
+  , /*decltype(_impl_.tail_filter_)*/nullptr
+  , /*decltype(_impl_.dyn_val_size_)*/false
+  , /*decltype(_impl_.replica_)*/false
+  , /*decltype(_impl_.push_)*/true
+  , /*decltype(_impl_.hot_key_)*/1} {}
+struct ParamCallDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamCallDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamCallDefaultTypeInternal() {}
+  union {
+    ParamCall _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamCallDefaultTypeInternal _ParamCall_default_instance_;
+PROTOBUF_CONSTEXPR ParamInitConfig::ParamInitConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.type_)*/1
+  , /*decltype(_impl_.constant_)*/1
+  , /*decltype(_impl_.std_)*/1} {}
+struct ParamInitConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamInitConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamInitConfigDefaultTypeInternal() {}
+  union {
+    ParamInitConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamInitConfigDefaultTypeInternal _ParamInitConfig_default_instance_;
+PROTOBUF_CONSTEXPR Timestamp::Timestamp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_)*/0} {}
+struct TimestampDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimestampDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimestampDefaultTypeInternal() {}
+  union {
+    Timestamp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimestampDefaultTypeInternal _Timestamp_default_instance_;
+PROTOBUF_CONSTEXPR TailKeyIFilter::TailKeyIFilter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.freq_threshold_)*/0
+  , /*decltype(_impl_.insert_count_)*/false
+  , /*decltype(_impl_.query_value_)*/false
+  , /*decltype(_impl_.countmin_n_)*/1000000
+  , /*decltype(_impl_.countmin_k_)*/2} {}
+struct TailKeyIFilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TailKeyIFilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TailKeyIFilterDefaultTypeInternal() {}
+  union {
+    TailKeyIFilter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TailKeyIFilterDefaultTypeInternal _TailKeyIFilter_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2fparam_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2fparam_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fparam_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fparam_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.push_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.dyn_val_size_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.tail_filter_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.replica_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.backup_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamCall, _impl_.hot_key_),
+  3,
+  1,
+  0,
+  2,
+  ~0u,
+  4,
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_.constant_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_.std_),
+  PROTOBUF_FIELD_OFFSET(::ps::ParamInitConfig, _impl_.file_name_),
+  2,
+  3,
+  1,
+  4,
+  0,
+  PROTOBUF_FIELD_OFFSET(::ps::Timestamp, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::Timestamp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::Timestamp, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::ps::Timestamp, _impl_.time_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_.insert_count_),
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_.freq_threshold_),
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_.query_value_),
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_.countmin_n_),
+  PROTOBUF_FIELD_OFFSET(::ps::TailKeyIFilter, _impl_.countmin_k_),
+  1,
+  0,
+  2,
+  3,
+  4,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::ps::ParamCall)},
+  { 18, 29, -1, sizeof(::ps::ParamInitConfig)},
+  { 34, 42, -1, sizeof(::ps::Timestamp)},
+  { 44, 55, -1, sizeof(::ps::TailKeyIFilter)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_ParamCall_default_instance_._instance,
+  &::ps::_ParamInitConfig_default_instance_._instance,
+  &::ps::_Timestamp_default_instance_._instance,
+  &::ps::_TailKeyIFilter_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fparam_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021proto/param.proto\022\002ps\"\214\002\n\tParamCall\022\022\n"
+  "\004push\030\001 \001(\010:\004true\022\033\n\014dyn_val_size\030\004 \001(\010:"
+  "\005false\022\'\n\013tail_filter\030\003 \001(\0132\022.ps.TailKey"
+  "IFilter\022\017\n\007replica\030\n \001(\010\022\035\n\006backup\030\013 \003(\013"
+  "2\r.ps.Timestamp\022)\n\007hot_key\030\014 \001(\0162\030.ps.Pa"
+  "ramCall.HotKeyCall\"J\n\nHotKeyCall\022\017\n\013HOT_"
+  "ENTRIES\020\001\022\016\n\nHOT_PUSHES\020\002\022\r\n\tHOT_PULLS\020\003"
+  "\022\014\n\010HOT_KEYS\020\004\"\313\001\n\017ParamInitConfig\022,\n\004ty"
+  "pe\030\001 \001(\0162\030.ps.ParamInitConfig.Type:\004ZERO"
+  "\022\023\n\010constant\030\002 \001(\001:\0011\022\017\n\004mean\030\003 \001(\001:\0010\022\016"
+  "\n\003std\030\004 \001(\001:\0011\022\021\n\tfile_name\030\005 \001(\t\"A\n\004Typ"
+  "e\022\010\n\004ZERO\020\001\022\014\n\010CONSTANT\020\002\022\014\n\010GAUSSIAN\020\003\022"
+  "\010\n\004FILE\020\004\022\t\n\005CLONE\020\005\")\n\tTimestamp\022\016\n\006sen"
+  "der\030\001 \002(\t\022\014\n\004time\030\002 \002(\005\"\207\001\n\016TailKeyIFilt"
+  "er\022\024\n\014insert_count\030\001 \001(\010\022\026\n\016freq_thresho"
+  "ld\030\002 \001(\005\022\023\n\013query_value\030\003 \001(\010\022\033\n\ncountmi"
+  "n_n\030\004 \001(\005:\0071000000\022\025\n\ncountmin_k\030\005 \001(\005:\001"
+  "2"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fparam_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fparam_2eproto = {
+    false, false, 681, descriptor_table_protodef_proto_2fparam_2eproto,
+    "proto/param.proto",
+    &descriptor_table_proto_2fparam_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_proto_2fparam_2eproto::offsets,
+    file_level_metadata_proto_2fparam_2eproto, file_level_enum_descriptors_proto_2fparam_2eproto,
+    file_level_service_descriptors_proto_2fparam_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fparam_2eproto_getter() {
+  return &descriptor_table_proto_2fparam_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fparam_2eproto(&descriptor_table_proto_2fparam_2eproto);
+namespace ps {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamCall_HotKeyCall_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fparam_2eproto);
+  return file_level_enum_descriptors_proto_2fparam_2eproto[0];
+}
+bool ParamCall_HotKeyCall_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ParamCall_HotKeyCall ParamCall::HOT_ENTRIES;
+constexpr ParamCall_HotKeyCall ParamCall::HOT_PUSHES;
+constexpr ParamCall_HotKeyCall ParamCall::HOT_PULLS;
+constexpr ParamCall_HotKeyCall ParamCall::HOT_KEYS;
+constexpr ParamCall_HotKeyCall ParamCall::HotKeyCall_MIN;
+constexpr ParamCall_HotKeyCall ParamCall::HotKeyCall_MAX;
+constexpr int ParamCall::HotKeyCall_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamInitConfig_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fparam_2eproto);
+  return file_level_enum_descriptors_proto_2fparam_2eproto[1];
+}
+bool ParamInitConfig_Type_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ParamInitConfig_Type ParamInitConfig::ZERO;
+constexpr ParamInitConfig_Type ParamInitConfig::CONSTANT;
+constexpr ParamInitConfig_Type ParamInitConfig::GAUSSIAN;
+constexpr ParamInitConfig_Type ParamInitConfig::FILE;
+constexpr ParamInitConfig_Type ParamInitConfig::CLONE;
+constexpr ParamInitConfig_Type ParamInitConfig::Type_MIN;
+constexpr ParamInitConfig_Type ParamInitConfig::Type_MAX;
+constexpr int ParamInitConfig::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class ParamCall::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ParamCall>()._impl_._has_bits_);
+  static void set_has_push(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_dyn_val_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::ps::TailKeyIFilter& tail_filter(const ParamCall* msg);
+  static void set_has_tail_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replica(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_hot_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::ps::TailKeyIFilter&
+ParamCall::_Internal::tail_filter(const ParamCall* msg) {
+  return *msg->_impl_.tail_filter_;
+}
+ParamCall::ParamCall(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.ParamCall)
+}
+ParamCall::ParamCall(const ParamCall& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParamCall* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.backup_){from._impl_.backup_}
+    , decltype(_impl_.tail_filter_){nullptr}
+    , decltype(_impl_.dyn_val_size_){}
+    , decltype(_impl_.replica_){}
+    , decltype(_impl_.push_){}
+    , decltype(_impl_.hot_key_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_tail_filter()) {
+    _this->_impl_.tail_filter_ = new ::ps::TailKeyIFilter(*from._impl_.tail_filter_);
+  }
+  ::memcpy(&_impl_.dyn_val_size_, &from._impl_.dyn_val_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hot_key_) -
+    reinterpret_cast<char*>(&_impl_.dyn_val_size_)) + sizeof(_impl_.hot_key_));
+  // @@protoc_insertion_point(copy_constructor:ps.ParamCall)
+}
+
+inline void ParamCall::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.backup_){arena}
+    , decltype(_impl_.tail_filter_){nullptr}
+    , decltype(_impl_.dyn_val_size_){false}
+    , decltype(_impl_.replica_){false}
+    , decltype(_impl_.push_){true}
+    , decltype(_impl_.hot_key_){1}
+  };
+}
+
+ParamCall::~ParamCall() {
+  // @@protoc_insertion_point(destructor:ps.ParamCall)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParamCall::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.backup_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.tail_filter_;
+}
+
+void ParamCall::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParamCall::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.ParamCall)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.backup_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.tail_filter_ != nullptr);
+    _impl_.tail_filter_->Clear();
+  }
+  ::memset(&_impl_.dyn_val_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_) -
+      reinterpret_cast<char*>(&_impl_.dyn_val_size_)) + sizeof(_impl_.replica_));
+  if (cached_has_bits & 0x00000018u) {
+    _impl_.push_ = true;
+    _impl_.hot_key_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParamCall::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool push = 1 [default = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_push(&has_bits);
+          _impl_.push_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.TailKeyIFilter tail_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tail_filter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool dyn_val_size = 4 [default = false];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_dyn_val_size(&has_bits);
+          _impl_.dyn_val_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool replica = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_replica(&has_bits);
+          _impl_.replica_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ps.Timestamp backup = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_backup(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.ParamCall.HotKeyCall hot_key = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::ParamCall_HotKeyCall_IsValid(val))) {
+            _internal_set_hot_key(static_cast<::ps::ParamCall_HotKeyCall>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(12, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParamCall::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.ParamCall)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool push = 1 [default = true];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_push(), target);
+  }
+
+  // optional .ps.TailKeyIFilter tail_filter = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::tail_filter(this),
+        _Internal::tail_filter(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool dyn_val_size = 4 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_dyn_val_size(), target);
+  }
+
+  // optional bool replica = 10;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_replica(), target);
+  }
+
+  // repeated .ps.Timestamp backup = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_backup_size()); i < n; i++) {
+    const auto& repfield = this->_internal_backup(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .ps.ParamCall.HotKeyCall hot_key = 12;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      12, this->_internal_hot_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.ParamCall)
+  return target;
+}
+
+size_t ParamCall::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.ParamCall)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ps.Timestamp backup = 11;
+  total_size += 1UL * this->_internal_backup_size();
+  for (const auto& msg : this->_impl_.backup_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .ps.TailKeyIFilter tail_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.tail_filter_);
+    }
+
+    // optional bool dyn_val_size = 4 [default = false];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool replica = 10;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool push = 1 [default = true];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .ps.ParamCall.HotKeyCall hot_key = 12;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_hot_key());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParamCall::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParamCall::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParamCall::GetClassData() const { return &_class_data_; }
+
+
+void ParamCall::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParamCall*>(&to_msg);
+  auto& from = static_cast<const ParamCall&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.ParamCall)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.backup_.MergeFrom(from._impl_.backup_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_tail_filter()->::ps::TailKeyIFilter::MergeFrom(
+          from._internal_tail_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.dyn_val_size_ = from._impl_.dyn_val_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.replica_ = from._impl_.replica_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.push_ = from._impl_.push_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.hot_key_ = from._impl_.hot_key_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParamCall::CopyFrom(const ParamCall& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.ParamCall)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParamCall::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.backup_))
+    return false;
+  return true;
+}
+
+void ParamCall::InternalSwap(ParamCall* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.backup_.InternalSwap(&other->_impl_.backup_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ParamCall, _impl_.replica_)
+      + sizeof(ParamCall::_impl_.replica_)
+      - PROTOBUF_FIELD_OFFSET(ParamCall, _impl_.tail_filter_)>(
+          reinterpret_cast<char*>(&_impl_.tail_filter_),
+          reinterpret_cast<char*>(&other->_impl_.tail_filter_));
+  swap(_impl_.push_, other->_impl_.push_);
+  swap(_impl_.hot_key_, other->_impl_.hot_key_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParamCall::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fparam_2eproto_getter, &descriptor_table_proto_2fparam_2eproto_once,
+      file_level_metadata_proto_2fparam_2eproto[0]);
+}
+
+// ===================================================================
+
+class ParamInitConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ParamInitConfig>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_constant(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_mean(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_std(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_file_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ParamInitConfig::ParamInitConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.ParamInitConfig)
+}
+ParamInitConfig::ParamInitConfig(const ParamInitConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParamInitConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.constant_){}
+    , decltype(_impl_.std_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_name()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.mean_, &from._impl_.mean_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.std_) -
+    reinterpret_cast<char*>(&_impl_.mean_)) + sizeof(_impl_.std_));
+  // @@protoc_insertion_point(copy_constructor:ps.ParamInitConfig)
+}
+
+inline void ParamInitConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.type_){1}
+    , decltype(_impl_.constant_){1}
+    , decltype(_impl_.std_){1}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ParamInitConfig::~ParamInitConfig() {
+  // @@protoc_insertion_point(destructor:ps.ParamInitConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParamInitConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+}
+
+void ParamInitConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParamInitConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.ParamInitConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.file_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    _impl_.mean_ = 0;
+    _impl_.type_ = 1;
+    _impl_.constant_ = 1;
+    _impl_.std_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParamInitConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .ps.ParamInitConfig.Type type = 1 [default = ZERO];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::ParamInitConfig_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::ps::ParamInitConfig_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double constant = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_constant(&has_bits);
+          _impl_.constant_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double mean = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_mean(&has_bits);
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double std = 4 [default = 1];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_std(&has_bits);
+          _impl_.std_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file_name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.ParamInitConfig.file_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParamInitConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.ParamInitConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .ps.ParamInitConfig.Type type = 1 [default = ZERO];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional double constant = 2 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_constant(), target);
+  }
+
+  // optional double mean = 3 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_mean(), target);
+  }
+
+  // optional double std = 4 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_std(), target);
+  }
+
+  // optional string file_name = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.ParamInitConfig.file_name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_file_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.ParamInitConfig)
+  return target;
+}
+
+size_t ParamInitConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.ParamInitConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string file_name = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_file_name());
+    }
+
+    // optional double mean = 3 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional .ps.ParamInitConfig.Type type = 1 [default = ZERO];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+    // optional double constant = 2 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double std = 4 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParamInitConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParamInitConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParamInitConfig::GetClassData() const { return &_class_data_; }
+
+
+void ParamInitConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParamInitConfig*>(&to_msg);
+  auto& from = static_cast<const ParamInitConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.ParamInitConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_file_name(from._internal_file_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.mean_ = from._impl_.mean_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.constant_ = from._impl_.constant_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.std_ = from._impl_.std_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParamInitConfig::CopyFrom(const ParamInitConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.ParamInitConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParamInitConfig::IsInitialized() const {
+  return true;
+}
+
+void ParamInitConfig::InternalSwap(ParamInitConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  swap(_impl_.mean_, other->_impl_.mean_);
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.constant_, other->_impl_.constant_);
+  swap(_impl_.std_, other->_impl_.std_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParamInitConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fparam_2eproto_getter, &descriptor_table_proto_2fparam_2eproto_once,
+      file_level_metadata_proto_2fparam_2eproto[1]);
+}
+
+// ===================================================================
+
+class Timestamp::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Timestamp>()._impl_._has_bits_);
+  static void set_has_sender(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Timestamp::Timestamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.Timestamp)
+}
+Timestamp::Timestamp(const Timestamp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Timestamp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_sender()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.time_ = from._impl_.time_;
+  // @@protoc_insertion_point(copy_constructor:ps.Timestamp)
+}
+
+inline void Timestamp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.time_){0}
+  };
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Timestamp::~Timestamp() {
+  // @@protoc_insertion_point(destructor:ps.Timestamp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Timestamp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sender_.Destroy();
+}
+
+void Timestamp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Timestamp::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.Timestamp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.sender_.ClearNonDefaultToEmpty();
+  }
+  _impl_.time_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Timestamp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string sender = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ps.Timestamp.sender");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Timestamp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.Timestamp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string sender = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ps.Timestamp.sender");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_sender(), target);
+  }
+
+  // required int32 time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.Timestamp)
+  return target;
+}
+
+size_t Timestamp::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ps.Timestamp)
+  size_t total_size = 0;
+
+  if (_internal_has_sender()) {
+    // required string sender = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+  }
+
+  if (_internal_has_time()) {
+    // required int32 time = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_time());
+  }
+
+  return total_size;
+}
+size_t Timestamp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.Timestamp)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string sender = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+
+    // required int32 time = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_time());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Timestamp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Timestamp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Timestamp::GetClassData() const { return &_class_data_; }
+
+
+void Timestamp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Timestamp*>(&to_msg);
+  auto& from = static_cast<const Timestamp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.Timestamp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_sender(from._internal_sender());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Timestamp::CopyFrom(const Timestamp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.Timestamp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Timestamp::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Timestamp::InternalSwap(Timestamp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  swap(_impl_.time_, other->_impl_.time_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Timestamp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fparam_2eproto_getter, &descriptor_table_proto_2fparam_2eproto_once,
+      file_level_metadata_proto_2fparam_2eproto[2]);
+}
+
+// ===================================================================
+
+class TailKeyIFilter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TailKeyIFilter>()._impl_._has_bits_);
+  static void set_has_insert_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_freq_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_query_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_countmin_n(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_countmin_k(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+TailKeyIFilter::TailKeyIFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.TailKeyIFilter)
+}
+TailKeyIFilter::TailKeyIFilter(const TailKeyIFilter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TailKeyIFilter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.freq_threshold_){}
+    , decltype(_impl_.insert_count_){}
+    , decltype(_impl_.query_value_){}
+    , decltype(_impl_.countmin_n_){}
+    , decltype(_impl_.countmin_k_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.freq_threshold_, &from._impl_.freq_threshold_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.countmin_k_) -
+    reinterpret_cast<char*>(&_impl_.freq_threshold_)) + sizeof(_impl_.countmin_k_));
+  // @@protoc_insertion_point(copy_constructor:ps.TailKeyIFilter)
+}
+
+inline void TailKeyIFilter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.freq_threshold_){0}
+    , decltype(_impl_.insert_count_){false}
+    , decltype(_impl_.query_value_){false}
+    , decltype(_impl_.countmin_n_){1000000}
+    , decltype(_impl_.countmin_k_){2}
+  };
+}
+
+TailKeyIFilter::~TailKeyIFilter() {
+  // @@protoc_insertion_point(destructor:ps.TailKeyIFilter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TailKeyIFilter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TailKeyIFilter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TailKeyIFilter::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.TailKeyIFilter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.freq_threshold_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.query_value_) -
+        reinterpret_cast<char*>(&_impl_.freq_threshold_)) + sizeof(_impl_.query_value_));
+    _impl_.countmin_n_ = 1000000;
+    _impl_.countmin_k_ = 2;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TailKeyIFilter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool insert_count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_insert_count(&has_bits);
+          _impl_.insert_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 freq_threshold = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_freq_threshold(&has_bits);
+          _impl_.freq_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool query_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_query_value(&has_bits);
+          _impl_.query_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 countmin_n = 4 [default = 1000000];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_countmin_n(&has_bits);
+          _impl_.countmin_n_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 countmin_k = 5 [default = 2];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_countmin_k(&has_bits);
+          _impl_.countmin_k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TailKeyIFilter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.TailKeyIFilter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool insert_count = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_insert_count(), target);
+  }
+
+  // optional int32 freq_threshold = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_freq_threshold(), target);
+  }
+
+  // optional bool query_value = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_query_value(), target);
+  }
+
+  // optional int32 countmin_n = 4 [default = 1000000];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_countmin_n(), target);
+  }
+
+  // optional int32 countmin_k = 5 [default = 2];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_countmin_k(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.TailKeyIFilter)
+  return target;
+}
+
+size_t TailKeyIFilter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.TailKeyIFilter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional int32 freq_threshold = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_freq_threshold());
+    }
+
+    // optional bool insert_count = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool query_value = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 countmin_n = 4 [default = 1000000];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_countmin_n());
+    }
+
+    // optional int32 countmin_k = 5 [default = 2];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_countmin_k());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TailKeyIFilter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TailKeyIFilter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TailKeyIFilter::GetClassData() const { return &_class_data_; }
+
+
+void TailKeyIFilter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TailKeyIFilter*>(&to_msg);
+  auto& from = static_cast<const TailKeyIFilter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.TailKeyIFilter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.freq_threshold_ = from._impl_.freq_threshold_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.insert_count_ = from._impl_.insert_count_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.query_value_ = from._impl_.query_value_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.countmin_n_ = from._impl_.countmin_n_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.countmin_k_ = from._impl_.countmin_k_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TailKeyIFilter::CopyFrom(const TailKeyIFilter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.TailKeyIFilter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TailKeyIFilter::IsInitialized() const {
+  return true;
+}
+
+void TailKeyIFilter::InternalSwap(TailKeyIFilter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TailKeyIFilter, _impl_.query_value_)
+      + sizeof(TailKeyIFilter::_impl_.query_value_)
+      - PROTOBUF_FIELD_OFFSET(TailKeyIFilter, _impl_.freq_threshold_)>(
+          reinterpret_cast<char*>(&_impl_.freq_threshold_),
+          reinterpret_cast<char*>(&other->_impl_.freq_threshold_));
+  swap(_impl_.countmin_n_, other->_impl_.countmin_n_);
+  swap(_impl_.countmin_k_, other->_impl_.countmin_k_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TailKeyIFilter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fparam_2eproto_getter, &descriptor_table_proto_2fparam_2eproto_once,
+      file_level_metadata_proto_2fparam_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::ParamCall*
+Arena::CreateMaybeMessage< ::ps::ParamCall >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::ParamCall >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::ParamInitConfig*
+Arena::CreateMaybeMessage< ::ps::ParamInitConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::ParamInitConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::Timestamp*
+Arena::CreateMaybeMessage< ::ps::Timestamp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::Timestamp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::TailKeyIFilter*
+Arena::CreateMaybeMessage< ::ps::TailKeyIFilter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::TailKeyIFilter >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
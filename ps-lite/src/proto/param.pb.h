@@ -0,0 +1,1779 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/param.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fparam_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fparam_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fparam_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fparam_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fparam_2eproto;
+namespace ps {
+class ParamCall;
+struct ParamCallDefaultTypeInternal;
+extern ParamCallDefaultTypeInternal _ParamCall_default_instance_;
+class ParamInitConfig;
+struct ParamInitConfigDefaultTypeInternal;
+extern ParamInitConfigDefaultTypeInternal _ParamInitConfig_default_instance_;
+class TailKeyIFilter;
+struct TailKeyIFilterDefaultTypeInternal;
+extern TailKeyIFilterDefaultTypeInternal _TailKeyIFilter_default_instance_;
+class Timestamp;
+struct TimestampDefaultTypeInternal;
+extern TimestampDefaultTypeInternal _Timestamp_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::ParamCall* Arena::CreateMaybeMessage<::ps::ParamCall>(Arena*);
+template<> ::ps::ParamInitConfig* Arena::CreateMaybeMessage<::ps::ParamInitConfig>(Arena*);
+template<> ::ps::TailKeyIFilter* Arena::CreateMaybeMessage<::ps::TailKeyIFilter>(Arena*);
+template<> ::ps::Timestamp* Arena::CreateMaybeMessage<::ps::Timestamp>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum ParamCall_HotKeyCall : int {
+  ParamCall_HotKeyCall_HOT_ENTRIES = 1,
+  ParamCall_HotKeyCall_HOT_PUSHES = 2,
+  ParamCall_HotKeyCall_HOT_PULLS = 3,
+  ParamCall_HotKeyCall_HOT_KEYS = 4
+};
+bool ParamCall_HotKeyCall_IsValid(int value);
+constexpr ParamCall_HotKeyCall ParamCall_HotKeyCall_HotKeyCall_MIN = ParamCall_HotKeyCall_HOT_ENTRIES;
+constexpr ParamCall_HotKeyCall ParamCall_HotKeyCall_HotKeyCall_MAX = ParamCall_HotKeyCall_HOT_KEYS;
+constexpr int ParamCall_HotKeyCall_HotKeyCall_ARRAYSIZE = ParamCall_HotKeyCall_HotKeyCall_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamCall_HotKeyCall_descriptor();
+template<typename T>
+inline const std::string& ParamCall_HotKeyCall_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ParamCall_HotKeyCall>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ParamCall_HotKeyCall_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ParamCall_HotKeyCall_descriptor(), enum_t_value);
+}
+inline bool ParamCall_HotKeyCall_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ParamCall_HotKeyCall* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ParamCall_HotKeyCall>(
+    ParamCall_HotKeyCall_descriptor(), name, value);
+}
+enum ParamInitConfig_Type : int {
+  ParamInitConfig_Type_ZERO = 1,
+  ParamInitConfig_Type_CONSTANT = 2,
+  ParamInitConfig_Type_GAUSSIAN = 3,
+  ParamInitConfig_Type_FILE = 4,
+  ParamInitConfig_Type_CLONE = 5
+};
+bool ParamInitConfig_Type_IsValid(int value);
+constexpr ParamInitConfig_Type ParamInitConfig_Type_Type_MIN = ParamInitConfig_Type_ZERO;
+constexpr ParamInitConfig_Type ParamInitConfig_Type_Type_MAX = ParamInitConfig_Type_CLONE;
+constexpr int ParamInitConfig_Type_Type_ARRAYSIZE = ParamInitConfig_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamInitConfig_Type_descriptor();
+template<typename T>
+inline const std::string& ParamInitConfig_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ParamInitConfig_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ParamInitConfig_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ParamInitConfig_Type_descriptor(), enum_t_value);
+}
+inline bool ParamInitConfig_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ParamInitConfig_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ParamInitConfig_Type>(
+    ParamInitConfig_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class ParamCall final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.ParamCall) */ {
+ public:
+  inline ParamCall() : ParamCall(nullptr) {}
+  ~ParamCall() override;
+  explicit PROTOBUF_CONSTEXPR ParamCall(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ParamCall(const ParamCall& from);
+  ParamCall(ParamCall&& from) noexcept
+    : ParamCall() {
+    *this = ::std::move(from);
+  }
+
+  inline ParamCall& operator=(const ParamCall& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ParamCall& operator=(ParamCall&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ParamCall& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ParamCall* internal_default_instance() {
+    return reinterpret_cast<const ParamCall*>(
+               &_ParamCall_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ParamCall& a, ParamCall& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ParamCall* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ParamCall* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ParamCall* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParamCall>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ParamCall& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ParamCall& from) {
+    ParamCall::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ParamCall* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.ParamCall";
+  }
+  protected:
+  explicit ParamCall(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ParamCall_HotKeyCall HotKeyCall;
+  static constexpr HotKeyCall HOT_ENTRIES =
+    ParamCall_HotKeyCall_HOT_ENTRIES;
+  static constexpr HotKeyCall HOT_PUSHES =
+    ParamCall_HotKeyCall_HOT_PUSHES;
+  static constexpr HotKeyCall HOT_PULLS =
+    ParamCall_HotKeyCall_HOT_PULLS;
+  static constexpr HotKeyCall HOT_KEYS =
+    ParamCall_HotKeyCall_HOT_KEYS;
+  static inline bool HotKeyCall_IsValid(int value) {
+    return ParamCall_HotKeyCall_IsValid(value);
+  }
+  static constexpr HotKeyCall HotKeyCall_MIN =
+    ParamCall_HotKeyCall_HotKeyCall_MIN;
+  static constexpr HotKeyCall HotKeyCall_MAX =
+    ParamCall_HotKeyCall_HotKeyCall_MAX;
+  static constexpr int HotKeyCall_ARRAYSIZE =
+    ParamCall_HotKeyCall_HotKeyCall_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  HotKeyCall_descriptor() {
+    return ParamCall_HotKeyCall_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& HotKeyCall_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, HotKeyCall>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function HotKeyCall_Name.");
+    return ParamCall_HotKeyCall_Name(enum_t_value);
+  }
+  static inline bool HotKeyCall_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      HotKeyCall* value) {
+    return ParamCall_HotKeyCall_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBackupFieldNumber = 11,
+    kTailFilterFieldNumber = 3,
+    kDynValSizeFieldNumber = 4,
+    kReplicaFieldNumber = 10,
+    kPushFieldNumber = 1,
+    kHotKeyFieldNumber = 12,
+  };
+  // repeated .ps.Timestamp backup = 11;
+  int backup_size() const;
+  private:
+  int _internal_backup_size() const;
+  public:
+  void clear_backup();
+  ::ps::Timestamp* mutable_backup(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Timestamp >*
+      mutable_backup();
+  private:
+  const ::ps::Timestamp& _internal_backup(int index) const;
+  ::ps::Timestamp* _internal_add_backup();
+  public:
+  const ::ps::Timestamp& backup(int index) const;
+  ::ps::Timestamp* add_backup();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Timestamp >&
+      backup() const;
+
+  // optional .ps.TailKeyIFilter tail_filter = 3;
+  bool has_tail_filter() const;
+  private:
+  bool _internal_has_tail_filter() const;
+  public:
+  void clear_tail_filter();
+  const ::ps::TailKeyIFilter& tail_filter() const;
+  PROTOBUF_NODISCARD ::ps::TailKeyIFilter* release_tail_filter();
+  ::ps::TailKeyIFilter* mutable_tail_filter();
+  void set_allocated_tail_filter(::ps::TailKeyIFilter* tail_filter);
+  private:
+  const ::ps::TailKeyIFilter& _internal_tail_filter() const;
+  ::ps::TailKeyIFilter* _internal_mutable_tail_filter();
+  public:
+  void unsafe_arena_set_allocated_tail_filter(
+      ::ps::TailKeyIFilter* tail_filter);
+  ::ps::TailKeyIFilter* unsafe_arena_release_tail_filter();
+
+  // optional bool dyn_val_size = 4 [default = false];
+  bool has_dyn_val_size() const;
+  private:
+  bool _internal_has_dyn_val_size() const;
+  public:
+  void clear_dyn_val_size();
+  bool dyn_val_size() const;
+  void set_dyn_val_size(bool value);
+  private:
+  bool _internal_dyn_val_size() const;
+  void _internal_set_dyn_val_size(bool value);
+  public:
+
+  // optional bool replica = 10;
+  bool has_replica() const;
+  private:
+  bool _internal_has_replica() const;
+  public:
+  void clear_replica();
+  bool replica() const;
+  void set_replica(bool value);
+  private:
+  bool _internal_replica() const;
+  void _internal_set_replica(bool value);
+  public:
+
+  // optional bool push = 1 [default = true];
+  bool has_push() const;
+  private:
+  bool _internal_has_push() const;
+  public:
+  void clear_push();
+  bool push() const;
+  void set_push(bool value);
+  private:
+  bool _internal_push() const;
+  void _internal_set_push(bool value);
+  public:
+
+  // optional .ps.ParamCall.HotKeyCall hot_key = 12;
+  bool has_hot_key() const;
+  private:
+  bool _internal_has_hot_key() const;
+  public:
+  void clear_hot_key();
+  ::ps::ParamCall_HotKeyCall hot_key() const;
+  void set_hot_key(::ps::ParamCall_HotKeyCall value);
+  private:
+  ::ps::ParamCall_HotKeyCall _internal_hot_key() const;
+  void _internal_set_hot_key(::ps::ParamCall_HotKeyCall value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.ParamCall)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Timestamp > backup_;
+    ::ps::TailKeyIFilter* tail_filter_;
+    bool dyn_val_size_;
+    bool replica_;
+    bool push_;
+    int hot_key_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fparam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ParamInitConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.ParamInitConfig) */ {
+ public:
+  inline ParamInitConfig() : ParamInitConfig(nullptr) {}
+  ~ParamInitConfig() override;
+  explicit PROTOBUF_CONSTEXPR ParamInitConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ParamInitConfig(const ParamInitConfig& from);
+  ParamInitConfig(ParamInitConfig&& from) noexcept
+    : ParamInitConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline ParamInitConfig& operator=(const ParamInitConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ParamInitConfig& operator=(ParamInitConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ParamInitConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ParamInitConfig* internal_default_instance() {
+    return reinterpret_cast<const ParamInitConfig*>(
+               &_ParamInitConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ParamInitConfig& a, ParamInitConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ParamInitConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ParamInitConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ParamInitConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParamInitConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ParamInitConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ParamInitConfig& from) {
+    ParamInitConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ParamInitConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.ParamInitConfig";
+  }
+  protected:
+  explicit ParamInitConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ParamInitConfig_Type Type;
+  static constexpr Type ZERO =
+    ParamInitConfig_Type_ZERO;
+  static constexpr Type CONSTANT =
+    ParamInitConfig_Type_CONSTANT;
+  static constexpr Type GAUSSIAN =
+    ParamInitConfig_Type_GAUSSIAN;
+  static constexpr Type FILE =
+    ParamInitConfig_Type_FILE;
+  static constexpr Type CLONE =
+    ParamInitConfig_Type_CLONE;
+  static inline bool Type_IsValid(int value) {
+    return ParamInitConfig_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ParamInitConfig_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ParamInitConfig_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ParamInitConfig_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ParamInitConfig_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ParamInitConfig_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ParamInitConfig_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 5,
+    kMeanFieldNumber = 3,
+    kTypeFieldNumber = 1,
+    kConstantFieldNumber = 2,
+    kStdFieldNumber = 4,
+  };
+  // optional string file_name = 5;
+  bool has_file_name() const;
+  private:
+  bool _internal_has_file_name() const;
+  public:
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // optional double mean = 3 [default = 0];
+  bool has_mean() const;
+  private:
+  bool _internal_has_mean() const;
+  public:
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // optional .ps.ParamInitConfig.Type type = 1 [default = ZERO];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::ps::ParamInitConfig_Type type() const;
+  void set_type(::ps::ParamInitConfig_Type value);
+  private:
+  ::ps::ParamInitConfig_Type _internal_type() const;
+  void _internal_set_type(::ps::ParamInitConfig_Type value);
+  public:
+
+  // optional double constant = 2 [default = 1];
+  bool has_constant() const;
+  private:
+  bool _internal_has_constant() const;
+  public:
+  void clear_constant();
+  double constant() const;
+  void set_constant(double value);
+  private:
+  double _internal_constant() const;
+  void _internal_set_constant(double value);
+  public:
+
+  // optional double std = 4 [default = 1];
+  bool has_std() const;
+  private:
+  bool _internal_has_std() const;
+  public:
+  void clear_std();
+  double std() const;
+  void set_std(double value);
+  private:
+  double _internal_std() const;
+  void _internal_set_std(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.ParamInitConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    double mean_;
+    int type_;
+    double constant_;
+    double std_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fparam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Timestamp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Timestamp) */ {
+ public:
+  inline Timestamp() : Timestamp(nullptr) {}
+  ~Timestamp() override;
+  explicit PROTOBUF_CONSTEXPR Timestamp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Timestamp(const Timestamp& from);
+  Timestamp(Timestamp&& from) noexcept
+    : Timestamp() {
+    *this = ::std::move(from);
+  }
+
+  inline Timestamp& operator=(const Timestamp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Timestamp& operator=(Timestamp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Timestamp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Timestamp* internal_default_instance() {
+    return reinterpret_cast<const Timestamp*>(
+               &_Timestamp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Timestamp& a, Timestamp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Timestamp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Timestamp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Timestamp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Timestamp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Timestamp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Timestamp& from) {
+    Timestamp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Timestamp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Timestamp";
+  }
+  protected:
+  explicit Timestamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSenderFieldNumber = 1,
+    kTimeFieldNumber = 2,
+  };
+  // required string sender = 1;
+  bool has_sender() const;
+  private:
+  bool _internal_has_sender() const;
+  public:
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // required int32 time = 2;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  int32_t time() const;
+  void set_time(int32_t value);
+  private:
+  int32_t _internal_time() const;
+  void _internal_set_time(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.Timestamp)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    int32_t time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fparam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TailKeyIFilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.TailKeyIFilter) */ {
+ public:
+  inline TailKeyIFilter() : TailKeyIFilter(nullptr) {}
+  ~TailKeyIFilter() override;
+  explicit PROTOBUF_CONSTEXPR TailKeyIFilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TailKeyIFilter(const TailKeyIFilter& from);
+  TailKeyIFilter(TailKeyIFilter&& from) noexcept
+    : TailKeyIFilter() {
+    *this = ::std::move(from);
+  }
+
+  inline TailKeyIFilter& operator=(const TailKeyIFilter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TailKeyIFilter& operator=(TailKeyIFilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TailKeyIFilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TailKeyIFilter* internal_default_instance() {
+    return reinterpret_cast<const TailKeyIFilter*>(
+               &_TailKeyIFilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TailKeyIFilter& a, TailKeyIFilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TailKeyIFilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TailKeyIFilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TailKeyIFilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TailKeyIFilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TailKeyIFilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TailKeyIFilter& from) {
+    TailKeyIFilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TailKeyIFilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.TailKeyIFilter";
+  }
+  protected:
+  explicit TailKeyIFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFreqThresholdFieldNumber = 2,
+    kInsertCountFieldNumber = 1,
+    kQueryValueFieldNumber = 3,
+    kCountminNFieldNumber = 4,
+    kCountminKFieldNumber = 5,
+  };
+  // optional int32 freq_threshold = 2;
+  bool has_freq_threshold() const;
+  private:
+  bool _internal_has_freq_threshold() const;
+  public:
+  void clear_freq_threshold();
+  int32_t freq_threshold() const;
+  void set_freq_threshold(int32_t value);
+  private:
+  int32_t _internal_freq_threshold() const;
+  void _internal_set_freq_threshold(int32_t value);
+  public:
+
+  // optional bool insert_count = 1;
+  bool has_insert_count() const;
+  private:
+  bool _internal_has_insert_count() const;
+  public:
+  void clear_insert_count();
+  bool insert_count() const;
+  void set_insert_count(bool value);
+  private:
+  bool _internal_insert_count() const;
+  void _internal_set_insert_count(bool value);
+  public:
+
+  // optional bool query_value = 3;
+  bool has_query_value() const;
+  private:
+  bool _internal_has_query_value() const;
+  public:
+  void clear_query_value();
+  bool query_value() const;
+  void set_query_value(bool value);
+  private:
+  bool _internal_query_value() const;
+  void _internal_set_query_value(bool value);
+  public:
+
+  // optional int32 countmin_n = 4 [default = 1000000];
+  bool has_countmin_n() const;
+  private:
+  bool _internal_has_countmin_n() const;
+  public:
+  void clear_countmin_n();
+  int32_t countmin_n() const;
+  void set_countmin_n(int32_t value);
+  private:
+  int32_t _internal_countmin_n() const;
+  void _internal_set_countmin_n(int32_t value);
+  public:
+
+  // optional int32 countmin_k = 5 [default = 2];
+  bool has_countmin_k() const;
+  private:
+  bool _internal_has_countmin_k() const;
+  public:
+  void clear_countmin_k();
+  int32_t countmin_k() const;
+  void set_countmin_k(int32_t value);
+  private:
+  int32_t _internal_countmin_k() const;
+  void _internal_set_countmin_k(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.TailKeyIFilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t freq_threshold_;
+    bool insert_count_;
+    bool query_value_;
+    int32_t countmin_n_;
+    int32_t countmin_k_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fparam_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ParamCall
+
+// optional bool push = 1 [default = true];
+inline bool ParamCall::_internal_has_push() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ParamCall::has_push() const {
+  return _internal_has_push();
+}
+inline void ParamCall::clear_push() {
+  _impl_.push_ = true;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ParamCall::_internal_push() const {
+  return _impl_.push_;
+}
+inline bool ParamCall::push() const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.push)
+  return _internal_push();
+}
+inline void ParamCall::_internal_set_push(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.push_ = value;
+}
+inline void ParamCall::set_push(bool value) {
+  _internal_set_push(value);
+  // @@protoc_insertion_point(field_set:ps.ParamCall.push)
+}
+
+// optional bool dyn_val_size = 4 [default = false];
+inline bool ParamCall::_internal_has_dyn_val_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ParamCall::has_dyn_val_size() const {
+  return _internal_has_dyn_val_size();
+}
+inline void ParamCall::clear_dyn_val_size() {
+  _impl_.dyn_val_size_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool ParamCall::_internal_dyn_val_size() const {
+  return _impl_.dyn_val_size_;
+}
+inline bool ParamCall::dyn_val_size() const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.dyn_val_size)
+  return _internal_dyn_val_size();
+}
+inline void ParamCall::_internal_set_dyn_val_size(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.dyn_val_size_ = value;
+}
+inline void ParamCall::set_dyn_val_size(bool value) {
+  _internal_set_dyn_val_size(value);
+  // @@protoc_insertion_point(field_set:ps.ParamCall.dyn_val_size)
+}
+
+// optional .ps.TailKeyIFilter tail_filter = 3;
+inline bool ParamCall::_internal_has_tail_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.tail_filter_ != nullptr);
+  return value;
+}
+inline bool ParamCall::has_tail_filter() const {
+  return _internal_has_tail_filter();
+}
+inline void ParamCall::clear_tail_filter() {
+  if (_impl_.tail_filter_ != nullptr) _impl_.tail_filter_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ps::TailKeyIFilter& ParamCall::_internal_tail_filter() const {
+  const ::ps::TailKeyIFilter* p = _impl_.tail_filter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::TailKeyIFilter&>(
+      ::ps::_TailKeyIFilter_default_instance_);
+}
+inline const ::ps::TailKeyIFilter& ParamCall::tail_filter() const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.tail_filter)
+  return _internal_tail_filter();
+}
+inline void ParamCall::unsafe_arena_set_allocated_tail_filter(
+    ::ps::TailKeyIFilter* tail_filter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tail_filter_);
+  }
+  _impl_.tail_filter_ = tail_filter;
+  if (tail_filter) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.ParamCall.tail_filter)
+}
+inline ::ps::TailKeyIFilter* ParamCall::release_tail_filter() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ps::TailKeyIFilter* temp = _impl_.tail_filter_;
+  _impl_.tail_filter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::TailKeyIFilter* ParamCall::unsafe_arena_release_tail_filter() {
+  // @@protoc_insertion_point(field_release:ps.ParamCall.tail_filter)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ps::TailKeyIFilter* temp = _impl_.tail_filter_;
+  _impl_.tail_filter_ = nullptr;
+  return temp;
+}
+inline ::ps::TailKeyIFilter* ParamCall::_internal_mutable_tail_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.tail_filter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::TailKeyIFilter>(GetArenaForAllocation());
+    _impl_.tail_filter_ = p;
+  }
+  return _impl_.tail_filter_;
+}
+inline ::ps::TailKeyIFilter* ParamCall::mutable_tail_filter() {
+  ::ps::TailKeyIFilter* _msg = _internal_mutable_tail_filter();
+  // @@protoc_insertion_point(field_mutable:ps.ParamCall.tail_filter)
+  return _msg;
+}
+inline void ParamCall::set_allocated_tail_filter(::ps::TailKeyIFilter* tail_filter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tail_filter_;
+  }
+  if (tail_filter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tail_filter);
+    if (message_arena != submessage_arena) {
+      tail_filter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tail_filter, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.tail_filter_ = tail_filter;
+  // @@protoc_insertion_point(field_set_allocated:ps.ParamCall.tail_filter)
+}
+
+// optional bool replica = 10;
+inline bool ParamCall::_internal_has_replica() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ParamCall::has_replica() const {
+  return _internal_has_replica();
+}
+inline void ParamCall::clear_replica() {
+  _impl_.replica_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ParamCall::_internal_replica() const {
+  return _impl_.replica_;
+}
+inline bool ParamCall::replica() const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.replica)
+  return _internal_replica();
+}
+inline void ParamCall::_internal_set_replica(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.replica_ = value;
+}
+inline void ParamCall::set_replica(bool value) {
+  _internal_set_replica(value);
+  // @@protoc_insertion_point(field_set:ps.ParamCall.replica)
+}
+
+// repeated .ps.Timestamp backup = 11;
+inline int ParamCall::_internal_backup_size() const {
+  return _impl_.backup_.size();
+}
+inline int ParamCall::backup_size() const {
+  return _internal_backup_size();
+}
+inline void ParamCall::clear_backup() {
+  _impl_.backup_.Clear();
+}
+inline ::ps::Timestamp* ParamCall::mutable_backup(int index) {
+  // @@protoc_insertion_point(field_mutable:ps.ParamCall.backup)
+  return _impl_.backup_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Timestamp >*
+ParamCall::mutable_backup() {
+  // @@protoc_insertion_point(field_mutable_list:ps.ParamCall.backup)
+  return &_impl_.backup_;
+}
+inline const ::ps::Timestamp& ParamCall::_internal_backup(int index) const {
+  return _impl_.backup_.Get(index);
+}
+inline const ::ps::Timestamp& ParamCall::backup(int index) const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.backup)
+  return _internal_backup(index);
+}
+inline ::ps::Timestamp* ParamCall::_internal_add_backup() {
+  return _impl_.backup_.Add();
+}
+inline ::ps::Timestamp* ParamCall::add_backup() {
+  ::ps::Timestamp* _add = _internal_add_backup();
+  // @@protoc_insertion_point(field_add:ps.ParamCall.backup)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Timestamp >&
+ParamCall::backup() const {
+  // @@protoc_insertion_point(field_list:ps.ParamCall.backup)
+  return _impl_.backup_;
+}
+
+// optional .ps.ParamCall.HotKeyCall hot_key = 12;
+inline bool ParamCall::_internal_has_hot_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ParamCall::has_hot_key() const {
+  return _internal_has_hot_key();
+}
+inline void ParamCall::clear_hot_key() {
+  _impl_.hot_key_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::ps::ParamCall_HotKeyCall ParamCall::_internal_hot_key() const {
+  return static_cast< ::ps::ParamCall_HotKeyCall >(_impl_.hot_key_);
+}
+inline ::ps::ParamCall_HotKeyCall ParamCall::hot_key() const {
+  // @@protoc_insertion_point(field_get:ps.ParamCall.hot_key)
+  return _internal_hot_key();
+}
+inline void ParamCall::_internal_set_hot_key(::ps::ParamCall_HotKeyCall value) {
+  assert(::ps::ParamCall_HotKeyCall_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.hot_key_ = value;
+}
+inline void ParamCall::set_hot_key(::ps::ParamCall_HotKeyCall value) {
+  _internal_set_hot_key(value);
+  // @@protoc_insertion_point(field_set:ps.ParamCall.hot_key)
+}
+
+// -------------------------------------------------------------------
+
+// ParamInitConfig
+
+// optional .ps.ParamInitConfig.Type type = 1 [default = ZERO];
+inline bool ParamInitConfig::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ParamInitConfig::has_type() const {
+  return _internal_has_type();
+}
+inline void ParamInitConfig::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::ps::ParamInitConfig_Type ParamInitConfig::_internal_type() const {
+  return static_cast< ::ps::ParamInitConfig_Type >(_impl_.type_);
+}
+inline ::ps::ParamInitConfig_Type ParamInitConfig::type() const {
+  // @@protoc_insertion_point(field_get:ps.ParamInitConfig.type)
+  return _internal_type();
+}
+inline void ParamInitConfig::_internal_set_type(::ps::ParamInitConfig_Type value) {
+  assert(::ps::ParamInitConfig_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void ParamInitConfig::set_type(::ps::ParamInitConfig_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ps.ParamInitConfig.type)
+}
+
+// optional double constant = 2 [default = 1];
+inline bool ParamInitConfig::_internal_has_constant() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ParamInitConfig::has_constant() const {
+  return _internal_has_constant();
+}
+inline void ParamInitConfig::clear_constant() {
+  _impl_.constant_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double ParamInitConfig::_internal_constant() const {
+  return _impl_.constant_;
+}
+inline double ParamInitConfig::constant() const {
+  // @@protoc_insertion_point(field_get:ps.ParamInitConfig.constant)
+  return _internal_constant();
+}
+inline void ParamInitConfig::_internal_set_constant(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.constant_ = value;
+}
+inline void ParamInitConfig::set_constant(double value) {
+  _internal_set_constant(value);
+  // @@protoc_insertion_point(field_set:ps.ParamInitConfig.constant)
+}
+
+// optional double mean = 3 [default = 0];
+inline bool ParamInitConfig::_internal_has_mean() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ParamInitConfig::has_mean() const {
+  return _internal_has_mean();
+}
+inline void ParamInitConfig::clear_mean() {
+  _impl_.mean_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double ParamInitConfig::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double ParamInitConfig::mean() const {
+  // @@protoc_insertion_point(field_get:ps.ParamInitConfig.mean)
+  return _internal_mean();
+}
+inline void ParamInitConfig::_internal_set_mean(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mean_ = value;
+}
+inline void ParamInitConfig::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:ps.ParamInitConfig.mean)
+}
+
+// optional double std = 4 [default = 1];
+inline bool ParamInitConfig::_internal_has_std() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ParamInitConfig::has_std() const {
+  return _internal_has_std();
+}
+inline void ParamInitConfig::clear_std() {
+  _impl_.std_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double ParamInitConfig::_internal_std() const {
+  return _impl_.std_;
+}
+inline double ParamInitConfig::std() const {
+  // @@protoc_insertion_point(field_get:ps.ParamInitConfig.std)
+  return _internal_std();
+}
+inline void ParamInitConfig::_internal_set_std(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.std_ = value;
+}
+inline void ParamInitConfig::set_std(double value) {
+  _internal_set_std(value);
+  // @@protoc_insertion_point(field_set:ps.ParamInitConfig.std)
+}
+
+// optional string file_name = 5;
+inline bool ParamInitConfig::_internal_has_file_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ParamInitConfig::has_file_name() const {
+  return _internal_has_file_name();
+}
+inline void ParamInitConfig::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ParamInitConfig::file_name() const {
+  // @@protoc_insertion_point(field_get:ps.ParamInitConfig.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ParamInitConfig::set_file_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.ParamInitConfig.file_name)
+}
+inline std::string* ParamInitConfig::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:ps.ParamInitConfig.file_name)
+  return _s;
+}
+inline const std::string& ParamInitConfig::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void ParamInitConfig::_internal_set_file_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ParamInitConfig::_internal_mutable_file_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ParamInitConfig::release_file_name() {
+  // @@protoc_insertion_point(field_release:ps.ParamInitConfig.file_name)
+  if (!_internal_has_file_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.file_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ParamInitConfig::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.ParamInitConfig.file_name)
+}
+
+// -------------------------------------------------------------------
+
+// Timestamp
+
+// required string sender = 1;
+inline bool Timestamp::_internal_has_sender() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Timestamp::has_sender() const {
+  return _internal_has_sender();
+}
+inline void Timestamp::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Timestamp::sender() const {
+  // @@protoc_insertion_point(field_get:ps.Timestamp.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Timestamp::set_sender(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.Timestamp.sender)
+}
+inline std::string* Timestamp::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:ps.Timestamp.sender)
+  return _s;
+}
+inline const std::string& Timestamp::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void Timestamp::_internal_set_sender(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Timestamp::_internal_mutable_sender() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Timestamp::release_sender() {
+  // @@protoc_insertion_point(field_release:ps.Timestamp.sender)
+  if (!_internal_has_sender()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.sender_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Timestamp::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.Timestamp.sender)
+}
+
+// required int32 time = 2;
+inline bool Timestamp::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Timestamp::has_time() const {
+  return _internal_has_time();
+}
+inline void Timestamp::clear_time() {
+  _impl_.time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Timestamp::_internal_time() const {
+  return _impl_.time_;
+}
+inline int32_t Timestamp::time() const {
+  // @@protoc_insertion_point(field_get:ps.Timestamp.time)
+  return _internal_time();
+}
+inline void Timestamp::_internal_set_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.time_ = value;
+}
+inline void Timestamp::set_time(int32_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:ps.Timestamp.time)
+}
+
+// -------------------------------------------------------------------
+
+// TailKeyIFilter
+
+// optional bool insert_count = 1;
+inline bool TailKeyIFilter::_internal_has_insert_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TailKeyIFilter::has_insert_count() const {
+  return _internal_has_insert_count();
+}
+inline void TailKeyIFilter::clear_insert_count() {
+  _impl_.insert_count_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool TailKeyIFilter::_internal_insert_count() const {
+  return _impl_.insert_count_;
+}
+inline bool TailKeyIFilter::insert_count() const {
+  // @@protoc_insertion_point(field_get:ps.TailKeyIFilter.insert_count)
+  return _internal_insert_count();
+}
+inline void TailKeyIFilter::_internal_set_insert_count(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.insert_count_ = value;
+}
+inline void TailKeyIFilter::set_insert_count(bool value) {
+  _internal_set_insert_count(value);
+  // @@protoc_insertion_point(field_set:ps.TailKeyIFilter.insert_count)
+}
+
+// optional int32 freq_threshold = 2;
+inline bool TailKeyIFilter::_internal_has_freq_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TailKeyIFilter::has_freq_threshold() const {
+  return _internal_has_freq_threshold();
+}
+inline void TailKeyIFilter::clear_freq_threshold() {
+  _impl_.freq_threshold_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TailKeyIFilter::_internal_freq_threshold() const {
+  return _impl_.freq_threshold_;
+}
+inline int32_t TailKeyIFilter::freq_threshold() const {
+  // @@protoc_insertion_point(field_get:ps.TailKeyIFilter.freq_threshold)
+  return _internal_freq_threshold();
+}
+inline void TailKeyIFilter::_internal_set_freq_threshold(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.freq_threshold_ = value;
+}
+inline void TailKeyIFilter::set_freq_threshold(int32_t value) {
+  _internal_set_freq_threshold(value);
+  // @@protoc_insertion_point(field_set:ps.TailKeyIFilter.freq_threshold)
+}
+
+// optional bool query_value = 3;
+inline bool TailKeyIFilter::_internal_has_query_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TailKeyIFilter::has_query_value() const {
+  return _internal_has_query_value();
+}
+inline void TailKeyIFilter::clear_query_value() {
+  _impl_.query_value_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool TailKeyIFilter::_internal_query_value() const {
+  return _impl_.query_value_;
+}
+inline bool TailKeyIFilter::query_value() const {
+  // @@protoc_insertion_point(field_get:ps.TailKeyIFilter.query_value)
+  return _internal_query_value();
+}
+inline void TailKeyIFilter::_internal_set_query_value(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.query_value_ = value;
+}
+inline void TailKeyIFilter::set_query_value(bool value) {
+  _internal_set_query_value(value);
+  // @@protoc_insertion_point(field_set:ps.TailKeyIFilter.query_value)
+}
+
+// optional int32 countmin_n = 4 [default = 1000000];
+inline bool TailKeyIFilter::_internal_has_countmin_n() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TailKeyIFilter::has_countmin_n() const {
+  return _internal_has_countmin_n();
+}
+inline void TailKeyIFilter::clear_countmin_n() {
+  _impl_.countmin_n_ = 1000000;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t TailKeyIFilter::_internal_countmin_n() const {
+  return _impl_.countmin_n_;
+}
+inline int32_t TailKeyIFilter::countmin_n() const {
+  // @@protoc_insertion_point(field_get:ps.TailKeyIFilter.countmin_n)
+  return _internal_countmin_n();
+}
+inline void TailKeyIFilter::_internal_set_countmin_n(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.countmin_n_ = value;
+}
+inline void TailKeyIFilter::set_countmin_n(int32_t value) {
+  _internal_set_countmin_n(value);
+  // @@protoc_insertion_point(field_set:ps.TailKeyIFilter.countmin_n)
+}
+
+// optional int32 countmin_k = 5 [default = 2];
+inline bool TailKeyIFilter::_internal_has_countmin_k() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TailKeyIFilter::has_countmin_k() const {
+  return _internal_has_countmin_k();
+}
+inline void TailKeyIFilter::clear_countmin_k() {
+  _impl_.countmin_k_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t TailKeyIFilter::_internal_countmin_k() const {
+  return _impl_.countmin_k_;
+}
+inline int32_t TailKeyIFilter::countmin_k() const {
+  // @@protoc_insertion_point(field_get:ps.TailKeyIFilter.countmin_k)
+  return _internal_countmin_k();
+}
+inline void TailKeyIFilter::_internal_set_countmin_k(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.countmin_k_ = value;
+}
+inline void TailKeyIFilter::set_countmin_k(int32_t value) {
+  _internal_set_countmin_k(value);
+  // @@protoc_insertion_point(field_set:ps.TailKeyIFilter.countmin_k)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::ParamCall_HotKeyCall> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::ParamCall_HotKeyCall>() {
+  return ::ps::ParamCall_HotKeyCall_descriptor();
+}
+template <> struct is_proto_enum< ::ps::ParamInitConfig_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::ParamInitConfig_Type>() {
+  return ::ps::ParamInitConfig_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fparam_2eproto
@@ -0,0 +1,349 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/range.proto
+
+#include "proto/range.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR PbRange::PbRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/uint64_t{0u}} {}
+struct PbRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PbRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PbRangeDefaultTypeInternal() {}
+  union {
+    PbRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PbRangeDefaultTypeInternal _PbRange_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2frange_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2frange_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2frange_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2frange_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::PbRange, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::PbRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::PbRange, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::ps::PbRange, _impl_.end_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::ps::PbRange)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_PbRange_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2frange_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021proto/range.proto\022\002ps\"%\n\007PbRange\022\r\n\005be"
+  "gin\030\001 \002(\004\022\013\n\003end\030\002 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2frange_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2frange_2eproto = {
+    false, false, 62, descriptor_table_protodef_proto_2frange_2eproto,
+    "proto/range.proto",
+    &descriptor_table_proto_2frange_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_proto_2frange_2eproto::offsets,
+    file_level_metadata_proto_2frange_2eproto, file_level_enum_descriptors_proto_2frange_2eproto,
+    file_level_service_descriptors_proto_2frange_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2frange_2eproto_getter() {
+  return &descriptor_table_proto_2frange_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2frange_2eproto(&descriptor_table_proto_2frange_2eproto);
+namespace ps {
+
+// ===================================================================
+
+class PbRange::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PbRange>()._impl_._has_bits_);
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+PbRange::PbRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.PbRange)
+}
+PbRange::PbRange(const PbRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PbRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.begin_, &from._impl_.begin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:ps.PbRange)
+}
+
+inline void PbRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.begin_){uint64_t{0u}}
+    , decltype(_impl_.end_){uint64_t{0u}}
+  };
+}
+
+PbRange::~PbRange() {
+  // @@protoc_insertion_point(destructor:ps.PbRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PbRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PbRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PbRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.PbRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.begin_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PbRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 begin = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_begin(&has_bits);
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PbRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.PbRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 begin = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_begin(), target);
+  }
+
+  // required uint64 end = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.PbRange)
+  return target;
+}
+
+size_t PbRange::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ps.PbRange)
+  size_t total_size = 0;
+
+  if (_internal_has_begin()) {
+    // required uint64 begin = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+  }
+
+  if (_internal_has_end()) {
+    // required uint64 end = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+  }
+
+  return total_size;
+}
+size_t PbRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.PbRange)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 begin = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_begin());
+
+    // required uint64 end = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PbRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PbRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PbRange::GetClassData() const { return &_class_data_; }
+
+
+void PbRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PbRange*>(&to_msg);
+  auto& from = static_cast<const PbRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.PbRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.begin_ = from._impl_.begin_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PbRange::CopyFrom(const PbRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.PbRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PbRange::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PbRange::InternalSwap(PbRange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PbRange, _impl_.end_)
+      + sizeof(PbRange::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(PbRange, _impl_.begin_)>(
+          reinterpret_cast<char*>(&_impl_.begin_),
+          reinterpret_cast<char*>(&other->_impl_.begin_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PbRange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2frange_2eproto_getter, &descriptor_table_proto_2frange_2eproto_once,
+      file_level_metadata_proto_2frange_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::PbRange*
+Arena::CreateMaybeMessage< ::ps::PbRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::PbRange >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1297 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/task.proto
+
+#include "proto/task.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ps {
+PROTOBUF_CONSTEXPR Task::Task(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._extensions_)*/{}
+  , /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.wait_time_)*/{}
+  , /*decltype(_impl_.filter_)*/{}
+  , /*decltype(_impl_.value_type_)*/{}
+  , /*decltype(_impl_._value_type_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_range_)*/nullptr
+  , /*decltype(_impl_.ctrl_)*/nullptr
+  , /*decltype(_impl_.param_)*/nullptr
+  , /*decltype(_impl_.customer_id_)*/0
+  , /*decltype(_impl_.control_)*/false
+  , /*decltype(_impl_.request_)*/false
+  , /*decltype(_impl_.has_key_)*/false
+  , /*decltype(_impl_.time_)*/0
+  , /*decltype(_impl_.key_channel_)*/0
+  , /*decltype(_impl_.key_type_)*/0
+  , /*decltype(_impl_.cmd_)*/0
+  , /*decltype(_impl_.op_)*/0} {}
+struct TaskDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TaskDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TaskDefaultTypeInternal() {}
+  union {
+    Task _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TaskDefaultTypeInternal _Task_default_instance_;
+PROTOBUF_CONSTEXPR Control::Control(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.node_)*/{}
+  , /*decltype(_impl_.cmd_)*/2} {}
+struct ControlDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControlDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControlDefaultTypeInternal() {}
+  union {
+    Control _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlDefaultTypeInternal _Control_default_instance_;
+}  // namespace ps
+static ::_pb::Metadata file_level_metadata_proto_2ftask_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2ftask_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2ftask_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2ftask_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_._extensions_),
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.cmd_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.control_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.customer_id_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.wait_time_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.key_range_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.key_channel_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.has_key_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.key_type_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.value_type_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.filter_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.ctrl_),
+  PROTOBUF_FIELD_OFFSET(::ps::Task, _impl_.param_),
+  0,
+  11,
+  12,
+  5,
+  6,
+  4,
+  8,
+  ~0u,
+  1,
+  9,
+  7,
+  10,
+  ~0u,
+  ~0u,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::ps::Control, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ps::Control, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ps::Control, _impl_.cmd_),
+  PROTOBUF_FIELD_OFFSET(::ps::Control, _impl_.node_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 22, -1, sizeof(::ps::Task)},
+  { 38, 46, -1, sizeof(::ps::Control)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ps::_Task_default_instance_._instance,
+  &::ps::_Control_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2ftask_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020proto/task.proto\022\002ps\032\021proto/range.prot"
+  "o\032\020proto/data.proto\032\020proto/node.proto\032\021p"
+  "roto/param.proto\032\022proto/filter.proto\032\025pr"
+  "oto/assign_op.proto\"\216\003\n\004Task\022\013\n\003msg\030\021 \001("
+  "\014\022\016\n\003cmd\030\023 \001(\005:\0010\022\024\n\002op\030\025 \001(\0162\010.ps.AsOp\022"
+  "\026\n\007control\030\001 \001(\010:\005false\022\026\n\007request\030\002 \001(\010"
+  ":\005false\022\023\n\013customer_id\030\003 \001(\005\022\014\n\004time\030\005 \001"
+  "(\005\022\021\n\twait_time\030\006 \003(\005\022\036\n\tkey_range\030\007 \001(\013"
+  "2\013.ps.PbRange\022\023\n\013key_channel\030\010 \001(\005\022\026\n\007ha"
+  "s_key\030\t \001(\010:\005false\022\036\n\010key_type\030\r \001(\0162\014.p"
+  "s.DataType\022$\n\nvalue_type\030\016 \003(\0162\014.ps.Data"
+  "TypeB\002\020\001\022\032\n\006filter\030\014 \003(\0132\n.ps.Filter\022\031\n\004"
+  "ctrl\030\022 \001(\0132\013.ps.Control\022\034\n\005param\030\024 \001(\0132\r"
+  ".ps.ParamCall*\005\010d\020\310\001\"\257\001\n\007Control\022 \n\003cmd\030"
+  "\001 \002(\0162\023.ps.Control.Command\022\026\n\004node\030\002 \003(\013"
+  "2\010.ps.Node\"j\n\007Command\022\021\n\rREGISTER_NODE\020\002"
+  "\022\021\n\rREADY_TO_EXIT\020\004\022\020\n\014READY_TO_RUN\020\005\022\014\n"
+  "\010ADD_NODE\020\n\022\017\n\013REMOVE_NODE\020\r\022\010\n\004EXIT\020\016*\220"
+  "\001\n\010DataType\022\t\n\005OTHER\020\000\022\010\n\004INT8\020\001\022\t\n\005INT1"
+  "6\020\002\022\t\n\005INT32\020\003\022\t\n\005INT64\020\004\022\t\n\005UINT8\020\005\022\n\n\006"
+  "UINT16\020\006\022\n\n\006UINT32\020\007\022\n\n\006UINT64\020\010\022\t\n\005FLOA"
+  "T\020\t\022\n\n\006DOUBLE\020\n\022\010\n\004CHAR\020\013"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2ftask_2eproto_deps[6] = {
+  &::descriptor_table_proto_2fassign_5fop_2eproto,
+  &::descriptor_table_proto_2fdata_2eproto,
+  &::descriptor_table_proto_2ffilter_2eproto,
+  &::descriptor_table_proto_2fnode_2eproto,
+  &::descriptor_table_proto_2fparam_2eproto,
+  &::descriptor_table_proto_2frange_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2ftask_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2ftask_2eproto = {
+    false, false, 865, descriptor_table_protodef_proto_2ftask_2eproto,
+    "proto/task.proto",
+    &descriptor_table_proto_2ftask_2eproto_once, descriptor_table_proto_2ftask_2eproto_deps, 6, 2,
+    schemas, file_default_instances, TableStruct_proto_2ftask_2eproto::offsets,
+    file_level_metadata_proto_2ftask_2eproto, file_level_enum_descriptors_proto_2ftask_2eproto,
+    file_level_service_descriptors_proto_2ftask_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2ftask_2eproto_getter() {
+  return &descriptor_table_proto_2ftask_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2ftask_2eproto(&descriptor_table_proto_2ftask_2eproto);
+namespace ps {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Control_Command_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2ftask_2eproto);
+  return file_level_enum_descriptors_proto_2ftask_2eproto[0];
+}
+bool Control_Command_IsValid(int value) {
+  switch (value) {
+    case 2:
+    case 4:
+    case 5:
+    case 10:
+    case 13:
+    case 14:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Control_Command Control::REGISTER_NODE;
+constexpr Control_Command Control::READY_TO_EXIT;
+constexpr Control_Command Control::READY_TO_RUN;
+constexpr Control_Command Control::ADD_NODE;
+constexpr Control_Command Control::REMOVE_NODE;
+constexpr Control_Command Control::EXIT;
+constexpr Control_Command Control::Command_MIN;
+constexpr Control_Command Control::Command_MAX;
+constexpr int Control::Command_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2ftask_2eproto);
+  return file_level_enum_descriptors_proto_2ftask_2eproto[1];
+}
+bool DataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Task::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Task>()._impl_._has_bits_);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_cmd(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_op(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_control(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_customer_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::ps::PbRange& key_range(const Task* msg);
+  static void set_has_key_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_key_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_key_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::ps::Control& ctrl(const Task* msg);
+  static void set_has_ctrl(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::ps::ParamCall& param(const Task* msg);
+  static void set_has_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::ps::PbRange&
+Task::_Internal::key_range(const Task* msg) {
+  return *msg->_impl_.key_range_;
+}
+const ::ps::Control&
+Task::_Internal::ctrl(const Task* msg) {
+  return *msg->_impl_.ctrl_;
+}
+const ::ps::ParamCall&
+Task::_Internal::param(const Task* msg) {
+  return *msg->_impl_.param_;
+}
+void Task::clear_key_range() {
+  if (_impl_.key_range_ != nullptr) _impl_.key_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+void Task::clear_filter() {
+  _impl_.filter_.Clear();
+}
+void Task::clear_param() {
+  if (_impl_.param_ != nullptr) _impl_.param_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+Task::Task(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.Task)
+}
+Task::Task(const Task& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Task* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{}
+    , decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.wait_time_){from._impl_.wait_time_}
+    , decltype(_impl_.filter_){from._impl_.filter_}
+    , decltype(_impl_.value_type_){from._impl_.value_type_}
+    , /*decltype(_impl_._value_type_cached_byte_size_)*/{0}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.key_range_){nullptr}
+    , decltype(_impl_.ctrl_){nullptr}
+    , decltype(_impl_.param_){nullptr}
+    , decltype(_impl_.customer_id_){}
+    , decltype(_impl_.control_){}
+    , decltype(_impl_.request_){}
+    , decltype(_impl_.has_key_){}
+    , decltype(_impl_.time_){}
+    , decltype(_impl_.key_channel_){}
+    , decltype(_impl_.key_type_){}
+    , decltype(_impl_.cmd_){}
+    , decltype(_impl_.op_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_key_range()) {
+    _this->_impl_.key_range_ = new ::ps::PbRange(*from._impl_.key_range_);
+  }
+  if (from._internal_has_ctrl()) {
+    _this->_impl_.ctrl_ = new ::ps::Control(*from._impl_.ctrl_);
+  }
+  if (from._internal_has_param()) {
+    _this->_impl_.param_ = new ::ps::ParamCall(*from._impl_.param_);
+  }
+  ::memcpy(&_impl_.customer_id_, &from._impl_.customer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.op_) -
+    reinterpret_cast<char*>(&_impl_.customer_id_)) + sizeof(_impl_.op_));
+  // @@protoc_insertion_point(copy_constructor:ps.Task)
+}
+
+inline void Task::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.wait_time_){arena}
+    , decltype(_impl_.filter_){arena}
+    , decltype(_impl_.value_type_){arena}
+    , /*decltype(_impl_._value_type_cached_byte_size_)*/{0}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.key_range_){nullptr}
+    , decltype(_impl_.ctrl_){nullptr}
+    , decltype(_impl_.param_){nullptr}
+    , decltype(_impl_.customer_id_){0}
+    , decltype(_impl_.control_){false}
+    , decltype(_impl_.request_){false}
+    , decltype(_impl_.has_key_){false}
+    , decltype(_impl_.time_){0}
+    , decltype(_impl_.key_channel_){0}
+    , decltype(_impl_.key_type_){0}
+    , decltype(_impl_.cmd_){0}
+    , decltype(_impl_.op_){0}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Task::~Task() {
+  // @@protoc_insertion_point(destructor:ps.Task)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Task::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_._extensions_.~ExtensionSet();
+  _impl_.wait_time_.~RepeatedField();
+  _impl_.filter_.~RepeatedPtrField();
+  _impl_.value_type_.~RepeatedField();
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.key_range_;
+  if (this != internal_default_instance()) delete _impl_.ctrl_;
+  if (this != internal_default_instance()) delete _impl_.param_;
+}
+
+void Task::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Task::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.Task)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.wait_time_.Clear();
+  _impl_.filter_.Clear();
+  _impl_.value_type_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.key_range_ != nullptr);
+      _impl_.key_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.ctrl_ != nullptr);
+      _impl_.ctrl_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.param_ != nullptr);
+      _impl_.param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.customer_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.has_key_) -
+        reinterpret_cast<char*>(&_impl_.customer_id_)) + sizeof(_impl_.has_key_));
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    ::memset(&_impl_.time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.op_) -
+        reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.op_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Task::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool control = 1 [default = false];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_control(&has_bits);
+          _impl_.control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool request = 2 [default = false];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_request(&has_bits);
+          _impl_.request_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 customer_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_customer_id(&has_bits);
+          _impl_.customer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 time = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 wait_time = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_wait_time(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_wait_time(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.PbRange key_range = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 key_channel = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_key_channel(&has_bits);
+          _impl_.key_channel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool has_key = 9 [default = false];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_has_key(&has_bits);
+          _impl_.has_key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ps.Filter filter = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_filter(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.DataType key_type = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::DataType_IsValid(val))) {
+            _internal_set_key_type(static_cast<::ps::DataType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(13, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ps.DataType value_type = 14 [packed = true];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_value_type(), ptr, ctx, ::ps::DataType_IsValid, &_internal_metadata_, 14);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 112) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::DataType_IsValid(val))) {
+            _internal_add_value_type(static_cast<::ps::DataType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(14, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes msg = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.Control ctrl = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ctrl(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 cmd = 19 [default = 0];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_cmd(&has_bits);
+          _impl_.cmd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.ParamCall param = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ps.AsOp op = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::AsOp_IsValid(val))) {
+            _internal_set_op(static_cast<::ps::AsOp>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(21, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    if ((800u <= tag && tag < 1600u)) {
+      ptr = _impl_._extensions_.ParseField(tag, ptr, internal_default_instance(), &_internal_metadata_, ctx);
+      CHK_(ptr != nullptr);
+      continue;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Task::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.Task)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool control = 1 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_control(), target);
+  }
+
+  // optional bool request = 2 [default = false];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_request(), target);
+  }
+
+  // optional int32 customer_id = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_customer_id(), target);
+  }
+
+  // optional int32 time = 5;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_time(), target);
+  }
+
+  // repeated int32 wait_time = 6;
+  for (int i = 0, n = this->_internal_wait_time_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_wait_time(i), target);
+  }
+
+  // optional .ps.PbRange key_range = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::key_range(this),
+        _Internal::key_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 key_channel = 8;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_key_channel(), target);
+  }
+
+  // optional bool has_key = 9 [default = false];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_has_key(), target);
+  }
+
+  // repeated .ps.Filter filter = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_filter_size()); i < n; i++) {
+    const auto& repfield = this->_internal_filter(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .ps.DataType key_type = 13;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      13, this->_internal_key_type(), target);
+  }
+
+  // repeated .ps.DataType value_type = 14 [packed = true];
+  {
+    int byte_size = _impl_._value_type_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          14, _impl_.value_type_, byte_size, target);
+    }
+  }
+
+  // optional bytes msg = 17;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        17, this->_internal_msg(), target);
+  }
+
+  // optional .ps.Control ctrl = 18;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::ctrl(this),
+        _Internal::ctrl(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 cmd = 19 [default = 0];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_cmd(), target);
+  }
+
+  // optional .ps.ParamCall param = 20;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::param(this),
+        _Internal::param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .ps.AsOp op = 21;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      21, this->_internal_op(), target);
+  }
+
+  // Extension range [100, 200)
+  target = _impl_._extensions_._InternalSerialize(
+  internal_default_instance(), 100, 200, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.Task)
+  return target;
+}
+
+size_t Task::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.Task)
+  size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 wait_time = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.wait_time_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_wait_time_size());
+    total_size += data_size;
+  }
+
+  // repeated .ps.Filter filter = 12;
+  total_size += 1UL * this->_internal_filter_size();
+  for (const auto& msg : this->_impl_.filter_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .ps.DataType value_type = 14 [packed = true];
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_value_type_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_value_type(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._value_type_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes msg = 17;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_msg());
+    }
+
+    // optional .ps.PbRange key_range = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.key_range_);
+    }
+
+    // optional .ps.Control ctrl = 18;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ctrl_);
+    }
+
+    // optional .ps.ParamCall param = 20;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.param_);
+    }
+
+    // optional int32 customer_id = 3;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_customer_id());
+    }
+
+    // optional bool control = 1 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool request = 2 [default = false];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool has_key = 9 [default = false];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    // optional int32 time = 5;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_time());
+    }
+
+    // optional int32 key_channel = 8;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_key_channel());
+    }
+
+    // optional .ps.DataType key_type = 13;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_key_type());
+    }
+
+    // optional int32 cmd = 19 [default = 0];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_cmd());
+    }
+
+    // optional .ps.AsOp op = 21;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_op());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Task::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Task::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Task::GetClassData() const { return &_class_data_; }
+
+
+void Task::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Task*>(&to_msg);
+  auto& from = static_cast<const Task&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.Task)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.wait_time_.MergeFrom(from._impl_.wait_time_);
+  _this->_impl_.filter_.MergeFrom(from._impl_.filter_);
+  _this->_impl_.value_type_.MergeFrom(from._impl_.value_type_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_msg(from._internal_msg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_key_range()->::ps::PbRange::MergeFrom(
+          from._internal_key_range());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_ctrl()->::ps::Control::MergeFrom(
+          from._internal_ctrl());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_param()->::ps::ParamCall::MergeFrom(
+          from._internal_param());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.customer_id_ = from._impl_.customer_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.control_ = from._impl_.control_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.request_ = from._impl_.request_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.has_key_ = from._impl_.has_key_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.key_channel_ = from._impl_.key_channel_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.key_type_ = from._impl_.key_type_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.cmd_ = from._impl_.cmd_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.op_ = from._impl_.op_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Task::CopyFrom(const Task& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.Task)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Task::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized()) {
+    return false;
+  }
+
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.filter_))
+    return false;
+  if (_internal_has_key_range()) {
+    if (!_impl_.key_range_->IsInitialized()) return false;
+  }
+  if (_internal_has_ctrl()) {
+    if (!_impl_.ctrl_->IsInitialized()) return false;
+  }
+  if (_internal_has_param()) {
+    if (!_impl_.param_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Task::InternalSwap(Task* other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.wait_time_.InternalSwap(&other->_impl_.wait_time_);
+  _impl_.filter_.InternalSwap(&other->_impl_.filter_);
+  _impl_.value_type_.InternalSwap(&other->_impl_.value_type_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Task, _impl_.op_)
+      + sizeof(Task::_impl_.op_)
+      - PROTOBUF_FIELD_OFFSET(Task, _impl_.key_range_)>(
+          reinterpret_cast<char*>(&_impl_.key_range_),
+          reinterpret_cast<char*>(&other->_impl_.key_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Task::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2ftask_2eproto_getter, &descriptor_table_proto_2ftask_2eproto_once,
+      file_level_metadata_proto_2ftask_2eproto[0]);
+}
+
+// ===================================================================
+
+class Control::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Control>()._impl_._has_bits_);
+  static void set_has_cmd(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+void Control::clear_node() {
+  _impl_.node_.Clear();
+}
+Control::Control(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ps.Control)
+}
+Control::Control(const Control& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Control* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){from._impl_.node_}
+    , decltype(_impl_.cmd_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.cmd_ = from._impl_.cmd_;
+  // @@protoc_insertion_point(copy_constructor:ps.Control)
+}
+
+inline void Control::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){arena}
+    , decltype(_impl_.cmd_){2}
+  };
+}
+
+Control::~Control() {
+  // @@protoc_insertion_point(destructor:ps.Control)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Control::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_.~RepeatedPtrField();
+}
+
+void Control::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Control::Clear() {
+// @@protoc_insertion_point(message_clear_start:ps.Control)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_.Clear();
+  _impl_.cmd_ = 2;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Control::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .ps.Control.Command cmd = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ps::Control_Command_IsValid(val))) {
+            _internal_set_cmd(static_cast<::ps::Control_Command>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ps.Node node = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_node(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Control::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ps.Control)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .ps.Control.Command cmd = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_cmd(), target);
+  }
+
+  // repeated .ps.Node node = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_node_size()); i < n; i++) {
+    const auto& repfield = this->_internal_node(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ps.Control)
+  return target;
+}
+
+size_t Control::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ps.Control)
+  size_t total_size = 0;
+
+  // required .ps.Control.Command cmd = 1;
+  if (_internal_has_cmd()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_cmd());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ps.Node node = 2;
+  total_size += 1UL * this->_internal_node_size();
+  for (const auto& msg : this->_impl_.node_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Control::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Control::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Control::GetClassData() const { return &_class_data_; }
+
+
+void Control::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Control*>(&to_msg);
+  auto& from = static_cast<const Control&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ps.Control)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.node_.MergeFrom(from._impl_.node_);
+  if (from._internal_has_cmd()) {
+    _this->_internal_set_cmd(from._internal_cmd());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Control::CopyFrom(const Control& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ps.Control)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Control::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.node_))
+    return false;
+  return true;
+}
+
+void Control::InternalSwap(Control* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.node_.InternalSwap(&other->_impl_.node_);
+  swap(_impl_.cmd_, other->_impl_.cmd_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Control::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2ftask_2eproto_getter, &descriptor_table_proto_2ftask_2eproto_once,
+      file_level_metadata_proto_2ftask_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ps::Task*
+Arena::CreateMaybeMessage< ::ps::Task >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::Task >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ps::Control*
+Arena::CreateMaybeMessage< ::ps::Control >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ps::Control >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
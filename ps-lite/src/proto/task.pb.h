@@ -0,0 +1,1786 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/task.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2ftask_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2ftask_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "proto/range.pb.h"
+#include "proto/data.pb.h"
+#include "proto/node.pb.h"
+#include "proto/param.pb.h"
+#include "proto/filter.pb.h"
+#include "proto/assign_op.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2ftask_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2ftask_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2ftask_2eproto;
+namespace ps {
+class Control;
+struct ControlDefaultTypeInternal;
+extern ControlDefaultTypeInternal _Control_default_instance_;
+class Task;
+struct TaskDefaultTypeInternal;
+extern TaskDefaultTypeInternal _Task_default_instance_;
+}  // namespace ps
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ps::Control* Arena::CreateMaybeMessage<::ps::Control>(Arena*);
+template<> ::ps::Task* Arena::CreateMaybeMessage<::ps::Task>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ps {
+
+enum Control_Command : int {
+  Control_Command_REGISTER_NODE = 2,
+  Control_Command_READY_TO_EXIT = 4,
+  Control_Command_READY_TO_RUN = 5,
+  Control_Command_ADD_NODE = 10,
+  Control_Command_REMOVE_NODE = 13,
+  Control_Command_EXIT = 14
+};
+bool Control_Command_IsValid(int value);
+constexpr Control_Command Control_Command_Command_MIN = Control_Command_REGISTER_NODE;
+constexpr Control_Command Control_Command_Command_MAX = Control_Command_EXIT;
+constexpr int Control_Command_Command_ARRAYSIZE = Control_Command_Command_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Control_Command_descriptor();
+template<typename T>
+inline const std::string& Control_Command_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Control_Command>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Control_Command_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Control_Command_descriptor(), enum_t_value);
+}
+inline bool Control_Command_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Control_Command* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Control_Command>(
+    Control_Command_descriptor(), name, value);
+}
+enum DataType : int {
+  OTHER = 0,
+  INT8 = 1,
+  INT16 = 2,
+  INT32 = 3,
+  INT64 = 4,
+  UINT8 = 5,
+  UINT16 = 6,
+  UINT32 = 7,
+  UINT64 = 8,
+  FLOAT = 9,
+  DOUBLE = 10,
+  CHAR = 11
+};
+bool DataType_IsValid(int value);
+constexpr DataType DataType_MIN = OTHER;
+constexpr DataType DataType_MAX = CHAR;
+constexpr int DataType_ARRAYSIZE = DataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor();
+template<typename T>
+inline const std::string& DataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DataType_descriptor(), enum_t_value);
+}
+inline bool DataType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DataType>(
+    DataType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Task final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Task) */ {
+ public:
+  inline Task() : Task(nullptr) {}
+  ~Task() override;
+  explicit PROTOBUF_CONSTEXPR Task(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Task(const Task& from);
+  Task(Task&& from) noexcept
+    : Task() {
+    *this = ::std::move(from);
+  }
+
+  inline Task& operator=(const Task& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Task& operator=(Task&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Task& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Task* internal_default_instance() {
+    return reinterpret_cast<const Task*>(
+               &_Task_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Task& a, Task& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Task* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Task* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Task* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Task>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Task& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Task& from) {
+    Task::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Task* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Task";
+  }
+  protected:
+  explicit Task(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWaitTimeFieldNumber = 6,
+    kFilterFieldNumber = 12,
+    kValueTypeFieldNumber = 14,
+    kMsgFieldNumber = 17,
+    kKeyRangeFieldNumber = 7,
+    kCtrlFieldNumber = 18,
+    kParamFieldNumber = 20,
+    kCustomerIdFieldNumber = 3,
+    kControlFieldNumber = 1,
+    kRequestFieldNumber = 2,
+    kHasKeyFieldNumber = 9,
+    kTimeFieldNumber = 5,
+    kKeyChannelFieldNumber = 8,
+    kKeyTypeFieldNumber = 13,
+    kCmdFieldNumber = 19,
+    kOpFieldNumber = 21,
+  };
+  // repeated int32 wait_time = 6;
+  int wait_time_size() const;
+  private:
+  int _internal_wait_time_size() const;
+  public:
+  void clear_wait_time();
+  private:
+  int32_t _internal_wait_time(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_wait_time() const;
+  void _internal_add_wait_time(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_wait_time();
+  public:
+  int32_t wait_time(int index) const;
+  void set_wait_time(int index, int32_t value);
+  void add_wait_time(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      wait_time() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_wait_time();
+
+  // repeated .ps.Filter filter = 12;
+  int filter_size() const;
+  private:
+  int _internal_filter_size() const;
+  public:
+  void clear_filter();
+  ::ps::Filter* mutable_filter(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter >*
+      mutable_filter();
+  private:
+  const ::ps::Filter& _internal_filter(int index) const;
+  ::ps::Filter* _internal_add_filter();
+  public:
+  const ::ps::Filter& filter(int index) const;
+  ::ps::Filter* add_filter();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter >&
+      filter() const;
+
+  // repeated .ps.DataType value_type = 14 [packed = true];
+  int value_type_size() const;
+  private:
+  int _internal_value_type_size() const;
+  public:
+  void clear_value_type();
+  private:
+  ::ps::DataType _internal_value_type(int index) const;
+  void _internal_add_value_type(::ps::DataType value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_value_type();
+  public:
+  ::ps::DataType value_type(int index) const;
+  void set_value_type(int index, ::ps::DataType value);
+  void add_value_type(::ps::DataType value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& value_type() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_value_type();
+
+  // optional bytes msg = 17;
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // optional .ps.PbRange key_range = 7;
+  bool has_key_range() const;
+  private:
+  bool _internal_has_key_range() const;
+  public:
+  void clear_key_range();
+  const ::ps::PbRange& key_range() const;
+  PROTOBUF_NODISCARD ::ps::PbRange* release_key_range();
+  ::ps::PbRange* mutable_key_range();
+  void set_allocated_key_range(::ps::PbRange* key_range);
+  private:
+  const ::ps::PbRange& _internal_key_range() const;
+  ::ps::PbRange* _internal_mutable_key_range();
+  public:
+  void unsafe_arena_set_allocated_key_range(
+      ::ps::PbRange* key_range);
+  ::ps::PbRange* unsafe_arena_release_key_range();
+
+  // optional .ps.Control ctrl = 18;
+  bool has_ctrl() const;
+  private:
+  bool _internal_has_ctrl() const;
+  public:
+  void clear_ctrl();
+  const ::ps::Control& ctrl() const;
+  PROTOBUF_NODISCARD ::ps::Control* release_ctrl();
+  ::ps::Control* mutable_ctrl();
+  void set_allocated_ctrl(::ps::Control* ctrl);
+  private:
+  const ::ps::Control& _internal_ctrl() const;
+  ::ps::Control* _internal_mutable_ctrl();
+  public:
+  void unsafe_arena_set_allocated_ctrl(
+      ::ps::Control* ctrl);
+  ::ps::Control* unsafe_arena_release_ctrl();
+
+  // optional .ps.ParamCall param = 20;
+  bool has_param() const;
+  private:
+  bool _internal_has_param() const;
+  public:
+  void clear_param();
+  const ::ps::ParamCall& param() const;
+  PROTOBUF_NODISCARD ::ps::ParamCall* release_param();
+  ::ps::ParamCall* mutable_param();
+  void set_allocated_param(::ps::ParamCall* param);
+  private:
+  const ::ps::ParamCall& _internal_param() const;
+  ::ps::ParamCall* _internal_mutable_param();
+  public:
+  void unsafe_arena_set_allocated_param(
+      ::ps::ParamCall* param);
+  ::ps::ParamCall* unsafe_arena_release_param();
+
+  // optional int32 customer_id = 3;
+  bool has_customer_id() const;
+  private:
+  bool _internal_has_customer_id() const;
+  public:
+  void clear_customer_id();
+  int32_t customer_id() const;
+  void set_customer_id(int32_t value);
+  private:
+  int32_t _internal_customer_id() const;
+  void _internal_set_customer_id(int32_t value);
+  public:
+
+  // optional bool control = 1 [default = false];
+  bool has_control() const;
+  private:
+  bool _internal_has_control() const;
+  public:
+  void clear_control();
+  bool control() const;
+  void set_control(bool value);
+  private:
+  bool _internal_control() const;
+  void _internal_set_control(bool value);
+  public:
+
+  // optional bool request = 2 [default = false];
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  bool request() const;
+  void set_request(bool value);
+  private:
+  bool _internal_request() const;
+  void _internal_set_request(bool value);
+  public:
+
+  // optional bool has_key = 9 [default = false];
+  bool has_has_key() const;
+  private:
+  bool _internal_has_has_key() const;
+  public:
+  void clear_has_key();
+  bool has_key() const;
+  void set_has_key(bool value);
+  private:
+  bool _internal_has_key() const;
+  void _internal_set_has_key(bool value);
+  public:
+
+  // optional int32 time = 5;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  int32_t time() const;
+  void set_time(int32_t value);
+  private:
+  int32_t _internal_time() const;
+  void _internal_set_time(int32_t value);
+  public:
+
+  // optional int32 key_channel = 8;
+  bool has_key_channel() const;
+  private:
+  bool _internal_has_key_channel() const;
+  public:
+  void clear_key_channel();
+  int32_t key_channel() const;
+  void set_key_channel(int32_t value);
+  private:
+  int32_t _internal_key_channel() const;
+  void _internal_set_key_channel(int32_t value);
+  public:
+
+  // optional .ps.DataType key_type = 13;
+  bool has_key_type() const;
+  private:
+  bool _internal_has_key_type() const;
+  public:
+  void clear_key_type();
+  ::ps::DataType key_type() const;
+  void set_key_type(::ps::DataType value);
+  private:
+  ::ps::DataType _internal_key_type() const;
+  void _internal_set_key_type(::ps::DataType value);
+  public:
+
+  // optional int32 cmd = 19 [default = 0];
+  bool has_cmd() const;
+  private:
+  bool _internal_has_cmd() const;
+  public:
+  void clear_cmd();
+  int32_t cmd() const;
+  void set_cmd(int32_t value);
+  private:
+  int32_t _internal_cmd() const;
+  void _internal_set_cmd(int32_t value);
+  public:
+
+  // optional .ps.AsOp op = 21;
+  bool has_op() const;
+  private:
+  bool _internal_has_op() const;
+  public:
+  void clear_op();
+  ::ps::AsOp op() const;
+  void set_op(::ps::AsOp value);
+  private:
+  ::ps::AsOp _internal_op() const;
+  void _internal_set_op(::ps::AsOp value);
+  public:
+
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_,
+                                  id.default_value());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Mutable(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+              Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Release(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) {
+
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Task, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+
+  // @@protoc_insertion_point(class_scope:ps.Task)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > wait_time_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter > filter_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> value_type_;
+    mutable std::atomic<int> _value_type_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::ps::PbRange* key_range_;
+    ::ps::Control* ctrl_;
+    ::ps::ParamCall* param_;
+    int32_t customer_id_;
+    bool control_;
+    bool request_;
+    bool has_key_;
+    int32_t time_;
+    int32_t key_channel_;
+    int key_type_;
+    int32_t cmd_;
+    int op_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2ftask_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Control final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ps.Control) */ {
+ public:
+  inline Control() : Control(nullptr) {}
+  ~Control() override;
+  explicit PROTOBUF_CONSTEXPR Control(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Control(const Control& from);
+  Control(Control&& from) noexcept
+    : Control() {
+    *this = ::std::move(from);
+  }
+
+  inline Control& operator=(const Control& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Control& operator=(Control&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Control& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Control* internal_default_instance() {
+    return reinterpret_cast<const Control*>(
+               &_Control_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Control& a, Control& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Control* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Control* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Control* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Control>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Control& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Control& from) {
+    Control::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Control* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ps.Control";
+  }
+  protected:
+  explicit Control(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Control_Command Command;
+  static constexpr Command REGISTER_NODE =
+    Control_Command_REGISTER_NODE;
+  static constexpr Command READY_TO_EXIT =
+    Control_Command_READY_TO_EXIT;
+  static constexpr Command READY_TO_RUN =
+    Control_Command_READY_TO_RUN;
+  static constexpr Command ADD_NODE =
+    Control_Command_ADD_NODE;
+  static constexpr Command REMOVE_NODE =
+    Control_Command_REMOVE_NODE;
+  static constexpr Command EXIT =
+    Control_Command_EXIT;
+  static inline bool Command_IsValid(int value) {
+    return Control_Command_IsValid(value);
+  }
+  static constexpr Command Command_MIN =
+    Control_Command_Command_MIN;
+  static constexpr Command Command_MAX =
+    Control_Command_Command_MAX;
+  static constexpr int Command_ARRAYSIZE =
+    Control_Command_Command_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Command_descriptor() {
+    return Control_Command_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Command_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Command>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Command_Name.");
+    return Control_Command_Name(enum_t_value);
+  }
+  static inline bool Command_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Command* value) {
+    return Control_Command_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeFieldNumber = 2,
+    kCmdFieldNumber = 1,
+  };
+  // repeated .ps.Node node = 2;
+  int node_size() const;
+  private:
+  int _internal_node_size() const;
+  public:
+  void clear_node();
+  ::ps::Node* mutable_node(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Node >*
+      mutable_node();
+  private:
+  const ::ps::Node& _internal_node(int index) const;
+  ::ps::Node* _internal_add_node();
+  public:
+  const ::ps::Node& node(int index) const;
+  ::ps::Node* add_node();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Node >&
+      node() const;
+
+  // required .ps.Control.Command cmd = 1;
+  bool has_cmd() const;
+  private:
+  bool _internal_has_cmd() const;
+  public:
+  void clear_cmd();
+  ::ps::Control_Command cmd() const;
+  void set_cmd(::ps::Control_Command value);
+  private:
+  ::ps::Control_Command _internal_cmd() const;
+  void _internal_set_cmd(::ps::Control_Command value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ps.Control)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Node > node_;
+    int cmd_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2ftask_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Task
+
+// optional bytes msg = 17;
+inline bool Task::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Task::has_msg() const {
+  return _internal_has_msg();
+}
+inline void Task::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Task::msg() const {
+  // @@protoc_insertion_point(field_get:ps.Task.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Task::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.msg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ps.Task.msg)
+}
+inline std::string* Task::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ps.Task.msg)
+  return _s;
+}
+inline const std::string& Task::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void Task::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Task::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Task::release_msg() {
+  // @@protoc_insertion_point(field_release:ps.Task.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Task::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ps.Task.msg)
+}
+
+// optional int32 cmd = 19 [default = 0];
+inline bool Task::_internal_has_cmd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Task::has_cmd() const {
+  return _internal_has_cmd();
+}
+inline void Task::clear_cmd() {
+  _impl_.cmd_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t Task::_internal_cmd() const {
+  return _impl_.cmd_;
+}
+inline int32_t Task::cmd() const {
+  // @@protoc_insertion_point(field_get:ps.Task.cmd)
+  return _internal_cmd();
+}
+inline void Task::_internal_set_cmd(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.cmd_ = value;
+}
+inline void Task::set_cmd(int32_t value) {
+  _internal_set_cmd(value);
+  // @@protoc_insertion_point(field_set:ps.Task.cmd)
+}
+
+// optional .ps.AsOp op = 21;
+inline bool Task::_internal_has_op() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Task::has_op() const {
+  return _internal_has_op();
+}
+inline void Task::clear_op() {
+  _impl_.op_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline ::ps::AsOp Task::_internal_op() const {
+  return static_cast< ::ps::AsOp >(_impl_.op_);
+}
+inline ::ps::AsOp Task::op() const {
+  // @@protoc_insertion_point(field_get:ps.Task.op)
+  return _internal_op();
+}
+inline void Task::_internal_set_op(::ps::AsOp value) {
+  assert(::ps::AsOp_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.op_ = value;
+}
+inline void Task::set_op(::ps::AsOp value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:ps.Task.op)
+}
+
+// optional bool control = 1 [default = false];
+inline bool Task::_internal_has_control() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Task::has_control() const {
+  return _internal_has_control();
+}
+inline void Task::clear_control() {
+  _impl_.control_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Task::_internal_control() const {
+  return _impl_.control_;
+}
+inline bool Task::control() const {
+  // @@protoc_insertion_point(field_get:ps.Task.control)
+  return _internal_control();
+}
+inline void Task::_internal_set_control(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.control_ = value;
+}
+inline void Task::set_control(bool value) {
+  _internal_set_control(value);
+  // @@protoc_insertion_point(field_set:ps.Task.control)
+}
+
+// optional bool request = 2 [default = false];
+inline bool Task::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Task::has_request() const {
+  return _internal_has_request();
+}
+inline void Task::clear_request() {
+  _impl_.request_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Task::_internal_request() const {
+  return _impl_.request_;
+}
+inline bool Task::request() const {
+  // @@protoc_insertion_point(field_get:ps.Task.request)
+  return _internal_request();
+}
+inline void Task::_internal_set_request(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.request_ = value;
+}
+inline void Task::set_request(bool value) {
+  _internal_set_request(value);
+  // @@protoc_insertion_point(field_set:ps.Task.request)
+}
+
+// optional int32 customer_id = 3;
+inline bool Task::_internal_has_customer_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Task::has_customer_id() const {
+  return _internal_has_customer_id();
+}
+inline void Task::clear_customer_id() {
+  _impl_.customer_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Task::_internal_customer_id() const {
+  return _impl_.customer_id_;
+}
+inline int32_t Task::customer_id() const {
+  // @@protoc_insertion_point(field_get:ps.Task.customer_id)
+  return _internal_customer_id();
+}
+inline void Task::_internal_set_customer_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.customer_id_ = value;
+}
+inline void Task::set_customer_id(int32_t value) {
+  _internal_set_customer_id(value);
+  // @@protoc_insertion_point(field_set:ps.Task.customer_id)
+}
+
+// optional int32 time = 5;
+inline bool Task::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Task::has_time() const {
+  return _internal_has_time();
+}
+inline void Task::clear_time() {
+  _impl_.time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t Task::_internal_time() const {
+  return _impl_.time_;
+}
+inline int32_t Task::time() const {
+  // @@protoc_insertion_point(field_get:ps.Task.time)
+  return _internal_time();
+}
+inline void Task::_internal_set_time(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.time_ = value;
+}
+inline void Task::set_time(int32_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:ps.Task.time)
+}
+
+// repeated int32 wait_time = 6;
+inline int Task::_internal_wait_time_size() const {
+  return _impl_.wait_time_.size();
+}
+inline int Task::wait_time_size() const {
+  return _internal_wait_time_size();
+}
+inline void Task::clear_wait_time() {
+  _impl_.wait_time_.Clear();
+}
+inline int32_t Task::_internal_wait_time(int index) const {
+  return _impl_.wait_time_.Get(index);
+}
+inline int32_t Task::wait_time(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Task.wait_time)
+  return _internal_wait_time(index);
+}
+inline void Task::set_wait_time(int index, int32_t value) {
+  _impl_.wait_time_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ps.Task.wait_time)
+}
+inline void Task::_internal_add_wait_time(int32_t value) {
+  _impl_.wait_time_.Add(value);
+}
+inline void Task::add_wait_time(int32_t value) {
+  _internal_add_wait_time(value);
+  // @@protoc_insertion_point(field_add:ps.Task.wait_time)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Task::_internal_wait_time() const {
+  return _impl_.wait_time_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Task::wait_time() const {
+  // @@protoc_insertion_point(field_list:ps.Task.wait_time)
+  return _internal_wait_time();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Task::_internal_mutable_wait_time() {
+  return &_impl_.wait_time_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Task::mutable_wait_time() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Task.wait_time)
+  return _internal_mutable_wait_time();
+}
+
+// optional .ps.PbRange key_range = 7;
+inline bool Task::_internal_has_key_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_range_ != nullptr);
+  return value;
+}
+inline bool Task::has_key_range() const {
+  return _internal_has_key_range();
+}
+inline const ::ps::PbRange& Task::_internal_key_range() const {
+  const ::ps::PbRange* p = _impl_.key_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::PbRange&>(
+      ::ps::_PbRange_default_instance_);
+}
+inline const ::ps::PbRange& Task::key_range() const {
+  // @@protoc_insertion_point(field_get:ps.Task.key_range)
+  return _internal_key_range();
+}
+inline void Task::unsafe_arena_set_allocated_key_range(
+    ::ps::PbRange* key_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_range_);
+  }
+  _impl_.key_range_ = key_range;
+  if (key_range) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.Task.key_range)
+}
+inline ::ps::PbRange* Task::release_key_range() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ps::PbRange* temp = _impl_.key_range_;
+  _impl_.key_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::PbRange* Task::unsafe_arena_release_key_range() {
+  // @@protoc_insertion_point(field_release:ps.Task.key_range)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ps::PbRange* temp = _impl_.key_range_;
+  _impl_.key_range_ = nullptr;
+  return temp;
+}
+inline ::ps::PbRange* Task::_internal_mutable_key_range() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.key_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::PbRange>(GetArenaForAllocation());
+    _impl_.key_range_ = p;
+  }
+  return _impl_.key_range_;
+}
+inline ::ps::PbRange* Task::mutable_key_range() {
+  ::ps::PbRange* _msg = _internal_mutable_key_range();
+  // @@protoc_insertion_point(field_mutable:ps.Task.key_range)
+  return _msg;
+}
+inline void Task::set_allocated_key_range(::ps::PbRange* key_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_range_);
+  }
+  if (key_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_range));
+    if (message_arena != submessage_arena) {
+      key_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_range_ = key_range;
+  // @@protoc_insertion_point(field_set_allocated:ps.Task.key_range)
+}
+
+// optional int32 key_channel = 8;
+inline bool Task::_internal_has_key_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Task::has_key_channel() const {
+  return _internal_has_key_channel();
+}
+inline void Task::clear_key_channel() {
+  _impl_.key_channel_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t Task::_internal_key_channel() const {
+  return _impl_.key_channel_;
+}
+inline int32_t Task::key_channel() const {
+  // @@protoc_insertion_point(field_get:ps.Task.key_channel)
+  return _internal_key_channel();
+}
+inline void Task::_internal_set_key_channel(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.key_channel_ = value;
+}
+inline void Task::set_key_channel(int32_t value) {
+  _internal_set_key_channel(value);
+  // @@protoc_insertion_point(field_set:ps.Task.key_channel)
+}
+
+// optional bool has_key = 9 [default = false];
+inline bool Task::_internal_has_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Task::has_has_key() const {
+  return _internal_has_has_key();
+}
+inline void Task::clear_has_key() {
+  _impl_.has_key_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Task::_internal_has_key() const {
+  return _impl_.has_key_;
+}
+inline bool Task::has_key() const {
+  // @@protoc_insertion_point(field_get:ps.Task.has_key)
+  return _internal_has_key();
+}
+inline void Task::_internal_set_has_key(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.has_key_ = value;
+}
+inline void Task::set_has_key(bool value) {
+  _internal_set_has_key(value);
+  // @@protoc_insertion_point(field_set:ps.Task.has_key)
+}
+
+// optional .ps.DataType key_type = 13;
+inline bool Task::_internal_has_key_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Task::has_key_type() const {
+  return _internal_has_key_type();
+}
+inline void Task::clear_key_type() {
+  _impl_.key_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::ps::DataType Task::_internal_key_type() const {
+  return static_cast< ::ps::DataType >(_impl_.key_type_);
+}
+inline ::ps::DataType Task::key_type() const {
+  // @@protoc_insertion_point(field_get:ps.Task.key_type)
+  return _internal_key_type();
+}
+inline void Task::_internal_set_key_type(::ps::DataType value) {
+  assert(::ps::DataType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.key_type_ = value;
+}
+inline void Task::set_key_type(::ps::DataType value) {
+  _internal_set_key_type(value);
+  // @@protoc_insertion_point(field_set:ps.Task.key_type)
+}
+
+// repeated .ps.DataType value_type = 14 [packed = true];
+inline int Task::_internal_value_type_size() const {
+  return _impl_.value_type_.size();
+}
+inline int Task::value_type_size() const {
+  return _internal_value_type_size();
+}
+inline void Task::clear_value_type() {
+  _impl_.value_type_.Clear();
+}
+inline ::ps::DataType Task::_internal_value_type(int index) const {
+  return static_cast< ::ps::DataType >(_impl_.value_type_.Get(index));
+}
+inline ::ps::DataType Task::value_type(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Task.value_type)
+  return _internal_value_type(index);
+}
+inline void Task::set_value_type(int index, ::ps::DataType value) {
+  assert(::ps::DataType_IsValid(value));
+  _impl_.value_type_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ps.Task.value_type)
+}
+inline void Task::_internal_add_value_type(::ps::DataType value) {
+  assert(::ps::DataType_IsValid(value));
+  _impl_.value_type_.Add(value);
+}
+inline void Task::add_value_type(::ps::DataType value) {
+  _internal_add_value_type(value);
+  // @@protoc_insertion_point(field_add:ps.Task.value_type)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Task::value_type() const {
+  // @@protoc_insertion_point(field_list:ps.Task.value_type)
+  return _impl_.value_type_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Task::_internal_mutable_value_type() {
+  return &_impl_.value_type_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Task::mutable_value_type() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Task.value_type)
+  return _internal_mutable_value_type();
+}
+
+// repeated .ps.Filter filter = 12;
+inline int Task::_internal_filter_size() const {
+  return _impl_.filter_.size();
+}
+inline int Task::filter_size() const {
+  return _internal_filter_size();
+}
+inline ::ps::Filter* Task::mutable_filter(int index) {
+  // @@protoc_insertion_point(field_mutable:ps.Task.filter)
+  return _impl_.filter_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter >*
+Task::mutable_filter() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Task.filter)
+  return &_impl_.filter_;
+}
+inline const ::ps::Filter& Task::_internal_filter(int index) const {
+  return _impl_.filter_.Get(index);
+}
+inline const ::ps::Filter& Task::filter(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Task.filter)
+  return _internal_filter(index);
+}
+inline ::ps::Filter* Task::_internal_add_filter() {
+  return _impl_.filter_.Add();
+}
+inline ::ps::Filter* Task::add_filter() {
+  ::ps::Filter* _add = _internal_add_filter();
+  // @@protoc_insertion_point(field_add:ps.Task.filter)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Filter >&
+Task::filter() const {
+  // @@protoc_insertion_point(field_list:ps.Task.filter)
+  return _impl_.filter_;
+}
+
+// optional .ps.Control ctrl = 18;
+inline bool Task::_internal_has_ctrl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ctrl_ != nullptr);
+  return value;
+}
+inline bool Task::has_ctrl() const {
+  return _internal_has_ctrl();
+}
+inline void Task::clear_ctrl() {
+  if (_impl_.ctrl_ != nullptr) _impl_.ctrl_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::ps::Control& Task::_internal_ctrl() const {
+  const ::ps::Control* p = _impl_.ctrl_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::Control&>(
+      ::ps::_Control_default_instance_);
+}
+inline const ::ps::Control& Task::ctrl() const {
+  // @@protoc_insertion_point(field_get:ps.Task.ctrl)
+  return _internal_ctrl();
+}
+inline void Task::unsafe_arena_set_allocated_ctrl(
+    ::ps::Control* ctrl) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ctrl_);
+  }
+  _impl_.ctrl_ = ctrl;
+  if (ctrl) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.Task.ctrl)
+}
+inline ::ps::Control* Task::release_ctrl() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ps::Control* temp = _impl_.ctrl_;
+  _impl_.ctrl_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::Control* Task::unsafe_arena_release_ctrl() {
+  // @@protoc_insertion_point(field_release:ps.Task.ctrl)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ps::Control* temp = _impl_.ctrl_;
+  _impl_.ctrl_ = nullptr;
+  return temp;
+}
+inline ::ps::Control* Task::_internal_mutable_ctrl() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.ctrl_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::Control>(GetArenaForAllocation());
+    _impl_.ctrl_ = p;
+  }
+  return _impl_.ctrl_;
+}
+inline ::ps::Control* Task::mutable_ctrl() {
+  ::ps::Control* _msg = _internal_mutable_ctrl();
+  // @@protoc_insertion_point(field_mutable:ps.Task.ctrl)
+  return _msg;
+}
+inline void Task::set_allocated_ctrl(::ps::Control* ctrl) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ctrl_;
+  }
+  if (ctrl) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ctrl);
+    if (message_arena != submessage_arena) {
+      ctrl = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ctrl, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.ctrl_ = ctrl;
+  // @@protoc_insertion_point(field_set_allocated:ps.Task.ctrl)
+}
+
+// optional .ps.ParamCall param = 20;
+inline bool Task::_internal_has_param() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.param_ != nullptr);
+  return value;
+}
+inline bool Task::has_param() const {
+  return _internal_has_param();
+}
+inline const ::ps::ParamCall& Task::_internal_param() const {
+  const ::ps::ParamCall* p = _impl_.param_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ps::ParamCall&>(
+      ::ps::_ParamCall_default_instance_);
+}
+inline const ::ps::ParamCall& Task::param() const {
+  // @@protoc_insertion_point(field_get:ps.Task.param)
+  return _internal_param();
+}
+inline void Task::unsafe_arena_set_allocated_param(
+    ::ps::ParamCall* param) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param_);
+  }
+  _impl_.param_ = param;
+  if (param) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ps.Task.param)
+}
+inline ::ps::ParamCall* Task::release_param() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ps::ParamCall* temp = _impl_.param_;
+  _impl_.param_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ps::ParamCall* Task::unsafe_arena_release_param() {
+  // @@protoc_insertion_point(field_release:ps.Task.param)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ps::ParamCall* temp = _impl_.param_;
+  _impl_.param_ = nullptr;
+  return temp;
+}
+inline ::ps::ParamCall* Task::_internal_mutable_param() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.param_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ps::ParamCall>(GetArenaForAllocation());
+    _impl_.param_ = p;
+  }
+  return _impl_.param_;
+}
+inline ::ps::ParamCall* Task::mutable_param() {
+  ::ps::ParamCall* _msg = _internal_mutable_param();
+  // @@protoc_insertion_point(field_mutable:ps.Task.param)
+  return _msg;
+}
+inline void Task::set_allocated_param(::ps::ParamCall* param) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.param_);
+  }
+  if (param) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(param));
+    if (message_arena != submessage_arena) {
+      param = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, param, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.param_ = param;
+  // @@protoc_insertion_point(field_set_allocated:ps.Task.param)
+}
+
+// -------------------------------------------------------------------
+
+// Control
+
+// required .ps.Control.Command cmd = 1;
+inline bool Control::_internal_has_cmd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Control::has_cmd() const {
+  return _internal_has_cmd();
+}
+inline void Control::clear_cmd() {
+  _impl_.cmd_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::ps::Control_Command Control::_internal_cmd() const {
+  return static_cast< ::ps::Control_Command >(_impl_.cmd_);
+}
+inline ::ps::Control_Command Control::cmd() const {
+  // @@protoc_insertion_point(field_get:ps.Control.cmd)
+  return _internal_cmd();
+}
+inline void Control::_internal_set_cmd(::ps::Control_Command value) {
+  assert(::ps::Control_Command_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cmd_ = value;
+}
+inline void Control::set_cmd(::ps::Control_Command value) {
+  _internal_set_cmd(value);
+  // @@protoc_insertion_point(field_set:ps.Control.cmd)
+}
+
+// repeated .ps.Node node = 2;
+inline int Control::_internal_node_size() const {
+  return _impl_.node_.size();
+}
+inline int Control::node_size() const {
+  return _internal_node_size();
+}
+inline ::ps::Node* Control::mutable_node(int index) {
+  // @@protoc_insertion_point(field_mutable:ps.Control.node)
+  return _impl_.node_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Node >*
+Control::mutable_node() {
+  // @@protoc_insertion_point(field_mutable_list:ps.Control.node)
+  return &_impl_.node_;
+}
+inline const ::ps::Node& Control::_internal_node(int index) const {
+  return _impl_.node_.Get(index);
+}
+inline const ::ps::Node& Control::node(int index) const {
+  // @@protoc_insertion_point(field_get:ps.Control.node)
+  return _internal_node(index);
+}
+inline ::ps::Node* Control::_internal_add_node() {
+  return _impl_.node_.Add();
+}
+inline ::ps::Node* Control::add_node() {
+  ::ps::Node* _add = _internal_add_node();
+  // @@protoc_insertion_point(field_add:ps.Control.node)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ps::Node >&
+Control::node() const {
+  // @@protoc_insertion_point(field_list:ps.Control.node)
+  return _impl_.node_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ps
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ps::Control_Command> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::Control_Command>() {
+  return ::ps::Control_Command_descriptor();
+}
+template <> struct is_proto_enum< ::ps::DataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ps::DataType>() {
+  return ::ps::DataType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2ftask_2eproto
@@ -127,7 +127,10 @@ class Customer {
    * from "request->sender"
    *
    * It which will be called by the executor's processing thread once the time
-   * dependencies specified in "request->task" have been satisfied.
+   * dependencies specified in "request->task" have been satisfied. If the
+   * executor processes requests in parallel, see \ref
+   * Executor::ParallelizeRequests, it is called by several threads at the same
+   * time, but never for two requests from the same sender.
    *
    * @param request the received request
    */
@@ -135,6 +138,10 @@ class Customer {
 
   /**
    * @brief Returns the last received request.
+   *
+   * If requests are processed concurrently, see \ref
+   * Executor::ParallelizeRequests, it is the last one picked, which may not be
+   * the one passed to the calling \ref ProcessRequest.
    */
   inline std::shared_ptr<Message> LastRequest() {
     return exec_.last_request();
@@ -45,6 +45,18 @@ typedef uint64 Key;
 /// \brief The maximal allowed key
 static const Key kMaxKey = std::numeric_limits<Key>::max();
 
+/**
+ * \brief Forces a function to be inlined
+ *
+ * Use it for a function which only issues prefetches. gcc treats such a
+ * function as pure and may remove its calls before inlining them.
+ */
+#ifdef _MSC_VER
+#define PS_ALWAYS_INLINE __forceinline
+#else
+#define PS_ALWAYS_INLINE inline __attribute__((always_inline))
+#endif
+
 /*! \brief returns a short debug string */
 template <typename V>
 inline std::string DebugStr(const V* data, int n, int m = 5) {
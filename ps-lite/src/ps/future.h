@@ -0,0 +1,299 @@
+/**
+ * @file   future.h
+ * @brief  Futures with chainable continuations for the asynchronous requests
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include "ps/base.h"
+namespace ps {
+
+/**
+ * \brief Runs a function somewhere else, such as queuing it to a pool of
+ * threads. An empty one runs the function by the calling thread.
+ */
+typedef std::function<void(const std::function<void()>&)> CallbackExecutor;
+
+template <typename T> class Future;
+template <typename T> class Promise;
+
+/// \brief The value of a Future<void>
+struct Unit { };
+
+/// \brief The type of the value stored for Future<T>
+template <typename T> struct FutureValue { typedef T type; };
+template <> struct FutureValue<void> { typedef Unit type; };
+
+/**
+ * \brief The state shared by a \ref Promise and its \ref Future
+ *
+ * The value is consumed once, either by \ref Future::Get or by the only
+ * continuation, and moved but never copied. It must be default
+ * constructible.
+ */
+template <typename T>
+class FutureState {
+ public:
+  typedef typename FutureValue<T>::type Value;
+
+  void Set(Value&& value) {
+    std::function<void(Value&&)> next;
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      CHECK(!ready_) << "the value is already set";
+      value_ = std::move(value);
+      ready_ = true;
+      if (next_) {
+        next = std::move(next_);
+        consumed_ = true;
+      }
+    }
+    cond_.notify_all();
+    if (next) next(std::move(value_));
+  }
+
+  /// \brief runs \a next with the value once it is set
+  void OnReady(std::function<void(Value&&)>&& next) {
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      CHECK(!next_ && !consumed_) << "a future can be consumed only once";
+      if (!ready_) {
+        next_ = std::move(next);
+        return;
+      }
+      consumed_ = true;
+    }
+    next(std::move(value_));
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [this]() { return ready_; });
+  }
+
+  Value Get() {
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [this]() { return ready_; });
+    CHECK(!next_ && !consumed_) << "a future can be consumed only once";
+    consumed_ = true;
+    return std::move(value_);
+  }
+
+  bool ready() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return ready_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cond_;
+  bool ready_ = false, consumed_ = false;
+  Value value_;
+  std::function<void(Value&&)> next_;
+};
+
+/**
+ * \brief The producer side of a \ref Future
+ */
+template <typename T>
+class Promise {
+ public:
+  typedef typename FutureValue<T>::type Value;
+
+  Promise() : state_(std::make_shared<FutureState<T>>()) { }
+
+  /// \brief returns the future of this promise
+  Future<T> GetFuture() const { return Future<T>(state_); }
+
+  /// \brief sets the value, which runs the continuation if any
+  void Set(Value value) const { state_->Set(std::move(value)); }
+
+  /// \brief makes a Future<void> ready
+  void Set() const {
+    static_assert(std::is_void<T>::value, "only for Promise<void>");
+    state_->Set(Unit());
+  }
+
+ private:
+  std::shared_ptr<FutureState<T>> state_;
+};
+
+/// \brief calls f with the value, or with no argument for a Future<void>
+template <typename F, typename V>
+auto ApplyValue(F& f, V&& v) -> decltype(f(std::move(v))) {
+  return f(std::move(v));
+}
+template <typename F>
+auto ApplyValue(F& f, Unit&&) -> decltype(f()) {
+  return f();
+}
+
+/// \brief sets the promise by the result of a continuation, which is unwrapped
+/// if it is a future
+template <typename R>
+struct Continue {
+  typedef R type;
+  template <typename F, typename V>
+  static void Run(F& f, V&& v, const Promise<R>& p) {
+    p.Set(ApplyValue(f, std::move(v)));
+  }
+};
+template <>
+struct Continue<void> {
+  typedef void type;
+  template <typename F, typename V>
+  static void Run(F& f, V&& v, const Promise<void>& p) {
+    ApplyValue(f, std::move(v));
+    p.Set();
+  }
+};
+template <typename U>
+struct Continue<Future<U>> {
+  typedef U type;
+  template <typename F, typename V>
+  static void Run(F& f, V&& v, const Promise<U>& p) {
+    ApplyValue(f, std::move(v)).Forward(p);
+  }
+};
+
+/**
+ * \brief The result of an asynchronous operation, such as a push or a pull of
+ * \ref KVWorker, which can be chained with continuations
+ *
+ * \code
+ *   KVWorker<float> w;
+ *   w.ZPullAsync(keys, opts).Then([&w, keys](KVValues<float> v) {
+ *       CalcGrad(v.vals.get());
+ *       return w.ZPushAsync(keys, v.vals);
+ *     }, compute_executor).Then([]() { LOG(INFO) << "pushed"; });
+ * \endcode
+ *
+ * The value is moved along the chain without copying. A future is consumed
+ * once, by \ref Then or \ref Get. It has no error state, failures are fatal as
+ * in the rest of the system.
+ */
+template <typename T>
+class Future {
+ public:
+  typedef typename FutureValue<T>::type Value;
+
+  Future() { }
+  explicit Future(const std::shared_ptr<FutureState<T>>& state)
+      : state_(state) { }
+
+  /// \brief returns true if it is associated with a promise
+  bool valid() const { return state_ != nullptr; }
+
+  /// \brief returns true if the value is set
+  bool ready() const { return state()->ready(); }
+
+  /// \brief waits until the value is set
+  void Wait() const { state()->Wait(); }
+
+  /// \brief waits and returns the value
+  Value Get() const { return state()->Get(); }
+
+  /**
+   * \brief Runs \a f with the value once it is set
+   *
+   * \a f takes the value, or nothing for a Future<void>, and may return a
+   * value, nothing or another future, which the returned future is ready
+   * with.
+   *
+   * @param f the continuation, which must be copyable
+   * @param executor runs \a f. if empty, \a f runs by the thread setting the
+   * value, which is the data receiving thread for the requests of \ref
+   * KVWorker, or by the calling thread if the value is already set
+   * @return the future of the result of \a f. this one is invalid afterwards
+   */
+  template <typename F>
+  auto Then(F f, const CallbackExecutor& executor = CallbackExecutor())
+      -> Future<typename Continue<decltype(
+          ApplyValue(f, std::declval<Value>()))>::type> {
+    typedef decltype(ApplyValue(f, std::declval<Value>())) R;
+    typedef typename Continue<R>::type U;
+    Promise<U> p;
+    auto ret = p.GetFuture();
+    state()->OnReady([f, p, executor](Value&& v) mutable {
+        if (!executor) {
+          Continue<R>::Run(f, std::move(v), p);
+          return;
+        }
+        // boxed so the executor can copy the task without copying the value
+        auto box = std::make_shared<Value>(std::move(v));
+        executor([f, p, box]() mutable {
+            Continue<R>::Run(f, std::move(*box), p);
+          });
+      });
+    state_.reset();
+    return ret;
+  }
+
+  /// \brief sets \a p by the value once it is set. this one is invalid
+  /// afterwards
+  void Forward(const Promise<T>& p) {
+    state()->OnReady([p](Value&& v) { p.Set(std::move(v)); });
+    state_.reset();
+  }
+
+ private:
+  FutureState<T>* state() const {
+    CHECK(state_) << "the future is invalid";
+    return state_.get();
+  }
+
+  std::shared_ptr<FutureState<T>> state_;
+};
+
+/// \brief returns a future which is ready with \a value
+template <typename T>
+Future<typename std::decay<T>::type> MakeReadyFuture(T&& value) {
+  Promise<typename std::decay<T>::type> p;
+  p.Set(std::forward<T>(value));
+  return p.GetFuture();
+}
+
+/// \brief returns a Future<void> which is ready
+inline Future<void> MakeReadyFuture() {
+  Promise<void> p;
+  p.Set();
+  return p.GetFuture();
+}
+
+/**
+ * \brief Returns a future which is ready once all \a futures are, with their
+ * values in order
+ */
+template <typename T>
+Future<std::vector<typename FutureValue<T>::type>> WhenAll(
+    const std::vector<Future<T>>& futures) {
+  typedef typename FutureValue<T>::type Value;
+  struct All {
+    std::vector<Value> values;
+    std::atomic<size_t> left;
+    Promise<std::vector<Value>> promise;
+  };
+  auto all = std::make_shared<All>();
+  all->values.resize(futures.size());
+  all->left = futures.size();
+  auto ret = all->promise.GetFuture();
+  if (futures.empty()) {
+    all->promise.Set(std::move(all->values));
+    return ret;
+  }
+  for (size_t i = 0; i < futures.size(); ++i) {
+    Future<T> f = futures[i];
+    f.Then([all, i](Value&& v) {
+        all->values[i] = std::move(v);
+        if (-- all->left == 0) all->promise.Set(std::move(all->values));
+      });
+  }
+  return ret;
+}
+
+}  // namespace ps
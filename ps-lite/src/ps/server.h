@@ -9,14 +9,16 @@
 #include "proto/task.pb.h"
 #include "kv/kv_store_sparse.h"
 #include "kv/kv_store_sparse_st.h"
-// #include "kv/kv_store_cuckoo.h"
+#include "kv/kv_store_column.h"
+#include "base/flat_hash_map.h"
 namespace ps {
 
 /**
  * @brief An example of the user-defined value for \ref OnlineServer
  *
  * The constructor function is called when the according key does not
- * exist. This class must be copyable and assignable (movable), which are only
+ * exist. A pull of such a key reads a default constructed value, but does not
+ * insert it. This class must be copyable and assignable (movable), which are only
  * called once with the constructor function, e.g. ``std::unordered_map::insert(IVal<Val>())``. It
  * also must implement the following three functions \ref Load, \ref Save and
  * \ref Empty
@@ -54,6 +56,11 @@ struct IVal {
  * may run in parallel with the number of threads specified in \ref
  * OnlineServer.
  *
+ * If several requests are processed at the same time, see \ref
+ * KVStore::SetConcurrency, each of them uses its own copy of the handle, from
+ * Start to Finish. So Push and Pull may be called on different copies at the
+ * same time, but never for the same key.
+ *
  * The procedure for a pull request is similar.
  *
  * \code
@@ -79,6 +86,17 @@ struct IVal {
  *   send_val.size = my_val.w.size();
  * }
  * \endcode
+ *
+ * A handle may also implement the batch versions of Push and Pull, which are
+ * called once per bucket with the entries of all keys resolved, see \ref
+ * KVBatch.
+ *
+ * \code
+ * void PushBatch(size_t n, const Key* keys, const Blob<const SyncV>* recv_vals,
+ *                Val** my_vals);
+ * void PullBatch(size_t n, const Key* keys, const Val* const* my_vals,
+ *                Blob<SyncV>* send_vals);
+ * \endcode
  */
 template <typename SyncV>
 class IOnlineHandle {
@@ -146,10 +164,14 @@ class IOnlineHandle {
  * user-defined type, see \ref IVal for more details
  * @tparam Handle User-defined handle for processing push and pull request from
  * workers, see \ref IOnlineHandle for more details
+ * @tparam Map the hash table storing the KV pairs, either the node-based
+ * `std::unordered_map<Key, Val>` or the open-addressing \ref FlatHashMap`<Key,
+ * Val>`, which stores keys and values inline and requires \a Val to be movable
  */
 template <typename SyncV,
           typename Val = IVal<SyncV>,
-          typename Handle = IOnlineHandle<SyncV> >
+          typename Handle = IOnlineHandle<SyncV>,
+          typename Map = std::unordered_map<Key, Val> >
 class OnlineServer {
  public:
   /**
@@ -168,14 +190,12 @@ class OnlineServer {
                int num_threads = 1,
                int id = NextID()) {
     if (num_threads == 1) {
-      server_ = new KVStoreSparseST<Key, Val, SyncV, Handle>(
+      server_ = new KVStoreSparseST<Key, Val, SyncV, Handle, Map>(
           id, handle, pull_val_len);
     } else {
-      server_ = new KVStoreSparse<Key, Val, SyncV, Handle>(
+      server_ = new KVStoreSparse<Key, Val, SyncV, Handle, Map>(
           id, handle, pull_val_len, num_threads);
     }
-    // server_ = new KVStoreCuckoo<Key, Val, SyncV, Handle>(
-    //     id, handle, pull_val_len, num_threads);
     Postoffice::instance().manager().TransferCustomer(CHECK_NOTNULL(server_));
   }
 
@@ -188,6 +208,40 @@ class OnlineServer {
   KVStore* server_ = NULL;
 };
 
+/**
+ * \brief The online key-value store for server nodes in the struct-of-arrays
+ * layout
+ *
+ * Similar to \ref OnlineServer, but the KV pairs are stored by \ref
+ * KVStoreColumn, which applies a push request to a whole batch of keys with
+ * `Handle::PushColumns`. It only supports pushing one value per key.
+ *
+ * @tparam SyncV the value type used for synchronization
+ * @tparam Val the value type stored in server, a plain struct of \a SyncV
+ * @tparam Handle User-defined handle, which implements `PushColumns` besides
+ * the functions in \ref IOnlineHandle
+ */
+template <typename SyncV, typename Val, typename Handle>
+class OnlineColumnServer {
+ public:
+  OnlineColumnServer(const Handle& handle = Handle(),
+                     int pull_val_len = 1,
+                     int num_threads = 1,
+                     int id = NextID()) {
+    server_ = new KVStoreColumn<Key, Val, SyncV, Handle>(
+        id, handle, pull_val_len, num_threads);
+    Postoffice::instance().manager().TransferCustomer(CHECK_NOTNULL(server_));
+  }
+
+  ~OnlineColumnServer() { }
+
+  /// \brief Returns the pointer of the actual KV store
+  KVStore* server() { return server_; }
+
+ private:
+  KVStore* server_ = NULL;
+};
+
 }  // namespace ps
 
 /**
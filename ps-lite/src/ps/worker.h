@@ -7,6 +7,7 @@
 #include <memory>
 #include "ps/base.h"
 #include "ps/blob.h"
+#include "ps/future.h"
 #include "kv/kv_cache.h"
 #include "proto/task.pb.h"
 #include "proto/filter.pb.h"
@@ -44,10 +45,23 @@ struct SyncOpts {
    *
    * The subtle difference is that, in the latter, \a func is executed before
    * \ref Wait returns, and it is executed by a different thread (KVworker's
-   * data receiving thread).
+   * data receiving thread), unless \ref executor is set.
    */
   std::function<void()> callback;
 
+  /**
+   * \brief Runs the callback off the data receiving thread
+   *
+   * The responses of all requests are processed by one thread, so a callback
+   * doing heavy work, such as computing the gradients with the pulled
+   * weights, delays the responses of the other requests in flight. If set,
+   * that thread only passes the callback to \a executor, which usually queues
+   * it to a pool of compute threads. The callback may then run after \ref
+   * KVWorker::Wait returns, use the futures of \ref KVWorker::ZPushAsync and
+   * \ref KVWorker::ZPullAsync to wait for it.
+   */
+  CallbackExecutor executor;
+
   /**
    * \brief Filters to compression data
    * \sa ps::IFilter AddFilter
@@ -72,6 +86,24 @@ struct SyncOpts {
    * \brief Returns the according system Task
    */
   Task GetTask() const;
+
+  /**
+   * \brief Returns the callback run by the data receiving thread, which runs
+   * \ref callback by \ref executor
+   */
+  std::function<void()> GetCallback() const;
+};
+
+/**
+ * \brief The values pulled by \ref KVWorker::ZPullAsync and \ref
+ * KVWorker::ZVPullAsync
+ */
+template <typename Val>
+struct KVValues {
+  /// \brief the values
+  std::shared_ptr<std::vector<Val>> vals;
+  /// \brief the value lengths, only for \ref KVWorker::ZVPullAsync
+  std::shared_ptr<std::vector<int>> vals_size;
 };
 
 /**
@@ -198,6 +230,16 @@ class KVWorker {
    */
   void Wait(int timestamp) { cache_->Wait(timestamp); }
 
+  /**
+   * \brief Sends the pushes and pulls of the hot keys replicated by the
+   * servers to the replicas instead of their owners, see \ref
+   * KVStore::SetHotKeys. The servers are asked for their hot keys every \a
+   * refresh_sec seconds, which should not exceed their round.
+   */
+  void ReplicateHotKeys(int refresh_sec) {
+    cache_->ReplicateHotKeys(refresh_sec);
+  }
+
   /**
    * @brief Extends \ref Push to dynamic length values
    *
@@ -279,7 +321,7 @@ class KVWorker {
             const std::shared_ptr<std::vector<Val> >& vals,
             const SyncOpts& opts = SyncOpts()) {
     return cache_->Push(opts.GetTask(), SArray<Key>(keys),
-                        SArray<Val>(vals), SArray<int>(), opts.callback);
+                        SArray<Val>(vals), SArray<int>(), opts.GetCallback());
   }
   /**
    * \brief The zero-copy version of \ref Pull
@@ -308,7 +350,7 @@ class KVWorker {
   int ZPull(const std::shared_ptr<std::vector<Key> >& keys,
             std::vector<Val>* vals,
             const SyncOpts& opts = SyncOpts()) {
-    return cache_->Pull(opts.GetTask(), SArray<Key>(keys), opts.callback,
+    return cache_->Pull(opts.GetTask(), SArray<Key>(keys), opts.GetCallback(),
                         CHECK_NOTNULL(vals), NULL);
   }
 
@@ -319,7 +361,7 @@ class KVWorker {
              const std::shared_ptr<std::vector<int> >& vals_size,
              const SyncOpts& opts = SyncOpts()) {
     return cache_->Push(opts.GetTask(), SArray<Key>(keys), SArray<Val>(vals),
-                        SArray<int>(vals_size), opts.callback);
+                        SArray<int>(vals_size), opts.GetCallback());
   }
 
   ///  \brief The zero-copy version of \ref VPull
@@ -327,11 +369,101 @@ class KVWorker {
              std::vector<Val>* vals,
              std::vector<int>* vals_size,
              const SyncOpts& opts = SyncOpts()) {
-    return cache_->Pull(opts.GetTask(), SArray<Key>(keys), opts.callback,
+    return cache_->Pull(opts.GetTask(), SArray<Key>(keys), opts.GetCallback(),
                         CHECK_NOTNULL(vals), CHECK_NOTNULL(vals_size));
   }
 
+  /**
+   * \brief The future version of \ref ZPush
+   *
+   * The returned future is ready once the push is finished, and after \a
+   * opts.callback, if any, has run. Dependent steps can be chained by \ref
+   * Future::Then instead of nesting callbacks, and each step can run by its
+   * own executor, such as a pool of compute threads:
+   *
+   * \code
+   *   KVWorker<float> w;
+   *   w.ZPullAsync(keys).Then([&w, keys](KVValues<float> v) {
+   *       // compute the gradients in place
+   *       return w.ZPushAsync(keys, v.vals);
+   *     }, compute_executor).Then([]() {
+   *       // the gradients are pushed
+   *     });
+   * \endcode
+   *
+   * @param keys a list of keys, which must be sorted
+   * @param vals the according values
+   * @param opts push options
+   * @return the future of this request
+   */
+  Future<void> ZPushAsync(const std::shared_ptr<std::vector<Key> >& keys,
+                          const std::shared_ptr<std::vector<Val> >& vals,
+                          const SyncOpts& opts = SyncOpts()) {
+    Promise<void> p;
+    ZPush(keys, vals, ThenSet(opts, [p]() { p.Set(); }));
+    return p.GetFuture();
+  }
+
+  /// \brief The future version of \ref ZVPush
+  Future<void> ZVPushAsync(const std::shared_ptr<std::vector<Key> >& keys,
+                           const std::shared_ptr<std::vector<Val> >& vals,
+                           const std::shared_ptr<std::vector<int> >& vals_size,
+                           const SyncOpts& opts = SyncOpts()) {
+    Promise<void> p;
+    ZVPush(keys, vals, vals_size, ThenSet(opts, [p]() { p.Set(); }));
+    return p.GetFuture();
+  }
+
+  /**
+   * \brief The future version of \ref ZPull
+   *
+   * The values are pulled into a buffer allocated here, and the future is
+   * ready with it once the pull is finished, after \a opts.callback, if any.
+   * The buffer is moved along the chain, so it can be pushed back by \ref
+   * ZPushAsync without copying.
+   *
+   * @param keys a list of keys, which must be sorted
+   * @param opts pull options
+   * @return the future of the pulled values
+   */
+  Future<KVValues<Val>> ZPullAsync(
+      const std::shared_ptr<std::vector<Key> >& keys,
+      const SyncOpts& opts = SyncOpts()) {
+    Promise<KVValues<Val>> p;
+    KVValues<Val> kv;
+    kv.vals = std::make_shared<std::vector<Val>>();
+    auto vals = kv.vals.get();
+    ZPull(keys, vals, ThenSet(opts, [p, kv]() { p.Set(kv); }));
+    return p.GetFuture();
+  }
+
+  /// \brief The future version of \ref ZVPull, see \ref ZPullAsync
+  Future<KVValues<Val>> ZVPullAsync(
+      const std::shared_ptr<std::vector<Key> >& keys,
+      const SyncOpts& opts = SyncOpts()) {
+    Promise<KVValues<Val>> p;
+    KVValues<Val> kv;
+    kv.vals = std::make_shared<std::vector<Val>>();
+    kv.vals_size = std::make_shared<std::vector<int>>();
+    auto vals = kv.vals.get();
+    auto vals_size = kv.vals_size.get();
+    ZVPull(keys, vals, vals_size, ThenSet(opts, [p, kv]() { p.Set(kv); }));
+    return p.GetFuture();
+  }
+
  private:
+  /// returns opts whose callback runs \a set after the one of \a opts
+  static SyncOpts ThenSet(const SyncOpts& opts,
+                          const std::function<void()>& set) {
+    SyncOpts o = opts;
+    auto cb = opts.callback;
+    o.callback = [cb, set]() {
+      if (cb) cb();
+      set();
+    };
+    return o;
+  }
+
   KVCache<Key, Val>* cache_;
 };
 
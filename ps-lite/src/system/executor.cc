@@ -26,6 +26,17 @@ Executor::~Executor() {
 
   CHECK_NOTNULL(thread_)->join();
   delete thread_;
+  // wait the requests being processed
+  request_pool_.reset();
+}
+
+void Executor::ParallelizeRequests(int num_threads) {
+  CHECK_GT(num_threads, 0);
+  Lock l(msg_mu_);
+  CHECK(!request_pool_) << "requests are already processed in parallel";
+  if (num_threads == 1) return;
+  request_pool_.reset(new ThreadPool(num_threads));
+  request_pool_->StartWorkers();
 }
 
 bool Executor::CheckFinished(RemoteNode* rnode, int timestamp, bool sent) {
@@ -221,6 +232,12 @@ bool Executor::PickActiveMsg() {
       continue;
     }
 
+    // a sender's requests are processed in order
+    if (req && request_pool_ && busy_senders_.count(msg->sender)) {
+      ++ it;
+      continue;
+    }
+
     // check for dependency constraint. only needed for request message.
     if (req) {
       for (int i = 0; i < msg->task.wait_time_size(); ++i) {
@@ -239,9 +256,26 @@ bool Executor::PickActiveMsg() {
               << recv_msgs_.size() << "] from " << msg->sender
               << ": " << msg->ShortDebugString();
 
+      rnode->DecodeMessage(msg);
+      if (req && request_pool_) {
+        // process it in the pool, and continue to pick
+        it = recv_msgs_.erase(it);
+        busy_senders_.insert(msg->sender);
+        std::shared_ptr<Message> request(msg);
+        last_request_ = request;
+        request_pool_->Add([this, request]() {
+            NodeID sender = request->sender;
+            ProcessRequest(request.get());
+            {
+              Lock l(msg_mu_);
+              busy_senders_.erase(sender);
+            }
+            dag_cond_.notify_one();
+          });
+        continue;
+      }
       active_msg_ = std::shared_ptr<Message>(msg);
       recv_msgs_.erase(it);
-      rnode->DecodeMessage(active_msg_.get());
       return true;
     }
   }
@@ -262,17 +296,11 @@ void Executor::ProcessActiveMsg() {
   bool req = active_msg_->task.request();
   int ts = active_msg_->task.time();
   if (req) {
-    last_request_ = active_msg_;
-    obj_.ProcessRequest(active_msg_.get());
-
-    if (active_msg_->finished) {
-      // if this message is marked as finished, then set the mark in tracker,
-      // otherwise, the user application need to call `Customer::FinishRecvReq`
-      // to set the mark
-      FinishRecvReq(ts, active_msg_->sender);
-      // reply an empty ACK message if necessary
-      if (!active_msg_->replied) obj_.Reply(active_msg_.get());
+    {
+      Lock l(msg_mu_);
+      last_request_ = active_msg_;
     }
+    ProcessRequest(active_msg_.get());
   } else {
     last_response_ = active_msg_;
     obj_.ProcessResponse(active_msg_.get());
@@ -314,6 +342,19 @@ void Executor::ProcessActiveMsg() {
   }
 }
 
+void Executor::ProcessRequest(Message* msg) {
+  obj_.ProcessRequest(msg);
+
+  if (msg->finished) {
+    // if this message is marked as finished, then set the mark in tracker,
+    // otherwise, the user application need to call `Customer::FinishRecvReq`
+    // to set the mark
+    FinishRecvReq(msg->task.time(), msg->sender);
+    // reply an empty ACK message if necessary
+    if (!msg->replied) obj_.Reply(msg);
+  }
+}
+
 void Executor::Accept(Message* msg) {
   {
     Lock l(msg_mu_);
@@ -1,6 +1,7 @@
 #pragma once
 #include "system/remote_node.h"
 #include "system/message.h"
+#include "base/thread_pool.h"
 namespace ps {
 
 const static NodeID kGroupPrefix  = "all_";
@@ -35,8 +36,11 @@ class Executor {
   void FinishRecvReq(int timestamp, const NodeID& sender);
   int QueryRecvReq(int timestamp, const NodeID& sender);
 
-  // the last received request
-  inline std::shared_ptr<Message> last_request() { return last_request_; }
+  // the last picked request. with ParallelizeRequests, it is not necessarily
+  // the one being processed by the calling thread
+  inline std::shared_ptr<Message> last_request() {
+    Lock l(msg_mu_); return last_request_;
+  }
   // the last received response
   inline std::shared_ptr<Message> last_response() { return last_response_; }
 
@@ -46,6 +50,13 @@ class Executor {
   void AddNode(const Node& node);
   void RemoveNode(const Node& node);
   void ReplaceNode(const Node& old_node, const Node& new_node);
+
+  // Processes up to num_threads received requests at the same time, by a pool
+  // of threads. The requests from the same sender are still processed one by
+  // one in the order they are picked, and the replies are sent by the pool
+  // threads, while the received responses are still processed by the
+  // executor's thread. The customer's ProcessRequest must be thread-safe.
+  void ParallelizeRequests(int num_threads);
  private:
   // Runs the DAG engine
   void Run() {
@@ -57,6 +68,7 @@ class Executor {
   // will be blocked.
   bool PickActiveMsg();
   void ProcessActiveMsg();
+  void ProcessRequest(Message* msg);
 
   // -- received messages --
   std::list<Message*> recv_msgs_;
@@ -65,6 +77,12 @@ class Executor {
   std::shared_ptr<Message> active_msg_, last_request_, last_response_;
   std::condition_variable dag_cond_;
 
+  // -- parallel requests --
+  // the pool processing requests, or null if they are processed by thread_
+  std::unique_ptr<ThreadPool> request_pool_;
+  // the senders whose requests are being processed by request_pool_
+  std::unordered_set<NodeID> busy_senders_;
+
   // -- remote nodes --
   std::mutex node_mu_;
   std::condition_variable recv_req_cond_;
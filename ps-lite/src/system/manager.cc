@@ -352,7 +352,8 @@ void Manager::RemoveCustomer(int id) {
 
 int Manager::NextCustomerID() {
   int id = 0;
-  for (const auto& it : customers_) id = std::min(id, it.second.first->id());
+  // the removed ones are kept with NULL, and their ids are not reused
+  for (const auto& it : customers_) id = std::min(id, it.first);
   return id - 1;
 }
 
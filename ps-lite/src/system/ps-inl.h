@@ -21,6 +21,13 @@ inline Task SyncOpts::GetTask() const {
   return req;
 }
 
+inline std::function<void()> SyncOpts::GetCallback() const {
+  if (!executor || !callback) return callback;
+  auto exec = executor;
+  auto cb = callback;
+  return [exec, cb]() { exec(cb); };
+}
+
 /// DEPRECATED
 
 inline int NextCustomerID() {
@@ -0,0 +1,119 @@
+/**
+ * @file   kv_test.h
+ * @brief  The entry and handle shared by the tests of the KV stores
+ */
+#pragma once
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include "ps/blob.h"
+#include "ps.h"
+#include "dmlc/io.h"
+#include "system/executor.h"
+namespace ps {
+
+/// an entry of two floats, which are pushed into and pulled from in place
+struct TestEntry {
+  float w[2] = {0, 0};
+  uint16 touched = 0;
+  bool Empty() const { return w[0] == 0 && w[1] == 0; }
+  void Save(dmlc::Stream* fo) const { fo->Write(w, sizeof(w)); }
+  void Load(dmlc::Stream* fi) { CHECK_EQ(fi->Read(w, sizeof(w)), sizeof(w)); }
+};
+
+/**
+ * \brief adds the pushed values into the entry, and points the pulled values
+ * into the entry, as handles avoiding copies do
+ */
+struct TestHandle {
+  void Start(bool push, int timestamp, int cmd, void* msg) { }
+  void Finish() { }
+  void Push(Key key, Blob<const float> val, TestEntry& e) {
+    for (size_t i = 0; i < val.size; ++i) e.w[i % 2] += val[i];
+  }
+  void Pull(Key key, const TestEntry& e, Blob<float>& val) {
+    val.data = const_cast<float*>(e.w); val.size = 2;
+  }
+  void Load(dmlc::Stream* fi) { }
+  void Save(dmlc::Stream* fo) const { }
+};
+
+/// \brief the same as \ref TestHandle, with the batch versions of push and pull
+struct TestBatchHandle : public TestHandle {
+  void PushBatch(size_t n, const Key* key, const Blob<const float>* val,
+                 TestEntry** e) {
+    for (size_t i = 0; i < n; ++i) Push(key[i], val[i], *e[i]);
+  }
+  void PullBatch(size_t n, const Key* key, const TestEntry* const* e,
+                 Blob<float>* val) {
+    for (size_t i = 0; i < n; ++i) Pull(key[i], *e[i], val[i]);
+  }
+};
+
+/// \brief the values a key is pushed, so a pulled value tells its key
+inline float TestValue(Key key, int i) { return (float)key * 2 + i; }
+
+/// \brief \a n distinct sorted keys over the whole range, so they are in all
+/// the buckets of a store
+inline std::vector<Key> TestKeys(size_t n, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<Key> key(n);
+  for (auto& k : key) k = gen();
+  std::sort(key.begin(), key.end());
+  key.erase(std::unique(key.begin(), key.end()), key.end());
+  return key;
+}
+
+/// \brief the values of \a key pushed \a c times, two per key
+inline std::vector<float> TestValues(const std::vector<Key>& key, float c = 1) {
+  std::vector<float> val;
+  for (Key k : key) { val.push_back(c * TestValue(k, 0)); val.push_back(c * TestValue(k, 1)); }
+  return val;
+}
+
+/// \brief a path for the files of a test, removed by the caller
+inline std::string TestFile(const std::string& name) {
+  return testing::TempDir() + "ps_unittest_" + std::to_string(getpid()) + "_" +
+      name;
+}
+
+/**
+ * \brief a KV store whose requests are handled by direct calls, as if they
+ * were sent by the workers. The system is not started
+ */
+template <typename Store>
+class TestStore : public Store {
+ public:
+  template <typename... Args>
+  explicit TestStore(Args&&... args) : Store(NextID(), std::forward<Args>(args)...) { }
+
+  /// \brief pushes val[i*k, (i+1)*k) into key[i], k = val.size() / key.size()
+  void Push(const std::vector<Key>& key, const std::vector<float>& val) {
+    Message msg = Request(key, true);
+    msg.add_value(SArray<float>(val));
+    this->HandlePush(&msg);
+  }
+
+  /// \brief pulls the values of \a key, with the length given to the store
+  std::vector<float> Pull(const std::vector<Key>& key) {
+    Message msg = Request(key, false);
+    this->HandlePull(&msg);
+    SArray<float> val(msg.value[0]);
+    return std::vector<float>(val.begin(), val.end());
+  }
+
+ private:
+  static Message Request(const std::vector<Key>& key, bool push) {
+    Message msg;
+    msg.task.mutable_param()->set_push(push);
+    msg.sender = kWorkerGroup;
+    msg.set_key(SArray<Key>(key));
+    return msg;
+  }
+};
+
+}  // namespace ps
@@ -0,0 +1,20 @@
+# unit tests, which do not start the system. run by `make test`
+
+UTEST_ROOT = test/unittest
+UNITTEST = build/ps_unittest
+UNITTEST_SRC = $(wildcard $(UTEST_ROOT)/*.cc)
+UNITTEST_OBJ = $(patsubst $(UTEST_ROOT)/%.cc, build/unittest/%.o, $(UNITTEST_SRC))
+
+ifndef GTEST_PATH
+GTEST_PATH = $(DEPS_PATH)
+endif
+
+build/unittest/%.o: $(UTEST_ROOT)/%.cc $(PS_LIB)
+	@mkdir -p $(@D)
+	$(CXX) $(INCPATH) -I$(GTEST_PATH)/include -std=c++0x -MM -MT $@ $< >build/unittest/$*.d
+	$(CXX) $(CFLAGS) -I$(GTEST_PATH)/include -c $< -o $@
+
+$(UNITTEST): $(UNITTEST_OBJ) $(PS_LIB)
+	$(CXX) $(CFLAGS) $^ -L$(GTEST_PATH)/lib -lgtest $(PS_LDFLAGS) \
+	$(addprefix $(DEPS_PATH)/lib/, libglog.a libgflags.a) -lpthread -lrt \
+	$(EXTRA_LDFLAGS) -o $@
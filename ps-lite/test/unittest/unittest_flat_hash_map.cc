@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_map>
+#include "base/flat_hash_map.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<uint64, uint64> Map;
+typedef std::unordered_map<uint64, uint64> Ref;
+const uint64 kLastKey = std::numeric_limits<uint64>::max();
+
+/// both maps have the same entries
+void ExpectSame(const Map& map, const Ref& ref) {
+  ASSERT_EQ(map.size(), ref.size());
+  EXPECT_EQ(map.empty(), ref.empty());
+  size_t n = 0;
+  for (const auto& s : map) {
+    auto it = ref.find(s.first);
+    ASSERT_TRUE(it != ref.end()) << "unexpected key " << s.first;
+    EXPECT_EQ(s.second, it->second) << "key " << s.first;
+    ++ n;
+  }
+  EXPECT_EQ(n, ref.size());
+  for (const auto& e : ref) {
+    auto it = map.find(e.first);
+    ASSERT_TRUE(it != map.end()) << "missing key " << e.first;
+    EXPECT_EQ(it->first, e.first);
+    EXPECT_EQ(it->second, e.second);
+    EXPECT_EQ(map.count(e.first), (size_t)1);
+  }
+}
+
+/// random inserts, finds and erases on both maps, with keys in [0, range) and
+/// the max key, which is stored out of the slot array
+void RandomOps(std::mt19937_64* gen, int ops, uint64 range, Map* map, Ref* ref) {
+  std::uniform_int_distribution<uint64> key(0, range);
+  std::uniform_int_distribution<int> op(0, 9);
+  for (int i = 0; i < ops; ++i) {
+    uint64 k = key(*gen);
+    if (k == range) k = kLastKey;
+    int o = op(*gen);
+    if (o < 5) {
+      uint64 v = (*gen)();
+      (*map)[k] = v; (*ref)[k] = v;
+    } else if (o < 7) {
+      ASSERT_EQ(map->erase(k), ref->erase(k)) << "erase " << k;
+    } else {
+      auto it = map->find(k);
+      auto rit = ref->find(k);
+      ASSERT_EQ(it == map->end(), rit == ref->end()) << "find " << k;
+      if (rit != ref->end()) {
+        EXPECT_EQ(it->second, rit->second);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(FlatHashMap, RandomOps) {
+  std::mt19937_64 gen(0);
+  Map map;
+  Ref ref;
+  // a small key range, so the probe sequences are long and erasing shifts
+  // many slots back
+  for (int r = 0; r < 20; ++r) {
+    RandomOps(&gen, 100000, 5000, &map, &ref);
+    ExpectSame(map, ref);
+    map.reserve(map.size() * 4);
+    ExpectSame(map, ref);
+    map.shrink_to_fit();
+    ExpectSame(map, ref);
+  }
+  map.clear(); ref.clear();
+  ExpectSame(map, ref);
+}
+
+TEST(FlatHashMap, EraseWhileIterating) {
+  std::mt19937_64 gen(1);
+  Map map;
+  Ref ref;
+  RandomOps(&gen, 50000, 5000, &map, &ref);
+  // the element shifted into an erased slot is visited next
+  size_t visited = 0, size = map.size();
+  for (auto it = map.begin(); it != map.end(); ) {
+    ++ visited;
+    if (it->second & 1) {
+      ref.erase(it->first);
+      it = map.erase(it);
+    } else {
+      ++ it;
+    }
+  }
+  EXPECT_GE(visited, size);
+  for (const auto& s : map) EXPECT_EQ(s.second & 1, (uint64)0);
+  ExpectSame(map, ref);
+}
+
+TEST(FlatHashMap, MaxKey) {
+  Map map;
+  EXPECT_TRUE(map.find(kLastKey) == map.end());
+  EXPECT_EQ(map.erase(kLastKey), (size_t)0);
+  map[kLastKey] = 7;
+  EXPECT_EQ(map.size(), (size_t)1);
+  EXPECT_EQ(map.capacity(), (size_t)0);
+  ASSERT_TRUE(map.begin() != map.end());
+  EXPECT_EQ(map.begin()->first, kLastKey);
+  EXPECT_EQ(map.begin()->second, (uint64)7);
+  map[1] = 1;
+  map.reserve(1000);
+  EXPECT_EQ(map.find(kLastKey)->second, (uint64)7);
+  EXPECT_EQ(map.erase(kLastKey), (size_t)1);
+  EXPECT_TRUE(map.find(kLastKey) == map.end());
+  // a value inserted again starts as a default one
+  EXPECT_EQ(map[kLastKey], (uint64)0);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.find(kLastKey) == map.end());
+}
+
+TEST(FlatHashMap, BackwardShift) {
+  Map map;
+  map.reserve(100);
+  size_t cap = map.capacity();
+  // the keys whose home is slot 0
+  std::vector<uint64> same;
+  for (uint64 k = 0; same.size() < 8 && k < 1000000; ++k) {
+    Map one;
+    one.reserve(100);
+    ASSERT_EQ(one.capacity(), cap);
+    one[k] = 0;
+    if (one.begin().pos() == 0) same.push_back(k);
+  }
+  ASSERT_EQ(same.size(), (size_t)8);
+  for (uint64 k : same) map[k] = k;
+  // they occupy slots 0..7, erasing the first one shifts the others back
+  for (size_t i = 0; i < same.size(); ++i) {
+    ASSERT_EQ(map.erase(same[i]), (size_t)1);
+    for (size_t j = i + 1; j < same.size(); ++j) {
+      EXPECT_EQ(map.find(same[j]).pos(), j - i - 1);
+      EXPECT_EQ(map.find(same[j])->second, same[j]);
+    }
+  }
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.capacity(), cap);
+}
+
+TEST(FlatHashMap, Move) {
+  Map a;
+  Ref ref;
+  for (uint64 k = 0; k < 100; ++k) a[k] = ref[k] = k * 3;
+  a[kLastKey] = ref[kLastKey] = 1;
+
+  Map b(std::move(a));
+  ExpectSame(b, ref);
+  // the source is left empty and usable
+  ExpectSame(a, Ref());
+  EXPECT_EQ(a.capacity(), (size_t)0);
+  EXPECT_TRUE(a.find(5) == a.end());
+  EXPECT_TRUE(a.find(kLastKey) == a.end());
+  a[5] = 5;
+  ExpectSame(a, Ref{{5, 5}});
+
+  a = std::move(b);
+  ExpectSame(a, ref);
+  ExpectSame(b, Ref());
+  EXPECT_TRUE(b.find(kLastKey) == b.end());
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include "base/common.h"
+#include "ps/future.h"
+
+using namespace ps;
+
+namespace {
+
+/// a value counting its copies, which the chains should never make
+struct Value {
+  Value() { }
+  explicit Value(int x) : v(1, x) { }
+  Value(Value&&) = default;
+  Value& operator=(Value&&) = default;
+  Value(const Value& rhs) : v(rhs.v) { ++ copies; }
+  Value& operator=(const Value& rhs) { v = rhs.v; ++ copies; return *this; }
+  std::vector<int> v;
+  static std::atomic<int> copies;
+};
+std::atomic<int> Value::copies{0};
+
+/// runs each function by a new thread, which are joined at the end
+class Threads {
+ public:
+  ~Threads() { Join(); }
+  CallbackExecutor Executor() {
+    return [this](const std::function<void()>& f) { Run(f); };
+  }
+  void Run(const std::function<void()>& f) {
+    std::lock_guard<std::mutex> lk(mu_);
+    ++ runs_;
+    threads_.emplace_back(f);
+  }
+  void Join() {
+    while (true) {
+      std::vector<std::thread> t;
+      {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (threads_.empty()) return;
+        t.swap(threads_);
+      }
+      for (auto& x : t) x.join();
+    }
+  }
+  int runs() { std::lock_guard<std::mutex> lk(mu_); return runs_; }
+ private:
+  std::mutex mu_;
+  std::vector<std::thread> threads_;
+  int runs_ = 0;
+};
+
+}  // namespace
+
+/// a chain of values, nothing, futures and executors
+TEST(Future, Chain) {
+  Threads threads;
+  auto exec = threads.Executor();
+  Promise<Value> p;
+  auto f = p.GetFuture()
+      .Then([](Value&& x) { x.v.push_back(2); return std::move(x); }, exec)
+      .Then([&threads](Value&& x) {
+          // a continuation returning a future, which is unwrapped
+          Promise<int> q;
+          int n = (int)x.v.size();
+          threads.Run([q, n]() { q.Set(n + 40); });
+          return q.GetFuture();
+        })
+      .Then([](int x) { EXPECT_EQ(x, 42); }, exec)
+      .Then([]() { return 7; });
+  EXPECT_FALSE(p.GetFuture().ready());
+  p.Set(Value(1));
+  EXPECT_EQ(f.Get(), 7);
+  EXPECT_EQ(threads.runs(), 3);
+  EXPECT_EQ(Value::copies.load(), 0);
+}
+
+/// a continuation without an executor runs by the thread setting the value,
+/// or by the calling thread if the value is already set
+TEST(Future, Inline) {
+  auto me = std::this_thread::get_id();
+  std::thread::id ran;
+  auto f = MakeReadyFuture(3).Then([&ran](int x) {
+      ran = std::this_thread::get_id(); return x + 1; });
+  EXPECT_TRUE(ran == me);
+  EXPECT_TRUE(f.ready());
+  EXPECT_EQ(f.Get(), 4);
+
+  Promise<void> p;
+  auto g = p.GetFuture().Then([&ran]() { ran = std::this_thread::get_id(); });
+  std::thread setter([p]() { p.Set(); });
+  auto setter_id = setter.get_id();
+  setter.join();
+  g.Wait();
+  EXPECT_TRUE(ran == setter_id);
+  EXPECT_TRUE(g.ready());
+}
+
+/// the values in the order of the futures, set in another order
+TEST(Future, WhenAll) {
+  const int n = 10;
+  std::vector<Promise<int>> p(n);
+  std::vector<Future<int>> f;
+  for (auto& x : p) f.push_back(x.GetFuture());
+  auto all = WhenAll(f);
+  std::vector<std::thread> setters;
+  for (int i = n - 1; i >= 0; --i) {
+    Promise<int> x = p[i];
+    setters.emplace_back([x, i]() { x.Set(i * i); });
+  }
+  for (auto& t : setters) t.join();
+  auto v = all.Get();
+  EXPECT_EQ(v.size(), (size_t)n);
+  for (int i = 0; i < n; ++i) EXPECT_EQ(v[i], i * i);
+
+  // none, and void ones of which some are ready
+  EXPECT_TRUE(WhenAll(std::vector<Future<int>>()).Get().empty());
+  Promise<void> pv;
+  std::vector<Future<void>> fv = {pv.GetFuture(), MakeReadyFuture()};
+  auto av = WhenAll(fv).Then([](std::vector<Unit> u) { return u.size(); });
+  EXPECT_FALSE(av.ready());
+  pv.Set();
+  EXPECT_EQ(av.Get(), (size_t)2);
+}
+
+/// sets the values while the continuations are being attached
+TEST(Future, Race) {
+  for (int r = 0; r < 1000; ++r) {
+    Promise<Value> p;
+    auto f = p.GetFuture();
+    std::thread setter([p, r]() { p.Set(Value(r)); });
+    auto g = f.Then([](Value&& x) { return x.v[0] + 1; });
+    setter.join();
+    ASSERT_EQ(g.Get(), r + 1);
+  }
+  EXPECT_EQ(Value::copies.load(), 0);
+}
@@ -0,0 +1,196 @@
+// the conversions of floats from and into fp16 and bf16. built with
+// EXTRA_CFLAGS=-march=native, the F16C and AVX2 paths are checked as well
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "base/common.h"
+#include "base/half.h"
+
+using namespace ps;
+
+namespace {
+
+/// number of encodings per value of the rounding checks
+const int kSamples = 100000;
+
+const char* Name(FloatFormat fmt) { return fmt == kFloat16 ? "fp16" : "bf16"; }
+
+float Bits(uint32 x) { float f; memcpy(&f, &x, sizeof(f)); return f; }
+
+// the format is a template argument, so the float paths, which would overrun
+// the 16-bit buffers, are known to be unused
+
+/// decodes one value, by the scalar path
+template <FloatFormat fmt>
+float Decode(uint16 h) {
+  float f;
+  DecodeFloats(fmt, &h, 1, &f);
+  return f;
+}
+
+/// encodes \a n copies of \a x, the first 8k ones by the vector path if any
+template <FloatFormat fmt>
+std::vector<uint16> Encode(float x, int n) {
+  std::vector<float> in(n, x);
+  std::vector<uint16> out(n);
+  EncodeFloats(fmt, in.data(), n, out.data());
+  return out;
+}
+
+/// the value of a half by its definition
+double HalfValue(uint16 h) {
+  int e = (h >> 10) & 0x1F, m = h & 0x3FF;
+  double v = e == 0 ? std::ldexp(m, -24) : std::ldexp(1024 + m, e - 25);
+  return h & 0x8000 ? -v : v;
+}
+
+/// all patterns are decoded to their values, and encoded back to themselves
+template <FloatFormat fmt>
+void TestRoundTrip() {
+  std::vector<uint16> h(1 << 16), back(1 << 16);
+  for (size_t i = 0; i < h.size(); ++i) h[i] = (uint16)i;
+  std::vector<float> f(h.size());
+  // the vector path, and the scalar one one by one
+  DecodeFloats(fmt, h.data(), (int)h.size(), f.data());
+  for (size_t i = 0; i < h.size(); ++i) {
+    float g = Decode<fmt>(h[i]);
+    ASSERT_EQ(memcmp(&g, &f[i], sizeof(g)), 0) << Name(fmt) << " " << i;
+  }
+  for (int r = 0; r < 2; ++r) {
+    if (r == 0) {
+      EncodeFloats(fmt, f.data(), (int)f.size(), back.data());
+    } else {
+      for (size_t i = 0; i < f.size(); ++i) EncodeFloats(fmt, &f[i], 1, &back[i]);
+    }
+    for (size_t i = 0; i < h.size(); ++i) {
+      bool nan = std::isnan(f[i]);
+      if (fmt == kFloat16) {
+        int e = (i >> 10) & 0x1F, m = i & 0x3FF;
+        ASSERT_EQ(nan, e == 0x1F && m != 0) << i;
+        if (e == 0x1F && m == 0) {
+          ASSERT_TRUE(std::isinf(f[i])) << i;
+        } else if (!nan) {
+          ASSERT_EQ((double)f[i], HalfValue(h[i])) << i;
+        }
+      } else {
+        uint32 bits = (uint32)i << 16;
+        ASSERT_EQ(memcmp(&f[i], &bits, sizeof(bits)), 0) << i;
+      }
+      if (nan) {
+        // the payload may be quieted, but the sign and nan-ness are kept
+        ASSERT_TRUE(std::isnan(Decode<fmt>(back[i]))) << Name(fmt) << " " << i;
+        ASSERT_EQ(back[i] & 0x8000, h[i] & 0x8000);
+      } else {
+        ASSERT_EQ(back[i], h[i]) << Name(fmt) << " " << i;
+      }
+    }
+  }
+}
+
+/**
+ * the encodings of \a x are its two neighbors in \a fmt, rounded up with the
+ * probability of the distance to the lower one
+ */
+template <FloatFormat fmt>
+void TestRounding(float x) {
+  int n = kSamples / 8 * 8 + 3;
+  auto h = Encode<fmt>(x, n);
+  double lo = -INFINITY, hi = INFINITY;
+  double sum = 0;
+  for (uint16 v : h) {
+    double d = Decode<fmt>(v);
+    if (d <= x) lo = std::max(lo, d); else hi = std::min(hi, d);
+    sum += d;
+  }
+  // at most two values, the neighbors of x
+  for (uint16 v : h) {
+    double d = Decode<fmt>(v);
+    ASSERT_TRUE(d == lo || d == hi) << Name(fmt) << " " << x << " -> " << d;
+  }
+  if (lo == x) {
+    ASSERT_EQ(hi, INFINITY) << Name(fmt) << " " << x << " is exact";
+    return;
+  }
+  double gap = std::fabs(hi - lo);
+  ASSERT_LT(gap, std::fabs(x) * (fmt == kFloat16 ? 1.0 / 512 : 1.0 / 64) +
+           (fmt == kFloat16 ? 1e-7 : 1e-38)) << Name(fmt) << " " << x;
+  // the mean is within 5 sigma of x, the sigma of a bernoulli is at most 1/2
+  double mean = sum / n;
+  ASSERT_LT(std::fabs(mean - x), 5 * 0.5 * gap / std::sqrt(n))
+      << Name(fmt) << " " << x << ", mean " << mean << " in [" << lo << ", "
+      << hi << "]";
+}
+
+/// out of range values saturate at the largest finite ones, inf and nan are
+/// kept
+template <FloatFormat fmt>
+void TestOverflow() {
+  float max = fmt == kFloat16 ? 65504.0f : Bits(0x7F7F0000);
+  std::vector<float> big = {max, 65519.0f, 65520.0f, 1e6f, 1e30f, Bits(0x7F7F8000),
+                            std::numeric_limits<float>::max()};
+  for (float b : big) {
+    for (float x : {b, -b}) {
+      for (uint16 v : Encode<fmt>(x, 67)) {
+        float d = Decode<fmt>(v);
+        ASSERT_TRUE(std::isfinite(d)) << Name(fmt) << " " << x << " -> " << d;
+        ASSERT_LE(std::fabs(d), max) << Name(fmt) << " " << x;
+        ASSERT_EQ(std::signbit(d), std::signbit(x));
+      }
+    }
+  }
+  for (float x : {INFINITY, -INFINITY}) {
+    for (uint16 v : Encode<fmt>(x, 67)) ASSERT_EQ(Decode<fmt>(v), x) << Name(fmt);
+  }
+  for (float x : {NAN, -NAN, Bits(0x7F800001), Bits(0xFFC00001)}) {
+    for (uint16 v : Encode<fmt>(x, 67)) {
+      ASSERT_TRUE(std::isnan(Decode<fmt>(v))) << Name(fmt) << " " << x;
+    }
+  }
+}
+
+/// a sum of updates of 1/10 of the gap in [1, 2), which rounding to the
+/// nearest loses. the tolerances are 4 sigma
+template <FloatFormat fmt>
+void TestSum() {
+  float step = fmt == kFloat16 ? 1e-4 : 1e-3;
+  float w = 1;
+  uint16 h;
+  EncodeFloats(fmt, &w, 1, &h);
+  for (int i = 0; i < (int)(1 / step); ++i) {
+    float x = Decode<fmt>(h) + step;
+    EncodeFloats(fmt, &x, 1, &h);
+  }
+  ASSERT_LT(std::fabs(Decode<fmt>(h) - 2), fmt == kFloat16 ? .2 : .5)
+      << Name(fmt) << " " << Decode<fmt>(h);
+}
+
+}  // namespace
+
+TEST(Half, RoundTrip) {
+  TestRoundTrip<kFloat16>();
+  TestRoundTrip<kBFloat16>();
+}
+
+TEST(Half, Overflow) {
+  TestOverflow<kFloat16>();
+  TestOverflow<kBFloat16>();
+}
+
+TEST(Half, Rounding) {
+  // normal values, and exact ones
+  for (float x : {1.0f, 1.1f, -1.1f, 1.0f / 3, 3e-3f, -2.7f, 1234.567f}) {
+    TestRounding<kFloat16>(x);
+    TestRounding<kBFloat16>(x);
+  }
+  // the subnormal numbers of fp16, and of floats, which are the ones of bf16
+  for (float x : {6e-5f, 1e-7f, -3e-8f, 1e-9f, 3e-10f}) TestRounding<kFloat16>(x);
+  for (float x : {Bits(0x00400000), -Bits(0x00012345)}) {
+    TestRounding<kBFloat16>(x);
+  }
+}
+
+TEST(Half, Sum) {
+  TestSum<kFloat16>();
+  TestSum<kBFloat16>();
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <map>
+#include "kv/kv_aggregator.h"
+#include "kv/kv_store_sparse.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+
+/// \a n values of a key per request, small integers so the sums are exact
+std::vector<float> SmallValues(std::mt19937* gen, size_t n) {
+  std::vector<float> val(n);
+  for (auto& v : val) v = (float)((*gen)() % 21) - 10;
+  return val;
+}
+
+}  // namespace
+
+TEST(KVAggregator, Sum) {
+  // the pushes of a cmd are summed per key in the order of the first push,
+  // and a shorter value is padded with zeros
+  KVAggregator<Key, float> aggr;
+  std::vector<float> a = {1, 2, 3}, b = {10}, c = {100, 200};
+  Key k[] = {7, 3};
+  Blob<const float> v0[] = {Blob<const float>(b.data(), 1),
+                            Blob<const float>(a.data(), 3)};
+  aggr.Add(0, 2, k, v0);
+  Blob<const float> v1[] = {Blob<const float>(a.data(), 3),
+                            Blob<const float>(c.data(), 2)};
+  aggr.Add(0, 2, k, v1);
+  aggr.Add(1, 1, k, v1);
+  EXPECT_EQ(aggr.added(), (size_t)5);
+
+  std::map<int, std::vector<std::vector<float>>> sum;
+  std::map<int, std::vector<Key>> key;
+  for (int cmd : {0, 1}) {
+    aggr.Take(cmd, [&](size_t n, const Key* k, const Blob<const float>* v) {
+        for (size_t i = 0; i < n; ++i) {
+          key[cmd].push_back(k[i]);
+          sum[cmd].emplace_back(v[i].data, v[i].data + v[i].size);
+        }
+      });
+  }
+  EXPECT_TRUE(key[0] == std::vector<Key>({7, 3}));
+  EXPECT_TRUE(sum[0][0] == std::vector<float>({11, 2, 3}));
+  EXPECT_TRUE(sum[0][1] == std::vector<float>({101, 202, 3}));
+  EXPECT_TRUE(key[1] == std::vector<Key>({7}));
+  EXPECT_TRUE(sum[1][0] == a);
+  EXPECT_EQ(aggr.applied(), (size_t)3);
+
+  // taken once
+  size_t n = 0;
+  aggr.Take(0, [&n](size_t m, const Key*, const Blob<const float>*) { n += m; });
+  EXPECT_EQ(n, (size_t)0);
+}
+
+TEST(KVAggregator, Store) {
+  // a store summing the pushes of 5 requests has the values of a store
+  // applying them one by one at the end of every window, and pulls within a
+  // window see the values at its start
+  Sparse store(TestHandle(), 2, 4), ref(TestHandle(), 2, 4);
+  store.SetAggregation(5, 0);
+  auto all = TestKeys(3000, 0);
+  std::vector<Key> hot(all.begin(), all.begin() + 20);
+  std::mt19937 gen(0);
+  auto start = ref.Pull(all);
+  for (int r = 0; r < 48; ++r) {
+    // the hot keys, and some others, with one or two values per key
+    std::vector<Key> key;
+    for (size_t i = 0; i < all.size(); ++i) {
+      if (i < hot.size() || gen() % 10 == 0) key.push_back(all[i]);
+    }
+    auto val = SmallValues(&gen, key.size() * (r % 3 ? 2 : 1));
+    store.Push(key, val);
+    ref.Push(key, val);
+    if ((r + 1) % 5 == 0) start = ref.Pull(all);
+    ASSERT_TRUE(store.Pull(all) == start) << "request " << r;
+  }
+  // the last window is applied by a flush
+  EXPECT_FALSE(store.Pull(all) == ref.Pull(all));
+  store.FlushPushes();
+  EXPECT_TRUE(store.Pull(all) == ref.Pull(all));
+}
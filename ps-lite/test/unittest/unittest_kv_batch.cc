@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include "kv/kv_batch.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+template <typename M, typename H>
+struct Types {
+  typedef M Map;
+  typedef H Handle;
+};
+
+template <typename T>
+class KVBatchTest : public testing::Test {
+ protected:
+  typedef typename T::Map Map;
+  typedef typename T::Handle Handle;
+
+  ~KVBatchTest() { if (cold_.size()) unlink(cold_.c_str()); }
+
+  /// evicts the keys not requested for \a ttl keys, into a cold tier if \a
+  /// cold
+  void Init(int ttl, bool cold) {
+    KVEvictionConf conf;
+    conf.ttl = ttl;
+    conf.tick_keys = 1;
+    if (cold) {
+      cold_ = TestFile("kv_batch_cold");
+      batch_.cold.Open(cold_);
+    }
+    batch_.eviction.Init(conf, 0, &mu_, cold ? &batch_.cold : nullptr);
+  }
+
+  void Push(const std::vector<Key>& key) {
+    std::vector<float> val;
+    for (Key k : key) { val.push_back(TestValue(k, 0)); val.push_back(TestValue(k, 1)); }
+    batch_.push.clear();
+    for (size_t i = 0; i < key.size(); ++i) {
+      batch_.push.push_back(Blob<const float>(val.data() + i * 2, 2));
+    }
+    batch_.Push(handle_, data_, key.size(), key.data(), batch_.push.data());
+  }
+
+  /// pulls \a key into buffers as a store thread does, and reads the values
+  /// only after the pull returns
+  std::vector<float> Pull(const std::vector<Key>& key) {
+    size_t n = key.size();
+    batch_.val.assign(n * 2, -1);
+    batch_.pull.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      batch_.pull[i] = Blob<float>(batch_.val.data() + i * 2, 2);
+    }
+    batch_.Pull(handle_, data_, n, key.data(), batch_.pull.data());
+    std::vector<float> val;
+    for (const auto& p : batch_.pull) {
+      EXPECT_EQ(p.size, (size_t)2);
+      val.insert(val.end(), p.data, p.data + p.size);
+    }
+    return val;
+  }
+
+  /// m distinct keys in [0, range)
+  std::vector<Key> Sample(size_t m, Key range) {
+    std::unordered_set<Key> s;
+    while (s.size() < m) s.insert(gen_() % range);
+    return std::vector<Key>(s.begin(), s.end());
+  }
+
+  KVBatch<Key, TestEntry, float, Handle, Map> batch_;
+  Map data_;
+  Handle handle_;
+  std::mutex mu_;
+  std::string cold_;
+  std::mt19937_64 gen_{0};
+};
+
+typedef testing::Types<
+  Types<std::unordered_map<Key, TestEntry>, TestHandle>,
+  Types<std::unordered_map<Key, TestEntry>, TestBatchHandle>,
+  Types<FlatHashMap<Key, TestEntry>, TestHandle>,
+  Types<FlatHashMap<Key, TestEntry>, TestBatchHandle>> AllTypes;
+
+}  // namespace
+
+TYPED_TEST_SUITE(KVBatchTest, AllTypes);
+
+TYPED_TEST(KVBatchTest, PullWhileEvicting) {
+  // every key not in the current request is expired, so the sweeps erase and
+  // move entries all the time, while the pulled values point into entries
+  this->Init(1, false);
+  const Key range = 3000;
+  for (int r = 0; r < 300; ++r) {
+    this->Push(this->Sample(40, range));
+    auto key = this->Sample(60, range);
+    auto val = this->Pull(key);
+    for (size_t i = 0; i < key.size(); ++i) {
+      // the value of the key pushed c times, c is 0 if evicted
+      float c = val[i * 2 + 1] - val[i * 2];
+      EXPECT_EQ(val[i * 2], c * TestValue(key[i], 0)) << "key " << key[i];
+    }
+  }
+}
+
+TYPED_TEST(KVBatchTest, PullWhileDemoting) {
+  // the evicted entries are demoted into the cold tier, and promoted by the
+  // pulls, so every value pulled is the one of its key
+  this->Init(1, true);
+  const Key range = 3000;
+  std::vector<Key> all(range);
+  for (Key k = 0; k < range; ++k) all[k] = k;
+  this->Push(all);
+  for (int r = 0; r < 300; ++r) {
+    auto key = this->Sample(60, range);
+    auto val = this->Pull(key);
+    for (size_t i = 0; i < key.size(); ++i) {
+      ASSERT_EQ(val[i * 2], TestValue(key[i], 0)) << "key " << key[i];
+      ASSERT_EQ(val[i * 2 + 1], TestValue(key[i], 1)) << "key " << key[i];
+    }
+  }
+  EXPECT_GT(this->batch_.cold.stats().demoted, (size_t)0);
+  EXPECT_GT(this->batch_.cold.stats().cold, (size_t)0);
+}
+
+TYPED_TEST(KVBatchTest, PullsKeepKeys) {
+  // the keys only pulled are kept, the others are evicted
+  this->Init(200, false);
+  const Key range = 3000;
+  std::vector<Key> all(range);
+  for (Key k = 0; k < range; ++k) all[k] = k;
+  this->Push(all);
+  auto hot = this->Sample(50, range);
+  for (int r = 0; r < 200; ++r) {
+    auto val = this->Pull(hot);
+    for (size_t i = 0; i < hot.size(); ++i) {
+      ASSERT_EQ(val[i * 2], TestValue(hot[i], 0)) << "key " << hot[i];
+    }
+  }
+  EXPECT_EQ(this->data_.size(), hot.size());
+  for (Key k : hot) EXPECT_EQ(this->data_.count(k), (size_t)1) << "key " << k;
+}
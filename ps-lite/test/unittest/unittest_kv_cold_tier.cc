@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <unordered_map>
+#include "kv/kv_cold_tier.h"
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+/// an entry of 1 KB whose floats tell its key
+struct BigEntry {
+  std::vector<float> w;
+  void Fill(Key key, int version) {
+    w.resize(256);
+    for (size_t i = 0; i < w.size(); ++i) w[i] = TestValue(key, i) + version;
+  }
+  void Save(dmlc::Stream* fo) const { fo->Write(w); }
+  void Load(dmlc::Stream* fi) { CHECK(fi->Read(&w)); }
+};
+
+/// the entries of \a key in \a tier, read with Get, are the ones in \a expect
+void ExpectIn(const KVColdTier<Key, BigEntry>& tier,
+              const std::unordered_map<Key, int>& expect) {
+  for (const auto& it : expect) {
+    BigEntry e, f;
+    ASSERT_TRUE(tier.Get(it.first, &e)) << "key " << it.first;
+    f.Fill(it.first, it.second);
+    ASSERT_TRUE(e.w == f.w) << "key " << it.first;
+  }
+}
+
+/**
+ * pushes \a key to \a store and \a ref in \a rounds, pulling some keys
+ * between, and checks the values of \a store with the tier are the ones of
+ * \a ref without it
+ */
+template <typename Store>
+void CompareWithoutTier(Store* store, Store* ref) {
+  auto key = TestKeys(20000, 0);
+  std::mt19937 gen(0);
+  for (int r = 0; r < 5; ++r) {
+    std::vector<Key> some;
+    for (Key k : key) if (gen() % 3 == 0) some.push_back(k);
+    for (Store* s : {store, ref}) s->Push(some, TestValues(some));
+    some.clear();
+    for (Key k : key) if (gen() % 10 == 0) some.push_back(k);
+    ASSERT_TRUE(store->Pull(some) == ref->Pull(some)) << "round " << r;
+  }
+  auto s = store->GetTierStats();
+  EXPECT_GT(s.demoted, (size_t)0);
+  EXPECT_GT(s.cold, (size_t)0);
+  EXPECT_GT(s.cold_keys, (size_t)0);
+  EXPECT_TRUE(store->Pull(key) == ref->Pull(key));
+
+  // the saved model has the entries of both tiers
+  std::string file = TestFile("kv_cold_tier_model");
+  {
+    std::unique_ptr<dmlc::Stream> fo(dmlc::Stream::Create(file.c_str(), "w"));
+    store->Save(fo.get());
+  }
+  Single loaded(TestHandle(), 2);
+  loaded.LoadFile(file, false);
+  EXPECT_TRUE(loaded.Pull(key) == ref->Pull(key));
+  unlink(file.c_str());
+}
+
+}  // namespace
+
+TEST(KVColdTier, RoundTrip) {
+  // the records are read from the write buffer and from the mapped file, and
+  // the file, over 64 MB, is rewritten once most records are taken
+  std::string file = TestFile("kv_cold_tier");
+  KVColdTier<Key, BigEntry> tier;
+  tier.Open(file);
+  ASSERT_TRUE(tier.enabled());
+  std::unordered_map<Key, int> expect;
+  auto key = TestKeys(100000, 0);
+  for (Key k : key) {
+    BigEntry e;
+    e.Fill(k, 0);
+    tier.Put(k, e);
+    expect[k] = 0;
+  }
+  ExpectIn(tier, expect);
+  size_t bytes = tier.stats().file_bytes;
+  EXPECT_GT(bytes, key.size() * 1024);
+
+  // take 7 of 8, and then put back 1 of 8 with new values
+  for (size_t i = 0; i < key.size(); ++i) {
+    if (i % 8 == 0) continue;
+    BigEntry e, f;
+    ASSERT_TRUE(tier.Take(key[i], &e));
+    f.Fill(key[i], 0);
+    ASSERT_TRUE(e.w == f.w);
+    EXPECT_FALSE(tier.Take(key[i], &e));
+    expect.erase(key[i]);
+  }
+  EXPECT_LT(tier.stats().file_bytes, bytes / 4);
+  ExpectIn(tier, expect);
+  for (size_t i = 1; i < key.size(); i += 8) {
+    BigEntry e;
+    e.Fill(key[i], 1);
+    tier.Put(key[i], e);
+    expect[key[i]] = 1;
+  }
+  EXPECT_EQ(tier.stats().cold_keys, expect.size());
+  ExpectIn(tier, expect);
+
+  // erase, and visit the others
+  tier.Erase(key[0]);
+  expect.erase(key[0]);
+  size_t n = 0;
+  tier.ForEach([&expect, &n](Key k, const BigEntry& e) {
+      BigEntry f;
+      f.Fill(k, expect.at(k));
+      EXPECT_TRUE(e.w == f.w) << "key " << k;
+      ++ n;
+    });
+  EXPECT_EQ(n, expect.size());
+
+  // the file is removed with the tier
+  tier = KVColdTier<Key, BigEntry>();
+  EXPECT_NE(access(file.c_str(), F_OK), 0);
+}
+
+TEST(KVColdTier, SingleThread) {
+  Single store(TestHandle(), 2), ref(TestHandle(), 2);
+  KVTierConf conf;
+  conf.path = TestFile("kv_cold_tier_st");
+  conf.hot_keys = 2000;
+  store.SetTier(conf);
+  CompareWithoutTier(&store, &ref);
+}
+
+TEST(KVColdTier, MultiThread) {
+  Sparse store(TestHandle(), 2, 4), ref(TestHandle(), 2, 4);
+  KVTierConf conf;
+  conf.path = TestFile("kv_cold_tier_mt");
+  conf.hot_keys = 2000;
+  store.SetTier(conf);
+  CompareWithoutTier(&store, &ref);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "kv/kv_store_column.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+/// an entry of the column store, a plain struct of floats
+struct ColumnEntry {
+  float w = 0;
+  float sq = 0;
+  bool Empty() const { return w == 0; }
+  void Save(dmlc::Stream* fo) const { fo->Write(this, sizeof(*this)); }
+  void Load(dmlc::Stream* fi) {
+    CHECK_EQ(fi->Read(this, sizeof(*this)), sizeof(*this));
+  }
+};
+
+/**
+ * an adagrad-like update applied by key, and by columns, which also checks
+ * the columns are aligned as the column store promises
+ */
+struct ColumnHandle {
+  void Start(bool push, int timestamp, int cmd, void* msg) { }
+  void Finish() { }
+  void Push(Key key, Blob<const float> grad, ColumnEntry& e) {
+    Update(grad[0], &e.w, &e.sq);
+  }
+  void PushColumns(size_t n, const float* grad, float* const* col) {
+    for (int c = 0; c < 2; ++c) EXPECT_EQ((uintptr_t)col[c] % 16, (uintptr_t)0);
+    for (size_t i = 0; i < n; ++i) Update(grad[i], &col[0][i], &col[1][i]);
+  }
+  void Pull(Key key, const ColumnEntry& e, Blob<float>& val) {
+    val[0] = e.w; val[1] = e.sq;
+  }
+  void Load(dmlc::Stream* fi) { }
+  void Save(dmlc::Stream* fo) const { }
+
+  static void Update(float g, float* w, float* sq) {
+    *sq += g * g;
+    *w -= g / (1 + *sq);
+  }
+};
+
+/**
+ * the column store with \a nt buckets gives the same values as the sparse
+ * store, which pushes key by key. the keys spread over all the buckets, and
+ * some of them are pushed to zero
+ */
+void CompareWithSparse(int nt) {
+  TestStore<KVStoreColumn<Key, ColumnEntry, float, ColumnHandle>> column(
+      ColumnHandle(), 2, nt);
+  TestStore<KVStoreSparseST<Key, ColumnEntry, float, ColumnHandle>> sparse(
+      ColumnHandle(), 2);
+  std::mt19937_64 gen(nt);
+  std::vector<Key> all(500);
+  for (auto& k : all) k = gen();
+  for (int r = 0; r < 100; ++r) {
+    std::vector<Key> key;
+    for (Key k : all) if (gen() % 3 == 0) key.push_back(k);
+    std::sort(key.begin(), key.end());
+    key.erase(std::unique(key.begin(), key.end()), key.end());
+    std::vector<float> grad(key.size());
+    for (auto& g : grad) g = (float)(gen() % 200) / 100 - 1;
+    column.Push(key, grad);
+    sparse.Push(key, grad);
+  }
+  std::sort(all.begin(), all.end());
+  all.erase(std::unique(all.begin(), all.end()), all.end());
+  EXPECT_TRUE(column.Pull(all) == sparse.Pull(all));
+}
+
+}  // namespace
+
+TEST(KVColumn, SingleBucket) {
+  CompareWithSparse(1);
+}
+
+TEST(KVColumn, Buckets) {
+  CompareWithSparse(4);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+
+/**
+ * compacts \a store all the time while the keys are pushed, and the even ones
+ * pushed back to empty entries, which the compaction removes
+ */
+template <typename Store>
+void CompactWhilePushing(Store* store) {
+  const int rounds = 200;
+  std::vector<Key> key(1000), even;
+  std::vector<float> val, neg;
+  for (Key k = 0; k < key.size(); ++k) {
+    key[k] = k;
+    val.push_back(TestValue(k, 0)); val.push_back(TestValue(k, 1));
+    if (k % 2) continue;
+    even.push_back(k);
+    neg.push_back(-TestValue(k, 0)); neg.push_back(-TestValue(k, 1));
+  }
+  std::atomic<bool> done(false);
+  std::thread compact([store, &done]() {
+      while (!done) store->Compact();
+    });
+  for (int r = 0; r < rounds; ++r) {
+    store->Push(key, val);
+    store->Push(even, neg);
+  }
+  done = true;
+  compact.join();
+
+  auto pulled = store->Pull(key);
+  for (Key k : key) {
+    float c = k % 2 ? rounds : 0;
+    EXPECT_EQ(pulled[k * 2], c * TestValue(k, 0)) << "key " << k;
+    EXPECT_EQ(pulled[k * 2 + 1], c * TestValue(k, 1)) << "key " << k;
+  }
+}
+
+}  // namespace
+
+TEST(KVCompact, SingleThread) {
+  TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> store(
+      TestHandle(), 2);
+  CompactWhilePushing(&store);
+}
+
+TEST(KVCompact, MultiThread) {
+  TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> store(
+      TestHandle(), 2, 4);
+  CompactWhilePushing(&store);
+}
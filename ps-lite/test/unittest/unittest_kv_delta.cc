@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <set>
+#include "kv/kv_delta.h"
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+class KVDeltaTest : public testing::Test {
+ protected:
+  KVDeltaTest() : key_(TestKeys(6000, 0)) {
+    for (const char* m : {"base", "delta-1", "delta-2", "folded"}) {
+      name_.push_back(TestFile(std::string("kv_delta_") + m));
+    }
+  }
+
+  ~KVDeltaTest() { for (const auto& n : name_) unlink(n.c_str()); }
+
+  /// the keys whose index modulo \a m is \a r
+  std::vector<Key> Keys(int m, int r) const {
+    std::vector<Key> key;
+    for (size_t i = r; i < key_.size(); i += m) key.push_back(key_[i]);
+    return key;
+  }
+
+  /**
+   * saves a base model and two deltas of \a store. the deltas update, add,
+   * delete, and add back keys, and the second one also deletes keys which the
+   * first one adds
+   */
+  template <typename Store>
+  void SaveChain(Store* store) {
+    store->TrackChanges();
+    auto base = Keys(2, 0);
+    store->Push(base, TestValues(base));
+    store->SaveIndexed(name_[0]);
+    store->ClearChanges();
+
+    auto add = Keys(4, 1), del = Keys(6, 0);
+    store->Push(Keys(10, 0), TestValues(Keys(10, 0)));
+    store->Push(add, TestValues(add));
+    store->Push(del, Pulled(store, del));
+    store->SaveDelta(name_[1], name_[0]);
+
+    auto back = Keys(12, 0), del2 = Keys(8, 1);
+    store->Push(back, TestValues(back, 3));
+    store->Push(del2, Pulled(store, del2));
+    store->SaveDelta(name_[2], name_[1]);
+  }
+
+  /// the negated values of \a key in \a store, which empty them if pushed
+  template <typename Store>
+  static std::vector<float> Pulled(Store* store, const std::vector<Key>& key) {
+    auto val = store->Pull(key);
+    for (auto& v : val) v = -v;
+    return val;
+  }
+
+  /// loads \a name by both stores, eagerly and lazily, and checks the values
+  void CheckLoad(const std::string& name, const std::vector<float>& expect) {
+    for (bool lazy : {false, true}) {
+      Sparse s(TestHandle(), 2, 3);
+      s.LoadFile(name, lazy);
+      EXPECT_TRUE(s.Pull(key_) == expect) << name << ", lazy " << lazy;
+      Single t(TestHandle(), 2);
+      t.LoadFile(name, lazy);
+      EXPECT_TRUE(t.Pull(key_) == expect) << name << ", lazy " << lazy;
+    }
+  }
+
+  std::vector<Key> key_;
+  std::vector<std::string> name_;
+};
+
+}  // namespace
+
+TEST(KVDirtyKeys, Take) {
+  // more keys than the first dedup, with duplicates
+  KVDirtyKeys<Key> dirty;
+  dirty.Add(1);
+  EXPECT_TRUE(dirty.Take().empty());
+  dirty.Enable();
+  std::mt19937_64 gen(0);
+  std::set<Key> expect;
+  for (int i = 0; i < 300000; ++i) {
+    Key k = gen() % 100000;
+    dirty.Add(k);
+    expect.insert(k);
+  }
+  auto key = dirty.Take();
+  EXPECT_TRUE(key == std::vector<Key>(expect.begin(), expect.end()));
+  EXPECT_TRUE(dirty.Take().empty());
+}
+
+TEST_F(KVDeltaTest, Replay) {
+  Sparse sparse(TestHandle(), 2, 4);
+  Single single(TestHandle(), 2);
+  for (int s = 0; s < 2; ++s) {
+    std::vector<float> expect;
+    if (s) {
+      SaveChain(&single);
+      expect = single.Pull(key_);
+    } else {
+      SaveChain(&sparse);
+      expect = sparse.Pull(key_);
+    }
+    // the deleted keys are tombstones of zero bytes
+    KVIndexedFile file;
+    file.Open(name_[2]);
+    EXPECT_TRUE(file.delta());
+    size_t tombs = 0;
+    for (size_t i = 0; i < file.size(); ++i) {
+      size_t len;
+      file.value(i, &len);
+      if (len == 0) {
+        ++ tombs;
+        size_t j = std::lower_bound(key_.begin(), key_.end(), file.key(i)) - key_.begin();
+        EXPECT_EQ(expect[j * 2], 0);
+        EXPECT_EQ(expect[j * 2 + 1], 0);
+      }
+    }
+    EXPECT_GT(tombs, (size_t)0);
+
+    EXPECT_TRUE(KVDeltaChain(name_[2]) ==
+                std::vector<std::string>(name_.begin(), name_.begin() + 3));
+    CheckLoad(name_[2], expect);
+
+    // folded into one model without the deleted keys
+    size_t n = FoldDeltas(name_[2], name_[3]);
+    size_t nonempty = 0;
+    for (size_t i = 0; i < key_.size(); ++i) {
+      nonempty += expect[i * 2] != 0 || expect[i * 2 + 1] != 0;
+    }
+    EXPECT_EQ(n, nonempty);
+    file.Open(name_[3]);
+    EXPECT_FALSE(file.delta());
+    CheckLoad(name_[3], expect);
+  }
+}
+
+TEST_F(KVDeltaTest, Broken) {
+  // a delta with a truncated file or a missing parent is rejected, rather than
+  // loaded partly
+  Single store(TestHandle(), 2);
+  SaveChain(&store);
+  ASSERT_EQ(truncate(name_[2].c_str(), 100), 0);
+  Single s(TestHandle(), 2);
+  EXPECT_DEATH(s.LoadFile(name_[2], false), "truncated");
+
+  unlink(name_[0].c_str());
+  Single t(TestHandle(), 2);
+  EXPECT_DEATH(t.LoadFile(name_[1], false), "kv_delta_base");
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+class KVEvictionTest : public testing::Test {
+ protected:
+  KVEvictionTest() : key_(TestKeys(20000, 0)), name_(TestFile("kv_archive")) {
+    archive_.reset(dmlc::Stream::Create(name_.c_str(), "w"));
+  }
+  ~KVEvictionTest() { unlink(name_.c_str()); }
+
+  /**
+   * checks \a store keeps all of \a hot and at most \a max_keys keys, with
+   * the values of \a ref without eviction, and the other keys are in the
+   * archive with the values pushed once
+   */
+  template <typename Store>
+  void CheckSweep(Store* store, Store* ref, const std::vector<Key>& hot,
+                  size_t max_keys) {
+    archive_.reset();
+    Single archived(TestHandle(), 2);
+    {
+      std::unique_ptr<dmlc::Stream> fi(dmlc::Stream::Create(name_.c_str(), "r"));
+      archived.Load(fi.get());
+    }
+    auto val = store->Pull(key_), expect = ref->Pull(key_);
+    auto arc = archived.Pull(key_);
+    size_t kept = 0;
+    for (size_t i = 0; i < key_.size(); ++i) {
+      bool keep = val[i * 2] != 0 || val[i * 2 + 1] != 0;
+      if (std::binary_search(hot.begin(), hot.end(), key_[i])) {
+        ASSERT_TRUE(keep) << "key " << key_[i];
+      }
+      kept += keep;
+      for (int d = 0; d < 2; ++d) {
+        ASSERT_EQ(val[i * 2 + d], keep ? expect[i * 2 + d] : 0) << "key " << key_[i];
+        ASSERT_EQ(arc[i * 2 + d], keep ? 0 : TestValue(key_[i], d)) << "key " << key_[i];
+      }
+    }
+    EXPECT_LE(kept, max_keys);
+  }
+
+  /// evicts the keys not requested for 20 ticks of 100 keys, while a few keys
+  /// are pushed and pulled
+  template <typename Store>
+  void TTL(Store* store, Store* ref) {
+    KVEvictionConf conf;
+    conf.ttl = 20;
+    conf.tick_keys = 100;
+    conf.archive = archive_.get();
+    store->SetEviction(conf);
+    std::vector<Key> hot;
+    for (size_t i = 0; i < key_.size(); i += 40) hot.push_back(key_[i]);
+    for (Store* s : {store, ref}) s->Push(key_, TestValues(key_));
+    for (int r = 0; r < 200; ++r) {
+      for (Store* s : {store, ref}) s->Push(hot, TestValues(hot));
+      ASSERT_TRUE(store->Pull(hot) == ref->Pull(hot)) << "round " << r;
+    }
+    CheckSweep(store, ref, hot, hot.size());
+  }
+
+  /// keeps at most 2000 keys, the most recently pushed ones, while the keys
+  /// are pushed in chunks
+  template <typename Store>
+  void LRU(Store* store, Store* ref) {
+    KVEvictionConf conf;
+    conf.max_keys = 2000;
+    conf.tick_keys = 1;
+    conf.archive = archive_.get();
+    store->SetEviction(conf);
+    std::vector<Key> chunk;
+    for (size_t i = 0; i < key_.size(); i += 500) {
+      chunk.assign(key_.begin() + i, key_.begin() + i + 500);
+      for (Store* s : {store, ref}) s->Push(chunk, TestValues(chunk));
+    }
+    // the last chunk is pushed until the sweeps are finished
+    std::vector<float> zero(chunk.size() * 2);
+    for (int r = 0; r < 200; ++r) store->Push(chunk, zero);
+    CheckSweep(store, ref, chunk, conf.max_keys);
+  }
+
+  std::vector<Key> key_;
+  std::string name_;
+  std::unique_ptr<dmlc::Stream> archive_;
+};
+
+}  // namespace
+
+TEST_F(KVEvictionTest, SingleThreadTTL) {
+  Single store(TestHandle(), 2), ref(TestHandle(), 2);
+  TTL(&store, &ref);
+}
+
+TEST_F(KVEvictionTest, MultiThreadTTL) {
+  Sparse store(TestHandle(), 2, 4), ref(TestHandle(), 2, 4);
+  TTL(&store, &ref);
+}
+
+TEST_F(KVEvictionTest, SingleThreadLRU) {
+  Single store(TestHandle(), 2), ref(TestHandle(), 2);
+  LRU(&store, &ref);
+}
+
+TEST_F(KVEvictionTest, MultiThreadLRU) {
+  Sparse store(TestHandle(), 2, 4), ref(TestHandle(), 2, 4);
+  LRU(&store, &ref);
+}
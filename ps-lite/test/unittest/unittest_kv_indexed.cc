@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "kv/kv_indexed_file.h"
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+class KVIndexedTest : public testing::Test {
+ protected:
+  KVIndexedTest() : name_(TestFile("kv_indexed")) { }
+  ~KVIndexedTest() { unlink(name_.c_str()); }
+
+  /// writes the entries of \a key with \a key_bytes and \a fence_stride, and
+  /// a meta string
+  void Write(const std::vector<Key>& key, int key_bytes, int fence_stride) {
+    std::unique_ptr<dmlc::Stream> fo(dmlc::Stream::Create(name_.c_str(), "w"));
+    KVIndexedWriter out(fo.get(), key_bytes, 0, fence_stride);
+    out.meta()->Write("meta", 4);
+    for (Key k : key) {
+      TestEntry e;
+      e.w[0] = TestValue(k, 0); e.w[1] = TestValue(k, 1);
+      out.Add(k, e);
+    }
+    EXPECT_EQ(out.Finish(), key.size());
+  }
+
+  /// every key is found with its value, and the keys between them are not.
+  /// the meta of a store is the state of its handle, which is empty
+  void Check(const std::vector<Key>& key, const std::string& meta = "meta") {
+    KVIndexedFile file;
+    file.Open(name_);
+    ASSERT_TRUE(IsIndexedModel(name_));
+    ASSERT_EQ(file.size(), key.size());
+    EXPECT_FALSE(file.delta());
+    size_t len;
+    const char* data = file.meta(&len);
+    EXPECT_EQ(std::string(data, len), meta);
+    for (size_t i = 0; i < key.size(); ++i) {
+      ASSERT_EQ(file.key(i), key[i]);
+      ASSERT_EQ(file.Find(key[i]), i) << "key " << key[i];
+      TestEntry e;
+      file.Load(i, &e);
+      ASSERT_EQ(e.w[0], TestValue(key[i], 0));
+      ASSERT_EQ(e.w[1], TestValue(key[i], 1));
+      // the key before it, if not a key
+      Key k = key[i] - 1;
+      if (i == 0 ? key[i] > 0 : k != key[i-1]) {
+        ASSERT_EQ(file.LowerBound(k), i) << "key " << k;
+        ASSERT_EQ(file.Find(k), file.size()) << "key " << k;
+      }
+    }
+    Key last = key.empty() ? 0 : key.back();
+    if (last < (uint64)-1) EXPECT_EQ(file.Find(last + 1), file.size());
+  }
+
+  std::string name_;
+};
+
+}  // namespace
+
+TEST_F(KVIndexedTest, Find) {
+  for (int key_bytes : {4, 8}) {
+    std::vector<Key> key = TestKeys(3000, key_bytes);
+    if (key_bytes == 4) for (auto& k : key) k >>= 32;
+    key.erase(std::unique(key.begin(), key.end()), key.end());
+    // within a block, one key per block, and blocks of all the keys
+    for (int stride : {1, 3, 256, 5000}) {
+      Write(key, key_bytes, stride);
+      Check(key);
+    }
+  }
+  // no keys, and one key
+  Write({}, 8, 256);
+  Check({});
+  Write({7}, 8, 256);
+  Check({7});
+}
+
+TEST_F(KVIndexedTest, Truncated) {
+  Write(TestKeys(100, 0), 8, 16);
+  ASSERT_EQ(truncate(name_.c_str(), 1000), 0);
+  KVIndexedFile file;
+  EXPECT_DEATH(file.Open(name_), "truncated");
+}
+
+TEST_F(KVIndexedTest, Store) {
+  // the models of both stores are loaded eagerly or lazily by both stores
+  auto key = TestKeys(5000, 0);
+  Sparse sparse(TestHandle(), 2, 4);
+  Single single(TestHandle(), 2);
+  sparse.Push(key, TestValues(key));
+  single.Push(key, TestValues(key));
+  for (int from = 0; from < 2; ++from) {
+    if (from) single.SaveIndexed(name_); else sparse.SaveIndexed(name_);
+    Check(key, "");
+    for (bool lazy : {false, true}) {
+      Sparse s(TestHandle(), 2, 3);
+      s.LoadFile(name_, lazy);
+      EXPECT_TRUE(s.Pull(key) == TestValues(key));
+      Single t(TestHandle(), 2);
+      t.LoadFile(name_, lazy);
+      EXPECT_TRUE(t.Pull(key) == TestValues(key));
+    }
+  }
+}
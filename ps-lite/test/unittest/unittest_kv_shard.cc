@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+class KVShardTest : public testing::Test {
+ protected:
+  KVShardTest() : key_(TestKeys(5000, 0)), name_(TestFile("kv_shard")) {
+    // the keys out of the model are pushed to empty entries, so they are not
+    // saved
+    for (size_t i = 0; i < key_.size(); ++i) {
+      (i % 5 ? model_ : empty_).push_back(key_[i]);
+    }
+  }
+
+  ~KVShardTest() {
+    unlink(name_.c_str());
+    for (int i = 0; i < 8; ++i) unlink(KVShardName(name_, i).c_str());
+  }
+
+  template <typename Store>
+  void Fill(Store* store) {
+    store->Push(key_, TestValues(key_));
+    store->Push(empty_, TestValues(empty_, -1));
+  }
+
+  /// \a store has the values of the model, and no other keys
+  template <typename Store>
+  void Check(Store* store) {
+    auto val = store->Pull(key_);
+    auto expect = TestValues(model_);
+    for (size_t i = 0, j = 0; i < key_.size(); ++i) {
+      bool saved = j < model_.size() && model_[j] == key_[i];
+      for (int c = 0; c < 2; ++c) {
+        ASSERT_EQ(val[i * 2 + c], saved ? expect[j * 2 + c] : 0) << "key " << key_[i];
+      }
+      if (saved) ++ j;
+    }
+  }
+
+  /// saves by \a from into shards, and loads them by \a to, with and without
+  /// compression
+  template <typename From, typename To>
+  void RoundTrip(From* from, To* to) {
+    Fill(from);
+    for (bool compress : {false, true}) {
+      from->SaveShards(name_, compress);
+      ASSERT_TRUE(IsShardedModel(name_));
+      to->Clear();
+      to->LoadFile(name_, false);
+      Check(to);
+    }
+  }
+
+  std::vector<Key> key_, model_, empty_;
+  std::string name_;
+};
+
+}  // namespace
+
+TEST_F(KVShardTest, SameBuckets) {
+  Sparse from(TestHandle(), 2, 4), to(TestHandle(), 2, 4);
+  RoundTrip(&from, &to);
+}
+
+TEST_F(KVShardTest, OtherBuckets) {
+  Sparse from(TestHandle(), 2, 4), to(TestHandle(), 2, 3);
+  RoundTrip(&from, &to);
+}
+
+TEST_F(KVShardTest, SingleThread) {
+  Sparse sparse(TestHandle(), 2, 4);
+  Single single(TestHandle(), 2);
+  RoundTrip(&sparse, &single);
+  Single from(TestHandle(), 2);
+  Sparse to(TestHandle(), 2, 3);
+  RoundTrip(&from, &to);
+}
+
+TEST_F(KVShardTest, Stream) {
+  // the blocks split the writes, and a block not shrunk by compression is
+  // stored as it is
+  std::string file = name_ + "_shard-0";
+  std::mt19937 gen(0);
+  std::vector<uint32> data(KVShardOutStream::kBlockBytes / 2);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = i < data.size() / 2 ? (uint32)i % 7 : (uint32)gen();
+  }
+  for (bool compress : {false, true}) {
+    {
+      std::unique_ptr<dmlc::Stream> fo(dmlc::Stream::Create(file.c_str(), "w"));
+      KVShardOutStream out(fo.get(), compress);
+      for (size_t i = 0; i < data.size(); i += 1001) {
+        out.Write(data.data() + i, std::min<size_t>(1001, data.size() - i) * 4);
+      }
+      out.Flush();
+      EXPECT_EQ(out.raw_bytes(), data.size() * 4);
+      if (compress) EXPECT_LT(out.bytes(), out.raw_bytes());
+    }
+    std::unique_ptr<dmlc::Stream> fi(dmlc::Stream::Create(file.c_str(), "r"));
+    KVShardInStream in(fi.get());
+    std::vector<uint32> back(data.size() + 1);
+    EXPECT_EQ(in.Read(back.data(), back.size() * 4), data.size() * 4);
+    back.pop_back();
+    EXPECT_TRUE(back == data);
+  }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "kv/kv_store_sparse.h"
+#include "kv/kv_store_sparse_st.h"
+#include "kv_test.h"
+
+using namespace ps;
+
+namespace {
+
+typedef FlatHashMap<Key, TestEntry> Map;
+typedef TestStore<KVStoreSparse<Key, TestEntry, float, TestHandle, Map>> Sparse;
+typedef TestStore<KVStoreSparseST<Key, TestEntry, float, TestHandle, Map>> Single;
+
+class KVSnapshotTest : public testing::Test {
+ protected:
+  KVSnapshotTest() : key_(TestKeys(100000, 0)), name_(TestFile("kv_snapshot")) {
+    // the keys added after the snapshot point
+    for (Key k : TestKeys(2000, 1)) {
+      if (!std::binary_search(key_.begin(), key_.end(), k)) add_.push_back(k);
+    }
+    std::merge(key_.begin(), key_.end(), add_.begin(), add_.end(),
+               std::back_inserter(all_));
+  }
+
+  ~KVSnapshotTest() {
+    for (const auto& n : {name_, name_ + "_base"}) {
+      unlink(n.c_str());
+      for (int i = 0; i < 4; ++i) unlink(KVShardName(n, i).c_str());
+    }
+  }
+
+  /**
+   * saves \a store in the background in \a format, and meanwhile pushes into
+   * all the keys, adds keys, and empties keys. the saved model is the store at
+   * the snapshot point
+   */
+  template <typename Store>
+  void SaveWhilePushing(Store* store, KVSaveConf::Format format,
+                        const std::string& parent = "") {
+    auto expect = store->Pull(all_);
+    KVSaveConf conf;
+    conf.format = format;
+    conf.name = name_;
+    conf.compress = true;
+    conf.parent = parent;
+    store->SaveAsync(conf);
+    std::vector<Key> half;
+    for (size_t i = 0; i < key_.size(); i += 2) half.push_back(key_[i]);
+    for (int r = 0; r < 5; ++r) {
+      store->Push(key_, TestValues(key_));
+      store->Push(add_, TestValues(add_));
+      auto val = store->Pull(half);
+      for (auto& v : val) v = -v;
+      store->Push(half, val);
+    }
+    store->WaitSave();
+
+    Single loaded(TestHandle(), 2);
+    loaded.LoadFile(name_, false);
+    EXPECT_TRUE(loaded.Pull(all_) == expect) << "format " << format;
+    // and the pushes are applied
+    auto val = store->Pull(key_);
+    EXPECT_EQ(val[0], 0);
+    EXPECT_NE(val[2], 0);
+  }
+
+  /// saves full models and deltas of \a store in the background
+  template <typename Store>
+  void Check(Store* store) {
+    store->TrackChanges();
+    for (auto format : {KVSaveConf::kStream, KVSaveConf::kShards,
+                        KVSaveConf::kIndexed}) {
+      store->Clear();
+      store->Push(key_, TestValues(key_));
+      SaveWhilePushing(store, format);
+    }
+    // the full model clears the changes, so the delta has the ones after it
+    store->Clear();
+    store->Push(key_, TestValues(key_));
+    store->SaveIndexed(name_ + "_base");
+    store->ClearChanges();
+    std::vector<Key> some;
+    for (size_t i = 0; i < key_.size(); i += 3) some.push_back(key_[i]);
+    store->Push(some, TestValues(some));
+    SaveWhilePushing(store, KVSaveConf::kDelta, name_ + "_base");
+  }
+
+  std::vector<Key> key_, add_, all_;
+  std::string name_;
+};
+
+}  // namespace
+
+TEST_F(KVSnapshotTest, SingleThread) {
+  Single store(TestHandle(), 2);
+  Check(&store);
+}
+
+TEST_F(KVSnapshotTest, MultiThread) {
+  Sparse store(TestHandle(), 2, 4);
+  Check(&store);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include "ps/app.h"
+#include "dmlc/io.h"
+
+namespace ps {
+// the tests do not start the system, so no app is created
+App* App::Create(int argc, char *argv[]) { return nullptr; }
+}  // namespace ps
+
+namespace dmlc {
+namespace {
+/// a local file. dmlc-core, which implements the streams of all the file
+/// systems, is not linked
+class LocalFileStream : public SeekStream {
+ public:
+  explicit LocalFileStream(FILE* fp) : fp_(fp) { }
+  virtual ~LocalFileStream() { fclose(fp_); }
+  virtual size_t Read(void* ptr, size_t size) {
+    return fread(ptr, 1, size, fp_);
+  }
+  virtual void Write(const void* ptr, size_t size) {
+    CHECK_EQ(fwrite(ptr, 1, size, fp_), size);
+  }
+  virtual void Seek(size_t pos) { CHECK_EQ(fseek(fp_, pos, SEEK_SET), 0); }
+  virtual size_t Tell() { return ftell(fp_); }
+ private:
+  FILE* fp_;
+};
+}  // namespace
+
+Stream* Stream::Create(const char* uri, const char* const flag, bool allow_null) {
+  std::string name(uri);
+  if (name.compare(0, 7, "file://") == 0) name = name.substr(7);
+  std::string mode = std::string(flag) + "b";
+  FILE* fp = fopen(name.c_str(), mode.c_str());
+  if (fp == NULL) {
+    CHECK(allow_null) << "failed to open " << uri;
+    return NULL;
+  }
+  return new LocalFileStream(fp);
+}
+
+SeekStream* SeekStream::CreateForRead(const char* uri, bool allow_null) {
+  return static_cast<SeekStream*>(Stream::Create(uri, "r", allow_null));
+}
+}  // namespace dmlc
+
+int main(int argc, char ** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  testing::FLAGS_gtest_death_test_style = "threadsafe";
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include "base/task_scheduler.h"
+#include "base/parallel_ordered_match.h"
+
+using namespace ps;
+
+namespace {
+
+/// runs \a f with 3 seeds, each by its own thread, as the minibatches of a
+/// worker call the kernels at the same time. the grain sizes of the kernels
+/// are small, so they split deeply and the pieces are stolen by the other
+/// threads
+template <typename F>
+void RunCallers(const F& f) {
+  TaskScheduler::SetNumThreads(4);
+  ASSERT_EQ(TaskScheduler::Get().size(), 4);
+  std::vector<std::thread> callers;
+  for (int c = 0; c < 3; ++c) {
+    callers.emplace_back([c, &f]() {
+        std::mt19937 gen(c);
+        for (int r = 0; r < 20; ++r) f(&gen);
+      });
+  }
+  for (auto& t : callers) t.join();
+}
+
+/// an item with a key and its origin, to check the merge is stable
+struct Item {
+  int key;
+  int src;
+  bool operator==(const Item& rhs) const {
+    return key == rhs.key && src == rhs.src;
+  }
+};
+
+}  // namespace
+
+TEST(TaskScheduler, NestedRun) {
+  RunCallers([](std::mt19937* gen) {
+      int n = (*gen)() % 20 + 1;
+      std::vector<std::atomic<int>> cnt(n * n);
+      for (auto& c : cnt) c = 0;
+      ParallelRun(n, [n, &cnt](int i) {
+          ParallelRun(n, [n, i, &cnt](int j) { ++ cnt[i * n + j]; });
+        });
+      for (auto& c : cnt) EXPECT_EQ(c.load(), 1);
+    });
+}
+
+TEST(TaskScheduler, ForAndSum) {
+  RunCallers([](std::mt19937* gen) {
+      size_t begin = (*gen)() % 100, end = begin + (*gen)() % 100000;
+      int nparts = (*gen)() % 64 + 1;
+      // the segments cover the range once
+      std::vector<int> cnt(end, 0);
+      ParallelFor(begin, end, nparts, [&cnt](size_t lo, size_t hi) {
+          for (size_t i = lo; i < hi; ++i) ++ cnt[i];
+        });
+      for (size_t i = 0; i < end; ++i) ASSERT_EQ(cnt[i], i >= begin ? 1 : 0) << i;
+
+      uint64 sum = ParallelSum<uint64>(begin, end, nparts, [](size_t lo, size_t hi) {
+          uint64 s = 0;
+          for (size_t i = lo; i < hi; ++i) s += i;
+          return s;
+        });
+      uint64 expect = 0;
+      for (size_t i = begin; i < end; ++i) expect += i;
+      EXPECT_EQ(sum, expect);
+    });
+}
+
+TEST(TaskScheduler, Merge) {
+  // the same result as std::merge, with many equal keys in both inputs
+  RunCallers([](std::mt19937* gen) {
+      size_t na = (*gen)() % 50000, nb = (*gen)() % 50000;
+      int range = (*gen)() % 1000 + 1;
+      std::vector<Item> a(na), b(nb);
+      for (size_t i = 0; i < na; ++i) a[i] = Item{(int)((*gen)() % range), (int)i};
+      for (size_t i = 0; i < nb; ++i) b[i] = Item{(int)((*gen)() % range), -(int)i-1};
+      auto cmp = [](const Item& x, const Item& y) { return x.key < y.key; };
+      std::stable_sort(a.begin(), a.end(), cmp);
+      std::stable_sort(b.begin(), b.end(), cmp);
+
+      std::vector<Item> expect(na + nb), out(na + nb);
+      std::merge(a.begin(), a.end(), b.begin(), b.end(), expect.begin(), cmp);
+      size_t grainsize = (*gen)() % 1000 + 1;
+      ParallelMerge(a.data(), na, b.data(), nb, out.data(), grainsize, cmp);
+      EXPECT_TRUE(out == expect) << na << " + " << nb << " items, grainsize "
+                                 << grainsize;
+    });
+}
+
+TEST(TaskScheduler, Sort) {
+  RunCallers([](std::mt19937* gen) {
+      size_t n = (*gen)() % 200000;
+      std::vector<uint64> data(n);
+      for (auto& d : data) d = (*gen)() % (n + 1);
+      auto expect = data;
+      std::sort(expect.begin(), expect.end());
+      ParallelSort(data.data(), n, (int)((*gen)() % 16 + 1), std::less<uint64>());
+      EXPECT_TRUE(data == expect) << n << " items";
+    });
+}
+
+TEST(TaskScheduler, OrderedMatch) {
+  // the same result as matching the keys one by one
+  RunCallers([](std::mt19937* gen) {
+      int k = (*gen)() % 3 + 1;
+      size_t n = (*gen)() % 50000;
+      std::vector<Key> src, dst;
+      for (size_t i = 0; i < n; ++i) {
+        Key key = (*gen)() % (n * 2 + 1);
+        if ((*gen)() % 2) src.push_back(key);
+        if ((*gen)() % 2) dst.push_back(key);
+      }
+      for (auto* v : {&src, &dst}) {
+        std::sort(v->begin(), v->end());
+        v->erase(std::unique(v->begin(), v->end()), v->end());
+      }
+      std::vector<int> src_val(src.size() * k), dst_val(dst.size() * k, 1);
+      for (auto& v : src_val) v = (*gen)() % 100;
+      std::vector<int> expect = dst_val;
+      size_t expect_n = 0;
+      for (size_t i = 0, j = 0; i < src.size() && j < dst.size(); ) {
+        if (src[i] < dst[j]) { ++ i; continue; }
+        if (src[i] == dst[j]) {
+          for (int c = 0; c < k; ++c) expect[j * k + c] += src_val[i * k + c];
+          expect_n += k; ++ i;
+        }
+        ++ j;
+      }
+      size_t m = 0;
+      size_t grainsize = (*gen)() % 1000 + 1;
+      ParallelOrderedMatch<Key, int>(
+          src.data(), src.data() + src.size(), src_val.data(),
+          dst.data(), dst.data() + dst.size(), dst_val.data(),
+          k, AsOp::PLUS, grainsize, &m);
+      EXPECT_EQ(m, expect_n);
+      EXPECT_TRUE(dst_val == expect) << src.size() << " to " << dst.size() << " keys";
+    });
+}
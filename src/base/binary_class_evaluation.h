@@ -1,7 +1,7 @@
 #pragma once
 #include <algorithm>
 #include <dmlc/logging.h>
-#include <dmlc/omp.h>
+#include "base/task_scheduler.h"
 namespace dmlc {
 
 template <typename V>
@@ -22,7 +22,7 @@ class BinClassEval {
       buff[i].label = label_[i];
       buff[i].predict = predict_[i];
     }
-    std::sort(buff.data(), buff.data()+n,  [](const Entry& a, const Entry&b) {
+    ps::ParallelSort(buff.data(), n, nt_, [](const Entry& a, const Entry&b) {
         return a.predict < b.predict; });
     V area = 0, cum_tp = 0;
     for (size_t i = 0; i < n; ++i) {
@@ -38,53 +38,62 @@ class BinClassEval {
   }
 
   V Accuracy(V threshold) {
-    V correct = 0;
     size_t n = size_;
-#pragma omp parallel for reduction(+:correct) num_threads(nt_)
-    for (size_t i = 0; i < n; ++i) {
-      if ((label_[i] > 0 && predict_[i] > threshold) ||
-          (label_[i] <= 0 && predict_[i] <= threshold))
-        correct += 1;
-    }
+    V correct = ps::ParallelSum<V>(0, n, nt_, [&](size_t begin, size_t end) {
+        V correct = 0;
+        for (size_t i = begin; i < end; ++i) {
+          if ((label_[i] > 0 && predict_[i] > threshold) ||
+              (label_[i] <= 0 && predict_[i] <= threshold))
+            correct += 1;
+        }
+        return correct;
+      });
     V acc = correct / (V) n;
     return acc > 0.5 ? acc : 1 - acc;
   }
 
   V LogLoss() {
-    V loss = 0;
-    size_t n = size_;
-#pragma omp parallel for reduction(+:loss) num_threads(nt_)
-    for (size_t i = 0; i < n; ++i) {
-      V y = label_[i] > 0;
-      V p = 1 / (1 + exp(- predict_[i]));
-      p = p < 1e-10 ? 1e-10 : p;
-      loss += y * log(p) + (1 - y) * log(1 - p);
-    }
+    V loss = ps::ParallelSum<V>(0, size_, nt_, [this](size_t begin, size_t end) {
+        V loss = 0;
+        for (size_t i = begin; i < end; ++i) {
+          V y = label_[i] > 0;
+          V p = 1 / (1 + exp(- predict_[i]));
+          p = p < 1e-10 ? 1e-10 : p;
+          loss += y * log(p) + (1 - y) * log(1 - p);
+        }
+        return loss;
+      });
     return - loss;
   }
 
   V LogitObjv() {
-    V objv = 0;
-#pragma omp parallel for reduction(+:objv) num_threads(nt_)
-    for (size_t i = 0; i < size_; ++i) {
-      V y = label_[i] > 0 ? 1 : -1;
-      V score = y * predict_[i];
-      if (score < -30)
-        objv += -score;
-      else if (score <= 30)
-        objv += log( 1 + exp( - score ));
-    }
-    return objv;
+    return ps::ParallelSum<V>(0, size_, nt_, [this](size_t begin, size_t end) {
+        V objv = 0;
+        for (size_t i = begin; i < end; ++i) {
+          V y = label_[i] > 0 ? 1 : -1;
+          V score = y * predict_[i];
+          if (score < -30)
+            objv += -score;
+          else if (score <= 30)
+            objv += log( 1 + exp( - score ));
+        }
+        return objv;
+      });
   }
   
   V Copc(){
-    V clk = 0;
-    V clk_exp = 0.0;
-#pragma omp parallel for reduction(+:clk,clk_exp) num_threads(nt_)
-    for (size_t i = 0; i < size_; ++i) {
-      if (label_[i] > 0) clk += 1;
-      clk_exp += 1.0 / ( 1.0 + exp( - predict_[i] ));
-    }
+    V clk = ps::ParallelSum<V>(0, size_, nt_, [this](size_t begin, size_t end) {
+        V clk = 0;
+        for (size_t i = begin; i < end; ++i) if (label_[i] > 0) clk += 1;
+        return clk;
+      });
+    V clk_exp = ps::ParallelSum<V>(0, size_, nt_, [this](size_t begin, size_t end) {
+        V clk_exp = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+          clk_exp += 1.0 / ( 1.0 + exp( - predict_[i] ));
+        }
+        return clk_exp;
+      });
     return clk / clk_exp;
   }
 
@@ -1,10 +1,12 @@
 #pragma once
 #include <type_traits>
 #include <limits>
+#include <algorithm>
+#include <cstring>
 #include "dmlc/data.h"
-#include "dmlc/omp.h"
 #include "data/row_block.h"
 #include "base/parallel_sort.h"
+#include "base/task_scheduler.h"
 #include "gflags/gflags_declare.h"
 
 
@@ -31,12 +33,30 @@ inline uint64_t ReverseBytes(uint64_t x) {
 /**
  * @brief Mapping a RowBlock with general indices into continuous indices
  * starting from 0
+ *
+ * The unique indices are found by one of the following methods, chosen by the
+ * size and the skew of the block if not given:
+ *
+ * - kSort: a comparison sort of (index, position) pairs, for small blocks
+ * - kRadix: an LSD radix sort of the pairs with 11-bit digits, which skips the
+ *   digits all indices share, such as the high bits of hashed indices
+ * - kHash: partitions the pairs by hash, and dedups each partition by a hash
+ *   table in parallel. only the unique indices are sorted, so it is faster if
+ *   the indices repeat much, such as a block dominated by hot features
+ *
+ * All methods record the rank of each nonzero's index, so \ref RemapIndex is
+ * a parallel pass over the nonzeros.
+ *
  * @tparam I the index type
  */
 template<typename I>
 class Localizer {
  public:
-  Localizer(int nthreads = 2) : nt_(nthreads) { }
+  /// @brief the methods of finding the unique indices
+  enum Method { kAuto, kSort, kRadix, kHash };
+
+  Localizer(int nthreads = 2, Method method = kAuto)
+      : nt_(std::max(nthreads, 1)), method_(method) { }
   ~Localizer() { }
   /**
    * @brief Localize a Rowblock
@@ -83,89 +103,319 @@ class Localizer {
   /**
    * @brief Clears the temporal results
    */
-  void Clear() { pair_.clear(); }
+  void Clear() { pair_.clear(); buf_.clear(); pos_.clear(); uniq_.clear(); }
+
+  /**
+   * @brief the method used by the last CountUniqIndex()
+   */
+  Method method() const { return used_; }
 
  private:
+  /// blocks with fewer nonzeros use kSort
+  static const size_t kMinRadix = 1 << 16;
+  /// the number of nonzeros sampled to estimate the skew
+  static const size_t kSample = 1 << 14;
+  /// use kHash if at most this share of the sampled indices are distinct
+  static constexpr double kMaxHashShare = 0.5;
+  static const int kRadixBits = 11;
+
+  Method Choose(const RowBlock<I>& blk, size_t n) const;
+
+  /// the key sorted for index x
+  I Key(I x) const {
+    if (hashed_) return x % max_index_;
+    return sizeof(I) == 8 ? static_cast<I>(ReverseBytes(x)) : x;
+  }
+
+  static uint64_t Mix(uint64_t x) {
+    x ^= x >> 33; x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+  }
+
+  /// fills pair_ with the keys of the nonzeros
+  void FillPairs(const RowBlock<I>& blk, size_t n);
+  /// sorts pair_ by radix
+  void RadixSort();
+  /// fills uniq_, pos_ and cnt from the sorted pair_
+  void RankSorted(std::vector<unsigned>* cnt);
+  /// fills uniq_, pos_ and cnt by hash tables
+  void HashUniq(std::vector<unsigned>* cnt);
+
+  /**
+   * scatters pair_ into buf_ stably by digit(pair) in [0, nd) in parallel,
+   * and stores the start of each digit in buf_ into start. returns false
+   * without scattering if all pairs have the same digit
+   */
+  template<typename Fn>
+  bool Scatter(int nd, const Fn& digit, std::vector<size_t>* start);
+
   int nt_;
+  Method method_, used_ = kSort;
+  bool hashed_ = false;
+  I max_index_ = 0;
 #pragma pack(push)
 #pragma pack(4)
   struct Pair {
     I k; unsigned i;
   };
 #pragma pack(pop)
-  std::vector<Pair> pair_;
+  std::vector<Pair> pair_, buf_;
+  /// the rank in uniq_ of the key of each nonzero
+  std::vector<unsigned> pos_;
+  /// the sorted unique keys
+  std::vector<I> uniq_;
 };
 
+template<typename I>
+typename Localizer<I>::Method Localizer<I>::Choose(
+    const RowBlock<I>& blk, size_t n) const {
+  if (n < kMinRadix) return kSort;
+  // a sample at pseudo-random positions, since a strided one may hit the same
+  // column of every row
+  std::vector<I> smp(kSample);
+  for (size_t j = 0; j < kSample; ++j) {
+    smp[j] = blk.index[Mix(j) % n];
+  }
+  std::sort(smp.begin(), smp.end());
+  size_t distinct = std::unique(smp.begin(), smp.end()) - smp.begin();
+  return distinct <= kMaxHashShare * kSample ? kHash : kRadix;
+}
+
+template<typename I>
+void Localizer<I>::FillPairs(const RowBlock<I>& blk, size_t n) {
+  pair_.resize(n);
+  ps::ParallelFor(0, n, nt_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      pair_[i].k = Key(blk.index[i]);
+      pair_[i].i = i;
+    }
+  });
+}
+
+template<typename I>
+template<typename Fn>
+bool Localizer<I>::Scatter(int nd, const Fn& digit, std::vector<size_t>* start) {
+  size_t n = pair_.size();
+  size_t chunk = (n + nt_ - 1) / nt_;
+  // hist[t*nd+d] is the count, and then the next position, of digit d in the
+  // t-th chunk
+  std::vector<size_t> hist((size_t)nt_ * nd, 0);
+  ps::ParallelRun(nt_, [&](int t) {
+    size_t* h = hist.data() + (size_t)t * nd;
+    size_t end = std::min(n, (t+1) * chunk);
+    for (size_t i = t * chunk; i < end; ++i) ++ h[digit(pair_[i])];
+  });
+  start->resize(nd+1);
+  size_t sum = 0;
+  bool one = false;
+  for (int d = 0; d < nd; ++d) {
+    (*start)[d] = sum;
+    for (int t = 0; t < nt_; ++t) {
+      size_t c = hist[(size_t)t * nd + d];
+      hist[(size_t)t * nd + d] = sum;
+      sum += c;
+    }
+    if (sum - (*start)[d] == n) one = true;
+  }
+  (*start)[nd] = sum;
+  if (one) return false;
+  buf_.resize(n);
+  ps::ParallelRun(nt_, [&](int t) {
+    size_t* h = hist.data() + (size_t)t * nd;
+    size_t end = std::min(n, (t+1) * chunk);
+    for (size_t i = t * chunk; i < end; ++i) buf_[h[digit(pair_[i])]++] = pair_[i];
+  });
+  return true;
+}
+
+template<typename I>
+void Localizer<I>::RadixSort() {
+  // the significant bits of the keys
+  std::vector<I> tmax(nt_, 0);
+  size_t n = pair_.size();
+  size_t chunk = (n + nt_ - 1) / nt_;
+  ps::ParallelRun(nt_, [&](int t) {
+    I m = 0;
+    size_t end = std::min(n, (t+1) * chunk);
+    for (size_t i = t * chunk; i < end; ++i) m = std::max(m, pair_[i].k);
+    tmax[t] = m;
+  });
+  I max_key = *std::max_element(tmax.begin(), tmax.end());
+  int bits = 0;
+  while (bits < (int)sizeof(I) * 8 && (max_key >> bits)) ++ bits;
+
+  const int nd = 1 << kRadixBits;
+  std::vector<size_t> start;
+  for (int shift = 0; shift < bits; shift += kRadixBits) {
+    if (Scatter(nd, [shift, nd](const Pair& p) {
+          return (int)((p.k >> shift) & (nd - 1)); }, &start)) {
+      pair_.swap(buf_);
+    }
+  }
+}
+
+template<typename I>
+void Localizer<I>::RankSorted(std::vector<unsigned>* cnt) {
+  size_t n = pair_.size();
+  size_t chunk = (n + nt_ - 1) / nt_;
+  // the number of unique keys starting in each chunk
+  std::vector<size_t> head(nt_+1, 0);
+  ps::ParallelRun(nt_, [&](int t) {
+    size_t c = 0, end = std::min(n, (t+1) * chunk);
+    for (size_t i = t * chunk; i < end; ++i) {
+      c += i == 0 || pair_[i].k != pair_[i-1].k;
+    }
+    head[t+1] = c;
+  });
+  for (int t = 0; t < nt_; ++t) head[t+1] += head[t];
+  size_t u = head[nt_];
+  uniq_.resize(u);
+  pos_.resize(n);
+  std::vector<size_t> first(u+1);
+  first[u] = n;
+  ps::ParallelRun(nt_, [&](int t) {
+    size_t r = head[t] - 1, end = std::min(n, (t+1) * chunk);
+    for (size_t i = t * chunk; i < end; ++i) {
+      const Pair& v = pair_[i];
+      if (i == 0 || v.k != pair_[i-1].k) {
+        uniq_[++r] = v.k;
+        first[r] = i;
+      }
+      pos_[v.i] = r;
+    }
+  });
+  cnt->resize(u);
+  ps::ParallelFor(0, u, nt_, [&](size_t begin, size_t end) {
+    for (size_t r = begin; r < end; ++r) (*cnt)[r] = first[r+1] - first[r];
+  });
+}
+
+template<typename I>
+void Localizer<I>::HashUniq(std::vector<unsigned>* cnt) {
+  // partition the pairs by the high bits of the hash, so that the threads
+  // dedup disjoint partitions
+  int log_np = 0;
+  while ((1 << log_np) < nt_) ++ log_np;
+  int np = 1 << log_np;
+  auto part = [log_np](const Pair& p) {
+    return log_np == 0 ? 0 : (int)(Mix(p.k) >> (64 - log_np));
+  };
+  std::vector<size_t> start;
+  if (Scatter(np, part, &start)) pair_.swap(buf_);
+
+  // dedup each partition by an open addressing table on the low bits of the
+  // hash. pos_ holds the id of a nonzero's key within its partition first
+  pos_.resize(pair_.size());
+  std::vector<std::vector<I>> keys(np);
+  std::vector<std::vector<unsigned>> counts(np);
+  ps::ParallelRun(np, [&](int p) {
+    auto& key = keys[p];
+    auto& count = counts[p];
+    size_t cap = 1024;
+    std::vector<unsigned> slot(cap, 0);  // id + 1, 0 means empty
+    for (size_t i = start[p]; i < start[p+1]; ++i) {
+      if (2 * (key.size() + 1) > cap) {
+        cap *= 2;
+        slot.assign(cap, 0);
+        for (size_t j = 0; j < key.size(); ++j) {
+          size_t s = Mix(key[j]) & (cap - 1);
+          while (slot[s]) s = (s + 1) & (cap - 1);
+          slot[s] = j + 1;
+        }
+      }
+      I k = pair_[i].k;
+      size_t s = Mix(k) & (cap - 1);
+      while (slot[s] && key[slot[s]-1] != k) s = (s + 1) & (cap - 1);
+      if (!slot[s]) {
+        key.push_back(k);
+        count.push_back(0);
+        slot[s] = key.size();
+      }
+      ++ count[slot[s]-1];
+      pos_[pair_[i].i] = slot[s] - 1;
+    }
+  });
+
+  // sort the unique keys, and translate the ids into ranks
+  std::vector<size_t> base(np+1, 0);
+  for (int p = 0; p < np; ++p) base[p+1] = base[p] + keys[p].size();
+  size_t u = base[np];
+  CHECK_LT(u, static_cast<size_t>(std::numeric_limits<unsigned>::max()));
+  std::vector<Pair> sorted(u);
+  for (int p = 0; p < np; ++p) {
+    for (size_t j = 0; j < keys[p].size(); ++j) {
+      sorted[base[p]+j].k = keys[p][j];
+      sorted[base[p]+j].i = base[p]+j;
+    }
+  }
+  ParallelSort(&sorted, nt_,
+               [](const Pair& a, const Pair& b) {return a.k < b.k; });
+  uniq_.resize(u);
+  cnt->resize(u);
+  std::vector<unsigned> rank(u);
+  ps::ParallelFor(0, u, nt_, [&](size_t begin, size_t end) {
+    for (size_t r = begin; r < end; ++r) {
+      size_t id = sorted[r].i;
+      uniq_[r] = sorted[r].k;
+      rank[id] = r;
+      int p = std::upper_bound(base.begin(), base.end(), id) - base.begin() - 1;
+      (*cnt)[r] = counts[p][id - base[p]];
+    }
+  });
+  ps::ParallelRun(np, [&](int p) {
+    for (size_t i = start[p]; i < start[p+1]; ++i) {
+      unsigned& v = pos_[pair_[i].i];
+      v = rank[base[p] + v];
+    }
+  });
+}
+
 template<typename I>
 template<typename C>
 void Localizer<I>:: CountUniqIndex(
     const RowBlock<I>& blk, std::vector<I> *uniq_idx, std::vector<C>* idx_frq) {
-  // sort
   if (blk.size == 0) return;
   size_t idx_size = blk.offset[blk.size];
   CHECK_LT(idx_size, static_cast<size_t>(std::numeric_limits<unsigned>::max()))
       << "you need to change Pair.i from unsigned to uint64";
-  pair_.resize(idx_size);
-
-  I max_index = std::numeric_limits<I>::max();
-  if (ps::FLAGS_max_key < (uint64_t)max_index) {
-    // hash kernel
-    max_index = (I) ps::FLAGS_max_key;
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < idx_size; ++i) {
-      pair_[i].k = blk.index[i] % max_index;
-      pair_[i].i = i;
-    }
-  } else if (sizeof(I) == 8) {
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < idx_size; ++i) {
-      pair_[i].k = ReverseBytes(blk.index[i]);
-      pair_[i].i = i;
-    }
+
+  max_index_ = std::numeric_limits<I>::max();
+  hashed_ = ps::FLAGS_max_key < (uint64_t)max_index_;
+  // hash kernel
+  if (hashed_) max_index_ = (I) ps::FLAGS_max_key;
+
+  used_ = method_ == kAuto ? Choose(blk, idx_size) : method_;
+  FillPairs(blk, idx_size);
+  std::vector<unsigned> cnt;
+  if (used_ == kHash) {
+    HashUniq(&cnt);
   } else {
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < idx_size; ++i) {
-      pair_[i].k = blk.index[i];
-      pair_[i].i = i;
+    if (used_ == kRadix) {
+      RadixSort();
+    } else {
+      ParallelSort(&pair_, nt_,
+                   [](const Pair& a, const Pair& b) {return a.k < b.k; });
     }
+    RankSorted(&cnt);
   }
-
-  ParallelSort(&pair_, nt_,
-               [](const Pair& a, const Pair& b) {return a.k < b.k; });
+  std::vector<Pair>().swap(buf_);
 
   // save data
   CHECK_NOTNULL(uniq_idx);
-  uniq_idx->clear();
-  if (idx_frq) idx_frq->clear();
-
-  // cnt_max doesn't work for float and double
-  bool int_cnt = std::is_integral<C>::value;
-  unsigned cnt_max = static_cast<unsigned>(std::numeric_limits<C>::max());
-  I curr = pair_[0].k;
-  unsigned cnt = 0;
-  for (size_t i = 0; i < pair_.size(); ++i) {
-    const Pair& v = pair_[i];
-    if (v.k != curr) {
-      uniq_idx->push_back(curr);
-      curr = v.k;
-      if (idx_frq) {
-        if (int_cnt) {
-          idx_frq->push_back(std::min(cnt, cnt_max));
-        } else {
-          idx_frq->push_back(static_cast<C>(cnt));
-        }
-      }
-      cnt = 0;
-    }
-    ++ cnt;
-  }
-  uniq_idx->push_back(curr);
+  *uniq_idx = uniq_;
   if (idx_frq) {
-    if (int_cnt) {
-      idx_frq->push_back(std::min(cnt, cnt_max));
-    } else {
-      idx_frq->push_back(static_cast<C>(cnt));
-    }
+    // cnt_max doesn't work for float and double
+    bool int_cnt = std::is_integral<C>::value;
+    unsigned cnt_max = static_cast<unsigned>(std::numeric_limits<C>::max());
+    idx_frq->resize(cnt.size());
+    ps::ParallelFor(0, cnt.size(), nt_, [&](size_t begin, size_t end) {
+      for (size_t r = begin; r < end; ++r) {
+        (*idx_frq)[r] = int_cnt ? static_cast<C>(std::min(cnt[r], cnt_max))
+                                : static_cast<C>(cnt[r]);
+      }
+    });
   }
 }
 
@@ -176,45 +426,59 @@ void Localizer<I>::RemapIndex(
   if (blk.size == 0 || idx_dict.empty()) return;
   CHECK_LT(idx_dict.size(),
            static_cast<size_t>(std::numeric_limits<unsigned>::max()));
-  CHECK_EQ(blk.offset[blk.size], pair_.size());
-
-  // build the index mapping
-  unsigned matched = 0;
-  std::vector<unsigned> remapped_idx(pair_.size(), 0);
-  auto cur_dict = idx_dict.cbegin();
-  auto cur_pair = pair_.cbegin();
-  while (cur_dict != idx_dict.cend() && cur_pair != pair_.cend()) {
-    if (*cur_dict < cur_pair->k) {
-      ++ cur_dict;
-    } else {
-      if (*cur_dict == cur_pair->k) {
-        remapped_idx[cur_pair->i]
-            = static_cast<unsigned>((cur_dict-idx_dict.cbegin()) + 1);
-        ++ matched;
+  CHECK_EQ(blk.offset[blk.size], pos_.size());
+
+  // the position + 1 in idx_dict of each unique key, 0 if dropped
+  size_t u = uniq_.size();
+  bool same = idx_dict.size() == u &&
+              std::equal(uniq_.begin(), uniq_.end(), idx_dict.begin());
+  std::vector<unsigned> dict;
+  if (!same) {
+    dict.resize(u);
+    ps::ParallelFor(0, u, nt_, [&](size_t begin, size_t end) {
+      for (size_t r = begin; r < end; ++r) {
+        auto it = std::lower_bound(idx_dict.begin(), idx_dict.end(), uniq_[r]);
+        dict[r] = it != idx_dict.end() && *it == uniq_[r] ?
+                  static_cast<unsigned>(it - idx_dict.begin()) + 1 : 0;
       }
-      ++ cur_pair;
-    }
+    });
   }
 
   // construct the new rowblock
   data::RowBlockContainer<unsigned>* o = localized;
   CHECK_NOTNULL(o);
   o->offset.resize(blk.size+1); o->offset[0] = 0;
+  if (same) {
+    for (size_t i = 0; i < blk.size; ++i) {
+      o->offset[i+1] = blk.offset[i+1] - blk.offset[0];
+    }
+  } else {
+    ps::ParallelFor(0, blk.size, nt_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        size_t n = 0;
+        for (size_t j = blk.offset[i]; j < blk.offset[i+1]; ++j) {
+          n += dict[pos_[j]] != 0;
+        }
+        o->offset[i+1] = n;
+      }
+    });
+    for (size_t i = 0; i < blk.size; ++i) o->offset[i+1] += o->offset[i];
+  }
+  size_t matched = o->offset[blk.size];
   o->index.resize(matched);
   if (blk.value) o->value.resize(matched);
 
-  size_t k = 0;
-  for (size_t i = 0; i < blk.size; ++i) {
-    size_t n = 0;
-    for (size_t j = blk.offset[i]; j < blk.offset[i+1]; ++j) {
-      if (remapped_idx[j] == 0) continue;
-      ++ n;
-      if (blk.value) o->value[k] = blk.value[j];
-      o->index[k++] = remapped_idx[j] - 1;
+  ps::ParallelFor(0, blk.size, nt_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      size_t k = o->offset[i];
+      for (size_t j = blk.offset[i]; j < blk.offset[i+1]; ++j) {
+        unsigned d = same ? pos_[j] + 1 : dict[pos_[j]];
+        if (d == 0) continue;
+        if (blk.value) o->value[k] = blk.value[j];
+        o->index[k++] = d - 1;
+      }
     }
-    o->offset[i+1] = o->offset[i] + n;
-  }
-  CHECK_EQ(k, matched);
+  });
 
   if (blk.label) {
     o->label.resize(blk.size);
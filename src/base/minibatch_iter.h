@@ -22,6 +22,8 @@ namespace data {
  * @param minibatch_size the minibatch size
  * @param if nonzero, then the minibatch is randomly picked from a buffer with
  * *shuf_buf* examples
+ * @param parse_threads the number of threads parsing the text, only the libsvm
+ * parser uses more than one
  */
 template<typename IndexType>
 class MinibatchIter {
@@ -29,19 +31,22 @@ class MinibatchIter {
   MinibatchIter(const char* uri, unsigned part_index, unsigned num_parts,
                 const char* type, unsigned minibatch_size,
                 unsigned shuf_buf = 0,
-                float negative_sampling = 1.0)
+                float negative_sampling = 1.0,
+                int parse_threads = 1)
       : mb_size_(minibatch_size), shuf_buf_(shuf_buf),
         negative_sampling_(negative_sampling), start_(0), end_(0) {
     if (shuf_buf) {
       CHECK_GT(shuf_buf, minibatch_size);
       buf_reader_ =
-          new MinibatchIter(uri, part_index, num_parts, type, shuf_buf, 0);
+          new MinibatchIter(uri, part_index, num_parts, type, shuf_buf, 0,
+                            1.0, parse_threads);
       parser_ = NULL;
     } else {
       // create parser
       if (!strcmp(type, "libsvm")) {
         parser_ = new LibSVMParser<IndexType>(
-            InputSplit::Create(uri, part_index, num_parts, "text"), 1);
+            InputSplit::Create(uri, part_index, num_parts, "text"),
+            std::max(parse_threads, 1));
       } else if (!strcmp(type, "criteo")) {
         parser_ = new CriteoParser<IndexType>(
             InputSplit::Create(uri, part_index, num_parts, "text"), true);
@@ -128,6 +133,22 @@ class MinibatchIter {
     return out_blk_;
   }
 
+  /**
+   * \brief moves the current minibatch into \a mb without copying, so it can
+   * be processed while reading the next one. \ref Value is invalid after it
+   */
+  void Swap(RowBlockContainer<IndexType>* mb) {
+    CHECK_NOTNULL(mb);
+    mb->offset.swap(mb_.offset);
+    mb->label.swap(mb_.label);
+    mb->weight.swap(mb_.weight);
+    mb->index.swap(mb_.index);
+    mb->value.swap(mb_.value);
+    std::swap(mb->max_index, mb_.max_index);
+    mb_.Clear();
+    out_blk_ = RowBlock<IndexType>();
+  }
+
  private:
   void Push(size_t pos, size_t len) {
     if (!len) return;
@@ -5,8 +5,7 @@
 #pragma once
 #include <cstring>
 #include "dmlc/data.h"
-#include "dmlc/omp.h"
-#include "base/spmv.h"  // for Range
+#include "base/spmv.h"  // for Range and ps::ParallelFor
 
 namespace dmlc {
 
@@ -56,12 +55,8 @@ class SpMM {
   static void Times(const SpMat& D, const V* const x,
                     V* y, int dim, int nt = kDefaultNT) {
     memset(y, 0, D.size * dim * sizeof(V));
-#pragma omp parallel num_threads(nt)
-    {
-      Range rg = Range(0, D.size).Segment(
-          omp_get_thread_num(), omp_get_num_threads());
-
-      for (size_t i = rg.begin; i < rg.end; ++i) {
+    ps::ParallelFor(0, D.size, nt, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
         if (D.offset[i] == D.offset[i+1]) continue;
         V* y_i = y + i * dim;
         if (D.value) {
@@ -77,7 +72,7 @@ class SpMM {
           }
         }
       }
-    }
+    });
   }
 
   // y = D' * x
@@ -92,10 +87,9 @@ class SpMM {
       memset(y, 0, y_size*sizeof(V));
     }
 
-#pragma omp parallel num_threads(nt)
-    {
-      Range rg = Range(0, y_size/dim).Segment(
-          omp_get_thread_num(), omp_get_num_threads());
+    // each part owns a range of the rows of y
+    ps::ParallelFor(0, y_size/dim, nt, [&](size_t begin, size_t end) {
+      Range rg(begin, end);
 
       for (size_t i = 0; i < D.size; ++i) {
         if (D.offset[i] == D.offset[i+1]) continue;
@@ -119,7 +113,7 @@ class SpMM {
           }
         }
       }
-    }
+    });
   }
 };
 
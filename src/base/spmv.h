@@ -1,7 +1,7 @@
 #pragma once
 #include <cstring>
 #include "dmlc/data.h"
-#include "dmlc/omp.h"
+#include "base/task_scheduler.h"
 namespace dmlc {
 
 /**
@@ -70,12 +70,8 @@ class SpMV {
   /** \brief y = D * x */
   template<typename V>
   static void Times(const SpMat& D,  const V* const x, V* y, int nthreads = kDefaultNT) {
-#pragma omp parallel num_threads(nthreads)
-    {
-      Range rg = Range(0, D.size).Segment(
-          omp_get_thread_num(), omp_get_num_threads());
-
-      for (size_t i = rg.begin; i < rg.end; ++i) {
+    ps::ParallelFor(0, D.size, nthreads, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
         if (D.offset[i] == D.offset[i+1]) continue;
         V y_i = 0;
         if (D.value) {
@@ -87,17 +83,16 @@ class SpMV {
         }
         y[i] = y_i;
       }
-    }
+    });
   }
 
   /** \brief y = D^T * x */
   template<typename V>
   static void TransTimes(const SpMat& D,  const V* const x, V* y, size_t y_size,
                          int nthreads = kDefaultNT) {
-#pragma omp parallel num_threads(nthreads)
-    {
-      Range rg = Range(0, y_size).Segment(
-          omp_get_thread_num(), omp_get_num_threads());
+    // each part owns a range of y
+    ps::ParallelFor(0, y_size, nthreads, [&](size_t begin, size_t end) {
+      Range rg(begin, end);
       std::memset(y + rg.begin, 0, sizeof(V) * (rg.end - rg.begin));
 
       for (size_t i = 0; i < D.size; ++i) {
@@ -115,7 +110,7 @@ class SpMV {
           }
         }
       }
-    }
+    });
   }
 
 };
@@ -1,9 +1,16 @@
 #pragma once
+#include <array>
 #include "progress.h"
 #include "config.pb.h"
 #include "loss.h"
 #include "base/localizer.h"
+#include "base/slab_allocator.h"
+#include "base/half.h"
+#include "dmlc/memory_io.h"
 #include "solver/minibatch_solver.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
 
 namespace dmlc {
 namespace difacto {
@@ -21,7 +28,9 @@ class AsyncScheduler : public solver::MinibatchScheduler {
   }
   virtual ~AsyncScheduler() { }
 
-  virtual std::string ProgHeader() { return Progress::HeadStr(); }
+  virtual std::string ProgHeader() {
+    return Progress::HeadStr(conf_.admission_threshold() > 1);
+  }
 
   virtual std::string ProgString(const solver::Progress& prog) {
     prog_.data = prog;
@@ -72,8 +81,9 @@ struct ISGDHandle {
     // reduce communication frequency
     ++ ct_;
     if (ct_ >= ns_ && reporter) {
-      Progress prog; prog.new_w() = new_w; prog.new_V() = new_V; reporter(prog);
-      new_w = 0; new_V = 0;ct_ = 0;
+      Progress prog;
+      prog.new_w() = new_w.exchange(0); prog.new_V() = new_V.exchange(0);
+      reporter(prog); ct_ = 0;
     }
   }
 
@@ -94,12 +104,19 @@ struct ISGDHandle {
   Embedding V;
   bool l1_shrk;
 
-  // statistic
+  // statistic, updated by all threads of the server
   bool push_count;
-  static int64_t new_w;
-  static int64_t new_V;
+  static std::atomic<int64_t> new_w;
+  static std::atomic<int64_t> new_V;
   std::function<void(const Progress& prog)> reporter;
 
+  /// the changes of new_w and new_V made by one thread, which are added to the
+  /// shared counters once when it is destroyed
+  struct Count {
+    ~Count() { if (w) new_w += w; if (V) new_V += V; }
+    int64_t w = 0, V = 0;
+  };
+
   void Load(Stream* fi) { }
   void Save(Stream *fo) const { }
 
@@ -129,67 +146,310 @@ struct ISGDHandle {
   int ct_ = 0, ns_ = 0;
 };
 
+/**
+ * \brief per-bucket arenas storing w and V of the features with embedding
+ *
+ * A feature with embedding gets one slot in two arenas of its bucket, one with
+ * w and V, and the other with the square root of the cumulative gradient and z
+ * of w, followed by the ones of V. Both arenas are always allocated and freed
+ * together, so one index addresses both. The bucket is stored in the high bits
+ * of the index.
+ *
+ * w, its cumulative gradient and z are always floats, while V and its
+ * cumulative gradient can be stored in 16-bit formats, which halves the memory
+ * of an embedding.
+ */
+class EmbeddingSlab {
+ public:
+  static EmbeddingSlab& Get() {
+    // never deleted, since entries may be destroyed at exit
+    static EmbeddingSlab* slab = new EmbeddingSlab();
+    return *slab;
+  }
+
+  /**
+   * @param num_buckets the number of buckets
+   * @param dim the embedding dimension
+   * @param V_format the format of V
+   * @param accum_format the format of the cumulative gradient of V
+   */
+  void Init(int num_buckets, int dim,
+            ps::FloatFormat V_format = ps::kFloat32,
+            ps::FloatFormat accum_format = ps::kFloat32) {
+    CHECK_LE(num_buckets, 1 << (32 - kLocalBits));
+    dim_ = dim; w_.clear(); cg_.clear();
+    V_format_ = V_format; accum_format_ = accum_format;
+    // in floats, rounded up
+    int V_size = (dim * ps::FloatBytes(V_format) + 3) / 4;
+    int accum_size = (dim * ps::FloatBytes(accum_format) + 3) / 4;
+    for (int i = 0; i < num_buckets; ++i) {
+      w_.emplace_back(1+V_size); cg_.emplace_back(2+accum_size);
+    }
+  }
+
+  inline uint32_t Alloc() {
+    int b = ps::KVStoreBucket::Get();
+    CHECK_LT((size_t)b, w_.size()) << "the slab is not initialized";
+    uint32_t i = w_[b].Alloc();
+    CHECK_EQ(i, cg_[b].Alloc());
+    CHECK_LT(i, 1U << kLocalBits);
+    return (uint32_t)b << kLocalBits | i;
+  }
+
+  inline void Free(uint32_t slot) {
+    int b = slot >> kLocalBits; uint32_t i = slot & kLocalMask;
+    w_[b].Free(i); cg_[b].Free(i);
+  }
+
+  inline float* w(uint32_t slot) const {
+    return w_[slot >> kLocalBits].Get(slot & kLocalMask);
+  }
+
+  inline float* sqc_grad(uint32_t slot) const {
+    return cg_[slot >> kLocalBits].Get(slot & kLocalMask);
+  }
+
+  int dim() const { return dim_; }
+
+  ps::FloatFormat V_format() const { return V_format_; }
+
+  ps::FloatFormat accum_format() const { return accum_format_; }
+
+  size_t bytes() const {
+    size_t b = 0;
+    for (size_t i = 0; i < w_.size(); ++i) b += w_[i].bytes() + cg_[i].bytes();
+    return b;
+  }
+
+ private:
+  EmbeddingSlab() { }
+  static const int kLocalBits = 27;
+  static const uint32_t kLocalMask = (1U << kLocalBits) - 1;
+  int dim_ = 0;
+  ps::FloatFormat V_format_ = ps::kFloat32;
+  ps::FloatFormat accum_format_ = ps::kFloat32;
+  std::vector<ps::SlabAllocator<float>> w_, cg_;
+};
+
 /**
  * \brief value stored on server nodes
  */
 struct AdaGradEntry {
+  /// the embedding dimension is only known at runtime
+  static const int kDim = 0;
+
   AdaGradEntry() { }
   ~AdaGradEntry() { Clear(); }
 
+  /// movable but not copyable, so it can be stored inline in ps::FlatHashMap
+  AdaGradEntry(AdaGradEntry&& e) { *this = std::move(e); }
+  AdaGradEntry& operator=(AdaGradEntry&& e) {
+    if (this == &e) return *this;
+    Clear();
+    fea_cnt = e.fea_cnt; size = e.size; touched = e.touched;
+    memcpy(val_, e.val_, sizeof(val_));
+    e.size = 1; memset(e.val_, 0, sizeof(val_));
+    return *this;
+  }
+  AdaGradEntry(const AdaGradEntry&) = delete;
+  AdaGradEntry& operator=(const AdaGradEntry&) = delete;
+
   inline void Clear() {
-    if ( size > 1 ) { delete [] w; delete [] sqc_grad; }
-    size = 0; w = NULL; sqc_grad = NULL;
+    if (size > 1) EmbeddingSlab::Get().Free(slot_);
+    size = 1; memset(val_, 0, sizeof(val_));
   }
 
+  /// \brief grows to \a n = dim + 1 elements, the new elements are not initialized
   inline void Resize(int n) {
-    if (n < size) { size = n; return; }
+    if (n <= size) return;
+    CHECK_EQ(size, 1);
+    auto& slab = EmbeddingSlab::Get();
+    CHECK_EQ(n, slab.dim() + 1) << "mismatched embedding dimension";
+    uint32_t i = slab.Alloc();
+    float* new_w = slab.w(i); float* new_cg = slab.sqc_grad(i);
+    new_w[0] = w_0(); new_cg[0] = sqc_grad_0(); new_cg[1] = z_0();
+    slot_ = i; size = n;
+  }
+
+  /// \brief w_0 followed by V in \ref V_format, only valid if size > 1
+  inline float* w() const { return EmbeddingSlab::Get().w(slot_); }
+
+  /// \brief the square root of the cumulative gradient and z of w_0, followed
+  /// by the former of V in \ref accum_format, only valid if size > 1
+  inline float* sqc_grad() const {
+    return EmbeddingSlab::Get().sqc_grad(slot_);
+  }
+
+  inline ps::FloatFormat V_format() const {
+    return EmbeddingSlab::Get().V_format();
+  }
+
+  inline ps::FloatFormat accum_format() const {
+    return EmbeddingSlab::Get().accum_format();
+  }
+
+  inline float& w_0() { return size == 1 ? val_[0] : w()[0]; }
+  inline float w_0() const { return size == 1 ? val_[0] : w()[0]; }
+
+  inline float& sqc_grad_0() { return size == 1 ? val_[1] : sqc_grad()[0]; }
+
+  inline float& z_0() { return size == 1 ? val_[2] : sqc_grad()[1]; }
 
-    float* new_w = new float[n]; float* new_cg = new float[n+1];
+  // the file format is the same as when w and sqc_grad were two pointers,
+  // which store {w_0, fea_cnt} and {sqc_grad_0, z_0} if size == 1. fea_cnt
+  // takes the unused half of the former w, and is only saved before V is
+  // allocated, the only time it is used
+  void Load(Stream* fi) {
+    Reload(fi);
+    if (size > 1) ISGDHandle::new_V += size - 1;
+    if (w_0() != 0) ++ ISGDHandle::new_w;
+  }
+
+  /// \brief Load without counting new_w and new_V, for ps::KVColdTier
+  void Reload(Stream* fi) {
+    Clear();
+    fea_cnt = 0;
+    int n = 1;
+    fi->Read(&n, sizeof(n));
+    if (n == 1) {
+      float pad[4];
+      fi->Read(pad, sizeof(pad));
+      val_[0] = pad[0]; val_[1] = pad[2]; val_[2] = pad[3];
+      memcpy(&fea_cnt, &pad[1], sizeof(fea_cnt));
+    } else if (V_format() == ps::kFloat32 && accum_format() == ps::kFloat32) {
+      Resize(n);
+      fi->Read(w(), sizeof(float)*size);
+      fi->Read(sqc_grad(), sizeof(float)*(size+1));
+    } else {
+      Resize(n);
+      auto& buf = Buffer();
+      buf.resize(2*size+1);
+      fi->Read(buf.data(), sizeof(float)*buf.size());
+      float* w = this->w(); float* cg = sqc_grad();
+      w[0] = buf[0]; cg[0] = buf[size]; cg[1] = buf[size+1];
+      ps::EncodeFloats(V_format(), buf.data()+1, size-1, w+1);
+      ps::EncodeFloats(accum_format(), buf.data()+size+2, size-1, cg+2);
+    }
+  }
+
+  void Save(Stream *fo) const {
+    fo->Write(&size, sizeof(size));
     if (size == 1) {
-      new_w[0] = w_0(); new_cg[0] = sqc_grad_0(); new_cg[1] = z_0();
+      float pad[4] = {val_[0], 0, val_[1], val_[2]};
+      memcpy(&pad[1], &fea_cnt, sizeof(fea_cnt));
+      fo->Write(pad, sizeof(pad));
+    } else if (V_format() == ps::kFloat32 && accum_format() == ps::kFloat32) {
+      fo->Write(w(), sizeof(float)*size);
+      fo->Write(sqc_grad(), sizeof(float)*(size+1));
     } else {
-      memcpy(new_w, w, size * sizeof(float));
-      memcpy(new_cg, sqc_grad, (size+1) * sizeof(float));
-      Clear();
+      auto& buf = Buffer();
+      buf.resize(2*size+1);
+      const float* w = this->w(); const float* cg = sqc_grad();
+      buf[0] = w[0]; buf[size] = cg[0]; buf[size+1] = cg[1];
+      ps::DecodeFloats(V_format(), w+1, size-1, buf.data()+1);
+      ps::DecodeFloats(accum_format(), cg+2, size-1, buf.data()+size+2);
+      fo->Write(buf.data(), sizeof(float)*buf.size());
     }
-    w = new_w; sqc_grad = new_cg; size = n;
   }
 
-  inline float& w_0() { return size == 1 ? *(float *)&w : w[0]; }
-  inline float w_0() const { return size == 1 ? *(float *)&w : w[0]; }
+  bool Empty() const { return (w_0() == 0 && size == 1); }
 
-  inline float& sqc_grad_0() {
-    return size == 1 ? *(float *)&sqc_grad : sqc_grad[0];
+  /// #appearence of this feature in the data
+  unsigned fea_cnt = 0;
+
+  /// the tick this feature is last pushed, for ps::KVEviction. it fits in the
+  /// padding of the table slot
+  uint16_t touched = 0;
+
+  /// length of w. if size == 1, then w_0, sqc_grad_0 and z_0 are stored in
+  /// the entry to save memory, otherwise in \ref EmbeddingSlab
+  int size = 1;
+
+ private:
+  /// the floats of an entry in the file, if V is not stored as floats
+  static std::vector<float>& Buffer() {
+    static thread_local std::vector<float> buf;
+    return buf;
   }
 
-  inline float& z_0() {
-    return size == 1 ? *(((float *)&sqc_grad)+1) : sqc_grad[1];
+  union {
+    /// w_0, sqc_grad_0 and z_0 if size == 1
+    float val_[3] = {0, 0, 0};
+    /// the slot in EmbeddingSlab if size > 1
+    uint32_t slot_;
+  };
+};
+
+/**
+ * \brief value stored on server nodes for a compile-time embedding dimension
+ *
+ * w, V and the AdaGrad state are stored inline in one block, so pushing and
+ * pulling a feature touches only the table slot. The price is that every
+ * feature, including those which never get an embedding, has the memory of a
+ * full embedding. The file format is the same as \ref AdaGradEntry.
+ *
+ * @tparam DIM the embedding dimension
+ */
+template <int DIM>
+struct FixedAdaGradEntry {
+  static const int kDim = DIM;
+
+  /// \brief grows to \a n = DIM + 1 elements, the new elements are not initialized
+  inline void Resize(int n) {
+    if (n <= size) return;
+    CHECK_EQ(n, DIM + 1) << "mismatched embedding dimension";
+    size = n;
   }
 
+  /// \brief w and V
+  inline float* w() const { return const_cast<float*>(w_); }
+
+  /// \brief the square root of the cumulative gradient, followed by z_0
+  inline float* sqc_grad() const { return const_cast<float*>(cg_); }
+
+  static ps::FloatFormat V_format() { return ps::kFloat32; }
+
+  static ps::FloatFormat accum_format() { return ps::kFloat32; }
+
+  inline float& w_0() { return w_[0]; }
+  inline float w_0() const { return w_[0]; }
+
+  inline float& sqc_grad_0() { return cg_[0]; }
+
+  inline float& z_0() { return cg_[1]; }
+
   void Load(Stream* fi) {
-    fi->Read(&size, sizeof(size)) ;
+    Reload(fi);
+    if (size > 1) ISGDHandle::new_V += size - 1;
+    if (w_0() != 0) ++ ISGDHandle::new_w;
+  }
+
+  /// \brief Load without counting new_w and new_V, for ps::KVColdTier
+  void Reload(Stream* fi) {
+    memset(w_, 0, sizeof(w_)); memset(cg_, 0, sizeof(cg_));
+    fea_cnt = 0;
+    fi->Read(&size, sizeof(size));
     if (size == 1) {
-      fi->Read(&w, sizeof(float*));
-      fi->Read(&sqc_grad, sizeof(float*));
+      float pad[4];
+      fi->Read(pad, sizeof(pad));
+      w_[0] = pad[0]; cg_[0] = pad[2]; cg_[1] = pad[3];
+      memcpy(&fea_cnt, &pad[1], sizeof(fea_cnt));
     } else {
-      w = new float[size];
-      sqc_grad = new float[size+1];
-      fi->Read(w, sizeof(float)*size);
-      fi->Read(sqc_grad, sizeof(float)*(size+1));
-      ISGDHandle::new_V += size - 1;
+      CHECK_EQ(size, DIM + 1) << "mismatched embedding dimension";
+      fi->Read(w_, sizeof(float)*size);
+      fi->Read(cg_, sizeof(float)*(size+1));
     }
-    //printf("---------- load size %d\n", size);
-    if (w_0() != 0) ++ ISGDHandle::new_w;
   }
 
   void Save(Stream *fo) const {
     fo->Write(&size, sizeof(size));
     if (size == 1) {
-      fo->Write(&w, sizeof(float*));
-      fo->Write(&sqc_grad, sizeof(float*));
+      float pad[4] = {w_[0], 0, cg_[0], cg_[1]};
+      memcpy(&pad[1], &fea_cnt, sizeof(fea_cnt));
+      fo->Write(pad, sizeof(pad));
     } else {
-      fo->Write(w, sizeof(float)*size);
-      fo->Write(sqc_grad, sizeof(float)*(size+1));
+      fo->Write(w_, sizeof(float)*size);
+      fo->Write(cg_, sizeof(float)*(size+1));
     }
   }
 
@@ -198,69 +458,139 @@ struct AdaGradEntry {
   /// #appearence of this feature in the data
   unsigned fea_cnt = 0;
 
-  /// length of w. if size == 1, then using w itself to store the value to save
-  /// memory and avoid unnecessary new (see w_0())
-  int size = 1;
+  /// the tick this feature is last pushed, for ps::KVEviction. it fits in the
+  /// padding of the table slot
+  uint16_t touched = 0;
 
-  /// w and V
-  float *w = NULL;
+  /// length of w, either 1 or DIM + 1
+  int size = 1;
 
-  /// square root of the cumulative gradient
-  float *sqc_grad = NULL;
+ private:
+  float w_[DIM + 1] = {0};
+  float cg_[DIM + 2] = {0};
 };
 
 /**
  * \brief model updater
+ *
+ * It works with both \ref AdaGradEntry and \ref FixedAdaGradEntry. For the
+ * latter, the update of V has a compile-time length.
  */
 struct AdaGradHandle : public ISGDHandle {
 
-  inline void Push(FeaID key, Blob<const float> recv, AdaGradEntry& val) {
+  template <typename Entry>
+  inline void Push(FeaID key, Blob<const float> recv, Entry& val) {
+    Count cnt;
+    Update(recv, val, &cnt);
+  }
+
+  template <typename Entry>
+  inline void Pull(FeaID key, const Entry& val, Blob<float>& send) {
+    float w0 = val.w_0();
+    if (val.size == 1 || (l1_shrk && (w0 == 0))) {
+      CHECK_GT(send.size, (size_t)0);
+      send[0] = w0;
+      send.size = 1;
+    } else if (val.V_format() == ps::kFloat32) {
+      send.data = val.w();
+      send.size = val.size;
+    } else {
+      CHECK_GE(send.size, (size_t)val.size) << "the pull buffer is too small";
+      send[0] = w0;
+      ps::DecodeFloats(val.V_format(), val.w()+1, val.size-1, send.data+1);
+      send.size = val.size;
+    }
+  }
+
+  /// \brief batch push, the statistics are updated once per batch
+  template <typename Entry>
+  inline void PushBatch(size_t n, const FeaID* key,
+                        const Blob<const float>* recv, Entry** val) {
+    Count cnt;
+    for (size_t i = 0; i < n; ++i) {
+      if (i + kPrefetch < n) Prefetch(*val[i + kPrefetch]);
+      Update(recv[i], *val[i], &cnt);
+    }
+  }
+
+  /// \brief batch pull, prefetches the embeddings ahead
+  template <typename Entry>
+  inline void PullBatch(size_t n, const FeaID* key, const Entry* const* val,
+                        Blob<float>* send) {
+    for (size_t i = 0; i < n; ++i) {
+      if (i + kPrefetch < n) Prefetch(*val[i + kPrefetch]);
+      Pull(key[i], *val[i], send[i]);
+    }
+  }
+
+  /// \brief the number of entries prefetched ahead in a batch
+  static const size_t kPrefetch = 4;
+
+  template <typename Entry>
+  PS_ALWAYS_INLINE void Prefetch(const Entry& val) {
+    if (val.size > 1) {
+      __builtin_prefetch(val.w());
+      __builtin_prefetch(val.sqc_grad());
+    }
+  }
+
+  template <typename Entry>
+  inline void Update(Blob<const float> recv, Entry& val, Count* cnt) {
     if (push_count) {
       val.fea_cnt += (unsigned) recv[0];
-      Resize(val);
+      Resize(val, cnt);
     } else {
       CHECK_LE(recv.size, (size_t)val.size);
       CHECK_GE(recv.size, (size_t)0);
 
       // update w
-      UpdateW(val, recv[0]);
+      UpdateW(val, recv[0], cnt);
 
       // update V
-      if (recv.size > 1) {
-        UpdateV(val.w+1, val.sqc_grad+2, recv.data+1, recv.size-1);
+      if (recv.size <= 1) return;
+      if (val.V_format() == ps::kFloat32 &&
+          val.accum_format() == ps::kFloat32) {
+        UpdateV<Entry::kDim>(
+            val.w()+1, val.sqc_grad()+2, recv.data+1, recv.size-1);
+      } else {
+        // update in floats, then round back into the storage formats
+        int n = recv.size - 1;
+        float* V = Buffer(2 * n); float* cg = V + n;
+        ps::DecodeFloats(val.V_format(), val.w()+1, n, V);
+        ps::DecodeFloats(val.accum_format(), val.sqc_grad()+2, n, cg);
+        UpdateV<0>(V, cg, recv.data+1, n);
+        ps::EncodeFloats(val.V_format(), V, n, val.w()+1);
+        ps::EncodeFloats(val.accum_format(), cg, n, val.sqc_grad()+2);
       }
     }
   }
 
-  inline void Pull(FeaID key, const AdaGradEntry& val, Blob<float>& send) {
-    float w0 = val.w_0();
-    if (val.size == 1 || (l1_shrk && (w0 == 0))) {
-      CHECK_GT(send.size, (size_t)0);
-      send[0] = w0;
-      send.size = 1;
-    } else {
-      send.data = val.w;
-      send.size = val.size;
-    }
-  }
-
   /// \brief resize if necessary
-  inline void Resize(AdaGradEntry& val) {
+  template <typename Entry>
+  inline void Resize(Entry& val, Count* cnt) {
     // resize the larger dim first to avoid double resize
     if (val.fea_cnt > V.thr && val.size < V.dim + 1 &&
         (!l1_shrk || val.w_0() != 0)) {
       int old_siz = val.size;
       val.Resize(V.dim + 1);
-      for (int j = old_siz; j < val.size; ++j) {
-        val.w[j] = rand() / (float) RAND_MAX * (V.V_max - V.V_min) + V.V_min;
-        val.sqc_grad[j+1] = 0;
+      // V may not be stored as floats, so it is initialized in a buffer
+      int n = val.size - 1, m = old_siz - 1;
+      float* w = Buffer(2 * n); float* cg = w + n;
+      ps::DecodeFloats(val.V_format(), val.w()+1, m, w);
+      ps::DecodeFloats(val.accum_format(), val.sqc_grad()+2, m, cg);
+      for (int j = m; j < n; ++j) {
+        w[j] = rand() / (float) RAND_MAX * (V.V_max - V.V_min) + V.V_min;
+        cg[j] = 0;
       }
-      new_V += val.size - old_siz;
+      ps::EncodeFloats(val.V_format(), w, n, val.w()+1);
+      ps::EncodeFloats(val.accum_format(), cg, n, val.sqc_grad()+2);
+      cnt->V += val.size - old_siz;
     }
   }
 
   // ftrl
-  inline void UpdateW(AdaGradEntry& val, float g) {
+  template <typename Entry>
+  inline void UpdateW(Entry& val, float g, Count* cnt) {
     float w = val.w_0();
     g += lambda_l2 * w;
 
@@ -280,14 +610,43 @@ struct AdaGradHandle : public ISGDHandle {
     }
 
     if (w == 0 && val.w_0() != 0) {
-      ++ new_w; Resize(val);
+      ++ cnt->w; Resize(val, cnt);
     } else if (w != 0 && val.w_0() == 0) {
-      -- new_w;
+      -- cnt->w;
     }
   }
 
-  // adagrad
+  /// a buffer of \a n floats of the calling thread
+  static float* Buffer(size_t n) {
+    static thread_local std::vector<float> buf;
+    if (buf.size() < n) buf.resize(n);
+    return buf.data();
+  }
+
+  // adagrad, n == DIM if DIM > 0
+  template <int DIM>
   inline void UpdateV(float* w, float* cg, float const* g, int n) {
+#ifdef __SSE__
+    if (DIM > 0 && DIM % 4 == 0) {
+      CHECK_EQ(n, DIM);
+      const __m128 l2 = _mm_set1_ps(V.lambda_l2);
+      const __m128 alpha = _mm_set1_ps(V.alpha);
+      const __m128 beta = _mm_set1_ps(V.beta);
+      // a constant trip count, fully unrolled by the compiler. the rows are
+      // not 16-byte aligned since w_0 is stored before V
+      for (int i = 0; i < DIM; i += 4) {
+        __m128 wi = _mm_loadu_ps(w+i);
+        __m128 grad = _mm_add_ps(_mm_loadu_ps(g+i), _mm_mul_ps(l2, wi));
+        __m128 cgi = _mm_loadu_ps(cg+i);
+        cgi = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(cgi, cgi), _mm_mul_ps(grad, grad)));
+        _mm_storeu_ps(cg+i, cgi);
+        __m128 eta = _mm_div_ps(alpha, _mm_add_ps(cgi, beta));
+        _mm_storeu_ps(w+i, _mm_sub_ps(wi, _mm_mul_ps(eta, grad)));
+      }
+      return;
+    }
+#endif
+    if (DIM > 0) n = DIM;
     for (int i = 0; i < n; ++i) {
       float grad = g[i] + V.lambda_l2 * w[i];
       cg[i] = sqrt(cg[i] * cg[i] + grad * grad);
@@ -300,9 +659,16 @@ struct AdaGradHandle : public ISGDHandle {
 class AsyncServer : public solver::MinibatchServer {
  public:
   AsyncServer(const Config& conf) : conf_(conf) {
-    using Server = ps::OnlineServer<float, AdaGradEntry, AdaGradHandle>;
+    CHECK(!conf_.index_model() || !conf_.shard_model())
+        << "index_model cannot be used with shard_model";
     AdaGradHandle h;
-    h.reporter = [this](const Progress& prog) { ReportToScheduler(prog.data); };
+    h.reporter = [this](const Progress& prog) {
+      if (conf_.admission_threshold() > 1) {
+        Progress p = prog; AddAdmission(&p); ReportToScheduler(p.data);
+      } else {
+        ReportToScheduler(prog.data);
+      }
+    };
 
     // for w
     h.alpha     = conf.lr_eta();
@@ -323,26 +689,167 @@ class AsyncServer : public solver::MinibatchServer {
       h.V.beta      = c.has_lr_beta() ? c.lr_beta() : h.beta;
     }
 
-    Server s(h);
-    server_ = s.server();
+    bool fp32 = conf.v_format() == Config::FP32 &&
+                conf.v_accum_format() == Config::FP32;
+    bool fixed = conf.fixed_dim_entry() && fp32;
+    LOG_IF(WARNING, conf.fixed_dim_entry() && !fp32)
+        << "the fixed entry stores V as floats, use the general one";
+    if (fixed && h.V.dim == 8) {
+      CreateServer<FixedAdaGradEntry<8>>(h);
+    } else if (fixed && h.V.dim == 16) {
+      CreateServer<FixedAdaGradEntry<16>>(h);
+    } else if (fixed && h.V.dim == 32) {
+      CreateServer<FixedAdaGradEntry<32>>(h);
+    } else {
+      LOG_IF(WARNING, fixed)
+          << "no fixed entry for embedding dim " << h.V.dim
+          << ", use the general one";
+      EmbeddingSlab::Get().Init(
+          conf.num_threads(), h.V.dim,
+          static_cast<ps::FloatFormat>(conf.v_format()),
+          static_cast<ps::FloatFormat>(conf.v_accum_format()));
+      CreateServer<AdaGradEntry>(h);
+    }
+    ps::NumaConf numa;
+    numa.pin = conf.numa();
+    numa.nodes.assign(conf.numa_nodes().begin(), conf.numa_nodes().end());
+    numa.huge_pages = static_cast<ps::NumaMemory::HugePages>(conf.huge_pages());
+    server_->SetNuma(numa);
+    server_->SetAdmission(conf.admission_threshold(),
+                          conf.admission_sketch_size(),
+                          conf.admission_sketch_hashes());
+
+    ps::KVEvictionConf evict;
+    evict.ttl      = conf.evict_ttl();
+    evict.tick_sec = conf.evict_tick_sec();
+    evict.max_keys = conf.evict_max_keys();
+    if (evict.enabled() && conf.evict_archive().size()) {
+      auto name = conf.evict_archive() + "_part-" +
+                  std::to_string(ps::NodeInfo::MyRank());
+      archive_ = CHECK_NOTNULL(Stream::Create(name.c_str(), "w"));
+      evict.archive = archive_;
+    }
+    server_->SetEviction(evict);
+
+    ps::KVTierConf tier;
+    if (conf.tier_path().size()) {
+      tier.path = conf.tier_path() + "_part-" +
+                  std::to_string(ps::NodeInfo::MyRank());
+      tier.hot_keys = conf.tier_hot_keys();
+    }
+    server_->SetTier(tier);
+    if (conf.delta_iter() > 0) server_->TrackChanges();
+    server_->SetConcurrency(conf.concurrent_requests());
+    server_->SetAggregation(conf.aggregate_requests(), conf.aggregate_usec());
+
+    ps::KVHotKeyConf hot;
+    hot.max_keys = std::max(conf.hot_keys(), 0);
+    hot.min_share = conf.hot_key_share();
+    hot.round_sec = conf.hot_key_round_sec();
+    server_->SetHotKeys(hot);
   }
 
-  virtual ~AsyncServer() { }
+  virtual ~AsyncServer() { delete archive_; }
  protected:
+  template <typename Entry>
+  void CreateServer(const AdaGradHandle& h) {
+    if (conf_.server_store() == Config::FLAT_HASH_MAP) {
+      CreateServer<Entry, ps::FlatHashMap<FeaID, Entry>>(h);
+    } else {
+      CreateServer<Entry, std::unordered_map<FeaID, Entry>>(h);
+    }
+  }
+
+  template <typename Entry, typename Map>
+  void CreateServer(const AdaGradHandle& h) {
+    // a pull returns a pointer to w and V if V is stored as floats, otherwise
+    // it converts them into a buffer of dim+1 floats per feature
+    int k = Entry::kDim == 0 && conf_.v_format() != Config::FP32 ?
+            h.V.dim + 1 : 1;
+    ps::OnlineServer<float, Entry, AdaGradHandle, Map> s(
+        h, k, conf_.num_threads());
+    server_ = s.server();
+  }
+
   virtual void LoadModel(Stream* fi) {
 
     server_->Load(fi);
+    ReportModelSize();
+  }
+
+  virtual void SaveModel(Stream* fo) const {
+    server_->Save(fo);
+  }
+
+  virtual void LoadModelFile(const std::string& filename) {
+    server_->LoadFile(filename, conf_.lazy_load());
+    ReportModelSize();
+  }
+
+  virtual void SaveModelFile(const std::string& filename, bool async) const {
+    if (async) {
+      // the changes are cleared at the snapshot point
+      ps::KVSaveConf save;
+      save.name = filename;
+      save.compress = conf_.compress_model();
+      save.format = conf_.index_model() ? ps::KVSaveConf::kIndexed :
+                    conf_.shard_model() ? ps::KVSaveConf::kShards :
+                    ps::KVSaveConf::kStream;
+      server_->SaveAsync(save);
+      return;
+    }
+    if (conf_.index_model()) {
+      server_->SaveIndexed(filename);
+    } else if (conf_.shard_model()) {
+      server_->SaveShards(filename, conf_.compress_model());
+    } else {
+      server_->FlushPushes();
+      solver::MinibatchServer::SaveModelFile(filename, false);
+    }
+    server_->ClearChanges();
+  }
+
+  virtual void SaveDeltaFile(const std::string& filename,
+                             const std::string& parent, bool async) {
+    if (async) {
+      ps::KVSaveConf save;
+      save.name = filename;
+      save.format = ps::KVSaveConf::kDelta;
+      save.parent = parent;
+      server_->SaveAsync(save);
+    } else {
+      server_->SaveDelta(filename, parent);
+    }
+  }
 
+  /// reports the |w|_0 and |V|_0 of the loaded model
+  void ReportModelSize() {
     Progress prog;
-    prog.new_w() = ISGDHandle::new_w; prog.new_V() = ISGDHandle::new_V;
+    prog.new_w() = ISGDHandle::new_w.exchange(0);
+    prog.new_V() = ISGDHandle::new_V.exchange(0);
     ReportToScheduler(prog.data);
-    ISGDHandle::new_w = 0; ISGDHandle::new_V = 0;
   }
 
-  virtual void SaveModel(Stream* fo) const {
-    server_->Save(fo);
+  virtual void CompactModel() {
+    size_t bytes = server_->Compact();
+    LOG(INFO) << "compacted the model, " << bytes / 1e6 << " MB reclaimed";
   }
+
+  /// adds the admission statistics since the last report
+  void AddAdmission(Progress* prog) {
+    // called by the concurrent requests
+    std::lock_guard<std::mutex> lk(admission_mu_);
+    auto cur = server_->GetAdmissionStats();
+    prog->admitted()   = cur.admitted - admission_.admitted;
+    prog->rejected()   = cur.rejected - admission_.rejected;
+    prog->new_sketch() = (double)cur.bytes - admission_.bytes;
+    admission_ = cur;
+  }
+
   ps::KVStore* server_;
+  ps::KVAdmissionStats admission_;
+  std::mutex admission_mu_;
+  Stream* archive_ = nullptr;
   Config conf_;
 };
 
@@ -353,6 +860,10 @@ class AsyncWorker : public solver::MinibatchWorker {
     shuffle_       = conf_.rand_shuffle();
     concurrent_mb_ = conf_.max_concurrency();
     neg_sampling_  = conf_.neg_sampling();
+    parse_threads_    = conf_.parse_threads();
+    localize_threads_ = conf_.localize_threads();
+    compute_threads_  = conf_.compute_threads();
+    if (conf_.hot_keys() > 0) server_.ReplicateHotKeys(conf_.hot_key_round_sec());
     for (int i = 0; i < conf.embedding_size(); ++i) {
       if (conf.embedding(i).dim() > 0) {
         do_embedding_ = true; break;
@@ -364,18 +875,19 @@ class AsyncWorker : public solver::MinibatchWorker {
  protected:
 
   virtual void ProcessMinibatch(const Minibatch& mb, const Workload& wl) {
-    auto data = new dmlc::data::RowBlockContainer<unsigned>();
+    auto data = std::make_shared<dmlc::data::RowBlockContainer<unsigned>>();
     auto feaid = std::make_shared<std::vector<FeaID>>();
     auto feacnt = std::make_shared<std::vector<float>>();
 
     double start = GetTime();
     Localizer<FeaID> lc(conf_.num_threads());
-    lc.Localize(mb, data, feaid.get(), feacnt.get());
-    workload_time_ += GetTime() - start;
+    lc.Localize(mb, data.get(), feaid.get(), feacnt.get());
+    AddWorkloadTime(GetTime() - start);
 
     ps::SyncOpts pull_w_opt;
     if (wl.type == Workload::TRAIN && wl.data_pass == 0 && do_embedding_) {
-      // push the feature count to the servers
+      // push the feature count to the servers, which run the pull after it
+      // without waiting here
       ps::SyncOpts cnt_opt;
       SetFilters(0, &cnt_opt);
       cnt_opt.cmd = kPushFeaCnt;
@@ -384,49 +896,37 @@ class AsyncWorker : public solver::MinibatchWorker {
       // LL << DebugStr(*feacnt);
     }
 
-    // pull the weight from the servers
-    auto val = new std::vector<float>();
-    auto val_siz = new std::vector<int>();
-
-    // this callback will be called when the weight has been actually pulled
-    // back
-    pull_w_opt.callback = [this, data, feaid, val, val_siz, wl]() {
-      double start = GetTime();
-      // eval the objective, and report progress to the scheduler
-      Loss<float> loss(data->GetBlock(), *val, *val_siz, conf_);
-      Progress prog; loss.Evaluate(&prog); ReportToScheduler(prog.data);
-      if (wl.type == Workload::PRED) {
-        loss.Predict(PredictStream(conf_.predict_out(), wl), conf_.prob_predict());
-      }
-        bool train = wl.type == Workload::TRAIN;
-        if (train) {
-        // calculate and push the gradients
-        loss.CalcGrad(val);
-
-        ps::SyncOpts push_grad_opt;
-        // filters to reduce network traffic
-        SetFilters(2, &push_grad_opt);
-        // this callback will be called when the gradients have been actually
-        // pushed
-        // LL << DebugStr(*val);
-        push_grad_opt.callback = [this]() { FinishMinibatch(); };
-        server_.ZVPush(feaid,
-                       std::shared_ptr<std::vector<float>>(val),
-                       std::shared_ptr<std::vector<int>>(val_siz),
-                       push_grad_opt);
-
-      } else {
-        FinishMinibatch();
-        delete val;
-        delete val_siz;
-      }
-      delete data;
-      workload_time_ += GetTime() - start;
-    };
-
-    // filters to reduce network traffic
+    // pull the weight from the servers, then eval the loss and push the
+    // gradients by the compute stage. the pulled values are updated into the
+    // gradients in place and pushed without copying
     SetFilters(1, &pull_w_opt);
-    server_.ZVPull(feaid, val, val_siz, pull_w_opt);
+    auto pulled = server_.ZVPullAsync(feaid, pull_w_opt);
+    pulled.Then([this, data, feaid, wl](ps::KVValues<float> w) {
+        double start = GetTime();
+        // eval the objective, and report progress to the scheduler
+        Loss<float> loss(data->GetBlock(), *w.vals, *w.vals_size, conf_);
+        Progress prog; loss.Evaluate(&prog); ReportToScheduler(prog.data);
+        if (wl.type == Workload::PRED) {
+          std::string pred;
+          MemoryStringStream fo(&pred);
+          loss.Predict(&fo, conf_.prob_predict());
+          WritePredict(conf_.predict_out(), wl, pred);
+        }
+        if (wl.type == Workload::TRAIN) {
+          // calculate and push the gradients
+          loss.CalcGrad(w.vals.get());
+
+          ps::SyncOpts push_grad_opt;
+          // filters to reduce network traffic
+          SetFilters(2, &push_grad_opt);
+          double push_start = GetTime();
+          server_.ZVPushAsync(feaid, w.vals, w.vals_size, push_grad_opt)
+              .Then([this, push_start]() { FinishMinibatch(push_start); });
+        } else {
+          FinishMinibatch();
+        }
+        AddWorkloadTime(GetTime() - start);
+      }, ComputeExecutor());
   }
 
  private:
@@ -4,6 +4,7 @@
 #include "dmlc/io.h"
 #include "dmlc/logging.h"
 #include "base/localizer.h"
+#include "kv/kv_indexed_file.h"
 using namespace std;
 using namespace dmlc;
 typedef uint64_t K;
@@ -89,7 +90,46 @@ class Dump {
     cout << "dumped " << dumped << " kv pairs\n";
   }
 
+  // one line of the dump
+  std::string Line(K key, const AdaGradEntry& age) const {
+    uint64_t feature_id = need_inverse_ ? ReverseBytes(key) : key;
+    std::string write_buffer = std::to_string(feature_id);
+
+    if (age.size == 1) {
+      write_buffer.append("\t" + std::to_string(age.w_0()));
+    } else {
+      for (int i = 0; i < age.size; ++i) {
+        write_buffer.append("\t" + std::to_string(age.w[i]));
+      }
+    }
+    write_buffer.append("\n");
+    return write_buffer;
+  }
+
+  // dumps an indexed model in the order of the keys, whose width is recorded in
+  // the file. the file is mapped rather than parsed. a delta only has the
+  // changes of its parent, so it must be folded into a full model first
+  void RunIndexed() {
+    ps::KVIndexedFile file;
+    file.Open(file_in_);
+    CHECK(!file.delta()) << file_in_ << " is a delta, fold it by fold.dmlc "
+                         << "before dumping";
+    Stream* fo = CHECK_NOTNULL(Stream::Create(file_out_.c_str(), "w"));
+    for (size_t i = 0; i < file.size(); ++i) {
+      AdaGradEntry age;
+      file.Load(i, &age);
+      std::string write_buffer = Line(file.key(i), age);
+      fo->Write((char*)write_buffer.c_str(), write_buffer.length());
+    }
+    std::cout << "total dump " << file.size() << " kv pairs" << std::endl;
+    delete fo;
+  }
+
   void run() {
+    if (ps::IsIndexedModel(file_in_)) {
+      RunIndexed();
+      return;
+    }
     // LoadModel(file_in_);
     // DumpModel(file_out_);
     Stream* fi = CHECK_NOTNULL(Stream::Create(file_in_.c_str(), "r"));
@@ -100,17 +140,7 @@ class Dump {
       AdaGradEntry age;
       if (fi->Read(&key, sizeof(K)) != sizeof(K)) break;
       age.Load(fi);
-      uint64_t feature_id = need_inverse_ ? ReverseBytes(key) : key;
-      std::string write_buffer = std::to_string(feature_id);
-
-      if (age.size == 1) {
-        write_buffer.append("\t" + std::to_string(age.w_0()));
-      } else {
-        for (int i = 0; i < age.size; ++i) {
-          write_buffer.append("\t" + std::to_string(age.w[i]));
-        }
-      }
-      write_buffer.append("\n");
+      std::string write_buffer = Line(key, age);
       fo->Write((char*)write_buffer.c_str(), write_buffer.length());
       count++;
       if((count > 0) && (count % 200 == 0)){
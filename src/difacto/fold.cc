@@ -0,0 +1,30 @@
+/*
+ * \@file   fold.cc
+ * \brief   fold a chain of delta models into one indexed model
+ */
+#include <iostream>
+#include <string>
+#include "dmlc/logging.h"
+#include "kv/kv_delta.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cout << "Usage: model_in=<the last delta> model_out=<the folded model>\n";
+    return 0;
+  }
+  google::InitGoogleLogging(argv[0]);
+  std::string model_in, model_out;
+  for (int i = 1; i < argc; ++i) {
+    char name[256], val[256];
+    if (sscanf(argv[i], "%[^=]=%s", name, val) == 2) {
+      if (!strcmp(name, "model_in")) model_in = val;
+      if (!strcmp(name, "model_out")) model_out = val;
+    }
+  }
+  auto chain = ps::KVDeltaChain(model_in);
+  for (const auto& m : chain) std::cout << "folding " << m << std::endl;
+  size_t n = ps::FoldDeltas(model_in, model_out);
+  std::cout << "folded " << chain.size() << " models into " << model_out
+            << ", " << n << " kv pairs" << std::endl;
+  return 0;
+}
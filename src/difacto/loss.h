@@ -73,14 +73,15 @@ class Loss {
       SpMM::Times(V.X, V.weight, &V.XV, nt_);
 
       // py += .5 * sum((V.XV).^2 - xxvv)
-#pragma omp parallel for num_threads(nt_)
-      for (size_t i = 0; i < py_.size(); ++i) {
-        T* t = V.XV.data() + i * V.dim;
-        T* tt = xxvv.data() + i * V.dim;
-        T s = 0;
-        for (int j = 0; j < V.dim; ++j) s += t[j] * t[j] - tt[j];
-        py_[i] += .5 * s;
-      }
+      ps::ParallelFor(0, py_.size(), nt_, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          T* t = V.XV.data() + i * V.dim;
+          T* tt = xxvv.data() + i * V.dim;
+          T s = 0;
+          for (int j = 0; j < V.dim; ++j) s += t[j] * t[j] - tt[j];
+          py_[i] += .5 * s;
+        }
+      });
       prog->objv() = eval.LogitObjv();
     } else {
       prog->objv() = prog->objv_w();
@@ -102,11 +103,12 @@ class Loss {
   void CalcGrad(std::vector<T>* grad) {
     // p = ... (reuse py_)
     CHECK_EQ(py_.size(), w.X.size) << "call *evaluate* first";
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < py_.size(); ++i) {
-      T y = w.X.label[i] > 0 ? 1 : -1;
-      py_[i] = - y / ( 1 + exp ( y * py_[i] ));
-    }
+    ps::ParallelFor(0, py_.size(), nt_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        T y = w.X.label[i] > 0 ? 1 : -1;
+        py_[i] = - y / ( 1 + exp ( y * py_[i] ));
+      }
+    });
 
     // grad_w = ...
     SpMV::TransTimes(w.X, py_, &w.weight, nt_);
@@ -123,20 +125,22 @@ class Loss {
 
       // V = - diag(xxp) * V
       CHECK_EQ(V.weight.size(), dim * m);
-#pragma omp parallel for num_threads(nt_)
-      for (size_t i = 0; i < m; ++i) {
-        T* v = V.weight.data() + i * dim;
-        for (int j = 0; j < dim; ++j) v[j] *= - xxp[i];
-      }
+      ps::ParallelFor(0, m, nt_, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          T* v = V.weight.data() + i * dim;
+          for (int j = 0; j < dim; ++j) v[j] *= - xxp[i];
+        }
+      });
 
       // V.XV = diag(p) * X * V
       size_t n = py_.size();
       CHECK_EQ(V.XV.size(), n * dim);
-#pragma omp parallel for num_threads(nt_)
-      for (size_t i = 0; i < n; ++i) {
-        T* y = V.XV.data() + i * dim;
-        for (int j = 0; j < dim; ++j) y[j] *= py_[i];
-      }
+      ps::ParallelFor(0, n, nt_, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          T* y = V.XV.data() + i * dim;
+          for (int j = 0; j < dim; ++j) y[j] *= py_[i];
+        }
+      });
 
       // V += X' * V.XV
       SpMM::TransTimes(V.X, V.XV, (T)1, V.weight, &V.weight, nt_);
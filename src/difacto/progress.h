@@ -5,18 +5,21 @@ namespace dmlc {
 namespace difacto {
 
 struct Progress {
-  Progress() : data(8) { }
+  Progress() : data(11) { }
 
-  static std::string HeadStr() {
-    return "  ttl #ex   inc #ex |  |w|_0  logloss_w |   |V|_0    logloss    AUC";
+  static std::string HeadStr(bool admission = false) {
+    return std::string(
+        "  ttl #ex   inc #ex |  |w|_0  logloss_w |   |V|_0    logloss    AUC") +
+        (admission ? "   | admit  sketch" : "");
   }
 
   std::string PrintStr() {
 
-    if (data.size() < 8) data.resize(8,0);
+    if (data.size() < 11) data.resize(11,0);
     ttl_ex += new_ex();
     nnz_w += new_w();
     nnz_V += new_V();
+    sketch += new_sketch();
 
     if (new_ex() == 0) return "";
 
@@ -24,7 +27,15 @@ struct Progress {
     snprintf(buf, 256, "%9.4g  %7.2g | %9.4g  %6.4lf | %9.4g  %7.5lf  %7.5lf ",
              ttl_ex, new_ex(), nnz_w, objv_w() / new_ex(), nnz_V,
              objv() / new_ex(),  auc() / count());
-    return std::string(buf);
+    std::string str(buf);
+    if (sketch > 0) {
+      // the admission rate of the pushes on new features, and the sketch size
+      double tried = admitted() + rejected();
+      snprintf(buf, 256, "| %5.1f%%  %4.0fMB",
+               tried > 0 ? admitted() / tried * 100 : 100, sketch / 1e6);
+      str += buf;
+    }
+    return str;
   }
 
   double& objv() { return data[0]; }
@@ -37,11 +48,16 @@ struct Progress {
   double& new_w() { return data[6]; }
   double& new_V() { return data[7]; }
 
+  // the feature admission on servers
+  double& admitted() { return data[8]; }
+  double& rejected() { return data[9]; }
+  double& new_sketch() { return data[10]; }
+
   double objv() const { return data[0]; }
   double new_ex() const { return data[5]; }
 
   std::vector<double> data;
-  double ttl_ex = 0, nnz_w = 0, nnz_V;
+  double ttl_ex = 0, nnz_w = 0, nnz_V, sketch = 0;
 };
 
 }  // namespace difacto
@@ -12,6 +12,7 @@
 #include "dmlc/io.h"
 #include "dmlc/logging.h"
 #include "base/localizer.h"
+#include "kv/kv_indexed_file.h"
 using namespace dmlc;
 typedef uint64_t K;
 
@@ -56,8 +57,42 @@ struct AdaGradEntry {
     bool Empty() const { return (w_0() == 0 && size == 1); }
 };
 
+// one line pushed into production
+static std::string Line(K key, const AdaGradEntry& age, bool need_inverse) {
+    uint64_t feature_id = need_inverse ? ReverseBytes(key) : key;
+    std::string write_buffer = std::to_string(feature_id);
+    if (age.size == 1) {
+        write_buffer.append("\t" + std::to_string(age.w_0()));
+    } else {
+        for (int i = 0; i < age.size; ++i) {
+            write_buffer.append("\t" + std::to_string(age.w[i]));
+        }
+    }
+    write_buffer.append("\n");
+    return write_buffer;
+}
+
+// an indexed model is mapped and read in the order of the keys
+static void pushIndexed(const std::string model_part_file, const std::string out_part_file, bool need_inverse, int thread_no) {
+    ps::KVIndexedFile file;
+    file.Open(model_part_file);
+    Stream* fo = CHECK_NOTNULL(Stream::Create(out_part_file.c_str(), "w"));
+    for (size_t i = 0; i < file.size(); ++i) {
+        AdaGradEntry age;
+        file.Load(i, &age);
+        std::string write_buffer = Line(file.key(i), age, need_inverse);
+        fo->Write((char*)write_buffer.c_str(), write_buffer.length());
+    }
+    delete fo;
+    std::cout << "thread " << thread_no << " total pushed " << file.size() << " kv pairs." << std::endl;
+}
+
 public:
 static void push(const std::string model_part_file, const std::string out_part_file, bool need_inverse, int thread_no) {
+    if (ps::IsIndexedModel(model_part_file)) {
+        pushIndexed(model_part_file, out_part_file, need_inverse, thread_no);
+        return;
+    }
     Stream* fi = CHECK_NOTNULL(Stream::Create(model_part_file.c_str(), "r"));
     Stream* fo = CHECK_NOTNULL(Stream::Create(out_part_file.c_str(), "w"));
     int count = 0;
@@ -66,18 +101,7 @@ static void push(const std::string model_part_file, const std::string out_part_f
         AdaGradEntry age;
         if (fi->Read(&key, sizeof(K)) != sizeof(K)) break;
         age.Load(fi);
-        uint64_t feature_id = need_inverse ? ReverseBytes(key) : key;
-        std::string write_buffer = "";
-
-        if (age.size == 1) {
-            write_buffer = std::to_string(feature_id) + "\t" + std::to_string(age.w_0()) + "\n";
-        } else {
-            write_buffer.append(std::to_string(feature_id));
-            for (int i = 0; i < age.size; ++i) {
-                write_buffer.append("\t" + std::to_string(age.w[i]));
-            }
-            write_buffer.append("\n");
-        }
+        std::string write_buffer = Line(key, age, need_inverse);
         fo->Write((char*)write_buffer.c_str(), write_buffer.length());
         count += 1;
         if ((count > 0) && (count % 500 == 0)) {
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "dmlc/memory_io.h"
+#include "kv/kv_cold_tier.h"
+#include "async_sgd.h"
+
+using namespace dmlc::difacto;
+
+// defined by difacto.cc, which the tests do not link
+std::atomic<int64_t> dmlc::difacto::ISGDHandle::new_w(0);
+std::atomic<int64_t> dmlc::difacto::ISGDHandle::new_V(0);
+
+namespace {
+
+const int kDim = 4;
+
+template <typename E>
+class EntryTest : public testing::Test {
+ protected:
+  EntryTest() {
+    EmbeddingSlab::Get().Init(1, kDim);
+    h_.V.dim = kDim;
+    h_.V.thr = 5;
+    h_.l1_shrk = false;
+  }
+
+  /// pushes the count \a cnt of feature 1 into \a e
+  void PushCount(float cnt, E* e) {
+    h_.Start(true, 0, kPushFeaCnt, nullptr);
+    h_.Push(1, Blob<const float>(&cnt, 1), *e);
+  }
+
+  AdaGradHandle h_;
+};
+
+typedef testing::Types<AdaGradEntry, FixedAdaGradEntry<kDim>> EntryTypes;
+
+}  // namespace
+
+TYPED_TEST_SUITE(EntryTest, EntryTypes);
+
+TYPED_TEST(EntryTest, SaveFeaCnt) {
+  TypeParam e;
+  e.w_0() = .5; e.sqc_grad_0() = 2; e.z_0() = -1;
+  e.fea_cnt = 7;
+  std::string buf;
+  dmlc::MemoryStringStream fo(&buf);
+  e.Save(&fo);
+  // the same file format as before, 4 floats after the size
+  EXPECT_EQ(buf.size(), sizeof(int) + 4 * sizeof(float));
+
+  TypeParam f;
+  f.fea_cnt = 100;
+  dmlc::MemoryStringStream fi(&buf);
+  f.Reload(&fi);
+  EXPECT_EQ(f.size, 1);
+  EXPECT_EQ(f.fea_cnt, 7U);
+  EXPECT_EQ(f.w_0(), .5);
+  EXPECT_EQ(f.sqc_grad_0(), 2);
+  EXPECT_EQ(f.z_0(), -1);
+}
+
+TYPED_TEST(EntryTest, DemoteKeepsFeaCnt) {
+  // a feature reaching the threshold over a demote and a promote gets V
+  std::string file = testing::TempDir() + "difacto_unittest_" +
+      std::to_string(getpid());
+  ps::KVColdTier<FeaID, TypeParam> cold;
+  cold.Open(file);
+  TypeParam e;
+  this->PushCount(3, &e);
+  EXPECT_EQ(e.size, 1);
+  cold.Put(1, e);
+
+  TypeParam f;
+  f.fea_cnt = 100;
+  ASSERT_TRUE(cold.Take(1, &f));
+  EXPECT_EQ(f.fea_cnt, 3U);
+  this->PushCount(3, &f);
+  EXPECT_EQ(f.size, kDim + 1);
+
+  // the count is not needed once V is allocated
+  cold.Put(1, f);
+  TypeParam g;
+  g.fea_cnt = 100;
+  ASSERT_TRUE(cold.Take(1, &g));
+  EXPECT_EQ(g.size, kDim + 1);
+  EXPECT_EQ(g.fea_cnt, 0U);
+  for (int i = 0; i < kDim + 1; ++i) EXPECT_EQ(g.w()[i], f.w()[i]);
+  unlink(file.c_str());
+}
@@ -2,6 +2,7 @@
  * @file   async_sgd.h
  * @brief  Asynchronous stochastic gradient descent to solve linear methods.
  */
+#include "dmlc/memory_io.h"
 #include "solver/minibatch_solver.h"
 #include "config.pb.h"
 #include "progress.h"
@@ -27,8 +28,8 @@ struct ISGDHandle {
     // avoid too frequently reporting
     ++ ct_;
     if (ct_ >= ns_ && reporter) {
-      Progress prog; prog.new_w() = new_w; reporter(prog);
-      new_w = 0; ct_ = 0;
+      Progress prog; prog.new_w() = new_w.exchange(0); reporter(prog);
+      ct_ = 0;
     }
   }
 
@@ -40,6 +41,42 @@ struct ISGDHandle {
     }
   }
 
+#ifdef __SSE__
+  /// \brief returns the change of the number of nonzero w for 4 elements
+  inline static int CountNewW(__m128 cur_w, __m128 old_w) {
+    const __m128 zero = _mm_setzero_ps();
+    return __builtin_popcount(_mm_movemask_ps(_mm_cmpneq_ps(cur_w, zero))) -
+        __builtin_popcount(_mm_movemask_ps(_mm_cmpneq_ps(old_w, zero)));
+  }
+#endif
+
+  /**
+   * \brief applies a batch push with Handle::PushColumns by gathering the
+   * entries into columns chunk by chunk
+   */
+  template <typename Handle, typename Entry>
+  inline static void PushByColumns(Handle* h, size_t n,
+                                   const Blob<const float>* grad, Entry** val) {
+    const int kCols = sizeof(Entry) / sizeof(float);
+    const size_t kChunk = 64;
+    float g[kChunk], buf[kCols][kChunk];
+    float* col[kCols];
+    for (int c = 0; c < kCols; ++c) col[c] = buf[c];
+    for (size_t i = 0; i < n; i += kChunk) {
+      size_t m = std::min(kChunk, n - i);
+      for (size_t j = 0; j < m; ++j) {
+        g[j] = grad[i+j].data[0];
+        const float* v = reinterpret_cast<const float*>(val[i+j]);
+        for (int c = 0; c < kCols; ++c) buf[c][j] = v[c];
+      }
+      h->PushColumns(m, g, col);
+      for (size_t j = 0; j < m; ++j) {
+        float* v = reinterpret_cast<float*>(val[i+j]);
+        for (int c = 0; c < kCols; ++c) v[c] = buf[c][j];
+      }
+    }
+  }
+
   void Load(Stream* fi) { }
   void Save(Stream *fo) const { }
 
@@ -49,7 +86,8 @@ struct ISGDHandle {
   float alpha = 0.1, beta = 1;
 
   std::function<void(const Progress& prog)> reporter;
-  static int64_t new_w;
+  // updated by all threads of the server
+  static std::atomic<int64_t> new_w;
 
  private:
   int ct_ = 0;
@@ -78,14 +116,16 @@ struct SGDEntry {
 /**
  * \brief Standard SGD handle
  *
- * use alpha / ( beta + sqrt(t)) as the learning rate
+ * use alpha / ( beta + sqrt(t)) as the learning rate, where t counts the
+ * pushes. t is shared by the copies of the handle, so concurrent requests
+ * advance the same schedule.
  */
 struct SGDHandle : public ISGDHandle {
  public:
   inline void Start(bool push, int timestamp, int cmd, void* msg) {
     if (push) {
-      eta = (this->beta + sqrt((float)t)) / this->alpha;
-      t += 1;
+      int64_t cur_t = (*t)++;
+      eta = (this->beta + sqrt((float)cur_t)) / this->alpha;
     }
   }
   inline void Push(FeaID key, Blob<const float> grad, SGDEntry& w) {
@@ -97,7 +137,38 @@ struct SGDHandle : public ISGDHandle {
   inline void Pull(FeaID key, const SGDEntry& w, Blob<float>& send) {
     send[0] = w.w;
   }
-  int t = 1;
+
+  /// \brief batch push for ps::KVStoreSparse
+  inline void PushBatch(size_t n, const FeaID* key,
+                        const Blob<const float>* grad, SGDEntry** val) {
+    PushByColumns(this, n, grad, val);
+  }
+
+  /// \brief batch update for ps::KVStoreColumn, col = {w}
+  inline void PushColumns(size_t n, const float* grad, float* const* col) {
+    float* w = col[0];
+    size_t i = 0;
+#ifdef __SSE__
+    const __m128 eta4 = _mm_set1_ps(eta);
+    int cnt = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 old_w = _mm_loadu_ps(w+i);
+      __m128 cur_w = penalty.Solve(
+          _mm_sub_ps(_mm_mul_ps(eta4, old_w), _mm_loadu_ps(grad+i)), eta4);
+      _mm_storeu_ps(w+i, cur_w);
+      cnt += CountNewW(cur_w, old_w);
+    }
+    new_w += cnt;
+#endif
+    for (; i < n; ++i) {
+      SGDEntry val; val.w = w[i];
+      Push(0, Blob<const float>(grad+i, 1), val);
+      w[i] = val.w;
+    }
+  }
+  std::shared_ptr<std::atomic<int64_t>> t =
+      std::make_shared<std::atomic<int64_t>>(1);
+  // the learning rate of the current push
   float eta = 0;
 };
 
@@ -144,6 +215,40 @@ struct AdaGradHandle : public ISGDHandle {
   inline void Pull(FeaID key, const AdaGradEntry& val, Blob<float>& send) {
     send[0] = val.w;
   }
+
+  /// \brief batch push for ps::KVStoreSparse
+  inline void PushBatch(size_t n, const FeaID* key,
+                        const Blob<const float>* grad, AdaGradEntry** val) {
+    PushByColumns(this, n, grad, val);
+  }
+
+  /// \brief batch update for ps::KVStoreColumn, col = {w, sq_cum_grad}
+  inline void PushColumns(size_t n, const float* grad, float* const* col) {
+    float* w = col[0]; float* sq = col[1];
+    size_t i = 0;
+#ifdef __SSE__
+    const __m128 alpha4 = _mm_set1_ps(alpha), beta4 = _mm_set1_ps(beta);
+    int cnt = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 g = _mm_loadu_ps(grad+i);
+      __m128 sqrt_n = _mm_loadu_ps(sq+i);
+      sqrt_n = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(sqrt_n, sqrt_n), _mm_mul_ps(g, g)));
+      _mm_storeu_ps(sq+i, sqrt_n);
+
+      __m128 eta = _mm_div_ps(_mm_add_ps(sqrt_n, beta4), alpha4);
+      __m128 old_w = _mm_loadu_ps(w+i);
+      __m128 cur_w = penalty.Solve(_mm_sub_ps(_mm_mul_ps(eta, old_w), g), eta);
+      _mm_storeu_ps(w+i, cur_w);
+      cnt += CountNewW(cur_w, old_w);
+    }
+    new_w += cnt;
+#endif
+    for (; i < n; ++i) {
+      AdaGradEntry val; val.w = w[i]; val.sq_cum_grad = sq[i];
+      Push(0, Blob<const float>(grad+i, 1), val);
+      w[i] = val.w; sq[i] = val.sq_cum_grad;
+    }
+  }
 };
 
 /**
@@ -190,15 +295,58 @@ struct FTRLHandle : public ISGDHandle {
     Update(val.w, old_w);
   }
 
-  inline void Pull(FeaID key, FTRLEntry& val, Blob<float>& send) {
+  inline void Pull(FeaID key, const FTRLEntry& val, Blob<float>& send) {
     send[0] = val.w;
   }
+
+  /// \brief batch push for ps::KVStoreSparse
+  inline void PushBatch(size_t n, const FeaID* key,
+                        const Blob<const float>* grad, FTRLEntry** val) {
+    PushByColumns(this, n, grad, val);
+  }
+
+  /// \brief batch update for ps::KVStoreColumn, col = {w, z, sq_cum_grad}
+  inline void PushColumns(size_t n, const float* grad, float* const* col) {
+    float* w = col[0]; float* z = col[1]; float* sq = col[2];
+    size_t i = 0;
+#ifdef __SSE__
+    const __m128 alpha4 = _mm_set1_ps(alpha), beta4 = _mm_set1_ps(beta);
+    const __m128 sign = _mm_set1_ps(-0.f);
+    int cnt = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 g = _mm_loadu_ps(grad+i);
+      __m128 sqrt_n = _mm_loadu_ps(sq+i);
+      __m128 cur_sq = _mm_sqrt_ps(
+          _mm_add_ps(_mm_mul_ps(sqrt_n, sqrt_n), _mm_mul_ps(g, g)));
+      _mm_storeu_ps(sq+i, cur_sq);
+
+      __m128 old_w = _mm_loadu_ps(w+i);
+      __m128 sigma = _mm_div_ps(_mm_sub_ps(cur_sq, sqrt_n), alpha4);
+      __m128 zi = _mm_add_ps(_mm_loadu_ps(z+i),
+                             _mm_sub_ps(g, _mm_mul_ps(sigma, old_w)));
+      _mm_storeu_ps(z+i, zi);
+
+      __m128 cur_w = penalty.Solve(
+          _mm_xor_ps(zi, sign), _mm_div_ps(_mm_add_ps(beta4, cur_sq), alpha4));
+      _mm_storeu_ps(w+i, cur_w);
+      cnt += CountNewW(cur_w, old_w);
+    }
+    new_w += cnt;
+#endif
+    for (; i < n; ++i) {
+      FTRLEntry val; val.w = w[i]; val.z = z[i]; val.sq_cum_grad = sq[i];
+      Push(0, Blob<const float>(grad+i, 1), val);
+      w[i] = val.w; z[i] = val.z; sq[i] = val.sq_cum_grad;
+    }
+  }
 };
 
 
 class AsgdServer : public solver::MinibatchServer {
  public:
   AsgdServer(const Config& conf) : conf_(conf) {
+    CHECK(!conf_.index_model() || !conf_.shard_model())
+        << "index_model cannot be used with shard_model";
     auto algo = conf_.algo();
     if (algo == Config::SGD) {
       CreateServer<SGDEntry, SGDHandle>();
@@ -224,20 +372,99 @@ class AsgdServer : public solver::MinibatchServer {
     h.reporter = [this](const Progress& prog) {
       ReportToScheduler(prog.data);
     };
-    ps::OnlineServer<float, Entry, Handle> s(h);
-    server_ = s.server();
+    if (conf_.server_store() == Config::COLUMN_STORE) {
+      CHECK(!conf_.shard_model() && !conf_.index_model() &&
+            !conf_.async_save())
+          << "the column store cannot shard, index, or save the model in the "
+          << "background";
+      ps::OnlineColumnServer<float, Entry, Handle> s(h, 1, conf_.num_threads());
+      server_ = s.server();
+    } else if (conf_.server_store() == Config::FLAT_HASH_MAP) {
+      ps::OnlineServer<float, Entry, Handle,
+                       ps::FlatHashMap<FeaID, Entry>> s(
+                           h, 1, conf_.num_threads());
+      server_ = s.server();
+    } else {
+      ps::OnlineServer<float, Entry, Handle> s(h, 1, conf_.num_threads());
+      server_ = s.server();
+    }
+    ps::NumaConf numa;
+    numa.pin = conf_.numa();
+    numa.nodes.assign(conf_.numa_nodes().begin(), conf_.numa_nodes().end());
+    numa.huge_pages = static_cast<ps::NumaMemory::HugePages>(conf_.huge_pages());
+    server_->SetNuma(numa);
+    if (conf_.delta_iter() > 0) server_->TrackChanges();
+    server_->SetConcurrency(conf_.concurrent_requests());
+    server_->SetAggregation(conf_.aggregate_requests(), conf_.aggregate_usec());
+
+    ps::KVHotKeyConf hot;
+    hot.max_keys = std::max(conf_.hot_keys(), 0);
+    hot.min_share = conf_.hot_key_share();
+    hot.round_sec = conf_.hot_key_round_sec();
+    server_->SetHotKeys(hot);
   }
 
   virtual void LoadModel(Stream* fi) {
     server_->Load(fi);
-    Progress prog; prog.new_w() = ISGDHandle::new_w; ReportToScheduler(prog.data);
-    ISGDHandle::new_w = 0;
+    ReportModelSize();
   }
 
   virtual void SaveModel(Stream* fo) const {
     server_->Save(fo);
   }
 
+  virtual void LoadModelFile(const std::string& filename) {
+    server_->LoadFile(filename, conf_.lazy_load());
+    ReportModelSize();
+  }
+
+  virtual void SaveModelFile(const std::string& filename, bool async) const {
+    if (async) {
+      // the changes are cleared at the snapshot point
+      ps::KVSaveConf save;
+      save.name = filename;
+      save.compress = conf_.compress_model();
+      save.format = conf_.index_model() ? ps::KVSaveConf::kIndexed :
+                    conf_.shard_model() ? ps::KVSaveConf::kShards :
+                    ps::KVSaveConf::kStream;
+      server_->SaveAsync(save);
+      return;
+    }
+    if (conf_.index_model()) {
+      server_->SaveIndexed(filename);
+    } else if (conf_.shard_model()) {
+      server_->SaveShards(filename, conf_.compress_model());
+    } else {
+      server_->FlushPushes();
+      solver::MinibatchServer::SaveModelFile(filename, false);
+    }
+    server_->ClearChanges();
+  }
+
+  virtual void SaveDeltaFile(const std::string& filename,
+                             const std::string& parent, bool async) {
+    if (async) {
+      ps::KVSaveConf save;
+      save.name = filename;
+      save.format = ps::KVSaveConf::kDelta;
+      save.parent = parent;
+      server_->SaveAsync(save);
+    } else {
+      server_->SaveDelta(filename, parent);
+    }
+  }
+
+  /// reports the |w|_0 of the loaded model
+  void ReportModelSize() {
+    Progress prog; prog.new_w() = ISGDHandle::new_w.exchange(0);
+    ReportToScheduler(prog.data);
+  }
+
+  virtual void CompactModel() {
+    size_t bytes = server_->Compact();
+    LOG(INFO) << "compacted the model, " << bytes / 1e6 << " MB reclaimed";
+  }
+
   Config conf_;
   ps::KVStore* server_;
 };
@@ -249,59 +476,58 @@ class AsgdWorker : public solver::MinibatchWorker {
     shuffle_       = conf_.rand_shuffle();
     concurrent_mb_ = conf_.max_concurrency();
     neg_sampling_  = conf_.neg_sampling();
+    if (conf_.hot_keys() > 0) kv_.ReplicateHotKeys(conf_.hot_key_round_sec());
     nt_            = conf_.num_threads();
+    parse_threads_    = conf_.parse_threads();
+    localize_threads_ = conf_.localize_threads();
+    compute_threads_  = conf_.compute_threads();
   }
   virtual ~AsgdWorker() { }
 
  protected:
   virtual void ProcessMinibatch(const Minibatch& mb, const Workload& wl) {
     // find the unique feature ids in this minibatch
-    auto data = new dmlc::data::RowBlockContainer<unsigned>();
+    auto data = std::make_shared<dmlc::data::RowBlockContainer<unsigned>>();
     auto feaid = std::make_shared<std::vector<FeaID>>();
 
     double start = GetTime();
     Localizer<FeaID> lc(nt_);
-    lc.Localize(mb, data, feaid.get());
-    workload_time_ += GetTime() - start;
-
-    // pull the weight from the servers
-    auto val = new std::vector<float>();
-    ps::SyncOpts pull_w_opt;
-
-    // this callback will be called when the weight has been actually pulled
-    // back
-    int k = wl.file[0].k;
-    pull_w_opt.callback = [this, data, feaid, val, k, wl]() {
-      double start = GetTime();
-      // eval the objective, and report progress to the scheduler
-      auto loss = CreateLoss<float>(conf_.loss());
-      loss->Init(data->GetBlock(), *val, nt_);
-      Progress prog; loss->Evaluate(&prog); ReportToScheduler(prog.data);
-      if (wl.type == Workload::PRED) {
-        loss->Predict(PredictStream(conf_.predict_out(), wl), conf_.prob_predict());
-      }
-      bool train = wl.type == Workload::TRAIN;
-      if (train) {
-        // calculate and push the gradients
-        loss->CalcGrad(val);
-
-        ps::SyncOpts push_grad_opt;
-        // filters to reduce network traffic
-        SetFilters(train, &push_grad_opt);
-        // this callback will be called when the gradients have been actually
-        // pushed
-        push_grad_opt.callback = [this]() { FinishMinibatch(); };
-        kv_.ZPush(
-            feaid, std::shared_ptr<std::vector<float>>(val), push_grad_opt);
-      } else {
-        FinishMinibatch();
-        delete val;
-      }
-      delete loss;
-      delete data;
-      workload_time_ += GetTime() - start;
-    };
-    kv_.ZPull(feaid, val, pull_w_opt);
+    lc.Localize(mb, data.get(), feaid.get());
+    AddWorkloadTime(GetTime() - start);
+
+    // pull the weight from the servers, then eval the loss and push the
+    // gradients by the compute stage. the pulled values are updated into the
+    // gradients in place and pushed without copying
+    auto pulled = kv_.ZPullAsync(feaid);
+    pulled.Then([this, data, feaid, wl](ps::KVValues<float> w) {
+        double start = GetTime();
+        // eval the objective, and report progress to the scheduler
+        auto loss = CreateLoss<float>(conf_.loss());
+        loss->Init(data->GetBlock(), *w.vals, nt_);
+        Progress prog; loss->Evaluate(&prog); ReportToScheduler(prog.data);
+        if (wl.type == Workload::PRED) {
+          std::string pred;
+          MemoryStringStream fo(&pred);
+          loss->Predict(&fo, conf_.prob_predict());
+          WritePredict(conf_.predict_out(), wl, pred);
+        }
+        bool train = wl.type == Workload::TRAIN;
+        if (train) {
+          // calculate and push the gradients
+          loss->CalcGrad(w.vals.get());
+
+          ps::SyncOpts push_grad_opt;
+          // filters to reduce network traffic
+          SetFilters(train, &push_grad_opt);
+          double push_start = GetTime();
+          kv_.ZPushAsync(feaid, w.vals, push_grad_opt)
+              .Then([this, push_start]() { FinishMinibatch(push_start); });
+        } else {
+          FinishMinibatch();
+        }
+        delete loss;
+        AddWorkloadTime(GetTime() - start);
+      }, ComputeExecutor());
   }
  private:
   void SetFilters(bool push, ps::SyncOpts* opts) {
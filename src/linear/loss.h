@@ -106,11 +106,12 @@ class LogitLoss : public BinClassLoss<V> {
   virtual void CalcGrad(std::vector<V>* grad) {
     CHECK(init_);
     std::vector<V> dual(data_.size);
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < data_.size; ++i) {
-      V y = data_.label[i] > 0 ? 1 : -1;
-      dual[i] = - y / ( 1 + exp ( y * Xw_[i] ));
-    }
+    ps::ParallelFor(0, data_.size, nt_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        V y = data_.label[i] > 0 ? 1 : -1;
+        dual[i] = - y / ( 1 + exp ( y * Xw_[i] ));
+      }
+    });
     SpMV::TransTimes(data_, dual, grad, nt_);
   }
 };
@@ -128,31 +129,34 @@ class SquareHingeLoss : public BinClassLoss<V> {
 
   virtual void Evaluate(Progress* prog) {
     BinClassLoss<V>::Evaluate(prog);
-    V objv = 0;
-#pragma omp parallel for reduction(+:objv) num_threads(nt_)
-    for (size_t i = 0; i < data_.size; ++i) {
-      V y = data_.label[i] > 0 ? 1 : -1;
-      V tmp = std::max(1 - y * Xw_[i], (V)0);
-      objv += tmp * tmp;
-    }
-    prog->objv() = objv;
+    prog->objv() = ps::ParallelSum<V>(0, data_.size, nt_, [&](size_t begin, size_t end) {
+        V objv = 0;
+        for (size_t i = begin; i < end; ++i) {
+          V y = data_.label[i] > 0 ? 1 : -1;
+          V tmp = std::max(1 - y * Xw_[i], (V)0);
+          objv += tmp * tmp;
+        }
+        return objv;
+      });
   }
 
   virtual void CalcGrad(std::vector<V>* grad) {
     CHECK(init_);
 
     std::vector<V> dual(data_.size);
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < data_.size; ++i) {
-      V y = data_.label[i] > 0 ? 1 : -1;
-      dual[i] = y * (y * Xw_[i] > 1.0);
-    }
+    ps::ParallelFor(0, data_.size, nt_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        V y = data_.label[i] > 0 ? 1 : -1;
+        dual[i] = y * (y * Xw_[i] > 1.0);
+      }
+    });
     SpMV::TransTimes(data_, dual, grad, nt_);
 
-#pragma omp parallel for num_threads(nt_)
-    for (size_t i = 0; i < grad->size(); ++i) {
-      (*grad)[i] *= -2.0;
-    }
+    ps::ParallelFor(0, grad->size(), nt_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        (*grad)[i] *= -2.0;
+      }
+    });
   }
 };
 
@@ -0,0 +1,82 @@
+// the batch updates of the handles by columns, which ps::KVStoreColumn calls,
+// give the same entries and counts of nonzero weights as the updates key by
+// key. The lengths cover both the vectorized loops and their tails
+#include <gtest/gtest.h>
+#include <random>
+#include "async_sgd.h"
+
+using namespace dmlc::linear;
+
+// defined by linear.cc, which the tests do not link
+std::atomic<int64_t> dmlc::linear::ISGDHandle::new_w(0);
+
+namespace {
+
+template <typename E, typename H>
+struct Types {
+  typedef E Entry;
+  typedef H Handle;
+};
+
+template <typename T>
+class PushColumnsTest : public testing::Test {
+ protected:
+  typedef typename T::Entry Entry;
+  typedef typename T::Handle Handle;
+  static const int kCols = sizeof(Entry) / sizeof(float);
+
+  PushColumnsTest() {
+    h_.penalty.set_lambda1(.05);
+    h_.penalty.set_lambda2(.1);
+  }
+
+  /// pushes random gradients into \a n entries by columns and by keys, and
+  /// checks the results are the same
+  void Run(size_t n) {
+    std::vector<Entry> entry(n);
+    std::vector<float> grad(n);
+    std::vector<float> buf[kCols];
+    for (auto& b : buf) b.resize(n);
+    float* col[kCols];
+    for (int c = 0; c < kCols; ++c) col[c] = buf[c].data();
+    for (int r = 0; r < 20; ++r) {
+      for (size_t i = 0; i < n; ++i) {
+        // some gradients are 0, so some weights stay or become 0
+        grad[i] = gen_() % 4 ? (float)(gen_() % 200) / 100 - 1 : 0;
+        const float* v = reinterpret_cast<const float*>(&entry[i]);
+        for (int c = 0; c < kCols; ++c) col[c][i] = v[c];
+      }
+      h_.Start(true, 0, 0, nullptr);
+      int64_t w0 = ISGDHandle::new_w;
+      h_.PushColumns(n, grad.data(), col);
+      int64_t by_col = ISGDHandle::new_w - w0;
+      w0 = ISGDHandle::new_w;
+      for (size_t i = 0; i < n; ++i) {
+        h_.Push(i, Blob<const float>(&grad[i], 1), entry[i]);
+      }
+      EXPECT_EQ(by_col, ISGDHandle::new_w - w0) << n << " keys, round " << r;
+      for (size_t i = 0; i < n; ++i) {
+        const float* v = reinterpret_cast<const float*>(&entry[i]);
+        for (int c = 0; c < kCols; ++c) {
+          ASSERT_FLOAT_EQ(col[c][i], v[c]) << "key " << i << ", column " << c;
+        }
+      }
+    }
+  }
+
+  Handle h_;
+  std::mt19937 gen_{0};
+};
+
+typedef testing::Types<
+  Types<SGDEntry, SGDHandle>,
+  Types<AdaGradEntry, AdaGradHandle>,
+  Types<FTRLEntry, FTRLHandle>> AllTypes;
+
+}  // namespace
+
+TYPED_TEST_SUITE(PushColumnsTest, AllTypes);
+
+TYPED_TEST(PushColumnsTest, SameAsPush) {
+  for (size_t n : {1, 3, 4, 37, 256}) this->Run(n);
+}
@@ -0,0 +1,157 @@
+// all methods of dmlc::Localizer give the same results as a naive one. The
+// blocks are small ones, large ones with uniform indices and large ones
+// dominated by hot indices, which kAuto localizes by kSort, kRadix and kHash
+// respectively. Each block is localized by every method and thread count,
+// also with the hash kernel of -max_key, and remapped with a dictionary which
+// drops some of the indices.
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include "base/localizer.h"
+
+using namespace dmlc;
+typedef uint64_t I;
+typedef Localizer<I> Loc;
+
+namespace {
+
+/// the results of localizing a block
+struct Result {
+  std::vector<I> uniq;
+  std::vector<unsigned> frq;
+  std::vector<uint8_t> frq8;
+  data::RowBlockContainer<unsigned> local, dropped;
+};
+
+void ExpectEqual(const data::RowBlockContainer<unsigned>& a,
+           const data::RowBlockContainer<unsigned>& b) {
+  EXPECT_TRUE(a.offset == b.offset);
+  EXPECT_TRUE(a.index == b.index);
+  EXPECT_TRUE(a.value == b.value);
+  EXPECT_TRUE(a.label == b.label);
+  EXPECT_EQ(a.max_index, b.max_index);
+}
+
+void ExpectEqual(const Result& a, const Result& b) {
+  EXPECT_TRUE(a.uniq == b.uniq);
+  EXPECT_TRUE(a.frq == b.frq);
+  EXPECT_TRUE(a.frq8 == b.frq8);
+  ExpectEqual(a.local, b.local);
+  ExpectEqual(a.dropped, b.dropped);
+}
+
+/// every other unique key
+std::vector<I> Halve(const std::vector<I>& uniq) {
+  std::vector<I> dict;
+  for (size_t i = 0; i < uniq.size(); i += 2) dict.push_back(uniq[i]);
+  return dict;
+}
+
+/// localizes by a std::map
+Result Naive(const RowBlock<I>& blk) {
+  I max_index = std::numeric_limits<I>::max();
+  bool hashed = ps::FLAGS_max_key < (uint64_t)max_index;
+  auto key = [hashed](I x) {
+    return hashed ? x % (I)ps::FLAGS_max_key : ReverseBytes(x);
+  };
+  size_t n = blk.offset[blk.size];
+  std::map<I, unsigned> cnt;
+  for (size_t j = 0; j < n; ++j) ++ cnt[key(blk.index[j])];
+  Result r;
+  std::map<I, unsigned> rank;
+  for (const auto& c : cnt) {
+    rank[c.first] = r.uniq.size();
+    r.uniq.push_back(c.first);
+    r.frq.push_back(c.second);
+    r.frq8.push_back((uint8_t)std::min(c.second, 255U));
+  }
+  std::vector<I> dict = Halve(r.uniq);
+  for (auto* o : {&r.local, &r.dropped}) {
+    o->offset.assign(1, 0);
+    for (size_t i = 0; i < blk.size; ++i) {
+      for (size_t j = blk.offset[i]; j < blk.offset[i+1]; ++j) {
+        unsigned k = rank[key(blk.index[j])];
+        if (o == &r.dropped) {
+          if (k % 2) continue;
+          k /= 2;
+        }
+        o->index.push_back(k);
+        if (blk.value) o->value.push_back(blk.value[j]);
+      }
+      o->offset.push_back(o->index.size());
+      o->label.push_back(blk.label[i]);
+    }
+    o->max_index = (o == &r.local ? r.uniq.size() : dict.size()) - 1;
+  }
+  return r;
+}
+
+/// localizes by \a loc
+Result Run(const RowBlock<I>& blk, Loc* loc) {
+  Result r;
+  loc->CountUniqIndex(blk, &r.uniq, &r.frq);
+  loc->RemapIndex(blk, r.uniq, &r.local);
+  loc->Clear();
+  std::vector<I> uniq;
+  loc->CountUniqIndex(blk, &uniq, &r.frq8);
+  EXPECT_TRUE(uniq == r.uniq);
+  loc->RemapIndex(blk, Halve(uniq), &r.dropped);
+  loc->Clear();
+  return r;
+}
+
+/// a block of \a rows rows with about \a nnz indices per row, \a hot of the
+/// indices are drawn from 100 ones
+data::RowBlockContainer<I> Block(std::mt19937_64* gen, size_t rows, int nnz,
+                                 double hot) {
+  std::uniform_real_distribution<double> uni(0, 1);
+  data::RowBlockContainer<I> blk;
+  blk.offset.assign(1, 0);
+  bool value = (*gen)() % 2;
+  for (size_t i = 0; i < rows; ++i) {
+    int n = (*gen)() % (2 * nnz + 1);
+    for (int j = 0; j < n; ++j) {
+      I x = (*gen)();
+      if (uni(*gen) < hot) x %= 100;
+      blk.index.push_back(x);
+      if (value) blk.value.push_back((real_t)uni(*gen));
+    }
+    blk.offset.push_back(blk.index.size());
+    blk.label.push_back((*gen)() % 2 ? 1 : -1);
+  }
+  return blk;
+}
+
+/// localizes a block by all methods, \a expect is the one chosen by kAuto
+void Check(const data::RowBlockContainer<I>& data, Loc::Method expect) {
+  auto blk = data.GetBlock();
+  Result naive = Naive(blk);
+  for (int nt : {1, 3, 4}) {
+    for (auto m : {Loc::kAuto, Loc::kSort, Loc::kRadix, Loc::kHash}) {
+      SCOPED_TRACE(testing::Message() << nt << " threads, method " << m);
+      Loc loc(nt, m);
+      Result r = Run(blk, &loc);
+      EXPECT_EQ(loc.method(), m == Loc::kAuto ? expect : m);
+      ExpectEqual(r, naive);
+    }
+  }
+}
+
+/// checks blocks of the kind localized by \a expect, with and without hashing
+void CheckBlocks(size_t rows, int nnz, double hot, Loc::Method expect) {
+  ps::TaskScheduler::SetNumThreads(4);
+  std::mt19937_64 gen(rows * nnz);
+  for (uint64_t max_key : {(uint64_t)-1, (uint64_t)100000}) {
+    ps::FLAGS_max_key = max_key;
+    for (int r = 0; r < 3; ++r) Check(Block(&gen, rows, nnz, hot), expect);
+  }
+  ps::FLAGS_max_key = -1;
+}
+
+}  // namespace
+
+TEST(Localizer, Small) { CheckBlocks(100, 20, .5, Loc::kSort); }
+
+TEST(Localizer, Uniform) { CheckBlocks(5000, 40, 0, Loc::kRadix); }
+
+TEST(Localizer, Hot) { CheckBlocks(5000, 40, .9, Loc::kHash); }
@@ -2,6 +2,7 @@
  * @file   iter_solver.h
  * @brief  Template for an iterate solver
  */
+#include <mutex>
 #include "solver/data_parallel.h"
 namespace dmlc {
 namespace solver {
@@ -19,10 +20,16 @@ struct IterCmd : public DataParCmd {
   void set_iter(int iter) { cmd |= (iter+1) << 16; }
   void set_load_model() { cmd |= 1<<1; }
   void set_save_model() { cmd |= 1<<2; }
+  void set_compact_model() { cmd |= 1<<3; }
+  void set_delta_model() { cmd |= 1<<4; }
+  void set_async_save() { cmd |= 1<<5; }
 
   // accessors
   bool load_model() const { return cmd & 1<<1; }
   bool save_model() const { return cmd & 1<<2; }
+  bool compact_model() const { return cmd & 1<<3; }
+  bool delta_model() const { return cmd & 1<<4; }
+  bool async_save() const { return cmd & 1<<5; }
   int iter() const { return (cmd >> 16)-1; }
 };
 
@@ -48,13 +55,41 @@ class IterScheduler : public DataParScheduler {
    *
    * @param filename model filename
    * @param iter save for a particualr iteration. if -1, then saved as the last
+   * @param async the request finishes once the servers take a snapshot of the
+   * model, which is saved in the background while training goes on
    */
-  int SaveModel(const std::string& filename, int iter) {
+  int SaveModel(const std::string& filename, int iter, bool async = false) {
     IterCmd cmd; cmd.set_save_model(); cmd.set_iter(iter);
+    if (async) cmd.set_async_save();
     ps::Task task; task.set_cmd(cmd.cmd); task.set_msg(filename);
     return Submit(task, ps::kServerGroup);
   }
 
+  /**
+   * \brief Ask all servers to save the changes of the model since the last
+   * saved or loaded one, return the timestamp of this request
+   *
+   * @param filename model filename
+   * @param iter save for a particualr iteration. if -1, then saved as the last
+   * @param async save in the background, see \ref SaveModel
+   */
+  int SaveDelta(const std::string& filename, int iter, bool async = false) {
+    IterCmd cmd; cmd.set_save_model(); cmd.set_delta_model(); cmd.set_iter(iter);
+    if (async) cmd.set_async_save();
+    ps::Task task; task.set_cmd(cmd.cmd); task.set_msg(filename);
+    return Submit(task, ps::kServerGroup);
+  }
+
+  /**
+   * \brief Ask all servers to remove the empty entries of the model, return
+   * the timestamp of this request
+   */
+  int CompactModel() {
+    IterCmd cmd; cmd.set_compact_model();
+    ps::Task task; task.set_cmd(cmd.cmd);
+    return Submit(task, ps::kServerGroup);
+  }
+
   /**
    * \brief Returns the aggregated progress among all woreker/servers since the
    * last time calling this function
@@ -90,6 +125,46 @@ class IterServer : public ps::App {
    */
   virtual void LoadModel(Stream* fi) = 0;
 
+  /**
+   * \brief Save model into the file \a filename. In default it calls \ref
+   * SaveModel with a stream of the file
+   *
+   * \a async asks to return once a snapshot of the model is taken, and write
+   * the snapshot in the background. In default it is ignored
+   */
+  virtual void SaveModelFile(const std::string& filename, bool async) const {
+    Stream* fo = CHECK_NOTNULL(Stream::Create(filename.c_str(), "w"));
+    SaveModel(fo);
+    delete fo;
+  }
+
+  /**
+   * \brief Load model from the file \a filename. In default it calls \ref
+   * LoadModel with a stream of the file
+   */
+  virtual void LoadModelFile(const std::string& filename) {
+    Stream* fi = CHECK_NOTNULL(Stream::Create(filename.c_str(), "r"));
+    LoadModel(fi);
+    delete fi;
+  }
+
+  /**
+   * \brief Save the changes of the model since the model \a parent into the
+   * file \a filename, so loading \a filename loads \a parent first. \a parent
+   * is the model saved or loaded last, or empty if none. \a async is the same
+   * as the one of \ref SaveModelFile
+   */
+  virtual void SaveDeltaFile(const std::string& filename,
+                             const std::string& parent, bool async) {
+    LOG(FATAL) << "this server does not support delta models";
+  }
+
+  /**
+   * \brief Remove the entries which would not be saved from memory. Do nothing
+   * in default
+   */
+  virtual void CompactModel() { }
+
   /**
    * \brief Report the progress to the scheduler
    */
@@ -101,23 +176,28 @@ class IterServer : public ps::App {
   virtual ~IterServer() {}
 
   virtual void ProcessRequest(ps::Message* request) {
+    if (IterCmd(request->task.cmd()).compact_model()) {
+      CompactModel();
+      return;
+    }
     if (request->task.msg().size() == 0) {
 	LOG(INFO) << "message empty !" ;
 	return;
     }
     IterCmd cmd(request->task.cmd());
     auto filename = ModelName(request->task.msg(), cmd.iter());
-    if (cmd.save_model()) {
-      Stream* fo = CHECK_NOTNULL(Stream::Create(filename.c_str(), "w"));
+    if (cmd.save_model() && cmd.delta_model()) {
+      LOG(INFO) << "begin to save the changes since " << last_model_ << " into "
+                << filename;
+      SaveDeltaFile(filename, last_model_, cmd.async_save());
+    } else if (cmd.save_model()) {
       LOG(INFO) << "begin to save model " << filename;
-      SaveModel(fo);
-      delete fo;
+      SaveModelFile(filename, cmd.async_save());
     } else if (cmd.load_model()) {
-      Stream* fi = CHECK_NOTNULL(Stream::Create(filename.c_str(), "r"));
       LOG(INFO) << "begin to load model " << filename;
-      LoadModel(fi);
-      delete fi;
+      LoadModelFile(filename);
     }
+    last_model_ = filename;
   }
 
  private:
@@ -127,6 +207,8 @@ class IterServer : public ps::App {
     return name + "_part-" + std::to_string(ps::NodeInfo::MyRank());
   }
   ps::Slave<double> reporter_;
+  /// the model saved or loaded last, the parent of the next delta
+  std::string last_model_;
 };
 
 /**
@@ -141,13 +223,18 @@ class IterWorker : public DataParWorker {
   void ReportToScheduler(const Progress& prog) { reporter_.Push(prog); }
 
   /**
-   * \brief Returns stream for output prediction
+   * \brief Appends the predictions of a minibatch into the output file
+   *
+   * It is called by the threads computing minibatches, so the file is opened
+   * and written under a lock.
    *
    * \param filename the predict out filename
    * \param wl the received workload
+   * \param pred the predictions
    */
-  Stream* PredictStream(const std::string& filename, const Workload& wl) {
-
+  void WritePredict(const std::string& filename, const Workload& wl,
+                    const std::string& pred) {
+    std::lock_guard<std::mutex> lk(pred_mu_);
     CHECK_EQ(wl.type, Workload::PRED);
     CHECK_GE(wl.file.size(), (size_t)1);
 
@@ -161,8 +248,7 @@ class IterWorker : public DataParWorker {
       pred_out_ = CHECK_NOTNULL(Stream::Create(out.c_str(), "w"));
       prev_out_ = out;
     }
-
-    return pred_out_;
+    pred_out_->Write(pred.data(), pred.size());
   }
 
   // implementation
@@ -172,6 +258,7 @@ class IterWorker : public DataParWorker {
 
  private:
   ps::Slave<double> reporter_;
+  std::mutex pred_mu_;
   Stream* pred_out_ = NULL;
   std::string prev_out_;
 };
@@ -4,6 +4,7 @@
  */
 #include "solver/iter_solver.h"
 #include "base/minibatch_iter.h"
+#include "solver/pipeline.h"
 namespace dmlc {
 namespace solver {
 
@@ -29,6 +30,14 @@ class MinibatchScheduler : public IterScheduler {
   /// iteration
   int save_iter_ = 0;
 
+  /// \brief save the changes of the model since the last saved one for every k
+  /// iterations which do not save the full model. 0 disables it
+  int delta_iter_ = 0;
+
+  /// \brief save the models of the iterations above in the background, the
+  /// final one is always saved before exiting
+  bool async_save_ = false;
+
   /// \brief print the progress for every k seconds. only valid for the online model
   int print_sec_ = 1;
 
@@ -38,6 +47,9 @@ class MinibatchScheduler : public IterScheduler {
   /// \brief if set, then run a prediction task
   std::string predict_out_;
 
+  /// \brief remove the empty entries on the servers after every data pass
+  bool compact_model_ = false;
+
   /**
    * \brief a user-defined stop criteria. stop the system if returns true
    *
@@ -71,10 +83,13 @@ class MinibatchScheduler : public IterScheduler {
     max_data_pass_         = conf.max_data_pass();
     print_sec_             = conf.print_sec();
     save_iter_             = conf.save_iter();
+    delta_iter_            = conf.delta_iter();
+    async_save_            = conf.async_save();
     load_iter_             = conf.load_iter();
     model_in_              = conf.model_in();
     model_out_             = conf.model_out();
     predict_out_           = conf.predict_out();
+    compact_model_         = conf.compact_model();
   }
 
  public:
@@ -119,13 +134,21 @@ class MinibatchScheduler : public IterScheduler {
       if (Iterate(cur_iter, Workload::TRAIN) || Iterate(cur_iter, Workload::VAL)) {
         printf("Hit stop critera\n"); break;
       }
+      if (compact_model_) {
+        printf("Compacting model\n");
+        Wait(CompactModel());
+      }
       if (cur_iter == max_data_pass_ - 1) {
         printf("Hit max number of data passes %d\n", max_data_pass_);
         break;
       }
       if (model_out_.size() && save_iter_ > 0 && (cur_iter+1) % save_iter_ == 0) {
         printf("Saving model for iter = %d\n", cur_iter);
-        Wait(SaveModel(model_out_, cur_iter));
+        Wait(SaveModel(model_out_, cur_iter, async_save_));
+      } else if (model_out_.size() && delta_iter_ > 0 &&
+                 (cur_iter+1) % delta_iter_ == 0) {
+        printf("Saving the changes of the model for iter = %d\n", cur_iter);
+        Wait(SaveDelta(model_out_, cur_iter, async_save_));
       }
     }
 
@@ -243,6 +266,23 @@ class MinibatchWorker : public IterWorker {
    */
   int val_concurrent_mb_ = 10;
 
+  /**
+   * \brief the number of threads parsing the data
+   */
+  int parse_threads_ = 1;
+
+  /**
+   * \brief the number of threads running \ref ProcessMinibatch, which usually
+   * localizes a minibatch and then pulls the weights
+   */
+  int localize_threads_ = 1;
+
+  /**
+   * \brief the number of threads running the jobs passed to \ref Compute, such
+   * as evaluating the loss and computing the gradients
+   */
+  int compute_threads_ = 1;
+
   /**
    * \brief the time spent on real workload such as computing gradients. for
    * profiling usage
@@ -251,30 +291,86 @@ class MinibatchWorker : public IterWorker {
 
   /**
    * \brief Process one minibatch
+   *
+   * It runs by the localize stage, and may be called by several threads at the
+   * same time. The callback of pulling the weights should run by \ref
+   * ComputeExecutor instead of the thread receiving the data.
    */
   virtual void ProcessMinibatch(const Minibatch& mb, const Workload& wl) = 0;
 
+  /**
+   * \brief Runs \a job by the compute stage
+   *
+   * It never blocks, so it can be called by the thread receiving the data.
+   *
+   * @param job the job
+   * @param pull_start the time the pull started, for reporting its latency
+   */
+  void Compute(const PipelineStage::Job& job, double pull_start = 0) {
+    if (pull_start > 0) pull_.Add(GetTime() - pull_start);
+    CHECK(compute_) << "Compute is only valid within Process";
+    compute_->Push(job);
+  }
+
+  /**
+   * \brief Returns the executor passing the callback of a pull to \ref
+   * Compute, so the thread receiving the data never runs the loss. It should
+   * be created right around the pull for reporting the pull latency
+   *
+   * \code
+   *   kv.ZPullAsync(keys).Then([...](ps::KVValues<float> w) {
+   *       ...
+   *     }, ComputeExecutor());
+   * \endcode
+   *
+   * or as the \ref ps::SyncOpts::executor of the pull.
+   */
+  ps::CallbackExecutor ComputeExecutor() {
+    double pull_start = GetTime();
+    return [this, pull_start](const PipelineStage::Job& job) {
+      Compute(job, pull_start);
+    };
+  }
+
+  /**
+   * \brief adds the time spent on real workload, thread-safe
+   */
+  void AddWorkloadTime(double sec) {
+    std::lock_guard<std::mutex> lk(mb_mu_);
+    workload_time_ += sec;
+  }
+
   /**
    * \brief Mark one minibatch is finished
    *
    * one must call this function when the minibatch is actually done, namely the
    * gradients have been pushed to the servers nodes
+   *
+   * @param push_start the time the push started, for reporting its latency
    */
-  void FinishMinibatch() {
+  void FinishMinibatch(double push_start = 0) {
+    if (push_start > 0) push_.Add(GetTime() - push_start);
     // wake the main thread
-    mb_mu_.lock(); -- num_mb_fly_; ++ num_mb_done_; mb_mu_.unlock();
+    mb_mu_.lock();
+    -- num_mb_fly_; ++ num_mb_done_;
+    int done = num_mb_done_, fly = num_mb_fly_;
+    double workload_time = workload_time_;
+    bool report = GetTime() - last_report_ > kReportSec;
+    if (report) last_report_ = GetTime();
+    mb_mu_.unlock();
     mb_cond_.notify_one();
 
     // log info
     double time = (GetTime() - start_);
     std::string overhead;
-    if (workload_time_ > 0) {
+    if (workload_time > 0) {
       overhead = "overhead " + std::to_string(
-          std::max(time - workload_time_, (double)0) / time * 100) + "%, ";
+          std::max(time - workload_time, (double)0) / time * 100) + "%, ";
     }
-    LOG(INFO) << num_mb_done_ << " done, avg time "
-              << time / num_mb_done_ << ", " << overhead
-              << num_mb_fly_ << " on running";
+    LOG(INFO) << done << " done, avg time "
+              << time / done << ", " << overhead
+              << fly << " on running";
+    if (report) LOG(INFO) << PipelineReport();
   }
 
   // implementation
@@ -283,6 +379,16 @@ class MinibatchWorker : public IterWorker {
   virtual ~MinibatchWorker() { }
 
  protected:
+  /**
+   * \brief Processes a workload by a pipeline
+   *
+   * The reader parses the minibatches, the localize stage runs \ref
+   * ProcessMinibatch on them and the compute stage runs the jobs passed to
+   * \ref Compute once the weights are pulled. Each stage has its own threads
+   * and a bounded queue, and at most the maximal concurrency of minibatches
+   * are in flight, so the pulls and pushes of the in-flight ones overlap with
+   * the stages.
+   */
   virtual void Process(const Workload& wl) {
     bool  train   = wl.type == Workload::TRAIN;
     int   mb_size = train ? mb_size_ : val_mb_size_;
@@ -294,26 +400,51 @@ class MinibatchWorker : public IterWorker {
               << ", minibatch = " << mb_size
               << ", concurrency = " <<  max_mb
               << ", shuffle ratio = " << shuffle
-              << ", negative sampling = " << neg_sp;
+              << ", negative sampling = " << neg_sp
+              << ", threads = " << parse_threads_ << "/" << localize_threads_
+              << "/" << compute_threads_;
 
     num_mb_fly_ = num_mb_done_ = 0;
-    start_ = GetTime();
+    start_ = last_report_ = GetTime();
     workload_time_ = 0;
+    read_.Reset(); pull_.Reset(); push_.Reset();
+
+    // a minibatch waits in at most one queue, so the compute stage never
+    // blocks the thread receiving the weights
+    {
+      std::lock_guard<std::mutex> lk(stage_mu_);
+      localize_.reset(new PipelineStage("localize", localize_threads_,
+                                        localize_threads_));
+      compute_.reset(new PipelineStage("compute", compute_threads_, max_mb));
+    }
 
     CHECK_GE(wl.file.size(), (size_t)1);
     auto file = wl.file[0];
     dmlc::data::MinibatchIter<FeaID> reader(
         file.filename.c_str(), file.k, file.n, file.format.c_str(),
-        mb_size, shuffle, neg_sp);
+        mb_size, shuffle, neg_sp, parse_threads_);
     reader.BeforeFirst();
-    while (reader.Next()) {
+    while (true) {
+      double start = GetTime();
+      if (!reader.Next()) break;
+      auto mb = std::make_shared<dmlc::data::RowBlockContainer<FeaID>>();
+      reader.Swap(mb.get());
+      read_.Add(GetTime() - start);
+
       WaitMinibatch(max_mb);
-      ProcessMinibatch(reader.Value(), wl);
       mb_mu_.lock(); ++ num_mb_fly_; mb_mu_.unlock();
+      localize_->Push([this, mb, wl]() { ProcessMinibatch(mb->GetBlock(), wl); });
     }
 
     // wait untill all are done
+    localize_->Wait();
     WaitMinibatch(1);
+    compute_->Wait();
+    LOG(INFO) << PipelineReport();
+    std::unique_ptr<PipelineStage> localize, compute;
+    std::lock_guard<std::mutex> lk(stage_mu_);
+    localize.swap(localize_);
+    compute.swap(compute_);
   }
 
  private:
@@ -323,12 +454,49 @@ class MinibatchWorker : public IterWorker {
     mb_cond_.wait(lk, [this, num] {return num_mb_fly_ < num;});
   }
 
+  /**
+   * \brief returns the utilization of the stages, and the one limiting the
+   * throughput, namely the busiest one. If none of them is busy, then the
+   * minibatches are waiting for the servers
+   */
+  std::string PipelineReport() {
+    std::lock_guard<std::mutex> lk(stage_mu_);
+    std::vector<const StageStats*> stages = {&read_};
+    if (localize_) stages.push_back(&localize_->stats());
+    if (compute_) stages.push_back(&compute_->stats());
+    std::stringstream ss;
+    ss.precision(3);
+    ss << "pipeline: ";
+    const StageStats* busiest = nullptr;
+    double max_util = 0;
+    for (auto s : stages) {
+      ss << s->Print() << "; ";
+      double util = s->Utilization();
+      if (util > max_util) { max_util = util; busiest = s; }
+    }
+    ss << "pull " << pull_.PerJob() * 1000 << " ms, push "
+       << push_.PerJob() * 1000 << " ms; limited by "
+       << (busiest && max_util > kBusyUtil ? busiest->name() : "pull/push");
+    return ss.str();
+  }
+
+  // a stage at least this busy is the bottleneck
+  static constexpr double kBusyUtil = .8;
+  // report the pipeline every k seconds
+  static constexpr double kReportSec = 30;
+
   int num_mb_fly_;
   int num_mb_done_;
   std::mutex mb_mu_;
   std::condition_variable mb_cond_;
-  double start_;
-
+  double start_, last_report_;
+
+  // protects the stages, which are only alive within Process
+  std::mutex stage_mu_;
+  std::unique_ptr<PipelineStage> localize_, compute_;
+  StageStats read_{"read", 1};
+  // the latency of pulling the weights and pushing the gradients
+  StageStats pull_{"pull", 1}, push_{"push", 1};
 };
 
 }  // namespace solver
@@ -0,0 +1,158 @@
+/**
+ * @file   pipeline.h
+ * @brief  The stages of the minibatch pipeline of a worker
+ */
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dmlc/timer.h"
+#include "dmlc/logging.h"
+namespace dmlc {
+namespace solver {
+
+/**
+ * \brief The time a stage of the pipeline spends on its work, which is
+ * reported as the utilization of its threads
+ */
+class StageStats {
+ public:
+  StageStats(const std::string& name, int num_threads)
+      : name_(name), nt_(num_threads) { Reset(); }
+
+  /// \brief adds the time of one job
+  void Add(double sec) {
+    std::lock_guard<std::mutex> lk(mu_);
+    busy_ += sec; ++ jobs_;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lk(mu_);
+    busy_ = 0; jobs_ = 0; start_ = GetTime();
+  }
+
+  /// \brief the share of the time the threads are busy since the last Reset
+  double Utilization() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    double time = (GetTime() - start_) * nt_;
+    return time > 0 ? std::min(busy_ / time, 1.0) : 0;
+  }
+
+  /// \brief the average time of a job in sec
+  double PerJob() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return jobs_ ? busy_ / jobs_ : 0;
+  }
+
+  /// \brief e.g. "localize 45% of 2 threads, 12.3 ms/job"
+  std::string Print() const {
+    std::stringstream ss;
+    ss.precision(3);
+    ss << name_ << " " << (int)(Utilization() * 100) << "% of " << nt_
+       << " thread" << (nt_ > 1 ? "s, " : ", ") << PerJob() * 1000 << " ms/job";
+    return ss.str();
+  }
+
+  const std::string& name() const { return name_; }
+
+ private:
+  std::string name_;
+  int nt_;
+  mutable std::mutex mu_;
+  double busy_, start_;
+  size_t jobs_;
+};
+
+/**
+ * \brief A stage of the pipeline, which runs jobs by its own threads
+ *
+ * Jobs are queued in a bounded queue, \ref Push blocks while it is full, so a
+ * slow stage pushes back on the ones before it instead of buffering
+ * minibatches without limit.
+ */
+class PipelineStage {
+ public:
+  typedef std::function<void()> Job;
+
+  /**
+   * @param name the name in the reports
+   * @param num_threads the number of threads running the jobs
+   * @param capacity the maximal number of queued jobs
+   */
+  PipelineStage(const std::string& name, int num_threads, int capacity)
+      : stats_(name, std::max(num_threads, 1)),
+        capacity_(std::max(capacity, 1)) {
+    for (int i = 0; i < std::max(num_threads, 1); ++i) {
+      threads_.emplace_back([this]() { Loop(); });
+    }
+  }
+
+  ~PipelineStage() {
+    Wait();
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      done_ = true;
+    }
+    job_cond_.notify_all();
+    for (auto& t : threads_) t.join();
+  }
+
+  /// \brief queues a job, blocks while the queue is full
+  void Push(const Job& job) {
+    std::unique_lock<std::mutex> lk(mu_);
+    full_cond_.wait(lk, [this]() { return jobs_.size() < capacity_; });
+    jobs_.push_back(job);
+    ++ pending_;
+    job_cond_.notify_one();
+  }
+
+  /// \brief waits until all queued jobs are done
+  void Wait() {
+    std::unique_lock<std::mutex> lk(mu_);
+    full_cond_.wait(lk, [this]() { return pending_ == 0; });
+  }
+
+  StageStats& stats() { return stats_; }
+
+ private:
+  void Loop() {
+    while (true) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lk(mu_);
+        job_cond_.wait(lk, [this]() { return done_ || !jobs_.empty(); });
+        if (jobs_.empty()) return;
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      full_cond_.notify_all();
+      double start = GetTime();
+      job();
+      stats_.Add(GetTime() - start);
+      {
+        std::lock_guard<std::mutex> lk(mu_);
+        -- pending_;
+      }
+      full_cond_.notify_all();
+    }
+  }
+
+  StageStats stats_;
+  size_t capacity_;
+  std::mutex mu_;
+  std::condition_variable job_cond_, full_cond_;
+  std::deque<Job> jobs_;
+  // the jobs queued or running
+  size_t pending_ = 0;
+  bool done_ = false;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace solver
+}  // namespace dmlc